@@ -1,42 +0,0 @@
-// This asset was automatically generated by objToC.
-
-#ifndef ASSET_CUBE_H
-#define ASSET_CUBE_H
-
-typedef struct {
-	size_t v_count;
-	size_t f_count;
-	V3f v[8];
-	V3u f[12];
-} AssetCube;
-
-static const AssetCube asset_cube = {
-	.v_count = 8,
-	.f_count = 12,
-	.v = {
-		{{ 1.000000, -1.000000, -1.000000 }},
-		{{ 1.000000, -1.000000, 1.000000 }},
-		{{ -1.000000, -1.000000, 1.000000 }},
-		{{ -1.000000, -1.000000, -1.000000 }},
-		{{ 1.000000, 1.000000, -0.999999 }},
-		{{ 0.999999, 1.000000, 1.000001 }},
-		{{ -1.000000, 1.000000, 1.000000 }},
-		{{ -1.000000, 1.000000, -1.000000 }}
-	},
-	.f = {
-		{{ 2, 3, 4 }},
-		{{ 8, 7, 6 }},
-		{{ 5, 6, 2 }},
-		{{ 6, 7, 3 }},
-		{{ 3, 7, 8 }},
-		{{ 1, 4, 8 }},
-		{{ 1, 2, 4 }},
-		{{ 5, 8, 6 }},
-		{{ 1, 5, 2 }},
-		{{ 2, 6, 3 }},
-		{{ 4, 3, 8 }},
-		{{ 5, 1, 8 }}
-	}
-};
-
-#endif /* ASSET_CUBE_H */
@@ -1,9986 +0,0 @@
-// This asset was automatically generated by objToC.
-
-#ifndef ASSET_TEAPOT_H
-#define ASSET_TEAPOT_H
-
-typedef struct {
-	size_t v_count;
-	size_t f_count;
-	V3f v[3644];
-	V3u f[6320];
-} AssetTeapot;
-
-static const AssetTeapot asset_teapot = {
-	.v_count = 3644,
-	.f_count = 6320,
-	.v = {
-		{{ -3.000000, 1.800000, 0.000000 }},
-		{{ -2.991600, 1.800000, -0.081000 }},
-		{{ -2.991600, 1.800000, 0.081000 }},
-		{{ -2.989450, 1.666162, 0.000000 }},
-		{{ -2.985000, 1.921950, 0.000000 }},
-		{{ -2.985000, 1.921950, 0.000000 }},
-		{{ -2.981175, 1.667844, -0.081000 }},
-		{{ -2.981175, 1.667844, 0.081000 }},
-		{{ -2.976687, 1.920243, -0.081000 }},
-		{{ -2.976687, 1.920243, 0.081000 }},
-		{{ -2.968800, 1.800000, -0.144000 }},
-		{{ -2.968800, 1.800000, 0.144000 }},
-		{{ -2.958713, 1.672406, -0.144000 }},
-		{{ -2.958713, 1.672406, 0.144000 }},
-		{{ -2.957600, 1.534800, 0.000000 }},
-		{{ -2.957600, 1.534800, 0.000000 }},
-		{{ -2.954122, 1.915609, -0.144000 }},
-		{{ -2.954122, 1.915609, 0.144000 }},
-		{{ -2.949693, 1.537790, -0.081000 }},
-		{{ -2.949693, 1.537790, 0.081000 }},
-		{{ -2.940000, 2.019600, 0.000000 }},
-		{{ -2.935200, 1.800000, -0.189000 }},
-		{{ -2.935200, 1.800000, 0.189000 }},
-		{{ -2.931958, 2.016526, 0.081000 }},
-		{{ -2.931958, 2.016526, -0.081000 }},
-		{{ -2.928230, 1.545907, -0.144000 }},
-		{{ -2.928230, 1.545907, 0.144000 }},
-		{{ -2.925611, 1.679131, -0.189000 }},
-		{{ -2.925611, 1.679131, 0.189000 }},
-		{{ -2.920870, 1.908779, -0.189000 }},
-		{{ -2.920870, 1.908779, 0.189000 }},
-		{{ -2.910131, 2.008181, -0.144000 }},
-		{{ -2.910131, 2.008181, 0.144000 }},
-		{{ -2.904150, 1.406137, 0.000000 }},
-		{{ -2.904150, 1.406137, 0.000000 }},
-		{{ -2.896846, 1.410135, 0.081000 }},
-		{{ -2.896846, 1.410135, -0.081000 }},
-		{{ -2.896602, 1.557869, -0.189000 }},
-		{{ -2.896602, 1.557869, 0.189000 }},
-		{{ -2.894400, 1.800000, -0.216000 }},
-		{{ -2.894400, 1.800000, 0.216000 }},
-		{{ -2.885416, 1.687296, -0.216000 }},
-		{{ -2.885416, 1.687296, 0.216000 }},
-		{{ -2.880491, 1.900487, -0.216000 }},
-		{{ -2.880491, 1.900487, 0.216000 }},
-		{{ -2.877965, 1.995883, -0.189000 }},
-		{{ -2.877965, 1.995883, 0.189000 }},
-		{{ -2.877022, 1.420985, -0.144000 }},
-		{{ -2.877022, 1.420985, 0.144000 }},
-		{{ -2.865000, 2.095650, 0.000000 }},
-		{{ -2.858195, 1.572394, 0.216000 }},
-		{{ -2.858195, 1.572394, -0.216000 }},
-		{{ -2.857432, 2.091511, -0.081000 }},
-		{{ -2.857432, 2.091511, 0.081000 }},
-		{{ -2.850000, 1.800000, -0.225000 }},
-		{{ -2.850000, 1.800000, 0.225000 }},
-		{{ -2.847806, 1.436974, 0.189000 }},
-		{{ -2.847806, 1.436974, -0.189000 }},
-		{{ -2.841675, 1.696181, 0.225000 }},
-		{{ -2.841675, 1.696181, -0.225000 }},
-		{{ -2.838906, 1.980950, -0.216000 }},
-		{{ -2.838906, 1.980950, 0.216000 }},
-		{{ -2.836889, 2.080276, -0.144000 }},
-		{{ -2.836889, 2.080276, 0.144000 }},
-		{{ -2.836550, 1.891463, -0.225000 }},
-		{{ -2.836550, 1.891463, 0.225000 }},
-		{{ -2.828800, 1.280400, 0.000000 }},
-		{{ -2.822326, 1.285171, -0.081000 }},
-		{{ -2.822326, 1.285171, 0.081000 }},
-		{{ -2.816400, 1.588200, -0.225000 }},
-		{{ -2.816400, 1.588200, 0.225000 }},
-		{{ -2.812331, 1.456390, 0.216000 }},
-		{{ -2.812331, 1.456390, -0.216000 }},
-		{{ -2.806615, 2.063720, -0.189000 }},
-		{{ -2.806615, 2.063720, 0.189000 }},
-		{{ -2.805600, 1.800000, -0.216000 }},
-		{{ -2.805600, 1.800000, 0.216000 }},
-		{{ -2.804755, 1.298122, -0.144000 }},
-		{{ -2.804755, 1.298122, 0.144000 }},
-		{{ -2.797934, 1.705067, -0.216000 }},
-		{{ -2.797934, 1.705067, 0.216000 }},
-		{{ -2.796400, 1.964700, 0.225000 }},
-		{{ -2.796400, 1.964700, -0.225000 }},
-		{{ -2.792609, 1.882438, -0.216000 }},
-		{{ -2.792609, 1.882438, 0.216000 }},
-		{{ -2.778861, 1.317206, -0.189000 }},
-		{{ -2.778861, 1.317206, 0.189000 }},
-		{{ -2.774605, 1.604006, 0.216000 }},
-		{{ -2.774605, 1.604006, -0.216000 }},
-		{{ -2.773725, 1.477519, 0.225000 }},
-		{{ -2.773725, 1.477519, -0.225000 }},
-		{{ -2.769854, 2.043616, -0.216000 }},
-		{{ -2.769854, 2.043616, 0.216000 }},
-		{{ -2.764800, 1.800000, -0.189000 }},
-		{{ -2.764800, 1.800000, 0.189000 }},
-		{{ -2.760000, 2.152800, 0.000000 }},
-		{{ -2.760000, 2.152800, 0.000000 }},
-		{{ -2.757739, 1.713232, -0.189000 }},
-		{{ -2.757739, 1.713232, 0.189000 }},
-		{{ -2.753894, 1.948450, -0.216000 }},
-		{{ -2.753894, 1.948450, 0.216000 }},
-		{{ -2.753123, 2.147861, -0.081000 }},
-		{{ -2.753123, 2.147861, 0.081000 }},
-		{{ -2.752230, 1.874146, -0.189000 }},
-		{{ -2.752230, 1.874146, 0.189000 }},
-		{{ -2.747418, 1.340381, -0.216000 }},
-		{{ -2.747418, 1.340381, 0.216000 }},
-		{{ -2.736198, 1.618531, -0.189000 }},
-		{{ -2.736198, 1.618531, 0.189000 }},
-		{{ -2.735119, 1.498648, 0.216000 }},
-		{{ -2.735119, 1.498648, -0.216000 }},
-		{{ -2.734458, 2.134454, -0.144000 }},
-		{{ -2.734458, 2.134454, 0.144000 }},
-		{{ -2.731250, 1.157813, 0.000000 }},
-		{{ -2.731250, 1.157813, 0.000000 }},
-		{{ -2.731200, 1.800000, -0.144000 }},
-		{{ -2.731200, 1.800000, 0.144000 }},
-		{{ -2.729850, 2.021737, -0.225000 }},
-		{{ -2.729850, 2.021737, 0.225000 }},
-		{{ -2.725825, 1.163194, 0.081000 }},
-		{{ -2.725825, 1.163194, -0.081000 }},
-		{{ -2.724637, 1.719956, -0.144000 }},
-		{{ -2.724637, 1.719956, 0.144000 }},
-		{{ -2.718978, 1.867316, -0.144000 }},
-		{{ -2.718978, 1.867316, 0.144000 }},
-		{{ -2.714835, 1.933517, -0.189000 }},
-		{{ -2.714835, 1.933517, 0.189000 }},
-		{{ -2.713200, 1.365600, -0.225000 }},
-		{{ -2.713200, 1.365600, 0.225000 }},
-		{{ -2.711100, 1.177800, -0.144000 }},
-		{{ -2.711100, 1.177800, 0.144000 }},
-		{{ -2.708400, 1.800000, -0.081000 }},
-		{{ -2.708400, 1.800000, 0.081000 }},
-		{{ -2.706950, 2.114698, -0.189000 }},
-		{{ -2.706950, 2.114698, 0.189000 }},
-		{{ -2.704570, 1.630493, -0.144000 }},
-		{{ -2.704570, 1.630493, 0.144000 }},
-		{{ -2.702175, 1.724519, -0.081000 }},
-		{{ -2.702175, 1.724519, 0.081000 }},
-		{{ -2.700000, 1.800000, 0.000000 }},
-		{{ -2.699644, 1.518063, 0.189000 }},
-		{{ -2.699644, 1.518063, -0.189000 }},
-		{{ -2.696413, 1.862682, -0.081000 }},
-		{{ -2.696413, 1.862682, 0.081000 }},
-		{{ -2.693900, 1.726200, 0.000000 }},
-		{{ -2.689846, 1.999859, -0.216000 }},
-		{{ -2.689846, 1.999859, 0.216000 }},
-		{{ -2.689400, 1.199325, -0.189000 }},
-		{{ -2.689400, 1.199325, 0.189000 }},
-		{{ -2.688100, 1.860975, 0.000000 }},
-		{{ -2.688100, 1.860975, 0.000000 }},
-		{{ -2.683107, 1.638610, -0.081000 }},
-		{{ -2.683107, 1.638610, 0.081000 }},
-		{{ -2.682669, 1.921219, -0.144000 }},
-		{{ -2.682669, 1.921219, 0.144000 }},
-		{{ -2.678982, 1.390819, -0.216000 }},
-		{{ -2.678982, 1.390819, 0.216000 }},
-		{{ -2.675200, 1.641600, 0.000000 }},
-		{{ -2.675200, 1.641600, 0.000000 }},
-		{{ -2.673549, 2.090707, -0.216000 }},
-		{{ -2.673549, 2.090707, 0.216000 }},
-		{{ -2.670428, 1.534053, -0.144000 }},
-		{{ -2.670428, 1.534053, 0.144000 }},
-		{{ -2.663050, 1.225463, -0.216000 }},
-		{{ -2.663050, 1.225463, 0.216000 }},
-		{{ -2.660842, 1.912874, 0.081000 }},
-		{{ -2.660842, 1.912874, -0.081000 }},
-		{{ -2.653085, 1.979755, -0.189000 }},
-		{{ -2.653085, 1.979755, 0.189000 }},
-		{{ -2.652800, 1.909800, 0.000000 }},
-		{{ -2.652800, 1.909800, 0.000000 }},
-		{{ -2.650604, 1.544903, 0.081000 }},
-		{{ -2.650604, 1.544903, -0.081000 }},
-		{{ -2.647539, 1.413994, -0.189000 }},
-		{{ -2.647539, 1.413994, 0.189000 }},
-		{{ -2.643300, 1.548900, 0.000000 }},
-		{{ -2.637200, 2.064600, -0.225000 }},
-		{{ -2.637200, 2.064600, 0.225000 }},
-		{{ -2.634375, 1.253906, 0.225000 }},
-		{{ -2.634375, 1.253906, -0.225000 }},
-		{{ -2.625000, 2.193750, 0.000000 }},
-		{{ -2.622811, 1.963199, -0.144000 }},
-		{{ -2.622811, 1.963199, 0.144000 }},
-		{{ -2.621645, 1.433078, -0.144000 }},
-		{{ -2.621645, 1.433078, 0.144000 }},
-		{{ -2.619050, 2.188238, -0.081000 }},
-		{{ -2.619050, 2.188238, 0.081000 }},
-		{{ -2.611200, 1.038600, 0.000000 }},
-		{{ -2.611200, 1.038600, 0.000000 }},
-		{{ -2.607034, 1.044497, 0.081000 }},
-		{{ -2.607034, 1.044497, -0.081000 }},
-		{{ -2.605700, 1.282350, -0.216000 }},
-		{{ -2.605700, 1.282350, 0.216000 }},
-		{{ -2.604074, 1.446029, -0.081000 }},
-		{{ -2.604074, 1.446029, 0.081000 }},
-		{{ -2.602900, 2.173275, -0.144000 }},
-		{{ -2.602900, 2.173275, 0.144000 }},
-		{{ -2.602268, 1.951964, -0.081000 }},
-		{{ -2.602268, 1.951964, 0.081000 }},
-		{{ -2.600851, 2.038493, -0.216000 }},
-		{{ -2.600851, 2.038493, 0.216000 }},
-		{{ -2.597600, 1.450800, 0.000000 }},
-		{{ -2.595725, 1.060502, -0.144000 }},
-		{{ -2.595725, 1.060502, 0.144000 }},
-		{{ -2.594700, 1.947825, 0.000000 }},
-		{{ -2.579350, 1.308488, -0.189000 }},
-		{{ -2.579350, 1.308488, 0.189000 }},
-		{{ -2.579100, 2.151225, -0.189000 }},
-		{{ -2.579100, 2.151225, 0.189000 }},
-		{{ -2.579059, 1.084090, -0.189000 }},
-		{{ -2.579059, 1.084090, 0.189000 }},
-		{{ -2.567450, 2.014502, -0.189000 }},
-		{{ -2.567450, 2.014502, 0.189000 }},
-		{{ -2.558822, 1.112731, 0.216000 }},
-		{{ -2.558822, 1.112731, -0.216000 }},
-		{{ -2.557650, 1.330013, -0.144000 }},
-		{{ -2.557650, 1.330013, 0.144000 }},
-		{{ -2.550200, 2.124450, -0.216000 }},
-		{{ -2.550200, 2.124450, 0.216000 }},
-		{{ -2.542925, 1.344619, 0.081000 }},
-		{{ -2.542925, 1.344619, -0.081000 }},
-		{{ -2.539942, 1.994746, -0.144000 }},
-		{{ -2.539942, 1.994746, 0.144000 }},
-		{{ -2.537500, 1.350000, 0.000000 }},
-		{{ -2.537500, 1.350000, 0.000000 }},
-		{{ -2.536800, 1.143900, 0.225000 }},
-		{{ -2.536800, 1.143900, -0.225000 }},
-		{{ -2.521277, 1.981339, -0.081000 }},
-		{{ -2.521277, 1.981339, 0.081000 }},
-		{{ -2.518750, 2.095312, -0.225000 }},
-		{{ -2.518750, 2.095312, 0.225000 }},
-		{{ -2.514778, 1.175069, 0.216000 }},
-		{{ -2.514778, 1.175069, -0.216000 }},
-		{{ -2.514400, 1.976400, 0.000000 }},
-		{{ -2.514400, 1.976400, 0.000000 }},
-		{{ -2.494541, 1.203710, -0.189000 }},
-		{{ -2.494541, 1.203710, 0.189000 }},
-		{{ -2.487300, 2.066175, -0.216000 }},
-		{{ -2.487300, 2.066175, 0.216000 }},
-		{{ -2.477875, 1.227298, -0.144000 }},
-		{{ -2.477875, 1.227298, 0.144000 }},
-		{{ -2.468350, 0.922987, 0.000000 }},
-		{{ -2.466566, 1.243303, 0.081000 }},
-		{{ -2.466566, 1.243303, -0.081000 }},
-		{{ -2.465644, 0.929375, -0.081000 }},
-		{{ -2.465644, 0.929375, 0.081000 }},
-		{{ -2.462400, 1.249200, 0.000000 }},
-		{{ -2.462400, 1.249200, 0.000000 }},
-		{{ -2.460000, 2.221200, 0.000000 }},
-		{{ -2.460000, 2.221200, 0.000000 }},
-		{{ -2.458400, 2.039400, -0.189000 }},
-		{{ -2.458400, 2.039400, 0.189000 }},
-		{{ -2.458298, 0.946711, -0.144000 }},
-		{{ -2.458298, 0.946711, 0.144000 }},
-		{{ -2.455229, 2.215303, -0.081000 }},
-		{{ -2.455229, 2.215303, 0.081000 }},
-		{{ -2.447474, 0.972260, 0.189000 }},
-		{{ -2.447474, 0.972260, -0.189000 }},
-		{{ -2.442278, 2.199298, -0.144000 }},
-		{{ -2.442278, 2.199298, 0.144000 }},
-		{{ -2.434600, 2.017350, -0.144000 }},
-		{{ -2.434600, 2.017350, 0.144000 }},
-		{{ -2.434329, 1.003283, -0.216000 }},
-		{{ -2.434329, 1.003283, 0.216000 }},
-		{{ -2.423194, 2.175710, -0.189000 }},
-		{{ -2.423194, 2.175710, 0.189000 }},
-		{{ -2.420025, 1.037044, -0.225000 }},
-		{{ -2.420025, 1.037044, 0.225000 }},
-		{{ -2.418450, 2.002387, -0.081000 }},
-		{{ -2.418450, 2.002388, 0.081000 }},
-		{{ -2.412500, 1.996875, 0.000000 }},
-		{{ -2.412500, 1.996875, 0.000000 }},
-		{{ -2.405721, 1.070804, -0.216000 }},
-		{{ -2.405721, 1.070804, 0.216000 }},
-		{{ -2.400019, 2.147069, -0.216000 }},
-		{{ -2.400019, 2.147069, 0.216000 }},
-		{{ -2.392576, 1.101828, -0.189000 }},
-		{{ -2.392576, 1.101828, 0.189000 }},
-		{{ -2.381752, 1.127376, -0.144000 }},
-		{{ -2.381752, 1.127376, 0.144000 }},
-		{{ -2.374800, 2.115900, -0.225000 }},
-		{{ -2.374800, 2.115900, 0.225000 }},
-		{{ -2.374406, 1.144713, 0.081000 }},
-		{{ -2.374406, 1.144713, -0.081000 }},
-		{{ -2.371700, 1.151100, 0.000000 }},
-		{{ -2.349581, 2.084731, -0.216000 }},
-		{{ -2.349581, 2.084731, 0.216000 }},
-		{{ -2.326406, 2.056090, -0.189000 }},
-		{{ -2.326406, 2.056090, 0.189000 }},
-		{{ -2.307322, 2.032502, -0.144000 }},
-		{{ -2.307322, 2.032502, 0.144000 }},
-		{{ -2.302400, 0.811200, 0.000000 }},
-		{{ -2.302400, 0.811200, 0.000000 }},
-		{{ -2.301347, 0.818122, 0.081000 }},
-		{{ -2.301347, 0.818122, -0.081000 }},
-		{{ -2.298490, 0.836909, 0.144000 }},
-		{{ -2.298490, 0.836909, -0.144000 }},
-		{{ -2.294371, 2.016497, -0.081000 }},
-		{{ -2.294371, 2.016497, 0.081000 }},
-		{{ -2.294278, 0.864595, 0.189000 }},
-		{{ -2.294278, 0.864595, -0.189000 }},
-		{{ -2.289600, 2.010600, 0.000000 }},
-		{{ -2.289600, 2.010600, 0.000000 }},
-		{{ -2.289165, 0.898214, 0.216000 }},
-		{{ -2.289165, 0.898214, -0.216000 }},
-		{{ -2.283600, 0.934800, 0.225000 }},
-		{{ -2.283600, 0.934800, -0.225000 }},
-		{{ -2.278035, 0.971386, 0.216000 }},
-		{{ -2.278035, 0.971386, -0.216000 }},
-		{{ -2.272922, 1.005005, 0.189000 }},
-		{{ -2.272922, 1.005005, -0.189000 }},
-		{{ -2.268710, 1.032691, -0.144000 }},
-		{{ -2.268710, 1.032691, 0.144000 }},
-		{{ -2.265853, 1.051478, 0.081000 }},
-		{{ -2.265853, 1.051478, -0.081000 }},
-		{{ -2.265000, 2.237850, 0.000000 }},
-		{{ -2.264800, 1.058400, 0.000000 }},
-		{{ -2.264800, 1.058400, 0.000000 }},
-		{{ -2.261676, 2.231720, -0.081000 }},
-		{{ -2.261676, 2.231720, 0.081000 }},
-		{{ -2.252655, 2.215082, -0.144000 }},
-		{{ -2.252655, 2.215082, 0.144000 }},
-		{{ -2.239361, 2.190562, -0.189000 }},
-		{{ -2.239361, 2.190562, 0.189000 }},
-		{{ -2.223218, 2.160788, -0.216000 }},
-		{{ -2.223218, 2.160788, 0.216000 }},
-		{{ -2.205650, 2.128387, 0.225000 }},
-		{{ -2.205650, 2.128388, -0.225000 }},
-		{{ -2.188082, 2.095987, -0.216000 }},
-		{{ -2.188082, 2.095987, 0.216000 }},
-		{{ -2.171939, 2.066213, -0.189000 }},
-		{{ -2.171939, 2.066213, 0.189000 }},
-		{{ -2.158645, 2.041693, -0.144000 }},
-		{{ -2.158645, 2.041693, 0.144000 }},
-		{{ -2.149624, 2.025055, -0.081000 }},
-		{{ -2.149624, 2.025055, 0.081000 }},
-		{{ -2.146300, 2.018925, 0.000000 }},
-		{{ -2.141100, 0.973800, 0.000000 }},
-		{{ -2.141100, 0.973800, 0.000000 }},
-		{{ -2.140315, 0.966231, 0.081000 }},
-		{{ -2.140315, 0.966231, -0.081000 }},
-		{{ -2.138183, 0.945685, 0.144000 }},
-		{{ -2.138183, 0.945685, -0.144000 }},
-		{{ -2.135041, 0.915407, 0.189000 }},
-		{{ -2.135041, 0.915407, -0.189000 }},
-		{{ -2.131226, 0.878641, 0.216000 }},
-		{{ -2.131226, 0.878641, -0.216000 }},
-		{{ -2.127075, 0.838631, 0.225000 }},
-		{{ -2.127075, 0.838631, -0.225000 }},
-		{{ -2.122924, 0.798621, 0.216000 }},
-		{{ -2.122924, 0.798621, -0.216000 }},
-		{{ -2.119109, 0.761855, 0.189000 }},
-		{{ -2.119109, 0.761855, -0.189000 }},
-		{{ -2.115967, 0.731578, 0.144000 }},
-		{{ -2.115967, 0.731578, -0.144000 }},
-		{{ -2.113835, 0.711032, 0.081000 }},
-		{{ -2.113835, 0.711032, -0.081000 }},
-		{{ -2.113050, 0.703463, 0.000000 }},
-		{{ -2.113050, 0.703463, 0.000000 }},
-		{{ -2.040000, 2.246400, 0.000000 }},
-		{{ -2.040000, 2.246400, 0.000000 }},
-		{{ -2.038410, 2.240150, -0.081000 }},
-		{{ -2.038410, 2.240150, 0.081000 }},
-		{{ -2.034093, 2.223187, -0.144000 }},
-		{{ -2.034093, 2.223187, 0.144000 }},
-		{{ -2.027731, 2.198189, -0.189000 }},
-		{{ -2.027731, 2.198189, 0.189000 }},
-		{{ -2.020006, 2.167834, 0.216000 }},
-		{{ -2.020006, 2.167834, -0.216000 }},
-		{{ -2.011600, 2.134800, 0.225000 }},
-		{{ -2.011600, 2.134800, -0.225000 }},
-		{{ -2.003194, 2.101766, 0.216000 }},
-		{{ -2.003194, 2.101766, -0.216000 }},
-		{{ -2.000000, 0.900000, 0.000000 }},
-		{{ -2.000000, 0.900000, 0.000000 }},
-		{{ -2.000000, 0.900000, 0.000000 }},
-		{{ -1.997200, 0.891600, 0.081000 }},
-		{{ -1.997200, 0.891600, -0.081000 }},
-		{{ -1.995469, 2.071411, -0.189000 }},
-		{{ -1.995469, 2.071411, 0.189000 }},
-		{{ -1.992750, 1.037175, -0.000000 }},
-		{{ -1.992750, 1.037175, 0.000000 }},
-		{{ -1.989600, 0.868800, 0.144000 }},
-		{{ -1.989600, 0.868800, -0.144000 }},
-		{{ -1.989107, 2.046413, 0.144000 }},
-		{{ -1.989107, 2.046413, -0.144000 }},
-		{{ -1.986000, 0.771675, 0.000000 }},
-		{{ -1.986000, 0.771675, 0.000000 }},
-		{{ -1.984790, 2.029450, -0.081000 }},
-		{{ -1.984790, 2.029450, 0.081000 }},
-		{{ -1.983200, 2.023200, 0.000000 }},
-		{{ -1.983200, 2.023200, 0.000000 }},
-		{{ -1.978400, 0.835200, 0.189000 }},
-		{{ -1.978400, 0.835200, -0.189000 }},
-		{{ -1.974240, 0.900000, -0.328160 }},
-		{{ -1.974240, 0.900000, -0.328160 }},
-		{{ -1.974240, 0.900000, 0.328160 }},
-		{{ -1.972000, 1.178400, -0.000000 }},
-		{{ -1.972000, 1.178400, 0.000000 }},
-		{{ -1.967083, 1.037175, -0.326970 }},
-		{{ -1.967083, 1.037175, 0.326970 }},
-		{{ -1.964800, 0.794400, 0.216000 }},
-		{{ -1.964800, 0.794400, -0.216000 }},
-		{{ -1.960420, 0.771675, -0.325863 }},
-		{{ -1.960420, 0.771675, 0.325863 }},
-		{{ -1.950000, 0.750000, -0.225000 }},
-		{{ -1.950000, 0.750000, 0.225000 }},
-		{{ -1.948000, 0.656400, 0.000000 }},
-		{{ -1.948000, 0.656400, 0.000000 }},
-		{{ -1.946601, 1.178400, -0.323566 }},
-		{{ -1.946601, 1.178400, 0.323566 }},
-		{{ -1.939250, 1.323225, 0.000000 }},
-		{{ -1.939250, 1.323225, 0.000000 }},
-		{{ -1.935200, 0.705600, 0.216000 }},
-		{{ -1.935200, 0.705600, -0.216000 }},
-		{{ -1.922910, 0.656400, -0.319628 }},
-		{{ -1.922910, 0.656400, 0.319628 }},
-		{{ -1.921600, 0.664800, 0.189000 }},
-		{{ -1.921600, 0.664800, -0.189000 }},
-		{{ -1.914272, 1.323225, -0.318192 }},
-		{{ -1.914272, 1.323225, 0.318192 }},
-		{{ -1.910400, 0.631200, 0.144000 }},
-		{{ -1.910400, 0.631200, -0.144000 }},
-		{{ -1.902800, 0.608400, 0.081000 }},
-		{{ -1.902800, 0.608400, -0.081000 }},
-		{{ -1.900000, 0.600000, 0.000000 }},
-		{{ -1.900000, 0.600000, 0.000000 }},
-		{{ -1.899520, 0.900000, -0.638080 }},
-		{{ -1.899520, 0.900000, -0.638080 }},
-		{{ -1.899520, 0.900000, 0.638080 }},
-		{{ -1.899520, 0.900000, 0.638080 }},
-		{{ -1.896000, 1.471200, 0.000000 }},
-		{{ -1.896000, 1.471200, 0.000000 }},
-		{{ -1.892634, 1.037175, -0.635767 }},
-		{{ -1.892634, 1.037175, 0.635767 }},
-		{{ -1.892000, 0.553725, 0.000000 }},
-		{{ -1.892000, 0.553725, 0.000000 }},
-		{{ -1.886223, 0.771675, -0.633613 }},
-		{{ -1.886223, 0.771675, 0.633613 }},
-		{{ -1.872927, 1.178400, -0.629147 }},
-		{{ -1.872927, 1.178400, 0.629147 }},
-		{{ -1.871580, 1.471200, -0.311096 }},
-		{{ -1.871580, 1.471200, 0.311096 }},
-		{{ -1.867631, 0.553725, -0.310439 }},
-		{{ -1.867631, 0.553725, 0.310439 }},
-		{{ -1.850132, 0.656400, -0.621490 }},
-		{{ -1.850132, 0.656400, 0.621490 }},
-		{{ -1.843750, 1.621875, 0.000000 }},
-		{{ -1.843750, 1.621875, 0.000000 }},
-		{{ -1.841822, 1.323225, -0.618698 }},
-		{{ -1.841822, 1.323225, 0.618698 }},
-		{{ -1.824000, 0.463200, -0.000000 }},
-		{{ -1.824000, 0.463200, 0.000000 }},
-		{{ -1.820003, 1.621875, -0.302522 }},
-		{{ -1.820003, 1.621875, 0.302523 }},
-		{{ -1.800900, 2.024775, 0.000000 }},
-		{{ -1.800745, 1.471200, -0.604900 }},
-		{{ -1.800745, 1.471200, 0.604900 }},
-		{{ -1.800507, 0.463200, -0.299282 }},
-		{{ -1.800507, 0.463200, 0.299282 }},
-		{{ -1.800455, 2.031069, -0.081000 }},
-		{{ -1.800455, 2.031069, 0.081000 }},
-		{{ -1.799246, 2.048152, -0.144000 }},
-		{{ -1.799246, 2.048152, 0.144000 }},
-		{{ -1.797466, 2.073326, -0.189000 }},
-		{{ -1.797466, 2.073326, 0.189000 }},
-		{{ -1.796946, 0.553725, -0.603624 }},
-		{{ -1.796946, 0.553725, 0.603624 }},
-		{{ -1.795303, 2.103896, -0.216000 }},
-		{{ -1.795303, 2.103896, 0.216000 }},
-		{{ -1.792950, 2.137163, -0.225000 }},
-		{{ -1.792950, 2.137163, 0.225000 }},
-		{{ -1.790597, 2.170429, -0.216000 }},
-		{{ -1.790597, 2.170429, 0.216000 }},
-		{{ -1.788434, 2.200999, -0.189000 }},
-		{{ -1.788434, 2.200999, 0.189000 }},
-		{{ -1.786654, 2.226173, -0.144000 }},
-		{{ -1.786654, 2.226173, 0.144000 }},
-		{{ -1.785445, 2.243256, -0.081000 }},
-		{{ -1.785445, 2.243256, 0.081000 }},
-		{{ -1.785000, 2.249550, 0.000000 }},
-		{{ -1.784000, 1.774800, -0.000000 }},
-		{{ -1.784000, 1.774800, 0.000000 }},
-		{{ -1.779680, 0.900000, -0.925920 }},
-		{{ -1.779680, 0.900000, -0.925920 }},
-		{{ -1.779680, 0.900000, 0.925920 }},
-		{{ -1.779680, 0.900000, 0.925920 }},
-		{{ -1.773229, 1.037175, -0.922564 }},
-		{{ -1.773229, 1.037175, 0.922564 }},
-		{{ -1.767222, 0.771675, -0.919439 }},
-		{{ -1.767222, 0.771675, 0.919439 }},
-		{{ -1.761022, 1.774800, -0.292719 }},
-		{{ -1.761022, 1.774800, 0.292719 }},
-		{{ -1.754764, 1.178400, -0.912957 }},
-		{{ -1.754764, 1.178400, 0.912957 }},
-		{{ -1.751120, 1.621875, -0.588230 }},
-		{{ -1.751120, 1.621875, 0.588230 }},
-		{{ -1.750000, 0.384375, -0.000000 }},
-		{{ -1.750000, 0.384375, 0.000000 }},
-		{{ -1.733408, 0.656400, -0.901846 }},
-		{{ -1.733408, 0.656400, 0.901846 }},
-		{{ -1.732362, 0.463200, -0.581929 }},
-		{{ -1.732362, 0.463200, 0.581929 }},
-		{{ -1.727460, 0.384375, -0.287140 }},
-		{{ -1.727460, 0.384375, 0.287140 }},
-		{{ -1.725622, 1.323225, -0.897795 }},
-		{{ -1.725622, 1.323225, 0.897795 }},
-		{{ -1.718250, 1.929525, -0.000000 }},
-		{{ -1.718250, 1.929525, 0.000000 }},
-		{{ -1.696119, 1.929525, -0.281930 }},
-		{{ -1.696119, 1.929525, 0.281930 }},
-		{{ -1.694372, 1.774800, -0.569167 }},
-		{{ -1.694372, 1.774800, 0.569167 }},
-		{{ -1.687137, 1.471200, -0.877772 }},
-		{{ -1.687137, 1.471200, 0.877772 }},
-		{{ -1.683577, 0.553725, -0.875920 }},
-		{{ -1.683577, 0.553725, 0.875920 }},
-		{{ -1.676000, 0.316800, 0.000000 }},
-		{{ -1.676000, 0.316800, 0.000000 }},
-		{{ -1.662080, 0.384375, -0.558320 }},
-		{{ -1.662080, 0.384375, 0.558320 }},
-		{{ -1.654413, 0.316800, -0.274998 }},
-		{{ -1.654413, 0.316800, 0.274998 }},
-		{{ -1.648000, 2.085600, 0.000000 }},
-		{{ -1.648000, 2.085600, 0.000000 }},
-		{{ -1.640643, 1.621875, -0.853583 }},
-		{{ -1.640643, 1.621875, 0.853583 }},
-		{{ -1.631925, 1.929525, -0.548190 }},
-		{{ -1.631925, 1.929525, 0.548190 }},
-		{{ -1.626774, 2.085600, -0.270404 }},
-		{{ -1.626774, 2.085600, 0.270404 }},
-		{{ -1.623068, 0.463200, -0.844439 }},
-		{{ -1.623068, 0.463200, 0.844439 }},
-		{{ -1.618560, 0.900000, -1.187840 }},
-		{{ -1.618560, 0.900000, -1.187840 }},
-		{{ -1.618560, 0.900000, 1.187840 }},
-		{{ -1.618560, 0.900000, 1.187840 }},
-		{{ -1.612693, 1.037175, -1.183534 }},
-		{{ -1.612693, 1.037175, 1.183534 }},
-		{{ -1.608000, 0.260025, -0.000000 }},
-		{{ -1.608000, 0.260025, 0.000000 }},
-		{{ -1.607230, 0.771675, -1.179525 }},
-		{{ -1.607230, 0.771675, 1.179525 }},
-		{{ -1.600000, 2.025000, 0.000000 }},
-		{{ -1.597200, 2.031300, -0.081000 }},
-		{{ -1.597200, 2.031300, 0.081000 }},
-		{{ -1.595900, 1.178400, -1.171210 }},
-		{{ -1.595900, 1.178400, 1.171210 }},
-		{{ -1.591798, 0.316800, -0.534711 }},
-		{{ -1.591798, 0.316800, 0.534711 }},
-		{{ -1.589600, 2.048400, -0.144000 }},
-		{{ -1.589600, 2.048400, 0.144000 }},
-		{{ -1.587475, 1.774800, -0.825921 }},
-		{{ -1.587475, 1.774800, 0.825921 }},
-		{{ -1.587289, 0.260025, 0.263841 }},
-		{{ -1.587289, 0.260025, -0.263841 }},
-		{{ -1.578400, 2.073600, -0.189000 }},
-		{{ -1.578400, 2.073600, 0.189000 }},
-		{{ -1.576477, 0.656400, -1.156956 }},
-		{{ -1.576477, 0.656400, 1.156956 }},
-		{{ -1.574750, 2.242575, 0.000000 }},
-		{{ -1.574750, 2.242575, 0.000000 }},
-		{{ -1.569396, 1.323225, -1.151759 }},
-		{{ -1.569396, 1.323225, 1.151759 }},
-		{{ -1.565204, 2.085600, -0.525778 }},
-		{{ -1.565204, 2.085600, 0.525778 }},
-		{{ -1.564800, 2.104200, -0.216000 }},
-		{{ -1.564800, 2.104200, 0.216000 }},
-		{{ -1.557220, 0.384375, -0.810180 }},
-		{{ -1.557220, 0.384375, 0.810180 }},
-		{{ -1.554467, 2.242575, -0.258385 }},
-		{{ -1.554467, 2.242575, 0.258385 }},
-		{{ -1.552000, 0.213600, 0.000000 }},
-		{{ -1.552000, 0.213600, 0.000000 }},
-		{{ -1.550000, 2.137500, -0.225000 }},
-		{{ -1.550000, 2.137500, 0.225000 }},
-		{{ -1.535200, 2.170800, -0.216000 }},
-		{{ -1.535200, 2.170800, 0.216000 }},
-		{{ -1.534395, 1.471200, -1.126072 }},
-		{{ -1.534395, 1.471200, 1.126072 }},
-		{{ -1.532010, 0.213600, 0.254652 }},
-		{{ -1.532010, 0.213600, -0.254652 }},
-		{{ -1.531158, 0.553725, -1.123697 }},
-		{{ -1.531158, 0.553725, 1.123697 }},
-		{{ -1.528968, 1.929525, -0.795481 }},
-		{{ -1.528968, 1.929525, 0.795481 }},
-		{{ -1.527214, 0.260025, -0.513016 }},
-		{{ -1.527214, 0.260025, 0.513016 }},
-		{{ -1.521600, 2.201400, -0.189000 }},
-		{{ -1.521600, 2.201400, 0.189000 }},
-		{{ -1.514000, 0.177075, 0.000000 }},
-		{{ -1.514000, 0.177075, 0.000000 }},
-		{{ -1.510400, 2.226600, -0.144000 }},
-		{{ -1.510400, 2.226600, 0.144000 }},
-		{{ -1.502800, 2.243700, -0.081000 }},
-		{{ -1.502800, 2.243700, 0.081000 }},
-		{{ -1.500000, 2.400000, 0.000000 }},
-		{{ -1.500000, 0.150000, 0.000000 }},
-		{{ -1.500000, 2.250000, 0.000000 }},
-		{{ -1.500000, 2.400000, 0.000000 }},
-		{{ -1.500000, 0.150000, 0.000000 }},
-		{{ -1.496475, 0.127575, -0.000000 }},
-		{{ -1.496475, 0.127575, 0.000000 }},
-		{{ -1.495635, 2.242575, -0.502408 }},
-		{{ -1.495635, 2.242575, 0.502408 }},
-		{{ -1.494500, 0.177075, 0.248417 }},
-		{{ -1.494500, 0.177075, -0.248417 }},
-		{{ -1.492110, 1.621875, -1.095040 }},
-		{{ -1.492110, 1.621875, 1.095040 }},
-		{{ -1.491372, 0.316800, -0.775921 }},
-		{{ -1.491372, 0.316800, 0.775921 }},
-		{{ -1.480800, 0.105600, 0.000000 }},
-		{{ -1.480800, 0.105600, -0.000000 }},
-		{{ -1.480680, 2.400000, -0.246120 }},
-		{{ -1.480680, 0.150000, 0.246120 }},
-		{{ -1.480680, 2.400000, 0.246120 }},
-		{{ -1.480680, 0.150000, -0.246120 }},
-		{{ -1.480680, 0.150000, -0.246120 }},
-		{{ -1.480680, 0.150000, 0.246120 }},
-		{{ -1.480325, 2.435437, 0.000000 }},
-		{{ -1.480325, 2.435437, 0.000000 }},
-		{{ -1.477200, 0.127575, 0.245542 }},
-		{{ -1.477200, 0.127575, -0.245542 }},
-		{{ -1.476127, 0.463200, -1.083310 }},
-		{{ -1.476127, 0.463200, 1.083310 }},
-		{{ -1.474028, 0.213600, 0.495150 }},
-		{{ -1.474028, 0.213600, -0.495150 }},
-		{{ -1.466456, 2.085600, -0.762958 }},
-		{{ -1.466456, 2.085600, 0.762958 }},
-		{{ -1.461727, 0.105600, -0.242970 }},
-		{{ -1.461727, 0.105600, 0.242970 }},
-		{{ -1.461258, 2.435437, -0.242892 }},
-		{{ -1.461258, 2.435437, 0.242892 }},
-		{{ -1.459600, 2.463000, 0.000000 }},
-		{{ -1.459600, 2.463000, 0.000000 }},
-		{{ -1.445325, 0.084525, 0.000000 }},
-		{{ -1.445325, 0.084525, 0.000000 }},
-		{{ -1.443756, 1.774800, -1.059553 }},
-		{{ -1.443756, 1.774800, 1.059553 }},
-		{{ -1.440800, 2.463000, -0.239491 }},
-		{{ -1.440800, 2.463000, 0.239491 }},
-		{{ -1.439025, 2.482687, 0.000000 }},
-		{{ -1.437937, 0.177075, 0.483027 }},
-		{{ -1.437937, 0.177075, -0.483027 }},
-		{{ -1.430863, 0.260025, 0.744440 }},
-		{{ -1.430863, 0.260025, -0.744440 }},
-		{{ -1.426709, 0.084525, -0.237149 }},
-		{{ -1.426709, 0.084525, 0.237149 }},
-		{{ -1.424640, 2.400000, -0.478560 }},
-		{{ -1.424640, 0.150000, -0.478560 }},
-		{{ -1.424640, 0.150000, -0.478560 }},
-		{{ -1.424640, 0.150000, 0.478560 }},
-		{{ -1.424640, 0.150000, 0.478560 }},
-		{{ -1.424640, 2.400000, 0.478560 }},
-		{{ -1.421292, 0.127575, 0.477435 }},
-		{{ -1.421292, 0.127575, -0.477435 }},
-		{{ -1.420490, 2.482687, -0.236115 }},
-		{{ -1.420490, 2.482687, 0.236115 }},
-		{{ -1.420000, 0.900000, -1.420000 }},
-		{{ -1.420000, 0.900000, -1.420000 }},
-		{{ -1.420000, 0.900000, 1.420000 }},
-		{{ -1.420000, 0.900000, 1.420000 }},
-		{{ -1.419800, 2.494500, 0.000000 }},
-		{{ -1.419800, 2.494500, 0.000000 }},
-		{{ -1.416240, 0.384375, -1.039360 }},
-		{{ -1.416240, 0.384375, 1.039360 }},
-		{{ -1.414853, 1.037175, -1.414853 }},
-		{{ -1.414853, 1.037175, 1.414853 }},
-		{{ -1.410060, 0.771675, -1.410060 }},
-		{{ -1.410060, 0.771675, 1.410060 }},
-		{{ -1.406405, 0.105600, -0.472434 }},
-		{{ -1.406405, 0.105600, 0.472434 }},
-		{{ -1.405953, 2.435437, -0.472283 }},
-		{{ -1.405953, 2.435437, 0.472283 }},
-		{{ -1.403125, 2.498438, 0.000000 }},
-		{{ -1.403125, 2.498438, 0.000000 }},
-		{{ -1.401513, 2.494500, -0.232961 }},
-		{{ -1.401513, 2.494500, 0.232961 }},
-		{{ -1.401276, 2.242575, -0.729046 }},
-		{{ -1.401276, 2.242575, 0.729046 }},
-		{{ -1.400120, 1.178400, -1.400120 }},
-		{{ -1.400120, 1.178400, 1.400120 }},
-		{{ -1.400000, 2.400000, 0.000000 }},
-		{{ -1.400000, 2.400000, 0.000000 }},
-		{{ -1.390545, 1.929525, -1.020503 }},
-		{{ -1.390545, 1.929525, 1.020503 }},
-		{{ -1.390200, 2.494500, 0.000000 }},
-		{{ -1.390200, 2.494500, 0.000000 }},
-		{{ -1.386270, 2.463000, -0.465671 }},
-		{{ -1.386270, 2.463000, 0.465671 }},
-		{{ -1.385925, 2.435437, 0.000000 }},
-		{{ -1.385925, 2.435437, 0.000000 }},
-		{{ -1.385053, 2.498438, -0.230225 }},
-		{{ -1.385053, 2.498438, 0.230225 }},
-		{{ -1.383080, 0.656400, -1.383080 }},
-		{{ -1.383080, 0.656400, 1.383080 }},
-		{{ -1.382400, 0.064800, -0.000000 }},
-		{{ -1.382400, 0.064800, 0.000000 }},
-		{{ -1.382225, 2.482687, -0.000000 }},
-		{{ -1.382225, 2.482687, 0.000000 }},
-		{{ -1.381968, 2.400000, -0.229712 }},
-		{{ -1.381968, 2.400000, 0.229712 }},
-		{{ -1.381032, 0.213600, 0.718514 }},
-		{{ -1.381032, 0.213600, -0.718514 }},
-		{{ -1.380400, 2.463000, 0.000000 }},
-		{{ -1.380400, 2.463000, 0.000000 }},
-		{{ -1.376868, 1.323225, -1.376867 }},
-		{{ -1.376867, 1.323225, 1.376868 }},
-		{{ -1.372712, 0.084525, -0.461116 }},
-		{{ -1.372712, 0.084525, 0.461116 }},
-		{{ -1.372294, 2.494500, -0.228104 }},
-		{{ -1.372294, 2.494500, 0.228104 }},
-		{{ -1.368074, 2.435437, -0.227403 }},
-		{{ -1.368074, 2.435437, 0.227403 }},
-		{{ -1.366728, 2.482687, -0.459107 }},
-		{{ -1.366728, 2.482687, 0.459107 }},
-		{{ -1.364595, 0.064800, -0.226824 }},
-		{{ -1.364595, 0.064800, 0.226824 }},
-		{{ -1.364422, 2.482687, -0.226795 }},
-		{{ -1.364422, 2.482687, 0.226795 }},
-		{{ -1.362620, 2.463000, -0.226496 }},
-		{{ -1.362620, 2.463000, 0.226496 }},
-		{{ -1.356353, 0.316800, -0.995410 }},
-		{{ -1.356353, 0.316800, 0.995410 }},
-		{{ -1.348469, 2.494500, -0.452973 }},
-		{{ -1.348469, 2.494500, 0.452973 }},
-		{{ -1.347218, 0.177075, 0.700921 }},
-		{{ -1.347218, 0.177075, -0.700921 }},
-		{{ -1.346160, 1.471200, -1.346160 }},
-		{{ -1.346160, 1.471200, 1.346160 }},
-		{{ -1.343320, 0.553725, -1.343320 }},
-		{{ -1.343320, 0.553725, 1.343320 }},
-		{{ -1.334760, 2.400000, -0.694440 }},
-		{{ -1.334760, 0.150000, -0.694440 }},
-		{{ -1.334760, 0.150000, 0.694440 }},
-		{{ -1.334760, 0.150000, 0.694440 }},
-		{{ -1.334760, 2.400000, 0.694440 }},
-		{{ -1.334760, 0.150000, -0.694440 }},
-		{{ -1.333693, 2.085600, -0.978780 }},
-		{{ -1.333693, 2.085600, 0.978780 }},
-		{{ -1.332632, 2.498438, -0.447653 }},
-		{{ -1.332632, 2.498438, 0.447653 }},
-		{{ -1.331623, 0.127575, 0.692808 }},
-		{{ -1.331623, 0.127575, -0.692808 }},
-		{{ -1.329664, 2.400000, -0.446656 }},
-		{{ -1.329664, 2.400000, 0.446656 }},
-		{{ -1.320356, 2.494500, -0.443529 }},
-		{{ -1.320356, 2.494500, 0.443529 }},
-		{{ -1.317675, 0.105600, -0.685551 }},
-		{{ -1.317675, 0.105600, 0.685551 }},
-		{{ -1.317252, 2.435437, -0.685331 }},
-		{{ -1.317252, 2.435437, 0.685331 }},
-		{{ -1.316296, 2.435437, -0.442166 }},
-		{{ -1.316296, 2.435437, 0.442166 }},
-		{{ -1.312948, 0.064800, 0.441041 }},
-		{{ -1.312948, 0.064800, -0.441041 }},
-		{{ -1.312782, 2.482687, -0.440985 }},
-		{{ -1.312782, 2.482687, 0.440985 }},
-		{{ -1.311049, 2.463000, -0.440403 }},
-		{{ -1.311049, 2.463000, 0.440403 }},
-		{{ -1.309063, 1.621875, -1.309063 }},
-		{{ -1.309063, 1.621875, 1.309063 }},
-		{{ -1.301322, 0.260025, 0.955023 }},
-		{{ -1.301322, 0.260025, -0.955023 }},
-		{{ -1.300000, 2.400000, 0.000000 }},
-		{{ -1.300000, 2.400000, 0.000000 }},
-		{{ -1.298810, 2.463000, -0.675736 }},
-		{{ -1.298810, 2.463000, 0.675736 }},
-		{{ -1.295040, 0.463200, -1.295040 }},
-		{{ -1.295040, 0.463200, 1.295040 }},
-		{{ -1.286108, 0.084525, -0.669128 }},
-		{{ -1.286108, 0.084525, 0.669128 }},
-		{{ -1.284375, 0.046875, 0.000000 }},
-		{{ -1.284375, 0.046875, 0.000000 }},
-		{{ -1.283256, 2.400000, -0.213304 }},
-		{{ -1.283256, 2.400000, 0.213304 }},
-		{{ -1.280502, 2.482687, -0.666211 }},
-		{{ -1.280502, 2.482687, 0.666211 }},
-		{{ -1.274600, 2.440800, 0.000000 }},
-		{{ -1.274600, 2.440800, 0.000000 }},
-		{{ -1.274414, 2.242575, -0.935276 }},
-		{{ -1.274414, 2.242575, 0.935276 }},
-		{{ -1.267832, 0.046875, -0.210740 }},
-		{{ -1.267832, 0.046875, 0.210740 }},
-		{{ -1.266640, 1.774800, -1.266640 }},
-		{{ -1.266640, 1.774800, 1.266640 }},
-		{{ -1.263395, 2.494500, -0.657311 }},
-		{{ -1.263395, 2.494500, 0.657311 }},
-		{{ -1.258183, 2.440800, 0.209136 }},
-		{{ -1.258183, 2.440800, -0.209136 }},
-		{{ -1.256003, 0.213600, 0.921764 }},
-		{{ -1.256003, 0.213600, -0.921764 }},
-		{{ -1.248557, 2.498438, -0.649591 }},
-		{{ -1.248557, 2.498438, 0.649591 }},
-		{{ -1.245776, 2.400000, -0.648144 }},
-		{{ -1.245776, 2.400000, 0.648144 }},
-		{{ -1.242500, 0.384375, -1.242500 }},
-		{{ -1.242500, 0.384375, 1.242500 }},
-		{{ -1.237056, 2.494500, -0.643607 }},
-		{{ -1.237056, 2.494500, 0.643607 }},
-		{{ -1.234688, 2.400000, -0.414752 }},
-		{{ -1.234688, 2.400000, 0.414752 }},
-		{{ -1.233252, 2.435437, -0.641628 }},
-		{{ -1.233252, 2.435437, 0.641628 }},
-		{{ -1.230115, 0.064800, -0.639996 }},
-		{{ -1.230115, 0.064800, 0.639996 }},
-		{{ -1.229959, 2.482687, -0.639915 }},
-		{{ -1.229959, 2.482687, 0.639915 }},
-		{{ -1.228335, 2.463000, -0.639070 }},
-		{{ -1.228335, 2.463000, 0.639070 }},
-		{{ -1.225250, 0.177075, 0.899195 }},
-		{{ -1.225250, 0.177075, -0.899195 }},
-		{{ -1.219958, 1.929525, 1.219958 }},
-		{{ -1.219958, 1.929525, -1.219958 }},
-		{{ -1.219848, 0.046875, -0.409767 }},
-		{{ -1.219848, 0.046875, 0.409767 }},
-		{{ -1.213920, 2.400000, -0.890880 }},
-		{{ -1.213920, 0.150000, -0.890880 }},
-		{{ -1.213920, 0.150000, -0.890880 }},
-		{{ -1.213920, 0.150000, 0.890880 }},
-		{{ -1.213920, 0.150000, 0.890880 }},
-		{{ -1.213920, 2.400000, 0.890880 }},
-		{{ -1.211067, 0.127575, 0.888786 }},
-		{{ -1.211067, 0.127575, -0.888786 }},
-		{{ -1.210564, 2.440800, 0.406648 }},
-		{{ -1.210564, 2.440800, -0.406648 }},
-		{{ -1.204800, 2.474400, 0.000000 }},
-		{{ -1.204800, 2.474400, 0.000000 }},
-		{{ -1.198382, 0.105600, -0.879477 }},
-		{{ -1.198382, 0.105600, 0.879477 }},
-		{{ -1.197997, 2.435437, -0.879195 }},
-		{{ -1.197997, 2.435437, 0.879195 }},
-		{{ -1.189960, 0.316800, -1.189960 }},
-		{{ -1.189960, 0.316800, 1.189960 }},
-		{{ -1.189282, 2.474400, -0.197684 }},
-		{{ -1.189282, 2.474400, 0.197684 }},
-		{{ -1.187840, 0.900000, -1.618560 }},
-		{{ -1.187840, 0.900000, -1.618560 }},
-		{{ -1.187840, 0.900000, 1.618560 }},
-		{{ -1.187840, 0.900000, 1.618560 }},
-		{{ -1.183534, 1.037175, -1.612693 }},
-		{{ -1.183534, 1.037175, 1.612693 }},
-		{{ -1.181225, 2.463000, -0.866886 }},
-		{{ -1.181225, 2.463000, 0.866886 }},
-		{{ -1.179525, 0.771675, -1.607230 }},
-		{{ -1.179525, 0.771675, 1.607230 }},
-		{{ -1.171210, 1.178400, -1.595900 }},
-		{{ -1.171210, 1.178400, 1.595900 }},
-		{{ -1.170080, 2.085600, -1.170080 }},
-		{{ -1.170080, 2.085600, 1.170080 }},
-		{{ -1.169673, 0.084525, -0.858407 }},
-		{{ -1.169673, 0.084525, 0.858407 }},
-		{{ -1.164574, 2.482687, -0.854666 }},
-		{{ -1.164574, 2.482687, 0.854666 }},
-		{{ -1.156956, 0.656400, -1.576477 }},
-		{{ -1.156956, 0.656400, 1.576477 }},
-		{{ -1.156792, 2.400000, -0.601848 }},
-		{{ -1.156792, 2.400000, 0.601848 }},
-		{{ -1.151759, 1.323225, -1.569396 }},
-		{{ -1.151759, 1.323225, 1.569396 }},
-		{{ -1.149016, 2.494500, -0.843248 }},
-		{{ -1.149016, 2.494500, 0.843248 }},
-		{{ -1.144271, 2.474400, -0.384379 }},
-		{{ -1.144271, 2.474400, 0.384379 }},
-		{{ -1.143600, 0.031200, 0.000000 }},
-		{{ -1.143600, 0.031200, 0.000000 }},
-		{{ -1.142888, 0.046875, -0.594614 }},
-		{{ -1.142888, 0.046875, 0.594614 }},
-		{{ -1.141680, 0.260025, 1.141680 }},
-		{{ -1.141680, 0.260025, -1.141680 }},
-		{{ -1.135521, 2.498438, -0.833344 }},
-		{{ -1.135521, 2.498438, 0.833344 }},
-		{{ -1.134190, 2.440800, 0.590089 }},
-		{{ -1.134190, 2.440800, -0.590089 }},
-		{{ -1.132992, 2.400000, -0.831488 }},
-		{{ -1.132992, 2.400000, 0.831488 }},
-		{{ -1.128870, 0.031200, -0.187642 }},
-		{{ -1.128870, 0.031200, 0.187642 }},
-		{{ -1.126072, 1.471200, -1.534395 }},
-		{{ -1.126072, 1.471200, 1.534395 }},
-		{{ -1.125061, 2.494500, -0.825668 }},
-		{{ -1.125061, 2.494500, 0.825668 }},
-		{{ -1.123697, 0.553725, -1.531158 }},
-		{{ -1.123697, 0.553725, 1.531158 }},
-		{{ -1.121601, 2.435437, -0.823129 }},
-		{{ -1.121601, 2.435437, 0.823129 }},
-		{{ -1.118749, 0.064800, -0.821035 }},
-		{{ -1.118749, 0.064800, 0.821035 }},
-		{{ -1.118607, 2.482687, -0.820931 }},
-		{{ -1.118607, 2.482687, 0.820931 }},
-		{{ -1.118073, 2.242575, -1.118073 }},
-		{{ -1.118073, 2.242575, 1.118073 }},
-		{{ -1.117130, 2.463000, -0.819847 }},
-		{{ -1.117130, 2.463000, 0.819847 }},
-		{{ -1.101920, 0.213600, 1.101920 }},
-		{{ -1.101920, 0.213600, -1.101920 }},
-		{{ -1.100200, 2.502600, 0.000000 }},
-		{{ -1.100200, 2.502600, 0.000000 }},
-		{{ -1.095040, 1.621875, -1.492110 }},
-		{{ -1.095040, 1.621875, 1.492110 }},
-		{{ -1.086146, 0.031200, 0.364854 }},
-		{{ -1.086146, 0.031200, -0.364854 }},
-		{{ -1.086029, 2.502600, 0.180521 }},
-		{{ -1.086029, 2.502600, -0.180521 }},
-		{{ -1.083310, 0.463200, -1.476127 }},
-		{{ -1.083310, 0.463200, 1.476127 }},
-		{{ -1.074940, 0.177075, -1.074940 }},
-		{{ -1.074940, 0.177075, 1.074940 }},
-		{{ -1.072079, 2.474400, -0.557774 }},
-		{{ -1.072079, 2.474400, 0.557774 }},
-		{{ -1.065000, 2.400000, -1.065000 }},
-		{{ -1.065000, 0.150000, -1.065000 }},
-		{{ -1.065000, 0.150000, 1.065000 }},
-		{{ -1.065000, 2.400000, 1.065000 }},
-		{{ -1.062497, 0.127575, 1.062497 }},
-		{{ -1.062497, 0.127575, -1.062497 }},
-		{{ -1.059553, 1.774800, -1.443756 }},
-		{{ -1.059553, 1.774800, 1.443756 }},
-		{{ -1.052064, 2.400000, -0.772096 }},
-		{{ -1.052064, 2.400000, 0.772096 }},
-		{{ -1.051368, 0.105600, -1.051368 }},
-		{{ -1.051368, 0.105600, 1.051368 }},
-		{{ -1.051031, 2.435437, -1.051031 }},
-		{{ -1.051031, 2.435437, 1.051031 }},
-		{{ -1.044926, 2.502600, -0.351008 }},
-		{{ -1.044926, 2.502600, 0.351008 }},
-		{{ -1.039419, 0.046875, -0.762816 }},
-		{{ -1.039419, 0.046875, 0.762816 }},
-		{{ -1.039360, 0.384375, -1.416240 }},
-		{{ -1.039360, 0.384375, 1.416240 }},
-		{{ -1.036316, 2.463000, -1.036316 }},
-		{{ -1.036316, 2.463000, 1.036316 }},
-		{{ -1.031508, 2.440800, 0.757010 }},
-		{{ -1.031508, 2.440800, -0.757010 }},
-		{{ -1.026181, 0.084525, -1.026181 }},
-		{{ -1.026181, 0.084525, 1.026181 }},
-		{{ -1.021708, 2.482687, -1.021708 }},
-		{{ -1.021708, 2.482687, 1.021708 }},
-		{{ -1.020503, 1.929525, -1.390545 }},
-		{{ -1.020503, 1.929525, 1.390545 }},
-		{{ -1.017621, 0.031200, 0.529441 }},
-		{{ -1.017621, 0.031200, -0.529441 }},
-		{{ -1.008058, 2.494500, -1.008058 }},
-		{{ -1.008058, 2.494500, 1.008058 }},
-		{{ -0.996219, 2.498438, -0.996219 }},
-		{{ -0.996219, 2.498438, 0.996219 }},
-		{{ -0.995410, 0.316800, -1.356353 }},
-		{{ -0.995410, 0.316800, 1.356353 }},
-		{{ -0.994000, 2.400000, -0.994000 }},
-		{{ -0.994000, 2.400000, 0.994000 }},
-		{{ -0.987042, 2.494500, -0.987042 }},
-		{{ -0.987042, 2.494500, 0.987042 }},
-		{{ -0.984007, 2.435437, -0.984007 }},
-		{{ -0.984007, 2.435437, 0.984007 }},
-		{{ -0.981504, 0.064800, 0.981504 }},
-		{{ -0.981504, 0.064800, -0.981504 }},
-		{{ -0.981380, 2.482687, -0.981380 }},
-		{{ -0.981380, 2.482687, 0.981380 }},
-		{{ -0.980084, 2.463000, -0.980084 }},
-		{{ -0.980084, 2.463000, 0.980084 }},
-		{{ -0.979002, 2.502600, 0.509349 }},
-		{{ -0.979002, 2.502600, -0.509349 }},
-		{{ -0.978780, 2.085600, -1.333693 }},
-		{{ -0.978780, 2.085600, 1.333693 }},
-		{{ -0.975021, 2.474400, -0.715555 }},
-		{{ -0.975021, 2.474400, 0.715555 }},
-		{{ -0.970400, 2.527200, 0.000000 }},
-		{{ -0.970400, 2.527200, 0.000000 }},
-		{{ -0.957901, 2.527200, -0.159223 }},
-		{{ -0.957901, 2.527200, 0.159223 }},
-		{{ -0.955023, 0.260025, 1.301322 }},
-		{{ -0.955023, 0.260025, -1.301322 }},
-		{{ -0.952425, 0.018225, -0.000000 }},
-		{{ -0.952425, 0.018225, 0.000000 }},
-		{{ -0.940158, 0.018225, 0.156274 }},
-		{{ -0.940158, 0.018225, -0.156274 }},
-		{{ -0.935276, 2.242575, -1.274414 }},
-		{{ -0.935276, 2.242575, 1.274414 }},
-		{{ -0.925920, 0.900000, -1.779680 }},
-		{{ -0.925920, 0.900000, 1.779680 }},
-		{{ -0.925920, 0.900000, 1.779680 }},
-		{{ -0.925920, 0.900000, -1.779680 }},
-		{{ -0.925493, 0.031200, 0.679207 }},
-		{{ -0.925493, 0.031200, -0.679207 }},
-		{{ -0.923000, 2.400000, -0.923000 }},
-		{{ -0.923000, 2.400000, 0.923000 }},
-		{{ -0.922564, 1.037175, 1.773229 }},
-		{{ -0.922564, 1.037175, -1.773229 }},
-		{{ -0.921764, 0.213600, 1.256003 }},
-		{{ -0.921764, 0.213600, -1.256003 }},
-		{{ -0.921647, 2.527200, -0.309596 }},
-		{{ -0.921647, 2.527200, 0.309596 }},
-		{{ -0.919439, 0.771675, -1.767222 }},
-		{{ -0.919439, 0.771675, 1.767222 }},
-		{{ -0.912957, 1.178400, -1.754764 }},
-		{{ -0.912957, 1.178400, 1.754764 }},
-		{{ -0.911906, 0.046875, -0.911906 }},
-		{{ -0.911906, 0.046875, 0.911906 }},
-		{{ -0.904966, 2.440800, 0.904966 }},
-		{{ -0.904966, 2.440800, -0.904966 }},
-		{{ -0.904575, 0.018225, 0.303862 }},
-		{{ -0.904575, 0.018225, -0.303862 }},
-		{{ -0.901846, 0.656400, -1.733408 }},
-		{{ -0.901846, 0.656400, 1.733408 }},
-		{{ -0.899195, 0.177075, 1.225250 }},
-		{{ -0.899195, 0.177075, -1.225250 }},
-		{{ -0.897795, 1.323225, -1.725622 }},
-		{{ -0.897795, 1.323225, 1.725622 }},
-		{{ -0.890880, 0.150000, -1.213920 }},
-		{{ -0.890880, 0.150000, 1.213920 }},
-		{{ -0.890880, 2.400000, -1.213920 }},
-		{{ -0.890880, 0.150000, -1.213920 }},
-		{{ -0.890880, 0.150000, 1.213920 }},
-		{{ -0.890880, 2.400000, 1.213920 }},
-		{{ -0.890370, 2.502600, -0.653431 }},
-		{{ -0.890370, 2.502600, 0.653431 }},
-		{{ -0.888786, 0.127575, 1.211067 }},
-		{{ -0.888786, 0.127575, -1.211067 }},
-		{{ -0.879477, 0.105600, -1.198382 }},
-		{{ -0.879477, 0.105600, 1.198382 }},
-		{{ -0.879195, 2.435437, -1.197997 }},
-		{{ -0.879195, 2.435437, 1.197997 }},
-		{{ -0.877772, 1.471200, -1.687137 }},
-		{{ -0.877772, 1.471200, 1.687137 }},
-		{{ -0.875920, 0.553725, -1.683577 }},
-		{{ -0.875920, 0.553725, 1.683577 }},
-		{{ -0.866886, 2.463000, -1.181225 }},
-		{{ -0.866886, 2.463000, 1.181225 }},
-		{{ -0.863501, 2.527200, -0.449256 }},
-		{{ -0.863501, 2.527200, 0.449256 }},
-		{{ -0.858407, 0.084525, -1.169673 }},
-		{{ -0.858407, 0.084525, 1.169673 }},
-		{{ -0.855408, 2.474400, -0.855408 }},
-		{{ -0.855408, 2.474400, 0.855408 }},
-		{{ -0.854666, 2.482687, -1.164574 }},
-		{{ -0.854666, 2.482687, 1.164574 }},
-		{{ -0.853583, 1.621875, -1.640643 }},
-		{{ -0.853583, 1.621875, 1.640643 }},
-		{{ -0.847506, 0.018225, -0.440935 }},
-		{{ -0.847506, 0.018225, 0.440935 }},
-		{{ -0.844439, 0.463200, 1.623068 }},
-		{{ -0.844439, 0.463200, -1.623068 }},
-		{{ -0.843248, 2.494500, -1.149016 }},
-		{{ -0.843248, 2.494500, 1.149016 }},
-		{{ -0.833344, 2.498438, -1.135521 }},
-		{{ -0.833344, 2.498438, 1.135521 }},
-		{{ -0.831488, 2.400000, -1.132992 }},
-		{{ -0.831488, 2.400000, 1.132992 }},
-		{{ -0.825921, 1.774800, 1.587475 }},
-		{{ -0.825921, 1.774800, -1.587475 }},
-		{{ -0.825668, 2.494500, -1.125061 }},
-		{{ -0.825668, 2.494500, 1.125061 }},
-		{{ -0.825000, 2.550000, 0.000000 }},
-		{{ -0.825000, 2.550000, 0.000000 }},
-		{{ -0.823129, 2.435437, -1.121601 }},
-		{{ -0.823129, 2.435437, 1.121601 }},
-		{{ -0.821035, 0.064800, 1.118749 }},
-		{{ -0.821035, 0.064800, -1.118749 }},
-		{{ -0.820931, 2.482687, 1.118607 }},
-		{{ -0.820931, 2.482687, -1.118607 }},
-		{{ -0.819847, 2.463000, -1.117130 }},
-		{{ -0.819847, 2.463000, 1.117130 }},
-		{{ -0.814374, 2.550000, -0.135366 }},
-		{{ -0.814374, 2.550000, 0.135366 }},
-		{{ -0.811956, 0.031200, 0.811956 }},
-		{{ -0.811956, 0.031200, -0.811956 }},
-		{{ -0.810180, 0.384375, 1.557220 }},
-		{{ -0.810180, 0.384375, -1.557220 }},
-		{{ -0.795481, 1.929525, 1.528968 }},
-		{{ -0.795481, 1.929525, -1.528968 }},
-		{{ -0.785325, 2.527200, -0.576340 }},
-		{{ -0.785325, 2.527200, 0.576340 }},
-		{{ -0.783552, 2.550000, -0.263208 }},
-		{{ -0.783552, 2.550000, 0.263208 }},
-		{{ -0.781142, 2.502600, -0.781142 }},
-		{{ -0.781142, 2.502600, 0.781142 }},
-		{{ -0.775921, 0.316800, -1.491372 }},
-		{{ -0.775921, 0.316800, 1.491372 }},
-		{{ -0.772096, 2.400000, -1.052064 }},
-		{{ -0.772096, 2.400000, 1.052064 }},
-		{{ -0.770779, 0.018225, 0.565664 }},
-		{{ -0.770779, 0.018225, -0.565664 }},
-		{{ -0.762958, 2.085600, -1.466456 }},
-		{{ -0.762958, 2.085600, 1.466456 }},
-		{{ -0.762816, 0.046875, -1.039419 }},
-		{{ -0.762816, 0.046875, 1.039419 }},
-		{{ -0.757010, 2.440800, 1.031508 }},
-		{{ -0.757010, 2.440800, -1.031508 }},
-		{{ -0.744440, 0.260025, 1.430863 }},
-		{{ -0.744440, 0.260025, -1.430863 }},
-		{{ -0.734118, 2.550000, -0.381942 }},
-		{{ -0.734118, 2.550000, 0.381942 }},
-		{{ -0.729046, 2.242575, -1.401276 }},
-		{{ -0.729046, 2.242575, 1.401276 }},
-		{{ -0.718514, 0.213600, 1.381032 }},
-		{{ -0.718514, 0.213600, -1.381032 }},
-		{{ -0.715555, 2.474400, -0.975021 }},
-		{{ -0.715555, 2.474400, 0.975021 }},
-		{{ -0.703200, 0.008400, 0.000000 }},
-		{{ -0.700921, 0.177075, 1.347218 }},
-		{{ -0.700921, 0.177075, -1.347218 }},
-		{{ -0.694440, 0.150000, -1.334760 }},
-		{{ -0.694440, 0.150000, 1.334760 }},
-		{{ -0.694440, 2.400000, 1.334760 }},
-		{{ -0.694440, 0.150000, 1.334760 }},
-		{{ -0.694440, 2.400000, -1.334760 }},
-		{{ -0.694440, 0.150000, -1.334760 }},
-		{{ -0.694143, 0.008400, -0.115381 }},
-		{{ -0.694143, 0.008400, 0.115381 }},
-		{{ -0.692808, 0.127575, 1.331623 }},
-		{{ -0.692808, 0.127575, -1.331623 }},
-		{{ -0.688984, 2.527200, -0.688984 }},
-		{{ -0.688984, 2.527200, 0.688984 }},
-		{{ -0.685551, 0.105600, -1.317675 }},
-		{{ -0.685551, 0.105600, 1.317675 }},
-		{{ -0.685331, 2.435437, -1.317252 }},
-		{{ -0.685331, 2.435437, 1.317252 }},
-		{{ -0.679207, 0.031200, -0.925493 }},
-		{{ -0.679207, 0.031200, 0.925493 }},
-		{{ -0.676222, 0.018225, 0.676222 }},
-		{{ -0.676222, 0.018225, -0.676222 }},
-		{{ -0.675736, 2.463000, -1.298810 }},
-		{{ -0.675736, 2.463000, 1.298810 }},
-		{{ -0.673600, 2.572800, 0.000000 }},
-		{{ -0.673600, 2.572800, 0.000000 }},
-		{{ -0.669128, 0.084525, -1.286108 }},
-		{{ -0.669128, 0.084525, 1.286108 }},
-		{{ -0.667871, 0.008400, -0.224349 }},
-		{{ -0.667871, 0.008400, 0.224349 }},
-		{{ -0.667656, 2.550000, -0.489984 }},
-		{{ -0.667656, 2.550000, 0.489984 }},
-		{{ -0.666211, 2.482687, 1.280502 }},
-		{{ -0.666211, 2.482687, -1.280502 }},
-		{{ -0.664924, 2.572800, -0.110524 }},
-		{{ -0.664924, 2.572800, 0.110524 }},
-		{{ -0.657311, 2.494500, -1.263395 }},
-		{{ -0.657311, 2.494500, 1.263395 }},
-		{{ -0.653431, 2.502600, -0.890370 }},
-		{{ -0.653431, 2.502600, 0.890370 }},
-		{{ -0.649591, 2.498438, -1.248557 }},
-		{{ -0.649591, 2.498438, 1.248557 }},
-		{{ -0.648144, 2.400000, -1.245776 }},
-		{{ -0.648144, 2.400000, 1.245776 }},
-		{{ -0.643607, 2.494500, -1.237056 }},
-		{{ -0.643607, 2.494500, 1.237056 }},
-		{{ -0.641628, 2.435437, -1.233252 }},
-		{{ -0.641628, 2.435437, 1.233252 }},
-		{{ -0.639996, 0.064800, -1.230115 }},
-		{{ -0.639996, 0.064800, 1.230115 }},
-		{{ -0.639915, 2.482687, 1.229959 }},
-		{{ -0.639915, 2.482687, -1.229959 }},
-		{{ -0.639758, 2.572800, -0.214905 }},
-		{{ -0.639758, 2.572800, 0.214905 }},
-		{{ -0.639070, 2.463000, -1.228335 }},
-		{{ -0.639070, 2.463000, 1.228335 }},
-		{{ -0.638080, 0.900000, -1.899520 }},
-		{{ -0.638080, 0.900000, -1.899520 }},
-		{{ -0.638080, 0.900000, 1.899520 }},
-		{{ -0.638080, 0.900000, 1.899520 }},
-		{{ -0.635767, 1.037175, -1.892634 }},
-		{{ -0.635767, 1.037175, 1.892634 }},
-		{{ -0.633613, 0.771675, -1.886223 }},
-		{{ -0.633613, 0.771675, 1.886223 }},
-		{{ -0.629147, 1.178400, -1.872927 }},
-		{{ -0.629147, 1.178400, 1.872927 }},
-		{{ -0.625735, 0.008400, 0.325553 }},
-		{{ -0.625735, 0.008400, -0.325553 }},
-		{{ -0.621490, 0.656400, -1.850132 }},
-		{{ -0.621490, 0.656400, 1.850132 }},
-		{{ -0.618698, 1.323225, -1.841822 }},
-		{{ -0.618698, 1.323225, 1.841822 }},
-		{{ -0.604900, 1.471200, -1.800745 }},
-		{{ -0.604900, 1.471200, 1.800745 }},
-		{{ -0.603624, 0.553725, -1.796946 }},
-		{{ -0.603624, 0.553725, 1.796946 }},
-		{{ -0.601848, 2.400000, -1.156792 }},
-		{{ -0.601848, 2.400000, 1.156792 }},
-		{{ -0.599396, 2.572800, -0.311850 }},
-		{{ -0.599396, 2.572800, 0.311850 }},
-		{{ -0.594614, 0.046875, -1.142888 }},
-		{{ -0.594614, 0.046875, 1.142888 }},
-		{{ -0.590089, 2.440800, 1.134190 }},
-		{{ -0.590089, 2.440800, -1.134190 }},
-		{{ -0.588230, 1.621875, -1.751120 }},
-		{{ -0.588230, 1.621875, 1.751120 }},
-		{{ -0.585750, 2.550000, -0.585750 }},
-		{{ -0.585750, 2.550000, 0.585750 }},
-		{{ -0.581929, 0.463200, -1.732362 }},
-		{{ -0.581929, 0.463200, 1.732362 }},
-		{{ -0.576340, 2.527200, -0.785325 }},
-		{{ -0.576340, 2.527200, 0.785325 }},
-		{{ -0.569167, 1.774800, -1.694372 }},
-		{{ -0.569167, 1.774800, 1.694372 }},
-		{{ -0.569086, 0.008400, -0.417645 }},
-		{{ -0.569086, 0.008400, 0.417645 }},
-		{{ -0.565664, 0.018225, 0.770779 }},
-		{{ -0.565664, 0.018225, -0.770779 }},
-		{{ -0.558320, 0.384375, -1.662080 }},
-		{{ -0.558320, 0.384375, 1.662080 }},
-		{{ -0.557774, 2.474400, -1.072079 }},
-		{{ -0.557774, 2.474400, 1.072079 }},
-		{{ -0.548190, 1.929525, -1.631925 }},
-		{{ -0.548190, 1.929525, 1.631925 }},
-		{{ -0.545131, 2.572800, -0.400065 }},
-		{{ -0.545131, 2.572800, 0.400065 }},
-		{{ -0.534711, 0.316800, -1.591798 }},
-		{{ -0.534711, 0.316800, 1.591798 }},
-		{{ -0.529441, 0.031200, -1.017621 }},
-		{{ -0.529441, 0.031200, 1.017621 }},
-		{{ -0.525800, 2.597400, 0.000000 }},
-		{{ -0.525800, 2.597400, 0.000000 }},
-		{{ -0.525778, 2.085600, -1.565204 }},
-		{{ -0.525778, 2.085600, 1.565204 }},
-		{{ -0.519028, 2.597400, 0.086273 }},
-		{{ -0.519028, 2.597400, -0.086273 }},
-		{{ -0.513016, 0.260025, -1.527214 }},
-		{{ -0.513016, 0.260025, 1.527214 }},
-		{{ -0.509349, 2.502600, 0.979002 }},
-		{{ -0.509349, 2.502600, -0.979002 }},
-		{{ -0.502408, 2.242575, -1.495635 }},
-		{{ -0.502408, 2.242575, 1.495635 }},
-		{{ -0.499384, 2.597400, -0.167751 }},
-		{{ -0.499384, 2.597400, 0.167751 }},
-		{{ -0.499272, 0.008400, -0.499272 }},
-		{{ -0.499272, 0.008400, 0.499272 }},
-		{{ -0.495150, 0.213600, -1.474028 }},
-		{{ -0.495150, 0.213600, 1.474028 }},
-		{{ -0.489984, 2.550000, -0.667656 }},
-		{{ -0.489984, 2.550000, 0.667656 }},
-		{{ -0.483027, 0.177075, -1.437937 }},
-		{{ -0.483027, 0.177075, 1.437937 }},
-		{{ -0.478560, 0.150000, 1.424640 }},
-		{{ -0.478560, 2.400000, -1.424640 }},
-		{{ -0.478560, 0.150000, -1.424640 }},
-		{{ -0.478560, 0.150000, -1.424640 }},
-		{{ -0.478560, 0.150000, 1.424640 }},
-		{{ -0.478560, 2.400000, 1.424640 }},
-		{{ -0.478256, 2.572800, -0.478256 }},
-		{{ -0.478256, 2.572800, 0.478256 }},
-		{{ -0.477435, 0.127575, 1.421292 }},
-		{{ -0.477435, 0.127575, -1.421292 }},
-		{{ -0.472434, 0.105600, 1.406405 }},
-		{{ -0.472434, 0.105600, -1.406405 }},
-		{{ -0.472283, 2.435437, -1.405953 }},
-		{{ -0.472283, 2.435437, 1.405953 }},
-		{{ -0.467878, 2.597400, -0.243424 }},
-		{{ -0.467878, 2.597400, 0.243424 }},
-		{{ -0.465671, 2.463000, -1.386270 }},
-		{{ -0.465671, 2.463000, 1.386270 }},
-		{{ -0.461116, 0.084525, 1.372712 }},
-		{{ -0.461116, 0.084525, -1.372712 }},
-		{{ -0.459107, 2.482687, -1.366728 }},
-		{{ -0.459107, 2.482687, 1.366728 }},
-		{{ -0.452973, 2.494500, -1.348469 }},
-		{{ -0.452973, 2.494500, 1.348469 }},
-		{{ -0.449256, 2.527200, -0.863501 }},
-		{{ -0.449256, 2.527200, 0.863501 }},
-		{{ -0.447653, 2.498438, -1.332632 }},
-		{{ -0.447653, 2.498438, 1.332632 }},
-		{{ -0.446656, 2.400000, -1.329664 }},
-		{{ -0.446656, 2.400000, 1.329664 }},
-		{{ -0.443529, 2.494500, -1.320356 }},
-		{{ -0.443529, 2.494500, 1.320356 }},
-		{{ -0.442166, 2.435437, -1.316296 }},
-		{{ -0.442166, 2.435437, 1.316296 }},
-		{{ -0.441041, 0.064800, 1.312948 }},
-		{{ -0.441041, 0.064800, -1.312948 }},
-		{{ -0.440985, 2.482687, -1.312782 }},
-		{{ -0.440985, 2.482687, 1.312782 }},
-		{{ -0.440935, 0.018225, 0.847506 }},
-		{{ -0.440935, 0.018225, -0.847506 }},
-		{{ -0.440403, 2.463000, -1.311049 }},
-		{{ -0.440403, 2.463000, 1.311049 }},
-		{{ -0.425519, 2.597400, 0.312283 }},
-		{{ -0.425519, 2.597400, -0.312283 }},
-		{{ -0.417645, 0.008400, -0.569086 }},
-		{{ -0.417645, 0.008400, 0.569086 }},
-		{{ -0.414752, 2.400000, -1.234688 }},
-		{{ -0.414752, 2.400000, 1.234688 }},
-		{{ -0.409767, 0.046875, 1.219848 }},
-		{{ -0.409767, 0.046875, -1.219848 }},
-		{{ -0.406648, 2.440800, -1.210564 }},
-		{{ -0.406648, 2.440800, 1.210564 }},
-		{{ -0.400065, 2.572800, -0.545131 }},
-		{{ -0.400065, 2.572800, 0.545131 }},
-		{{ -0.391200, 2.625600, 0.000000 }},
-		{{ -0.391200, 2.625600, 0.000000 }},
-		{{ -0.388275, 0.002175, -0.000000 }},
-		{{ -0.388275, 0.002175, 0.000000 }},
-		{{ -0.386161, 2.625600, -0.064188 }},
-		{{ -0.386161, 2.625600, 0.064188 }},
-		{{ -0.384379, 2.474400, -1.144271 }},
-		{{ -0.384379, 2.474400, 1.144271 }},
-		{{ -0.383274, 0.002175, -0.063708 }},
-		{{ -0.383274, 0.002175, 0.063708 }},
-		{{ -0.381942, 2.550000, -0.734118 }},
-		{{ -0.381942, 2.550000, 0.734118 }},
-		{{ -0.373318, 2.597400, -0.373318 }},
-		{{ -0.373318, 2.597400, 0.373318 }},
-		{{ -0.371546, 2.625600, -0.124808 }},
-		{{ -0.371546, 2.625600, 0.124808 }},
-		{{ -0.368768, 0.002175, -0.123875 }},
-		{{ -0.368768, 0.002175, 0.123875 }},
-		{{ -0.364854, 0.031200, 1.086146 }},
-		{{ -0.364854, 0.031200, -1.086146 }},
-		{{ -0.358400, 3.034800, 0.000000 }},
-		{{ -0.358400, 3.034800, 0.000000 }},
-		{{ -0.358200, 3.081150, 0.000000 }},
-		{{ -0.358200, 3.081150, 0.000000 }},
-		{{ -0.353807, 3.034800, -0.059016 }},
-		{{ -0.353807, 3.034800, 0.059016 }},
-		{{ -0.353610, 3.081150, -0.058988 }},
-		{{ -0.353610, 3.081150, 0.058988 }},
-		{{ -0.351008, 2.502600, -1.044926 }},
-		{{ -0.351008, 2.502600, 1.044926 }},
-		{{ -0.348105, 2.625600, -0.181110 }},
-		{{ -0.348105, 2.625600, 0.181110 }},
-		{{ -0.345503, 0.002175, -0.179756 }},
-		{{ -0.345503, 0.002175, 0.179756 }},
-		{{ -0.340477, 3.034800, -0.114676 }},
-		{{ -0.340477, 3.034800, 0.114676 }},
-		{{ -0.340289, 3.081150, -0.114619 }},
-		{{ -0.340289, 3.081150, 0.114619 }},
-		{{ -0.328160, 0.900000, -1.974240 }},
-		{{ -0.328160, 0.900000, 1.974240 }},
-		{{ -0.328160, 0.900000, 1.974240 }},
-		{{ -0.326970, 1.037175, -1.967083 }},
-		{{ -0.326970, 1.037175, 1.967083 }},
-		{{ -0.325863, 0.771675, -1.960420 }},
-		{{ -0.325863, 0.771675, 1.960420 }},
-		{{ -0.325553, 0.008400, -0.625735 }},
-		{{ -0.325553, 0.008400, 0.625735 }},
-		{{ -0.325000, 2.981250, 0.000000 }},
-		{{ -0.325000, 2.981250, 0.000000 }},
-		{{ -0.323566, 1.178400, -1.946601 }},
-		{{ -0.323566, 1.178400, 1.946601 }},
-		{{ -0.320834, 2.981250, -0.053508 }},
-		{{ -0.320834, 2.981250, 0.053508 }},
-		{{ -0.319628, 0.656400, -1.922910 }},
-		{{ -0.319628, 0.656400, 1.922910 }},
-		{{ -0.319082, 3.034800, -0.166306 }},
-		{{ -0.319082, 3.034800, 0.166306 }},
-		{{ -0.318907, 3.081150, -0.166221 }},
-		{{ -0.318907, 3.081150, 0.166221 }},
-		{{ -0.318192, 1.323225, -1.914272 }},
-		{{ -0.318192, 1.323225, 1.914272 }},
-		{{ -0.316590, 2.625600, -0.232342 }},
-		{{ -0.316590, 2.625600, 0.232342 }},
-		{{ -0.314223, 0.002175, -0.230604 }},
-		{{ -0.314223, 0.002175, 0.230604 }},
-		{{ -0.312283, 2.597400, -0.425519 }},
-		{{ -0.312283, 2.597400, 0.425519 }},
-		{{ -0.311850, 2.572800, -0.599396 }},
-		{{ -0.311850, 2.572800, 0.599396 }},
-		{{ -0.311096, 1.471200, -1.871580 }},
-		{{ -0.311096, 1.471200, 1.871580 }},
-		{{ -0.310439, 0.553725, -1.867631 }},
-		{{ -0.310439, 0.553725, 1.867631 }},
-		{{ -0.309596, 2.527200, -0.921647 }},
-		{{ -0.309596, 2.527200, 0.921647 }},
-		{{ -0.308800, 3.117600, 0.000000 }},
-		{{ -0.308800, 3.117600, 0.000000 }},
-		{{ -0.308744, 2.981250, -0.103976 }},
-		{{ -0.308744, 2.981250, 0.103976 }},
-		{{ -0.304843, 3.117600, -0.050855 }},
-		{{ -0.304843, 3.117600, 0.050855 }},
-		{{ -0.303862, 0.018225, 0.904575 }},
-		{{ -0.303862, 0.018225, -0.904575 }},
-		{{ -0.302523, 1.621875, -1.820003 }},
-		{{ -0.302522, 1.621875, 1.820003 }},
-		{{ -0.299282, 0.463200, -1.800507 }},
-		{{ -0.299282, 0.463200, 1.800507 }},
-		{{ -0.293360, 3.117600, -0.098814 }},
-		{{ -0.293360, 3.117600, 0.098814 }},
-		{{ -0.292719, 1.774800, -1.761022 }},
-		{{ -0.292719, 1.774800, 1.761022 }},
-		{{ -0.290295, 3.034800, -0.213234 }},
-		{{ -0.290295, 3.034800, 0.213234 }},
-		{{ -0.290138, 3.081150, -0.213123 }},
-		{{ -0.290138, 3.081150, 0.213123 }},
-		{{ -0.289340, 2.981250, -0.150793 }},
-		{{ -0.289340, 2.981250, 0.150793 }},
-		{{ -0.287140, 0.384375, -1.727460 }},
-		{{ -0.287140, 0.384375, 1.727460 }},
-		{{ -0.281930, 1.929525, 1.696119 }},
-		{{ -0.281930, 1.929525, -1.696119 }},
-		{{ -0.279400, 2.659200, 0.000000 }},
-		{{ -0.277752, 2.625600, -0.277752 }},
-		{{ -0.277752, 2.625600, 0.277752 }},
-		{{ -0.275801, 2.659200, -0.045844 }},
-		{{ -0.275801, 2.659200, 0.045844 }},
-		{{ -0.275675, 0.002175, -0.275675 }},
-		{{ -0.275675, 0.002175, 0.275675 }},
-		{{ -0.274998, 0.316800, -1.654413 }},
-		{{ -0.274998, 0.316800, 1.654413 }},
-		{{ -0.274928, 3.117600, -0.143301 }},
-		{{ -0.274928, 3.117600, 0.143301 }},
-		{{ -0.273600, 2.923200, 0.000000 }},
-		{{ -0.273600, 2.923200, 0.000000 }},
-		{{ -0.270404, 2.085600, -1.626774 }},
-		{{ -0.270404, 2.085600, 1.626774 }},
-		{{ -0.270092, 2.923200, -0.045032 }},
-		{{ -0.270092, 2.923200, 0.045032 }},
-		{{ -0.265363, 2.659200, -0.089140 }},
-		{{ -0.265363, 2.659200, 0.089140 }},
-		{{ -0.263841, 0.260025, 1.587289 }},
-		{{ -0.263841, 0.260025, -1.587289 }},
-		{{ -0.263232, 2.981250, -0.193348 }},
-		{{ -0.263232, 2.981250, 0.193348 }},
-		{{ -0.263208, 2.550000, -0.783552 }},
-		{{ -0.263208, 2.550000, 0.783552 }},
-		{{ -0.259910, 2.923200, -0.087511 }},
-		{{ -0.259910, 2.923200, 0.087511 }},
-		{{ -0.258385, 2.242575, -1.554467 }},
-		{{ -0.258385, 2.242575, 1.554467 }},
-		{{ -0.254788, 3.034800, -0.254788 }},
-		{{ -0.254788, 3.034800, 0.254788 }},
-		{{ -0.254653, 3.081150, -0.254653 }},
-		{{ -0.254653, 3.081150, 0.254653 }},
-		{{ -0.254652, 0.213600, -1.532010 }},
-		{{ -0.254652, 0.213600, 1.532010 }},
-		{{ -0.250127, 3.117600, -0.183734 }},
-		{{ -0.250127, 3.117600, 0.183734 }},
-		{{ -0.248621, 2.659200, 0.129351 }},
-		{{ -0.248621, 2.659200, -0.129351 }},
-		{{ -0.248417, 0.177075, -1.494500 }},
-		{{ -0.248417, 0.177075, 1.494500 }},
-		{{ -0.246120, 0.150000, 1.480680 }},
-		{{ -0.246120, 2.400000, -1.480680 }},
-		{{ -0.246120, 0.150000, -1.480680 }},
-		{{ -0.246120, 0.150000, -1.480680 }},
-		{{ -0.246120, 0.150000, 1.480680 }},
-		{{ -0.246120, 2.400000, 1.480680 }},
-		{{ -0.245542, 0.127575, 1.477200 }},
-		{{ -0.245542, 0.127575, -1.477200 }},
-		{{ -0.243569, 2.923200, -0.126920 }},
-		{{ -0.243569, 2.923200, 0.126920 }},
-		{{ -0.243424, 2.597400, 0.467878 }},
-		{{ -0.243424, 2.597400, -0.467878 }},
-		{{ -0.242970, 0.105600, 1.461727 }},
-		{{ -0.242970, 0.105600, -1.461727 }},
-		{{ -0.242892, 2.435437, -1.461258 }},
-		{{ -0.242892, 2.435437, 1.461258 }},
-		{{ -0.239491, 2.463000, -1.440800 }},
-		{{ -0.239491, 2.463000, 1.440800 }},
-		{{ -0.237149, 0.084525, 1.426709 }},
-		{{ -0.237149, 0.084525, -1.426709 }},
-		{{ -0.236115, 2.482687, -1.420490 }},
-		{{ -0.236115, 2.482687, 1.420490 }},
-		{{ -0.232961, 2.494500, -1.401513 }},
-		{{ -0.232961, 2.494500, 1.401513 }},
-		{{ -0.232342, 2.625600, -0.316590 }},
-		{{ -0.232342, 2.625600, 0.316590 }},
-		{{ -0.231031, 2.981250, -0.231031 }},
-		{{ -0.231031, 2.981250, 0.231031 }},
-		{{ -0.230604, 0.002175, -0.314223 }},
-		{{ -0.230604, 0.002175, 0.314223 }},
-		{{ -0.230225, 2.498438, -1.385053 }},
-		{{ -0.230225, 2.498438, 1.385053 }},
-		{{ -0.229712, 2.400000, -1.381968 }},
-		{{ -0.229712, 2.400000, 1.381968 }},
-		{{ -0.228104, 2.494500, -1.372294 }},
-		{{ -0.228104, 2.494500, 1.372294 }},
-		{{ -0.227403, 2.435437, -1.368074 }},
-		{{ -0.227403, 2.435437, 1.368074 }},
-		{{ -0.226824, 0.064800, 1.364595 }},
-		{{ -0.226824, 0.064800, -1.364595 }},
-		{{ -0.226795, 2.482687, 1.364422 }},
-		{{ -0.226795, 2.482687, -1.364422 }},
-		{{ -0.226496, 2.463000, -1.362620 }},
-		{{ -0.226496, 2.463000, 1.362620 }},
-		{{ -0.226113, 2.659200, -0.165941 }},
-		{{ -0.226113, 2.659200, 0.165941 }},
-		{{ -0.224349, 0.008400, 0.667871 }},
-		{{ -0.224349, 0.008400, -0.667871 }},
-		{{ -0.221585, 2.923200, -0.162745 }},
-		{{ -0.221585, 2.923200, 0.162745 }},
-		{{ -0.219800, 2.863350, 0.000000 }},
-		{{ -0.219800, 2.863350, 0.000000 }},
-		{{ -0.219536, 3.117600, -0.219536 }},
-		{{ -0.219536, 3.117600, 0.219536 }},
-		{{ -0.216979, 2.863350, 0.036157 }},
-		{{ -0.216979, 2.863350, -0.036157 }},
-		{{ -0.214905, 2.572800, -0.639758 }},
-		{{ -0.214905, 2.572800, 0.639758 }},
-		{{ -0.213304, 2.400000, -1.283256 }},
-		{{ -0.213304, 2.400000, 1.283256 }},
-		{{ -0.213234, 3.034800, -0.290295 }},
-		{{ -0.213234, 3.034800, 0.290295 }},
-		{{ -0.213123, 3.081150, -0.290138 }},
-		{{ -0.213123, 3.081150, 0.290138 }},
-		{{ -0.210740, 0.046875, -1.267832 }},
-		{{ -0.210740, 0.046875, 1.267832 }},
-		{{ -0.209136, 2.440800, -1.258183 }},
-		{{ -0.209136, 2.440800, 1.258183 }},
-		{{ -0.208794, 2.863350, 0.070270 }},
-		{{ -0.208794, 2.863350, -0.070270 }},
-		{{ -0.200000, 2.700000, 0.000000 }},
-		{{ -0.200000, 2.700000, 0.000000 }},
-		{{ -0.200000, 2.700000, 0.000000 }},
-		{{ -0.200000, 2.700000, 0.000000 }},
-		{{ -0.198374, 2.659200, -0.198374 }},
-		{{ -0.198374, 2.659200, 0.198374 }},
-		{{ -0.197684, 2.474400, -1.189282 }},
-		{{ -0.197684, 2.474400, 1.189282 }},
-		{{ -0.197424, 2.700000, -0.032816 }},
-		{{ -0.197424, 2.700000, 0.032816 }},
-		{{ -0.197424, 2.700000, 0.032816 }},
-		{{ -0.197424, 2.700000, -0.032816 }},
-		{{ -0.195658, 2.863350, -0.101925 }},
-		{{ -0.195658, 2.863350, 0.101925 }},
-		{{ -0.194600, 3.141450, 0.000000 }},
-		{{ -0.194600, 3.141450, 0.000000 }},
-		{{ -0.194472, 2.923200, -0.194472 }},
-		{{ -0.194472, 2.923200, 0.194472 }},
-		{{ -0.193348, 2.981250, -0.263232 }},
-		{{ -0.193348, 2.981250, 0.263232 }},
-		{{ -0.192107, 3.141450, -0.032048 }},
-		{{ -0.192107, 3.141450, 0.032048 }},
-		{{ -0.189952, 2.700000, -0.063808 }},
-		{{ -0.189952, 2.700000, 0.063808 }},
-		{{ -0.189952, 2.700000, 0.063808 }},
-		{{ -0.189952, 2.700000, -0.063808 }},
-		{{ -0.187642, 0.031200, 1.128870 }},
-		{{ -0.187642, 0.031200, -1.128870 }},
-		{{ -0.184870, 3.141450, -0.062272 }},
-		{{ -0.184870, 3.141450, 0.062272 }},
-		{{ -0.183734, 3.117600, -0.250127 }},
-		{{ -0.183734, 3.117600, 0.250127 }},
-		{{ -0.181110, 2.625600, 0.348105 }},
-		{{ -0.181110, 2.625600, -0.348105 }},
-		{{ -0.180521, 2.502600, -1.086029 }},
-		{{ -0.180521, 2.502600, 1.086029 }},
-		{{ -0.179756, 0.002175, -0.345503 }},
-		{{ -0.179756, 0.002175, 0.345503 }},
-		{{ -0.179200, 2.804400, 0.000000 }},
-		{{ -0.179200, 2.804400, 0.000000 }},
-		{{ -0.177989, 2.863350, -0.130707 }},
-		{{ -0.177989, 2.863350, 0.130707 }},
-		{{ -0.177968, 2.700000, -0.092592 }},
-		{{ -0.177968, 2.700000, 0.092592 }},
-		{{ -0.177968, 2.700000, 0.092592 }},
-		{{ -0.177968, 2.700000, -0.092592 }},
-		{{ -0.176897, 2.804400, 0.029450 }},
-		{{ -0.176897, 2.804400, -0.029450 }},
-		{{ -0.173255, 3.141450, -0.090306 }},
-		{{ -0.173255, 3.141450, 0.090306 }},
-		{{ -0.170215, 2.804400, 0.057246 }},
-		{{ -0.170215, 2.804400, -0.057246 }},
-		{{ -0.167751, 2.597400, -0.499384 }},
-		{{ -0.167751, 2.597400, 0.499384 }},
-		{{ -0.167400, 2.749050, 0.000000 }},
-		{{ -0.167400, 2.749050, 0.000000 }},
-		{{ -0.166306, 3.034800, -0.319082 }},
-		{{ -0.166306, 3.034800, 0.319082 }},
-		{{ -0.166221, 3.081150, 0.318907 }},
-		{{ -0.166221, 3.081150, -0.318907 }},
-		{{ -0.165941, 2.659200, -0.226113 }},
-		{{ -0.165941, 2.659200, 0.226113 }},
-		{{ -0.165245, 2.749050, 0.027480 }},
-		{{ -0.165245, 2.749050, -0.027480 }},
-		{{ -0.162745, 2.923200, -0.221585 }},
-		{{ -0.162745, 2.923200, 0.221585 }},
-		{{ -0.161856, 2.700000, -0.118784 }},
-		{{ -0.161856, 2.700000, 0.118784 }},
-		{{ -0.161856, 2.700000, 0.118784 }},
-		{{ -0.161856, 2.700000, -0.118784 }},
-		{{ -0.159496, 2.804400, 0.083047 }},
-		{{ -0.159496, 2.804400, -0.083047 }},
-		{{ -0.159223, 2.527200, -0.957901 }},
-		{{ -0.159223, 2.527200, 0.957901 }},
-		{{ -0.158995, 2.749050, 0.053428 }},
-		{{ -0.158995, 2.749050, -0.053428 }},
-		{{ -0.157626, 3.141450, -0.115787 }},
-		{{ -0.157626, 3.141450, 0.115787 }},
-		{{ -0.156274, 0.018225, 0.940158 }},
-		{{ -0.156274, 0.018225, -0.940158 }},
-		{{ -0.156200, 2.863350, -0.156200 }},
-		{{ -0.156200, 2.863350, 0.156200 }},
-		{{ -0.150793, 2.981250, -0.289340 }},
-		{{ -0.150793, 2.981250, 0.289340 }},
-		{{ -0.148969, 2.749050, 0.077523 }},
-		{{ -0.148969, 2.749050, -0.077523 }},
-		{{ -0.145078, 2.804400, 0.106513 }},
-		{{ -0.145078, 2.804400, -0.106513 }},
-		{{ -0.143301, 3.117600, -0.274928 }},
-		{{ -0.143301, 3.117600, 0.274928 }},
-		{{ -0.142000, 2.700000, -0.142000 }},
-		{{ -0.142000, 2.700000, 0.142000 }},
-		{{ -0.142000, 2.700000, 0.142000 }},
-		{{ -0.142000, 2.700000, -0.142000 }},
-		{{ -0.138348, 3.141450, -0.138348 }},
-		{{ -0.138348, 3.141450, 0.138348 }},
-		{{ -0.135489, 2.749050, 0.099446 }},
-		{{ -0.135489, 2.749050, -0.099446 }},
-		{{ -0.135366, 2.550000, -0.814374 }},
-		{{ -0.135366, 2.550000, 0.814374 }},
-		{{ -0.130707, 2.863350, -0.177989 }},
-		{{ -0.130707, 2.863350, 0.177989 }},
-		{{ -0.129351, 2.659200, 0.248621 }},
-		{{ -0.129351, 2.659200, -0.248621 }},
-		{{ -0.127304, 2.804400, 0.127304 }},
-		{{ -0.127304, 2.804400, -0.127304 }},
-		{{ -0.126920, 2.923200, -0.243569 }},
-		{{ -0.126920, 2.923200, 0.243569 }},
-		{{ -0.124808, 2.625600, -0.371546 }},
-		{{ -0.124808, 2.625600, 0.371546 }},
-		{{ -0.123875, 0.002175, 0.368768 }},
-		{{ -0.123875, 0.002175, -0.368768 }},
-		{{ -0.118874, 2.749050, 0.118874 }},
-		{{ -0.118874, 2.749050, -0.118874 }},
-		{{ -0.118784, 2.700000, -0.161856 }},
-		{{ -0.118784, 2.700000, 0.161856 }},
-		{{ -0.118784, 2.700000, 0.161856 }},
-		{{ -0.118784, 2.700000, -0.161856 }},
-		{{ -0.115787, 3.141450, -0.157626 }},
-		{{ -0.115787, 3.141450, 0.157626 }},
-		{{ -0.115381, 0.008400, 0.694143 }},
-		{{ -0.115381, 0.008400, -0.694143 }},
-		{{ -0.114676, 3.034800, -0.340477 }},
-		{{ -0.114676, 3.034800, 0.340477 }},
-		{{ -0.114619, 3.081150, -0.340289 }},
-		{{ -0.114619, 3.081150, 0.340289 }},
-		{{ -0.110524, 2.572800, -0.664924 }},
-		{{ -0.110524, 2.572800, 0.664924 }},
-		{{ -0.106513, 2.804400, -0.145078 }},
-		{{ -0.106513, 2.804400, 0.145078 }},
-		{{ -0.103976, 2.981250, -0.308744 }},
-		{{ -0.103976, 2.981250, 0.308744 }},
-		{{ -0.101925, 2.863350, -0.195658 }},
-		{{ -0.101925, 2.863350, 0.195658 }},
-		{{ -0.099446, 2.749050, 0.135489 }},
-		{{ -0.099446, 2.749050, -0.135489 }},
-		{{ -0.098814, 3.117600, -0.293360 }},
-		{{ -0.098814, 3.117600, 0.293360 }},
-		{{ -0.092592, 2.700000, -0.177968 }},
-		{{ -0.092592, 2.700000, 0.177968 }},
-		{{ -0.092592, 2.700000, -0.177968 }},
-		{{ -0.092592, 2.700000, 0.177968 }},
-		{{ -0.090306, 3.141450, -0.173255 }},
-		{{ -0.090306, 3.141450, 0.173255 }},
-		{{ -0.089140, 2.659200, -0.265363 }},
-		{{ -0.089140, 2.659200, 0.265363 }},
-		{{ -0.087511, 2.923200, -0.259910 }},
-		{{ -0.087511, 2.923200, 0.259910 }},
-		{{ -0.086273, 2.597400, -0.519028 }},
-		{{ -0.086273, 2.597400, 0.519028 }},
-		{{ -0.083047, 2.804400, -0.159496 }},
-		{{ -0.083047, 2.804400, 0.159496 }},
-		{{ -0.077523, 2.749050, -0.148969 }},
-		{{ -0.077523, 2.749050, 0.148969 }},
-		{{ -0.070270, 2.863350, -0.208794 }},
-		{{ -0.070270, 2.863350, 0.208794 }},
-		{{ -0.064188, 2.625600, -0.386161 }},
-		{{ -0.064188, 2.625600, 0.386161 }},
-		{{ -0.063808, 2.700000, -0.189952 }},
-		{{ -0.063808, 2.700000, 0.189952 }},
-		{{ -0.063808, 2.700000, -0.189952 }},
-		{{ -0.063808, 2.700000, 0.189952 }},
-		{{ -0.063708, 0.002175, 0.383274 }},
-		{{ -0.063708, 0.002175, -0.383274 }},
-		{{ -0.062272, 3.141450, -0.184870 }},
-		{{ -0.062272, 3.141450, 0.184870 }},
-		{{ -0.059016, 3.034800, -0.353807 }},
-		{{ -0.059016, 3.034800, 0.353807 }},
-		{{ -0.058988, 3.081150, -0.353610 }},
-		{{ -0.058988, 3.081150, 0.353610 }},
-		{{ -0.057246, 2.804400, -0.170215 }},
-		{{ -0.057246, 2.804400, 0.170215 }},
-		{{ -0.053508, 2.981250, -0.320834 }},
-		{{ -0.053508, 2.981250, 0.320834 }},
-		{{ -0.053428, 2.749050, -0.158995 }},
-		{{ -0.053428, 2.749050, 0.158995 }},
-		{{ -0.050855, 3.117600, -0.304843 }},
-		{{ -0.050855, 3.117600, 0.304843 }},
-		{{ -0.045844, 2.659200, -0.275801 }},
-		{{ -0.045844, 2.659200, 0.275801 }},
-		{{ -0.045032, 2.923200, -0.270092 }},
-		{{ -0.045032, 2.923200, 0.270092 }},
-		{{ -0.036157, 2.863350, -0.216979 }},
-		{{ -0.036157, 2.863350, 0.216979 }},
-		{{ -0.032816, 2.700000, -0.197424 }},
-		{{ -0.032816, 2.700000, 0.197424 }},
-		{{ -0.032816, 2.700000, -0.197424 }},
-		{{ -0.032816, 2.700000, 0.197424 }},
-		{{ -0.032048, 3.141450, -0.192107 }},
-		{{ -0.032048, 3.141450, 0.192107 }},
-		{{ -0.029450, 2.804400, -0.176897 }},
-		{{ -0.029450, 2.804400, 0.176897 }},
-		{{ -0.027480, 2.749050, -0.165245 }},
-		{{ -0.027480, 2.749050, 0.165245 }},
-		{{ -0.000000, 0.260025, 1.608000 }},
-		{{ -0.000000, 1.929525, 1.718250 }},
-		{{ -0.000000, 2.085600, -1.648000 }},
-		{{ -0.000000, 0.656400, -1.948000 }},
-		{{ -0.000000, 0.771675, -1.986000 }},
-		{{ -0.000000, 2.482687, 1.382225 }},
-		{{ -0.000000, 2.700000, -0.200000 }},
-		{{ -0.000000, 0.127575, 1.496475 }},
-		{{ -0.000000, 2.474400, -1.204800 }},
-		{{ -0.000000, 2.749050, -0.167400 }},
-		{{ -0.000000, 0.018225, 0.952425 }},
-		{{ -0.000000, 0.046875, -1.284375 }},
-		{{ -0.000000, 0.064800, 1.382400 }},
-		{{ -0.000000, 0.384375, 1.750000 }},
-		{{ -0.000000, 0.463200, 1.824000 }},
-		{{ -0.000000, 0.553725, -1.892000 }},
-		{{ -0.000000, 1.037175, 1.992750 }},
-		{{ -0.000000, 1.178400, 1.972000 }},
-		{{ -0.000000, 1.323225, -1.939250 }},
-		{{ -0.000000, 1.621875, -1.843750 }},
-		{{ -0.000000, 1.774800, 1.784000 }},
-		{{ -0.000000, 2.400000, -1.300000 }},
-		{{ -0.000000, 2.435437, -1.480325 }},
-		{{ -0.000000, 2.435437, -1.385925 }},
-		{{ -0.000000, 2.463000, -1.459600 }},
-		{{ -0.000000, 2.463000, -1.380400 }},
-		{{ -0.000000, 2.494500, -1.390200 }},
-		{{ -0.000000, 2.502600, -1.100200 }},
-		{{ -0.000000, 2.804400, -0.179200 }},
-		{{ -0.000000, 2.863350, -0.219800 }},
-		{{ -0.000000, 2.572800, -0.673600 }},
-		{{ -0.000000, 0.105600, 1.480800 }},
-		{{ -0.000000, 0.177075, -1.514000 }},
-		{{ -0.000000, 2.494500, -1.419800 }},
-		{{ -0.000000, 2.527200, -0.970400 }},
-		{{ -0.000000, 2.923200, -0.273600 }},
-		{{ -0.000000, 3.117600, -0.308800 }},
-		{{ -0.000000, 2.597400, -0.525800 }},
-		{{ -0.000000, 2.700000, -0.200000 }},
-		{{ -0.000000, 2.981250, -0.325000 }},
-		{{ -0.000000, 3.141450, -0.194600 }},
-		{{ -0.000000, 0.002175, 0.388275 }},
-		{{ -0.000000, 3.081150, -0.358200 }},
-		{{ 0.000000, 0.000000, 0.000000 }},
-		{{ 0.000000, 0.002175, -0.388275 }},
-		{{ 0.000000, 0.002175, 0.388275 }},
-		{{ 0.000000, 0.008400, -0.703200 }},
-		{{ 0.000000, 0.008400, 0.703200 }},
-		{{ 0.000000, 0.018225, -0.952425 }},
-		{{ 0.000000, 0.018225, 0.952425 }},
-		{{ 0.000000, 0.031200, -1.143600 }},
-		{{ 0.000000, 0.031200, -1.143600 }},
-		{{ 0.000000, 0.031200, 1.143600 }},
-		{{ 0.000000, 0.031200, 1.143600 }},
-		{{ 0.000000, 0.046875, -1.284375 }},
-		{{ 0.000000, 0.046875, 1.284375 }},
-		{{ 0.000000, 0.064800, -1.382400 }},
-		{{ 0.000000, 0.064800, 1.382400 }},
-		{{ 0.000000, 0.084525, -1.445325 }},
-		{{ 0.000000, 0.084525, -1.445325 }},
-		{{ 0.000000, 0.084525, 1.445325 }},
-		{{ 0.000000, 0.084525, 1.445325 }},
-		{{ 0.000000, 0.105600, -1.480800 }},
-		{{ 0.000000, 0.105600, 1.480800 }},
-		{{ 0.000000, 0.127575, -1.496475 }},
-		{{ 0.000000, 0.127575, 1.496475 }},
-		{{ 0.000000, 0.150000, -1.500000 }},
-		{{ 0.000000, 0.150000, -1.500000 }},
-		{{ 0.000000, 0.150000, 1.500000 }},
-		{{ 0.000000, 0.150000, 1.500000 }},
-		{{ 0.000000, 0.177075, -1.514000 }},
-		{{ 0.000000, 0.177075, 1.514000 }},
-		{{ 0.000000, 0.213600, -1.552000 }},
-		{{ 0.000000, 0.213600, -1.552000 }},
-		{{ 0.000000, 0.213600, 1.552000 }},
-		{{ 0.000000, 0.213600, 1.552000 }},
-		{{ 0.000000, 0.260025, -1.608000 }},
-		{{ 0.000000, 0.260025, 1.608000 }},
-		{{ 0.000000, 0.316800, -1.676000 }},
-		{{ 0.000000, 0.316800, -1.676000 }},
-		{{ 0.000000, 0.316800, 1.676000 }},
-		{{ 0.000000, 0.316800, 1.676000 }},
-		{{ 0.000000, 0.384375, -1.750000 }},
-		{{ 0.000000, 0.384375, 1.750000 }},
-		{{ 0.000000, 0.463200, -1.824000 }},
-		{{ 0.000000, 0.463200, 1.824000 }},
-		{{ 0.000000, 0.553725, -1.892000 }},
-		{{ 0.000000, 0.553725, 1.892000 }},
-		{{ 0.000000, 0.656400, -1.948000 }},
-		{{ 0.000000, 0.656400, 1.948000 }},
-		{{ 0.000000, 0.771675, -1.986000 }},
-		{{ 0.000000, 0.771675, 1.986000 }},
-		{{ 0.000000, 0.900000, -2.000000 }},
-		{{ 0.000000, 0.900000, -2.000000 }},
-		{{ 0.000000, 0.900000, 2.000000 }},
-		{{ 0.000000, 0.900000, 2.000000 }},
-		{{ 0.000000, 1.037175, -1.992750 }},
-		{{ 0.000000, 1.037175, 1.992750 }},
-		{{ 0.000000, 1.178400, -1.972000 }},
-		{{ 0.000000, 1.178400, 1.972000 }},
-		{{ 0.000000, 1.323225, -1.939250 }},
-		{{ 0.000000, 1.323225, 1.939250 }},
-		{{ 0.000000, 1.471200, -1.896000 }},
-		{{ 0.000000, 1.471200, -1.896000 }},
-		{{ 0.000000, 1.471200, 1.896000 }},
-		{{ 0.000000, 1.471200, 1.896000 }},
-		{{ 0.000000, 1.621875, -1.843750 }},
-		{{ 0.000000, 1.621875, 1.843750 }},
-		{{ 0.000000, 1.774800, -1.784000 }},
-		{{ 0.000000, 1.774800, 1.784000 }},
-		{{ 0.000000, 1.929525, -1.718250 }},
-		{{ 0.000000, 1.929525, 1.718250 }},
-		{{ 0.000000, 2.085600, -1.648000 }},
-		{{ 0.000000, 2.085600, 1.648000 }},
-		{{ 0.000000, 2.242575, -1.574750 }},
-		{{ 0.000000, 2.242575, -1.574750 }},
-		{{ 0.000000, 2.242575, 1.574750 }},
-		{{ 0.000000, 2.242575, 1.574750 }},
-		{{ 0.000000, 2.400000, -1.500000 }},
-		{{ 0.000000, 2.400000, -1.500000 }},
-		{{ 0.000000, 2.400000, -1.400000 }},
-		{{ 0.000000, 2.400000, -1.400000 }},
-		{{ 0.000000, 2.400000, -1.300000 }},
-		{{ 0.000000, 2.400000, 1.300000 }},
-		{{ 0.000000, 2.400000, 1.400000 }},
-		{{ 0.000000, 2.400000, 1.400000 }},
-		{{ 0.000000, 2.400000, 1.500000 }},
-		{{ 0.000000, 2.400000, 1.500000 }},
-		{{ 0.000000, 2.435437, -1.480325 }},
-		{{ 0.000000, 2.435437, -1.385925 }},
-		{{ 0.000000, 2.435437, 1.385925 }},
-		{{ 0.000000, 2.435437, 1.480325 }},
-		{{ 0.000000, 2.440800, -1.274600 }},
-		{{ 0.000000, 2.440800, -1.274600 }},
-		{{ 0.000000, 2.440800, 1.274600 }},
-		{{ 0.000000, 2.440800, 1.274600 }},
-		{{ 0.000000, 2.463000, -1.459600 }},
-		{{ 0.000000, 2.463000, -1.380400 }},
-		{{ 0.000000, 2.463000, 1.380400 }},
-		{{ 0.000000, 2.463000, 1.459600 }},
-		{{ 0.000000, 2.474400, -1.204800 }},
-		{{ 0.000000, 2.474400, 1.204800 }},
-		{{ 0.000000, 2.482687, -1.439025 }},
-		{{ 0.000000, 2.482687, -1.382225 }},
-		{{ 0.000000, 2.482687, 1.382225 }},
-		{{ 0.000000, 2.482687, 1.439025 }},
-		{{ 0.000000, 2.494500, -1.419800 }},
-		{{ 0.000000, 2.494500, -1.390200 }},
-		{{ 0.000000, 2.494500, 1.390200 }},
-		{{ 0.000000, 2.494500, 1.419800 }},
-		{{ 0.000000, 2.498438, -1.403125 }},
-		{{ 0.000000, 2.498438, -1.403125 }},
-		{{ 0.000000, 2.498438, 1.403125 }},
-		{{ 0.000000, 2.498438, 1.403125 }},
-		{{ 0.000000, 2.502600, -1.100200 }},
-		{{ 0.000000, 2.502600, 1.100200 }},
-		{{ 0.000000, 2.527200, -0.970400 }},
-		{{ 0.000000, 2.527200, 0.970400 }},
-		{{ 0.000000, 2.550000, -0.825000 }},
-		{{ 0.000000, 2.550000, -0.825000 }},
-		{{ 0.000000, 2.550000, 0.825000 }},
-		{{ 0.000000, 2.550000, 0.825000 }},
-		{{ 0.000000, 2.572800, -0.673600 }},
-		{{ 0.000000, 2.572800, 0.673600 }},
-		{{ 0.000000, 2.597400, -0.525800 }},
-		{{ 0.000000, 2.597400, 0.525800 }},
-		{{ 0.000000, 2.625600, -0.391200 }},
-		{{ 0.000000, 2.625600, -0.391200 }},
-		{{ 0.000000, 2.625600, 0.391200 }},
-		{{ 0.000000, 2.625600, 0.391200 }},
-		{{ 0.000000, 2.659200, -0.279400 }},
-		{{ 0.000000, 2.659200, 0.279400 }},
-		{{ 0.000000, 2.700000, -0.200000 }},
-		{{ 0.000000, 2.700000, -0.200000 }},
-		{{ 0.000000, 2.700000, 0.200000 }},
-		{{ 0.000000, 2.700000, 0.200000 }},
-		{{ 0.000000, 2.749050, -0.167400 }},
-		{{ 0.000000, 2.749050, 0.167400 }},
-		{{ 0.000000, 2.804400, -0.179200 }},
-		{{ 0.000000, 2.804400, 0.179200 }},
-		{{ 0.000000, 2.863350, -0.219800 }},
-		{{ 0.000000, 2.863350, 0.219800 }},
-		{{ 0.000000, 2.923200, -0.273600 }},
-		{{ 0.000000, 2.923200, 0.273600 }},
-		{{ 0.000000, 2.981250, -0.325000 }},
-		{{ 0.000000, 2.981250, 0.325000 }},
-		{{ 0.000000, 3.034800, -0.358400 }},
-		{{ 0.000000, 3.034800, -0.358400 }},
-		{{ 0.000000, 3.034800, 0.358400 }},
-		{{ 0.000000, 3.034800, 0.358400 }},
-		{{ 0.000000, 3.081150, -0.358200 }},
-		{{ 0.000000, 3.081150, 0.358200 }},
-		{{ 0.000000, 3.117600, -0.308800 }},
-		{{ 0.000000, 3.117600, 0.308800 }},
-		{{ 0.000000, 3.141450, -0.194600 }},
-		{{ 0.000000, 3.141450, 0.194600 }},
-		{{ 0.000000, 3.150000, 0.000000 }},
-		{{ 0.000000, 0.002175, -0.388275 }},
-		{{ 0.000000, 3.081150, 0.358200 }},
-		{{ 0.000000, 2.597400, 0.525800 }},
-		{{ 0.000000, 2.700000, 0.200000 }},
-		{{ 0.000000, 2.981250, 0.325000 }},
-		{{ 0.000000, 3.141450, 0.194600 }},
-		{{ 0.000000, 3.117600, 0.308800 }},
-		{{ 0.000000, 0.105600, -1.480800 }},
-		{{ 0.000000, 0.177075, 1.514000 }},
-		{{ 0.000000, 2.494500, 1.419800 }},
-		{{ 0.000000, 2.527200, 0.970400 }},
-		{{ 0.000000, 2.923200, 0.273600 }},
-		{{ 0.000000, 2.572800, 0.673600 }},
-		{{ 0.000000, 2.863350, 0.219800 }},
-		{{ 0.000000, 0.018225, -0.952425 }},
-		{{ 0.000000, 0.046875, 1.284375 }},
-		{{ 0.000000, 0.064800, -1.382400 }},
-		{{ 0.000000, 0.384375, -1.750000 }},
-		{{ 0.000000, 0.463200, -1.824000 }},
-		{{ 0.000000, 0.553725, 1.892000 }},
-		{{ 0.000000, 1.037175, -1.992750 }},
-		{{ 0.000000, 1.178400, -1.972000 }},
-		{{ 0.000000, 1.323225, 1.939250 }},
-		{{ 0.000000, 1.621875, 1.843750 }},
-		{{ 0.000000, 1.774800, -1.784000 }},
-		{{ 0.000000, 2.400000, 1.300000 }},
-		{{ 0.000000, 2.435437, 1.385925 }},
-		{{ 0.000000, 2.435437, 1.480325 }},
-		{{ 0.000000, 2.463000, 1.380400 }},
-		{{ 0.000000, 2.463000, 1.459600 }},
-		{{ 0.000000, 2.494500, 1.390200 }},
-		{{ 0.000000, 2.502600, 1.100200 }},
-		{{ 0.000000, 2.804400, 0.179200 }},
-		{{ 0.000000, 2.749050, 0.167400 }},
-		{{ 0.000000, 0.127575, -1.496475 }},
-		{{ 0.000000, 2.474400, 1.204800 }},
-		{{ 0.000000, 0.656400, 1.948000 }},
-		{{ 0.000000, 0.771675, 1.986000 }},
-		{{ 0.000000, 2.482687, -1.382225 }},
-		{{ 0.000000, 2.700000, 0.200000 }},
-		{{ 0.000000, 0.260025, -1.608000 }},
-		{{ 0.000000, 1.929525, -1.718250 }},
-		{{ 0.000000, 2.085600, 1.648000 }},
-		{{ 0.027480, 2.749050, -0.165245 }},
-		{{ 0.027480, 2.749050, 0.165245 }},
-		{{ 0.029450, 2.804400, -0.176897 }},
-		{{ 0.029450, 2.804400, 0.176897 }},
-		{{ 0.032048, 3.141450, -0.192107 }},
-		{{ 0.032048, 3.141450, 0.192107 }},
-		{{ 0.032816, 2.700000, -0.197424 }},
-		{{ 0.032816, 2.700000, 0.197424 }},
-		{{ 0.032816, 2.700000, -0.197424 }},
-		{{ 0.032816, 2.700000, 0.197424 }},
-		{{ 0.036157, 2.863350, -0.216979 }},
-		{{ 0.036157, 2.863350, 0.216979 }},
-		{{ 0.045032, 2.923200, -0.270092 }},
-		{{ 0.045032, 2.923200, 0.270092 }},
-		{{ 0.045844, 2.659200, -0.275801 }},
-		{{ 0.045844, 2.659200, 0.275801 }},
-		{{ 0.050855, 3.117600, -0.304843 }},
-		{{ 0.050855, 3.117600, 0.304843 }},
-		{{ 0.053428, 2.749050, -0.158995 }},
-		{{ 0.053428, 2.749050, 0.158995 }},
-		{{ 0.053508, 2.981250, -0.320834 }},
-		{{ 0.053508, 2.981250, 0.320834 }},
-		{{ 0.057246, 2.804400, -0.170215 }},
-		{{ 0.057246, 2.804400, 0.170215 }},
-		{{ 0.058988, 3.081150, -0.353610 }},
-		{{ 0.058988, 3.081150, 0.353610 }},
-		{{ 0.059016, 3.034800, -0.353807 }},
-		{{ 0.059016, 3.034800, 0.353807 }},
-		{{ 0.062272, 3.141450, -0.184870 }},
-		{{ 0.062272, 3.141450, 0.184870 }},
-		{{ 0.063708, 0.002175, 0.383274 }},
-		{{ 0.063708, 0.002175, -0.383274 }},
-		{{ 0.063808, 2.700000, -0.189952 }},
-		{{ 0.063808, 2.700000, 0.189952 }},
-		{{ 0.063808, 2.700000, -0.189952 }},
-		{{ 0.063808, 2.700000, 0.189952 }},
-		{{ 0.064188, 2.625600, -0.386161 }},
-		{{ 0.064188, 2.625600, 0.386161 }},
-		{{ 0.070270, 2.863350, -0.208794 }},
-		{{ 0.070270, 2.863350, 0.208794 }},
-		{{ 0.077523, 2.749050, -0.148969 }},
-		{{ 0.077523, 2.749050, 0.148969 }},
-		{{ 0.083047, 2.804400, -0.159496 }},
-		{{ 0.083047, 2.804400, 0.159496 }},
-		{{ 0.086273, 2.597400, -0.519028 }},
-		{{ 0.086273, 2.597400, 0.519028 }},
-		{{ 0.087511, 2.923200, -0.259910 }},
-		{{ 0.087511, 2.923200, 0.259910 }},
-		{{ 0.089140, 2.659200, -0.265363 }},
-		{{ 0.089140, 2.659200, 0.265363 }},
-		{{ 0.090306, 3.141450, -0.173255 }},
-		{{ 0.090306, 3.141450, 0.173255 }},
-		{{ 0.092592, 2.700000, -0.177968 }},
-		{{ 0.092592, 2.700000, 0.177968 }},
-		{{ 0.092592, 2.700000, -0.177968 }},
-		{{ 0.092592, 2.700000, 0.177968 }},
-		{{ 0.098814, 3.117600, -0.293360 }},
-		{{ 0.098814, 3.117600, 0.293360 }},
-		{{ 0.099446, 2.749050, 0.135489 }},
-		{{ 0.099446, 2.749050, -0.135489 }},
-		{{ 0.101925, 2.863350, -0.195658 }},
-		{{ 0.101925, 2.863350, 0.195658 }},
-		{{ 0.103976, 2.981250, -0.308744 }},
-		{{ 0.103976, 2.981250, 0.308744 }},
-		{{ 0.106513, 2.804400, -0.145078 }},
-		{{ 0.106513, 2.804400, 0.145078 }},
-		{{ 0.110524, 2.572800, -0.664924 }},
-		{{ 0.110524, 2.572800, 0.664924 }},
-		{{ 0.114619, 3.081150, -0.340289 }},
-		{{ 0.114619, 3.081150, 0.340289 }},
-		{{ 0.114676, 3.034800, -0.340477 }},
-		{{ 0.114676, 3.034800, 0.340477 }},
-		{{ 0.115381, 0.008400, 0.694143 }},
-		{{ 0.115381, 0.008400, -0.694143 }},
-		{{ 0.115787, 3.141450, -0.157626 }},
-		{{ 0.115787, 3.141450, 0.157626 }},
-		{{ 0.118784, 2.700000, 0.161856 }},
-		{{ 0.118784, 2.700000, -0.161856 }},
-		{{ 0.118784, 2.700000, -0.161856 }},
-		{{ 0.118784, 2.700000, 0.161856 }},
-		{{ 0.118874, 2.749050, 0.118874 }},
-		{{ 0.118874, 2.749050, -0.118874 }},
-		{{ 0.123875, 0.002175, 0.368768 }},
-		{{ 0.123875, 0.002175, -0.368768 }},
-		{{ 0.124808, 2.625600, -0.371546 }},
-		{{ 0.124808, 2.625600, 0.371546 }},
-		{{ 0.126920, 2.923200, -0.243569 }},
-		{{ 0.126920, 2.923200, 0.243569 }},
-		{{ 0.127304, 2.804400, 0.127304 }},
-		{{ 0.127304, 2.804400, -0.127304 }},
-		{{ 0.129351, 2.659200, 0.248621 }},
-		{{ 0.129351, 2.659200, -0.248621 }},
-		{{ 0.130707, 2.863350, -0.177989 }},
-		{{ 0.130707, 2.863350, 0.177989 }},
-		{{ 0.135366, 2.550000, -0.814374 }},
-		{{ 0.135366, 2.550000, 0.814374 }},
-		{{ 0.135489, 2.749050, 0.099446 }},
-		{{ 0.135489, 2.749050, -0.099446 }},
-		{{ 0.138348, 3.141450, -0.138348 }},
-		{{ 0.138348, 3.141450, 0.138348 }},
-		{{ 0.142000, 2.700000, 0.142000 }},
-		{{ 0.142000, 2.700000, -0.142000 }},
-		{{ 0.142000, 2.700000, -0.142000 }},
-		{{ 0.142000, 2.700000, 0.142000 }},
-		{{ 0.143301, 3.117600, -0.274928 }},
-		{{ 0.143301, 3.117600, 0.274928 }},
-		{{ 0.145078, 2.804400, 0.106513 }},
-		{{ 0.145078, 2.804400, -0.106513 }},
-		{{ 0.148969, 2.749050, 0.077523 }},
-		{{ 0.148969, 2.749050, -0.077523 }},
-		{{ 0.150793, 2.981250, -0.289340 }},
-		{{ 0.150793, 2.981250, 0.289340 }},
-		{{ 0.156200, 2.863350, -0.156200 }},
-		{{ 0.156200, 2.863350, 0.156200 }},
-		{{ 0.156274, 0.018225, 0.940158 }},
-		{{ 0.156274, 0.018225, -0.940158 }},
-		{{ 0.157626, 3.141450, -0.115787 }},
-		{{ 0.157626, 3.141450, 0.115787 }},
-		{{ 0.158995, 2.749050, 0.053428 }},
-		{{ 0.158995, 2.749050, -0.053428 }},
-		{{ 0.159223, 2.527200, -0.957901 }},
-		{{ 0.159223, 2.527200, 0.957901 }},
-		{{ 0.159496, 2.804400, 0.083047 }},
-		{{ 0.159496, 2.804400, -0.083047 }},
-		{{ 0.161856, 2.700000, 0.118784 }},
-		{{ 0.161856, 2.700000, -0.118784 }},
-		{{ 0.161856, 2.700000, -0.118784 }},
-		{{ 0.161856, 2.700000, 0.118784 }},
-		{{ 0.162745, 2.923200, -0.221585 }},
-		{{ 0.162745, 2.923200, 0.221585 }},
-		{{ 0.165245, 2.749050, 0.027480 }},
-		{{ 0.165245, 2.749050, -0.027480 }},
-		{{ 0.165941, 2.659200, -0.226113 }},
-		{{ 0.165941, 2.659200, 0.226113 }},
-		{{ 0.166221, 3.081150, 0.318907 }},
-		{{ 0.166221, 3.081150, -0.318907 }},
-		{{ 0.166306, 3.034800, -0.319082 }},
-		{{ 0.166306, 3.034800, 0.319082 }},
-		{{ 0.167400, 2.749050, -0.000000 }},
-		{{ 0.167400, 2.749050, 0.000000 }},
-		{{ 0.167751, 2.597400, -0.499384 }},
-		{{ 0.167751, 2.597400, 0.499384 }},
-		{{ 0.170215, 2.804400, 0.057246 }},
-		{{ 0.170215, 2.804400, -0.057246 }},
-		{{ 0.173255, 3.141450, -0.090306 }},
-		{{ 0.173255, 3.141450, 0.090306 }},
-		{{ 0.176897, 2.804400, 0.029450 }},
-		{{ 0.176897, 2.804400, -0.029450 }},
-		{{ 0.177968, 2.700000, 0.092592 }},
-		{{ 0.177968, 2.700000, -0.092592 }},
-		{{ 0.177968, 2.700000, -0.092592 }},
-		{{ 0.177968, 2.700000, 0.092592 }},
-		{{ 0.177989, 2.863350, -0.130707 }},
-		{{ 0.177989, 2.863350, 0.130707 }},
-		{{ 0.179200, 2.804400, -0.000000 }},
-		{{ 0.179200, 2.804400, 0.000000 }},
-		{{ 0.179756, 0.002175, -0.345503 }},
-		{{ 0.179756, 0.002175, 0.345503 }},
-		{{ 0.180521, 2.502600, -1.086029 }},
-		{{ 0.180521, 2.502600, 1.086029 }},
-		{{ 0.181110, 2.625600, 0.348105 }},
-		{{ 0.181110, 2.625600, -0.348105 }},
-		{{ 0.183734, 3.117600, -0.250127 }},
-		{{ 0.183734, 3.117600, 0.250127 }},
-		{{ 0.184870, 3.141450, -0.062272 }},
-		{{ 0.184870, 3.141450, 0.062272 }},
-		{{ 0.187642, 0.031200, 1.128870 }},
-		{{ 0.187642, 0.031200, -1.128870 }},
-		{{ 0.189952, 2.700000, 0.063808 }},
-		{{ 0.189952, 2.700000, -0.063808 }},
-		{{ 0.189952, 2.700000, -0.063808 }},
-		{{ 0.189952, 2.700000, 0.063808 }},
-		{{ 0.192107, 3.141450, -0.032048 }},
-		{{ 0.192107, 3.141450, 0.032048 }},
-		{{ 0.193348, 2.981250, -0.263232 }},
-		{{ 0.193348, 2.981250, 0.263232 }},
-		{{ 0.194472, 2.923200, -0.194472 }},
-		{{ 0.194472, 2.923200, 0.194472 }},
-		{{ 0.194600, 3.141450, 0.000000 }},
-		{{ 0.194600, 3.141450, -0.000000 }},
-		{{ 0.195658, 2.863350, -0.101925 }},
-		{{ 0.195658, 2.863350, 0.101925 }},
-		{{ 0.197424, 2.700000, 0.032816 }},
-		{{ 0.197424, 2.700000, -0.032816 }},
-		{{ 0.197424, 2.700000, -0.032816 }},
-		{{ 0.197424, 2.700000, 0.032816 }},
-		{{ 0.197684, 2.474400, -1.189282 }},
-		{{ 0.197684, 2.474400, 1.189282 }},
-		{{ 0.198374, 2.659200, -0.198374 }},
-		{{ 0.198374, 2.659200, 0.198374 }},
-		{{ 0.200000, 2.700000, -0.000000 }},
-		{{ 0.200000, 2.700000, 0.000000 }},
-		{{ 0.200000, 2.700000, 0.000000 }},
-		{{ 0.200000, 2.700000, -0.000000 }},
-		{{ 0.208794, 2.863350, 0.070270 }},
-		{{ 0.208794, 2.863350, -0.070270 }},
-		{{ 0.209136, 2.440800, -1.258183 }},
-		{{ 0.209136, 2.440800, 1.258183 }},
-		{{ 0.210740, 0.046875, -1.267832 }},
-		{{ 0.210740, 0.046875, 1.267832 }},
-		{{ 0.213123, 3.081150, -0.290138 }},
-		{{ 0.213123, 3.081150, 0.290138 }},
-		{{ 0.213234, 3.034800, -0.290295 }},
-		{{ 0.213234, 3.034800, 0.290295 }},
-		{{ 0.213304, 2.400000, -1.283256 }},
-		{{ 0.213304, 2.400000, 1.283256 }},
-		{{ 0.214905, 2.572800, -0.639758 }},
-		{{ 0.214905, 2.572800, 0.639758 }},
-		{{ 0.216979, 2.863350, 0.036157 }},
-		{{ 0.216979, 2.863350, -0.036157 }},
-		{{ 0.219536, 3.117600, -0.219536 }},
-		{{ 0.219536, 3.117600, 0.219536 }},
-		{{ 0.219800, 2.863350, -0.000000 }},
-		{{ 0.219800, 2.863350, 0.000000 }},
-		{{ 0.221585, 2.923200, -0.162745 }},
-		{{ 0.221585, 2.923200, 0.162745 }},
-		{{ 0.224349, 0.008400, 0.667871 }},
-		{{ 0.224349, 0.008400, -0.667871 }},
-		{{ 0.226113, 2.659200, -0.165941 }},
-		{{ 0.226113, 2.659200, 0.165941 }},
-		{{ 0.226496, 2.463000, -1.362620 }},
-		{{ 0.226496, 2.463000, 1.362620 }},
-		{{ 0.226795, 2.482687, 1.364422 }},
-		{{ 0.226795, 2.482687, -1.364422 }},
-		{{ 0.226824, 0.064800, 1.364595 }},
-		{{ 0.226824, 0.064800, -1.364595 }},
-		{{ 0.227403, 2.435437, -1.368074 }},
-		{{ 0.227403, 2.435437, 1.368074 }},
-		{{ 0.228104, 2.494500, -1.372294 }},
-		{{ 0.228104, 2.494500, 1.372294 }},
-		{{ 0.229712, 2.400000, -1.381968 }},
-		{{ 0.229712, 2.400000, 1.381968 }},
-		{{ 0.230225, 2.498438, -1.385053 }},
-		{{ 0.230225, 2.498438, 1.385053 }},
-		{{ 0.230604, 0.002175, -0.314223 }},
-		{{ 0.230604, 0.002175, 0.314223 }},
-		{{ 0.231031, 2.981250, -0.231031 }},
-		{{ 0.231031, 2.981250, 0.231031 }},
-		{{ 0.232342, 2.625600, -0.316590 }},
-		{{ 0.232342, 2.625600, 0.316590 }},
-		{{ 0.232961, 2.494500, -1.401513 }},
-		{{ 0.232961, 2.494500, 1.401513 }},
-		{{ 0.236115, 2.482687, -1.420490 }},
-		{{ 0.236115, 2.482687, 1.420490 }},
-		{{ 0.237149, 0.084525, 1.426709 }},
-		{{ 0.237149, 0.084525, -1.426709 }},
-		{{ 0.239491, 2.463000, -1.440800 }},
-		{{ 0.239491, 2.463000, 1.440800 }},
-		{{ 0.242892, 2.435437, -1.461258 }},
-		{{ 0.242892, 2.435437, 1.461258 }},
-		{{ 0.242970, 0.105600, 1.461727 }},
-		{{ 0.242970, 0.105600, -1.461727 }},
-		{{ 0.243424, 2.597400, 0.467878 }},
-		{{ 0.243424, 2.597400, -0.467878 }},
-		{{ 0.243569, 2.923200, -0.126920 }},
-		{{ 0.243569, 2.923200, 0.126920 }},
-		{{ 0.245542, 0.127575, 1.477200 }},
-		{{ 0.245542, 0.127575, -1.477200 }},
-		{{ 0.246120, 0.150000, -1.480680 }},
-		{{ 0.246120, 2.400000, -1.480680 }},
-		{{ 0.246120, 0.150000, 1.480680 }},
-		{{ 0.246120, 0.150000, 1.480680 }},
-		{{ 0.246120, 2.400000, 1.480680 }},
-		{{ 0.246120, 0.150000, -1.480680 }},
-		{{ 0.248417, 0.177075, -1.494500 }},
-		{{ 0.248417, 0.177075, 1.494500 }},
-		{{ 0.248621, 2.659200, 0.129351 }},
-		{{ 0.248621, 2.659200, -0.129351 }},
-		{{ 0.250127, 3.117600, -0.183734 }},
-		{{ 0.250127, 3.117600, 0.183734 }},
-		{{ 0.254652, 0.213600, -1.532010 }},
-		{{ 0.254652, 0.213600, 1.532010 }},
-		{{ 0.254653, 3.081150, -0.254653 }},
-		{{ 0.254653, 3.081150, 0.254653 }},
-		{{ 0.254788, 3.034800, -0.254788 }},
-		{{ 0.254788, 3.034800, 0.254788 }},
-		{{ 0.258385, 2.242575, -1.554467 }},
-		{{ 0.258385, 2.242575, 1.554467 }},
-		{{ 0.259910, 2.923200, -0.087511 }},
-		{{ 0.259910, 2.923200, 0.087511 }},
-		{{ 0.263208, 2.550000, -0.783552 }},
-		{{ 0.263208, 2.550000, 0.783552 }},
-		{{ 0.263232, 2.981250, -0.193348 }},
-		{{ 0.263232, 2.981250, 0.193348 }},
-		{{ 0.263841, 0.260025, 1.587289 }},
-		{{ 0.263841, 0.260025, -1.587289 }},
-		{{ 0.265363, 2.659200, -0.089140 }},
-		{{ 0.265363, 2.659200, 0.089140 }},
-		{{ 0.270092, 2.923200, -0.045032 }},
-		{{ 0.270092, 2.923200, 0.045032 }},
-		{{ 0.270404, 2.085600, -1.626774 }},
-		{{ 0.270404, 2.085600, 1.626774 }},
-		{{ 0.273600, 2.923200, -0.000000 }},
-		{{ 0.273600, 2.923200, 0.000000 }},
-		{{ 0.274928, 3.117600, -0.143301 }},
-		{{ 0.274928, 3.117600, 0.143301 }},
-		{{ 0.274998, 0.316800, -1.654413 }},
-		{{ 0.274998, 0.316800, 1.654413 }},
-		{{ 0.275675, 0.002175, -0.275675 }},
-		{{ 0.275675, 0.002175, 0.275675 }},
-		{{ 0.275801, 2.659200, -0.045844 }},
-		{{ 0.275801, 2.659200, 0.045844 }},
-		{{ 0.277752, 2.625600, -0.277752 }},
-		{{ 0.277752, 2.625600, 0.277752 }},
-		{{ 0.279400, 2.659200, 0.000000 }},
-		{{ 0.281930, 1.929525, 1.696119 }},
-		{{ 0.281930, 1.929525, -1.696119 }},
-		{{ 0.287140, 0.384375, -1.727460 }},
-		{{ 0.287140, 0.384375, 1.727460 }},
-		{{ 0.289340, 2.981250, -0.150793 }},
-		{{ 0.289340, 2.981250, 0.150793 }},
-		{{ 0.290138, 3.081150, -0.213123 }},
-		{{ 0.290138, 3.081150, 0.213123 }},
-		{{ 0.290295, 3.034800, -0.213234 }},
-		{{ 0.290295, 3.034800, 0.213234 }},
-		{{ 0.292719, 1.774800, -1.761022 }},
-		{{ 0.292719, 1.774800, 1.761022 }},
-		{{ 0.293360, 3.117600, -0.098814 }},
-		{{ 0.293360, 3.117600, 0.098814 }},
-		{{ 0.299282, 0.463200, -1.800507 }},
-		{{ 0.299282, 0.463200, 1.800507 }},
-		{{ 0.302522, 1.621875, -1.820003 }},
-		{{ 0.302523, 1.621875, 1.820003 }},
-		{{ 0.303862, 0.018225, 0.904575 }},
-		{{ 0.303862, 0.018225, -0.904575 }},
-		{{ 0.304843, 3.117600, -0.050855 }},
-		{{ 0.304843, 3.117600, 0.050855 }},
-		{{ 0.308744, 2.981250, -0.103976 }},
-		{{ 0.308744, 2.981250, 0.103976 }},
-		{{ 0.308800, 3.117600, 0.000000 }},
-		{{ 0.308800, 3.117600, -0.000000 }},
-		{{ 0.309596, 2.527200, -0.921647 }},
-		{{ 0.309596, 2.527200, 0.921647 }},
-		{{ 0.310439, 0.553725, -1.867631 }},
-		{{ 0.310439, 0.553725, 1.867631 }},
-		{{ 0.311096, 1.471200, -1.871580 }},
-		{{ 0.311096, 1.471200, 1.871580 }},
-		{{ 0.311850, 2.572800, -0.599396 }},
-		{{ 0.311850, 2.572800, 0.599396 }},
-		{{ 0.312283, 2.597400, -0.425519 }},
-		{{ 0.312283, 2.597400, 0.425519 }},
-		{{ 0.314223, 0.002175, -0.230604 }},
-		{{ 0.314223, 0.002175, 0.230604 }},
-		{{ 0.316590, 2.625600, -0.232342 }},
-		{{ 0.316590, 2.625600, 0.232342 }},
-		{{ 0.318192, 1.323225, -1.914272 }},
-		{{ 0.318192, 1.323225, 1.914272 }},
-		{{ 0.318907, 3.081150, -0.166221 }},
-		{{ 0.318907, 3.081150, 0.166221 }},
-		{{ 0.319082, 3.034800, -0.166306 }},
-		{{ 0.319082, 3.034800, 0.166306 }},
-		{{ 0.319628, 0.656400, -1.922910 }},
-		{{ 0.319628, 0.656400, 1.922910 }},
-		{{ 0.320834, 2.981250, -0.053508 }},
-		{{ 0.320834, 2.981250, 0.053508 }},
-		{{ 0.323566, 1.178400, -1.946601 }},
-		{{ 0.323566, 1.178400, 1.946601 }},
-		{{ 0.325000, 2.981250, 0.000000 }},
-		{{ 0.325000, 2.981250, -0.000000 }},
-		{{ 0.325553, 0.008400, -0.625735 }},
-		{{ 0.325553, 0.008400, 0.625735 }},
-		{{ 0.325863, 0.771675, -1.960420 }},
-		{{ 0.325863, 0.771675, 1.960420 }},
-		{{ 0.326970, 1.037175, -1.967083 }},
-		{{ 0.326970, 1.037175, 1.967083 }},
-		{{ 0.328160, 0.900000, -1.974240 }},
-		{{ 0.328160, 0.900000, -1.974240 }},
-		{{ 0.328160, 0.900000, 1.974240 }},
-		{{ 0.340289, 3.081150, -0.114619 }},
-		{{ 0.340289, 3.081150, 0.114619 }},
-		{{ 0.340477, 3.034800, -0.114676 }},
-		{{ 0.340477, 3.034800, 0.114676 }},
-		{{ 0.345503, 0.002175, -0.179756 }},
-		{{ 0.345503, 0.002175, 0.179756 }},
-		{{ 0.348105, 2.625600, -0.181110 }},
-		{{ 0.348105, 2.625600, 0.181110 }},
-		{{ 0.351008, 2.502600, -1.044926 }},
-		{{ 0.351008, 2.502600, 1.044926 }},
-		{{ 0.353610, 3.081150, -0.058988 }},
-		{{ 0.353610, 3.081150, 0.058988 }},
-		{{ 0.353807, 3.034800, -0.059016 }},
-		{{ 0.353807, 3.034800, 0.059016 }},
-		{{ 0.358200, 3.081150, -0.000000 }},
-		{{ 0.358200, 3.081150, 0.000000 }},
-		{{ 0.358400, 3.034800, 0.000000 }},
-		{{ 0.358400, 3.034800, 0.000000 }},
-		{{ 0.364854, 0.031200, 1.086146 }},
-		{{ 0.364854, 0.031200, -1.086146 }},
-		{{ 0.368768, 0.002175, -0.123875 }},
-		{{ 0.368768, 0.002175, 0.123875 }},
-		{{ 0.371546, 2.625600, -0.124808 }},
-		{{ 0.371546, 2.625600, 0.124808 }},
-		{{ 0.373318, 2.597400, -0.373318 }},
-		{{ 0.373318, 2.597400, 0.373318 }},
-		{{ 0.381942, 2.550000, -0.734118 }},
-		{{ 0.381942, 2.550000, 0.734118 }},
-		{{ 0.383274, 0.002175, -0.063708 }},
-		{{ 0.383274, 0.002175, 0.063708 }},
-		{{ 0.384379, 2.474400, -1.144271 }},
-		{{ 0.384379, 2.474400, 1.144271 }},
-		{{ 0.386161, 2.625600, -0.064188 }},
-		{{ 0.386161, 2.625600, 0.064188 }},
-		{{ 0.388275, 0.002175, 0.000000 }},
-		{{ 0.388275, 0.002175, 0.000000 }},
-		{{ 0.391200, 2.625600, 0.000000 }},
-		{{ 0.391200, 2.625600, 0.000000 }},
-		{{ 0.400065, 2.572800, -0.545131 }},
-		{{ 0.400065, 2.572800, 0.545131 }},
-		{{ 0.406648, 2.440800, -1.210564 }},
-		{{ 0.406648, 2.440800, 1.210564 }},
-		{{ 0.409767, 0.046875, 1.219848 }},
-		{{ 0.409767, 0.046875, -1.219848 }},
-		{{ 0.414752, 2.400000, -1.234688 }},
-		{{ 0.414752, 2.400000, 1.234688 }},
-		{{ 0.417645, 0.008400, -0.569086 }},
-		{{ 0.417645, 0.008400, 0.569086 }},
-		{{ 0.425519, 2.597400, 0.312283 }},
-		{{ 0.425519, 2.597400, -0.312283 }},
-		{{ 0.440403, 2.463000, -1.311049 }},
-		{{ 0.440403, 2.463000, 1.311049 }},
-		{{ 0.440935, 0.018225, 0.847506 }},
-		{{ 0.440935, 0.018225, -0.847506 }},
-		{{ 0.440985, 2.482687, -1.312782 }},
-		{{ 0.440985, 2.482687, 1.312782 }},
-		{{ 0.441041, 0.064800, 1.312948 }},
-		{{ 0.441041, 0.064800, -1.312948 }},
-		{{ 0.442166, 2.435437, -1.316296 }},
-		{{ 0.442166, 2.435437, 1.316296 }},
-		{{ 0.443529, 2.494500, -1.320356 }},
-		{{ 0.443529, 2.494500, 1.320356 }},
-		{{ 0.446656, 2.400000, -1.329664 }},
-		{{ 0.446656, 2.400000, 1.329664 }},
-		{{ 0.447653, 2.498438, -1.332632 }},
-		{{ 0.447653, 2.498438, 1.332632 }},
-		{{ 0.449256, 2.527200, -0.863501 }},
-		{{ 0.449256, 2.527200, 0.863501 }},
-		{{ 0.452973, 2.494500, -1.348469 }},
-		{{ 0.452973, 2.494500, 1.348469 }},
-		{{ 0.459107, 2.482687, -1.366728 }},
-		{{ 0.459107, 2.482687, 1.366728 }},
-		{{ 0.461116, 0.084525, 1.372712 }},
-		{{ 0.461116, 0.084525, -1.372712 }},
-		{{ 0.465671, 2.463000, -1.386270 }},
-		{{ 0.465671, 2.463000, 1.386270 }},
-		{{ 0.467878, 2.597400, -0.243424 }},
-		{{ 0.467878, 2.597400, 0.243424 }},
-		{{ 0.472283, 2.435437, -1.405953 }},
-		{{ 0.472283, 2.435437, 1.405953 }},
-		{{ 0.472434, 0.105600, 1.406405 }},
-		{{ 0.472434, 0.105600, -1.406405 }},
-		{{ 0.477435, 0.127575, 1.421292 }},
-		{{ 0.477435, 0.127575, -1.421292 }},
-		{{ 0.478256, 2.572800, -0.478256 }},
-		{{ 0.478256, 2.572800, 0.478256 }},
-		{{ 0.478560, 0.150000, -1.424640 }},
-		{{ 0.478560, 2.400000, -1.424640 }},
-		{{ 0.478560, 0.150000, 1.424640 }},
-		{{ 0.478560, 0.150000, 1.424640 }},
-		{{ 0.478560, 0.150000, -1.424640 }},
-		{{ 0.478560, 2.400000, 1.424640 }},
-		{{ 0.483027, 0.177075, -1.437937 }},
-		{{ 0.483027, 0.177075, 1.437937 }},
-		{{ 0.489984, 2.550000, -0.667656 }},
-		{{ 0.489984, 2.550000, 0.667656 }},
-		{{ 0.495150, 0.213600, -1.474028 }},
-		{{ 0.495150, 0.213600, 1.474028 }},
-		{{ 0.499272, 0.008400, -0.499272 }},
-		{{ 0.499272, 0.008400, 0.499272 }},
-		{{ 0.499384, 2.597400, -0.167751 }},
-		{{ 0.499384, 2.597400, 0.167751 }},
-		{{ 0.502408, 2.242575, -1.495635 }},
-		{{ 0.502408, 2.242575, 1.495635 }},
-		{{ 0.509349, 2.502600, 0.979002 }},
-		{{ 0.509349, 2.502600, -0.979002 }},
-		{{ 0.513016, 0.260025, -1.527214 }},
-		{{ 0.513016, 0.260025, 1.527214 }},
-		{{ 0.519028, 2.597400, 0.086273 }},
-		{{ 0.519028, 2.597400, -0.086273 }},
-		{{ 0.525778, 2.085600, -1.565204 }},
-		{{ 0.525778, 2.085600, 1.565204 }},
-		{{ 0.525800, 2.597400, -0.000000 }},
-		{{ 0.525800, 2.597400, 0.000000 }},
-		{{ 0.529441, 0.031200, -1.017621 }},
-		{{ 0.529441, 0.031200, 1.017621 }},
-		{{ 0.534711, 0.316800, -1.591798 }},
-		{{ 0.534711, 0.316800, 1.591798 }},
-		{{ 0.545131, 2.572800, -0.400065 }},
-		{{ 0.545131, 2.572800, 0.400065 }},
-		{{ 0.548190, 1.929525, -1.631925 }},
-		{{ 0.548190, 1.929525, 1.631925 }},
-		{{ 0.557774, 2.474400, -1.072079 }},
-		{{ 0.557774, 2.474400, 1.072079 }},
-		{{ 0.558320, 0.384375, -1.662080 }},
-		{{ 0.558320, 0.384375, 1.662080 }},
-		{{ 0.565664, 0.018225, 0.770779 }},
-		{{ 0.565664, 0.018225, -0.770779 }},
-		{{ 0.569086, 0.008400, -0.417645 }},
-		{{ 0.569086, 0.008400, 0.417645 }},
-		{{ 0.569167, 1.774800, -1.694372 }},
-		{{ 0.569167, 1.774800, 1.694372 }},
-		{{ 0.576340, 2.527200, -0.785325 }},
-		{{ 0.576340, 2.527200, 0.785325 }},
-		{{ 0.581929, 0.463200, -1.732362 }},
-		{{ 0.581929, 0.463200, 1.732362 }},
-		{{ 0.585750, 2.550000, -0.585750 }},
-		{{ 0.585750, 2.550000, 0.585750 }},
-		{{ 0.588230, 1.621875, -1.751120 }},
-		{{ 0.588230, 1.621875, 1.751120 }},
-		{{ 0.590089, 2.440800, 1.134190 }},
-		{{ 0.590089, 2.440800, -1.134190 }},
-		{{ 0.594614, 0.046875, -1.142888 }},
-		{{ 0.594614, 0.046875, 1.142888 }},
-		{{ 0.599396, 2.572800, -0.311850 }},
-		{{ 0.599396, 2.572800, 0.311850 }},
-		{{ 0.601848, 2.400000, -1.156792 }},
-		{{ 0.601848, 2.400000, 1.156792 }},
-		{{ 0.603624, 0.553725, -1.796946 }},
-		{{ 0.603624, 0.553725, 1.796946 }},
-		{{ 0.604900, 1.471200, -1.800745 }},
-		{{ 0.604900, 1.471200, 1.800745 }},
-		{{ 0.618698, 1.323225, -1.841822 }},
-		{{ 0.618698, 1.323225, 1.841822 }},
-		{{ 0.621490, 0.656400, -1.850132 }},
-		{{ 0.621490, 0.656400, 1.850132 }},
-		{{ 0.625735, 0.008400, 0.325553 }},
-		{{ 0.625735, 0.008400, -0.325553 }},
-		{{ 0.629147, 1.178400, -1.872927 }},
-		{{ 0.629147, 1.178400, 1.872927 }},
-		{{ 0.633613, 0.771675, -1.886223 }},
-		{{ 0.633613, 0.771675, 1.886223 }},
-		{{ 0.635767, 1.037175, -1.892634 }},
-		{{ 0.635767, 1.037175, 1.892634 }},
-		{{ 0.638080, 0.900000, -1.899520 }},
-		{{ 0.638080, 0.900000, -1.899520 }},
-		{{ 0.638080, 0.900000, 1.899520 }},
-		{{ 0.638080, 0.900000, 1.899520 }},
-		{{ 0.639070, 2.463000, -1.228335 }},
-		{{ 0.639070, 2.463000, 1.228335 }},
-		{{ 0.639758, 2.572800, -0.214905 }},
-		{{ 0.639758, 2.572800, 0.214905 }},
-		{{ 0.639915, 2.482687, 1.229959 }},
-		{{ 0.639915, 2.482687, -1.229959 }},
-		{{ 0.639996, 0.064800, -1.230115 }},
-		{{ 0.639996, 0.064800, 1.230115 }},
-		{{ 0.641628, 2.435437, -1.233252 }},
-		{{ 0.641628, 2.435437, 1.233252 }},
-		{{ 0.643607, 2.494500, -1.237056 }},
-		{{ 0.643607, 2.494500, 1.237056 }},
-		{{ 0.648144, 2.400000, -1.245776 }},
-		{{ 0.648144, 2.400000, 1.245776 }},
-		{{ 0.649591, 2.498438, -1.248557 }},
-		{{ 0.649591, 2.498438, 1.248557 }},
-		{{ 0.653431, 2.502600, -0.890370 }},
-		{{ 0.653431, 2.502600, 0.890370 }},
-		{{ 0.657311, 2.494500, -1.263395 }},
-		{{ 0.657311, 2.494500, 1.263395 }},
-		{{ 0.664924, 2.572800, -0.110524 }},
-		{{ 0.664924, 2.572800, 0.110524 }},
-		{{ 0.666211, 2.482687, 1.280502 }},
-		{{ 0.666211, 2.482687, -1.280502 }},
-		{{ 0.667656, 2.550000, -0.489984 }},
-		{{ 0.667656, 2.550000, 0.489984 }},
-		{{ 0.667871, 0.008400, -0.224349 }},
-		{{ 0.667871, 0.008400, 0.224349 }},
-		{{ 0.669128, 0.084525, -1.286108 }},
-		{{ 0.669128, 0.084525, 1.286108 }},
-		{{ 0.673600, 2.572800, 0.000000 }},
-		{{ 0.673600, 2.572800, -0.000000 }},
-		{{ 0.675736, 2.463000, -1.298810 }},
-		{{ 0.675736, 2.463000, 1.298810 }},
-		{{ 0.676222, 0.018225, 0.676222 }},
-		{{ 0.676222, 0.018225, -0.676222 }},
-		{{ 0.679207, 0.031200, -0.925493 }},
-		{{ 0.679207, 0.031200, 0.925493 }},
-		{{ 0.685331, 2.435437, -1.317252 }},
-		{{ 0.685331, 2.435437, 1.317252 }},
-		{{ 0.685551, 0.105600, -1.317675 }},
-		{{ 0.685551, 0.105600, 1.317675 }},
-		{{ 0.688984, 2.527200, -0.688984 }},
-		{{ 0.688984, 2.527200, 0.688984 }},
-		{{ 0.692808, 0.127575, 1.331623 }},
-		{{ 0.692808, 0.127575, -1.331623 }},
-		{{ 0.694143, 0.008400, -0.115381 }},
-		{{ 0.694143, 0.008400, 0.115381 }},
-		{{ 0.694440, 0.150000, 1.334760 }},
-		{{ 0.694440, 0.150000, -1.334760 }},
-		{{ 0.694440, 2.400000, 1.334760 }},
-		{{ 0.694440, 0.150000, -1.334760 }},
-		{{ 0.694440, 0.150000, 1.334760 }},
-		{{ 0.694440, 2.400000, -1.334760 }},
-		{{ 0.700921, 0.177075, 1.347218 }},
-		{{ 0.700921, 0.177075, -1.347218 }},
-		{{ 0.703200, 0.008400, 0.000000 }},
-		{{ 0.715555, 2.474400, -0.975021 }},
-		{{ 0.715555, 2.474400, 0.975021 }},
-		{{ 0.718514, 0.213600, 1.381032 }},
-		{{ 0.718514, 0.213600, -1.381032 }},
-		{{ 0.729046, 2.242575, -1.401276 }},
-		{{ 0.729046, 2.242575, 1.401276 }},
-		{{ 0.734118, 2.550000, -0.381942 }},
-		{{ 0.734118, 2.550000, 0.381942 }},
-		{{ 0.744440, 0.260025, 1.430863 }},
-		{{ 0.744440, 0.260025, -1.430863 }},
-		{{ 0.757010, 2.440800, 1.031508 }},
-		{{ 0.757010, 2.440800, -1.031508 }},
-		{{ 0.762816, 0.046875, -1.039419 }},
-		{{ 0.762816, 0.046875, 1.039419 }},
-		{{ 0.762958, 2.085600, -1.466456 }},
-		{{ 0.762958, 2.085600, 1.466456 }},
-		{{ 0.770779, 0.018225, 0.565664 }},
-		{{ 0.770779, 0.018225, -0.565664 }},
-		{{ 0.772096, 2.400000, -1.052064 }},
-		{{ 0.772096, 2.400000, 1.052064 }},
-		{{ 0.775921, 0.316800, -1.491372 }},
-		{{ 0.775921, 0.316800, 1.491372 }},
-		{{ 0.781142, 2.502600, -0.781142 }},
-		{{ 0.781142, 2.502600, 0.781142 }},
-		{{ 0.783552, 2.550000, -0.263208 }},
-		{{ 0.783552, 2.550000, 0.263208 }},
-		{{ 0.785325, 2.527200, -0.576340 }},
-		{{ 0.785325, 2.527200, 0.576340 }},
-		{{ 0.795481, 1.929525, 1.528968 }},
-		{{ 0.795481, 1.929525, -1.528968 }},
-		{{ 0.810180, 0.384375, 1.557220 }},
-		{{ 0.810180, 0.384375, -1.557220 }},
-		{{ 0.811956, 0.031200, 0.811956 }},
-		{{ 0.811956, 0.031200, -0.811956 }},
-		{{ 0.814374, 2.550000, -0.135366 }},
-		{{ 0.814374, 2.550000, 0.135366 }},
-		{{ 0.819847, 2.463000, -1.117130 }},
-		{{ 0.819847, 2.463000, 1.117130 }},
-		{{ 0.820931, 2.482687, 1.118607 }},
-		{{ 0.820931, 2.482687, -1.118607 }},
-		{{ 0.821035, 0.064800, 1.118749 }},
-		{{ 0.821035, 0.064800, -1.118749 }},
-		{{ 0.823129, 2.435437, -1.121601 }},
-		{{ 0.823129, 2.435437, 1.121601 }},
-		{{ 0.825000, 2.550000, 0.000000 }},
-		{{ 0.825000, 2.550000, 0.000000 }},
-		{{ 0.825668, 2.494500, -1.125061 }},
-		{{ 0.825668, 2.494500, 1.125061 }},
-		{{ 0.825921, 1.774800, 1.587475 }},
-		{{ 0.825921, 1.774800, -1.587475 }},
-		{{ 0.831488, 2.400000, -1.132992 }},
-		{{ 0.831488, 2.400000, 1.132992 }},
-		{{ 0.833344, 2.498438, -1.135521 }},
-		{{ 0.833344, 2.498438, 1.135521 }},
-		{{ 0.843248, 2.494500, -1.149016 }},
-		{{ 0.843248, 2.494500, 1.149016 }},
-		{{ 0.844439, 0.463200, 1.623068 }},
-		{{ 0.844439, 0.463200, -1.623068 }},
-		{{ 0.847506, 0.018225, -0.440935 }},
-		{{ 0.847506, 0.018225, 0.440935 }},
-		{{ 0.853583, 1.621875, -1.640643 }},
-		{{ 0.853583, 1.621875, 1.640643 }},
-		{{ 0.854666, 2.482687, -1.164574 }},
-		{{ 0.854666, 2.482687, 1.164574 }},
-		{{ 0.855408, 2.474400, -0.855408 }},
-		{{ 0.855408, 2.474400, 0.855408 }},
-		{{ 0.858407, 0.084525, -1.169673 }},
-		{{ 0.858407, 0.084525, 1.169673 }},
-		{{ 0.863501, 2.527200, -0.449256 }},
-		{{ 0.863501, 2.527200, 0.449256 }},
-		{{ 0.866886, 2.463000, -1.181225 }},
-		{{ 0.866886, 2.463000, 1.181225 }},
-		{{ 0.875920, 0.553725, -1.683577 }},
-		{{ 0.875920, 0.553725, 1.683577 }},
-		{{ 0.877772, 1.471200, -1.687137 }},
-		{{ 0.877772, 1.471200, 1.687137 }},
-		{{ 0.879195, 2.435437, -1.197997 }},
-		{{ 0.879195, 2.435437, 1.197997 }},
-		{{ 0.879477, 0.105600, -1.198382 }},
-		{{ 0.879477, 0.105600, 1.198382 }},
-		{{ 0.888786, 0.127575, 1.211067 }},
-		{{ 0.888786, 0.127575, -1.211067 }},
-		{{ 0.890370, 2.502600, -0.653431 }},
-		{{ 0.890370, 2.502600, 0.653431 }},
-		{{ 0.890880, 0.150000, -1.213920 }},
-		{{ 0.890880, 0.150000, 1.213920 }},
-		{{ 0.890880, 2.400000, -1.213920 }},
-		{{ 0.890880, 0.150000, -1.213920 }},
-		{{ 0.890880, 0.150000, 1.213920 }},
-		{{ 0.890880, 2.400000, 1.213920 }},
-		{{ 0.897795, 1.323225, -1.725622 }},
-		{{ 0.897795, 1.323225, 1.725622 }},
-		{{ 0.899195, 0.177075, 1.225250 }},
-		{{ 0.899195, 0.177075, -1.225250 }},
-		{{ 0.901846, 0.656400, -1.733408 }},
-		{{ 0.901846, 0.656400, 1.733408 }},
-		{{ 0.904575, 0.018225, 0.303862 }},
-		{{ 0.904575, 0.018225, -0.303862 }},
-		{{ 0.904966, 2.440800, 0.904966 }},
-		{{ 0.904966, 2.440800, -0.904966 }},
-		{{ 0.911906, 0.046875, -0.911906 }},
-		{{ 0.911906, 0.046875, 0.911906 }},
-		{{ 0.912957, 1.178400, -1.754764 }},
-		{{ 0.912957, 1.178400, 1.754764 }},
-		{{ 0.919439, 0.771675, -1.767222 }},
-		{{ 0.919439, 0.771675, 1.767222 }},
-		{{ 0.921647, 2.527200, -0.309596 }},
-		{{ 0.921647, 2.527200, 0.309596 }},
-		{{ 0.921764, 0.213600, 1.256003 }},
-		{{ 0.921764, 0.213600, -1.256003 }},
-		{{ 0.922564, 1.037175, 1.773229 }},
-		{{ 0.922564, 1.037175, -1.773229 }},
-		{{ 0.923000, 2.400000, -0.923000 }},
-		{{ 0.923000, 2.400000, 0.923000 }},
-		{{ 0.925493, 0.031200, 0.679207 }},
-		{{ 0.925493, 0.031200, -0.679207 }},
-		{{ 0.925920, 0.900000, 1.779680 }},
-		{{ 0.925920, 0.900000, -1.779680 }},
-		{{ 0.925920, 0.900000, -1.779680 }},
-		{{ 0.925920, 0.900000, 1.779680 }},
-		{{ 0.935276, 2.242575, -1.274414 }},
-		{{ 0.935276, 2.242575, 1.274414 }},
-		{{ 0.940158, 0.018225, 0.156274 }},
-		{{ 0.940158, 0.018225, -0.156274 }},
-		{{ 0.952425, 0.018225, 0.000000 }},
-		{{ 0.952425, 0.018225, 0.000000 }},
-		{{ 0.955023, 0.260025, 1.301322 }},
-		{{ 0.955023, 0.260025, -1.301322 }},
-		{{ 0.957901, 2.527200, -0.159223 }},
-		{{ 0.957901, 2.527200, 0.159223 }},
-		{{ 0.970400, 2.527200, 0.000000 }},
-		{{ 0.970400, 2.527200, -0.000000 }},
-		{{ 0.975021, 2.474400, -0.715555 }},
-		{{ 0.975021, 2.474400, 0.715555 }},
-		{{ 0.978780, 2.085600, -1.333693 }},
-		{{ 0.978780, 2.085600, 1.333693 }},
-		{{ 0.979002, 2.502600, 0.509349 }},
-		{{ 0.979002, 2.502600, -0.509349 }},
-		{{ 0.980084, 2.463000, -0.980084 }},
-		{{ 0.980084, 2.463000, 0.980084 }},
-		{{ 0.981380, 2.482687, -0.981380 }},
-		{{ 0.981380, 2.482687, 0.981380 }},
-		{{ 0.981504, 0.064800, 0.981504 }},
-		{{ 0.981504, 0.064800, -0.981504 }},
-		{{ 0.984007, 2.435437, -0.984007 }},
-		{{ 0.984007, 2.435437, 0.984007 }},
-		{{ 0.987042, 2.494500, -0.987042 }},
-		{{ 0.987042, 2.494500, 0.987042 }},
-		{{ 0.994000, 2.400000, -0.994000 }},
-		{{ 0.994000, 2.400000, 0.994000 }},
-		{{ 0.995410, 0.316800, -1.356353 }},
-		{{ 0.995410, 0.316800, 1.356353 }},
-		{{ 0.996219, 2.498438, -0.996219 }},
-		{{ 0.996219, 2.498438, 0.996219 }},
-		{{ 1.008058, 2.494500, -1.008058 }},
-		{{ 1.008058, 2.494500, 1.008058 }},
-		{{ 1.017621, 0.031200, 0.529441 }},
-		{{ 1.017621, 0.031200, -0.529441 }},
-		{{ 1.020503, 1.929525, -1.390545 }},
-		{{ 1.020503, 1.929525, 1.390545 }},
-		{{ 1.021708, 2.482687, -1.021708 }},
-		{{ 1.021708, 2.482687, 1.021708 }},
-		{{ 1.026181, 0.084525, -1.026181 }},
-		{{ 1.026181, 0.084525, 1.026181 }},
-		{{ 1.031508, 2.440800, 0.757010 }},
-		{{ 1.031508, 2.440800, -0.757010 }},
-		{{ 1.036316, 2.463000, -1.036316 }},
-		{{ 1.036316, 2.463000, 1.036316 }},
-		{{ 1.039360, 0.384375, -1.416240 }},
-		{{ 1.039360, 0.384375, 1.416240 }},
-		{{ 1.039419, 0.046875, -0.762816 }},
-		{{ 1.039419, 0.046875, 0.762816 }},
-		{{ 1.044926, 2.502600, -0.351008 }},
-		{{ 1.044926, 2.502600, 0.351008 }},
-		{{ 1.051031, 2.435437, -1.051031 }},
-		{{ 1.051031, 2.435437, 1.051031 }},
-		{{ 1.051368, 0.105600, -1.051368 }},
-		{{ 1.051368, 0.105600, 1.051368 }},
-		{{ 1.052064, 2.400000, -0.772096 }},
-		{{ 1.052064, 2.400000, 0.772096 }},
-		{{ 1.059553, 1.774800, -1.443756 }},
-		{{ 1.059553, 1.774800, 1.443756 }},
-		{{ 1.062497, 0.127575, 1.062497 }},
-		{{ 1.062497, 0.127575, -1.062497 }},
-		{{ 1.065000, 0.150000, -1.065000 }},
-		{{ 1.065000, 0.150000, 1.065000 }},
-		{{ 1.065000, 2.400000, -1.065000 }},
-		{{ 1.065000, 2.400000, 1.065000 }},
-		{{ 1.072079, 2.474400, -0.557774 }},
-		{{ 1.072079, 2.474400, 0.557774 }},
-		{{ 1.074940, 0.177075, -1.074940 }},
-		{{ 1.074940, 0.177075, 1.074940 }},
-		{{ 1.083310, 0.463200, -1.476127 }},
-		{{ 1.083310, 0.463200, 1.476127 }},
-		{{ 1.086029, 2.502600, 0.180521 }},
-		{{ 1.086029, 2.502600, -0.180521 }},
-		{{ 1.086146, 0.031200, 0.364854 }},
-		{{ 1.086146, 0.031200, -0.364854 }},
-		{{ 1.095040, 1.621875, -1.492110 }},
-		{{ 1.095040, 1.621875, 1.492110 }},
-		{{ 1.100200, 2.502600, -0.000000 }},
-		{{ 1.100200, 2.502600, 0.000000 }},
-		{{ 1.101920, 0.213600, 1.101920 }},
-		{{ 1.101920, 0.213600, -1.101920 }},
-		{{ 1.117130, 2.463000, -0.819847 }},
-		{{ 1.117130, 2.463000, 0.819847 }},
-		{{ 1.118073, 2.242575, -1.118073 }},
-		{{ 1.118073, 2.242575, 1.118073 }},
-		{{ 1.118607, 2.482687, -0.820931 }},
-		{{ 1.118607, 2.482687, 0.820931 }},
-		{{ 1.118749, 0.064800, -0.821035 }},
-		{{ 1.118749, 0.064800, 0.821035 }},
-		{{ 1.121601, 2.435437, -0.823129 }},
-		{{ 1.121601, 2.435437, 0.823129 }},
-		{{ 1.123697, 0.553725, -1.531158 }},
-		{{ 1.123697, 0.553725, 1.531158 }},
-		{{ 1.125061, 2.494500, -0.825668 }},
-		{{ 1.125061, 2.494500, 0.825668 }},
-		{{ 1.126072, 1.471200, -1.534395 }},
-		{{ 1.126072, 1.471200, 1.534395 }},
-		{{ 1.128870, 0.031200, -0.187642 }},
-		{{ 1.128870, 0.031200, 0.187642 }},
-		{{ 1.132992, 2.400000, -0.831488 }},
-		{{ 1.132992, 2.400000, 0.831488 }},
-		{{ 1.134190, 2.440800, 0.590089 }},
-		{{ 1.134190, 2.440800, -0.590089 }},
-		{{ 1.135521, 2.498438, -0.833344 }},
-		{{ 1.135521, 2.498438, 0.833344 }},
-		{{ 1.141680, 0.260025, 1.141680 }},
-		{{ 1.141680, 0.260025, -1.141680 }},
-		{{ 1.142888, 0.046875, -0.594614 }},
-		{{ 1.142888, 0.046875, 0.594614 }},
-		{{ 1.143600, 0.031200, 0.000000 }},
-		{{ 1.143600, 0.031200, 0.000000 }},
-		{{ 1.144271, 2.474400, -0.384379 }},
-		{{ 1.144271, 2.474400, 0.384379 }},
-		{{ 1.149016, 2.494500, -0.843248 }},
-		{{ 1.149016, 2.494500, 0.843248 }},
-		{{ 1.151759, 1.323225, -1.569396 }},
-		{{ 1.151759, 1.323225, 1.569396 }},
-		{{ 1.156792, 2.400000, -0.601848 }},
-		{{ 1.156792, 2.400000, 0.601848 }},
-		{{ 1.156956, 0.656400, -1.576477 }},
-		{{ 1.156956, 0.656400, 1.576477 }},
-		{{ 1.164574, 2.482687, -0.854666 }},
-		{{ 1.164574, 2.482687, 0.854666 }},
-		{{ 1.169673, 0.084525, -0.858407 }},
-		{{ 1.169673, 0.084525, 0.858407 }},
-		{{ 1.170080, 2.085600, -1.170080 }},
-		{{ 1.170080, 2.085600, 1.170080 }},
-		{{ 1.171210, 1.178400, -1.595900 }},
-		{{ 1.171210, 1.178400, 1.595900 }},
-		{{ 1.179525, 0.771675, -1.607230 }},
-		{{ 1.179525, 0.771675, 1.607230 }},
-		{{ 1.181225, 2.463000, -0.866886 }},
-		{{ 1.181225, 2.463000, 0.866886 }},
-		{{ 1.183534, 1.037175, -1.612693 }},
-		{{ 1.183534, 1.037175, 1.612693 }},
-		{{ 1.187840, 0.900000, -1.618560 }},
-		{{ 1.187840, 0.900000, -1.618560 }},
-		{{ 1.187840, 0.900000, 1.618560 }},
-		{{ 1.187840, 0.900000, 1.618560 }},
-		{{ 1.189282, 2.474400, -0.197684 }},
-		{{ 1.189282, 2.474400, 0.197684 }},
-		{{ 1.189960, 0.316800, -1.189960 }},
-		{{ 1.189960, 0.316800, 1.189960 }},
-		{{ 1.197997, 2.435437, -0.879195 }},
-		{{ 1.197997, 2.435437, 0.879195 }},
-		{{ 1.198382, 0.105600, -0.879477 }},
-		{{ 1.198382, 0.105600, 0.879477 }},
-		{{ 1.204800, 2.474400, 0.000000 }},
-		{{ 1.204800, 2.474400, -0.000000 }},
-		{{ 1.210564, 2.440800, 0.406648 }},
-		{{ 1.210564, 2.440800, -0.406648 }},
-		{{ 1.211067, 0.127575, 0.888786 }},
-		{{ 1.211067, 0.127575, -0.888786 }},
-		{{ 1.213920, 0.150000, -0.890880 }},
-		{{ 1.213920, 0.150000, -0.890880 }},
-		{{ 1.213920, 0.150000, 0.890880 }},
-		{{ 1.213920, 0.150000, 0.890880 }},
-		{{ 1.213920, 2.400000, -0.890880 }},
-		{{ 1.213920, 2.400000, 0.890880 }},
-		{{ 1.219848, 0.046875, -0.409767 }},
-		{{ 1.219848, 0.046875, 0.409767 }},
-		{{ 1.219958, 1.929525, 1.219958 }},
-		{{ 1.219958, 1.929525, -1.219958 }},
-		{{ 1.225250, 0.177075, 0.899195 }},
-		{{ 1.225250, 0.177075, -0.899195 }},
-		{{ 1.228335, 2.463000, -0.639070 }},
-		{{ 1.228335, 2.463000, 0.639070 }},
-		{{ 1.229959, 2.482687, -0.639915 }},
-		{{ 1.229959, 2.482687, 0.639915 }},
-		{{ 1.230115, 0.064800, -0.639996 }},
-		{{ 1.230115, 0.064800, 0.639996 }},
-		{{ 1.233252, 2.435437, -0.641628 }},
-		{{ 1.233252, 2.435437, 0.641628 }},
-		{{ 1.234688, 2.400000, -0.414752 }},
-		{{ 1.234688, 2.400000, 0.414752 }},
-		{{ 1.237056, 2.494500, -0.643607 }},
-		{{ 1.237056, 2.494500, 0.643607 }},
-		{{ 1.242500, 0.384375, -1.242500 }},
-		{{ 1.242500, 0.384375, 1.242500 }},
-		{{ 1.245776, 2.400000, -0.648144 }},
-		{{ 1.245776, 2.400000, 0.648144 }},
-		{{ 1.248557, 2.498438, -0.649591 }},
-		{{ 1.248557, 2.498438, 0.649591 }},
-		{{ 1.256003, 0.213600, 0.921764 }},
-		{{ 1.256003, 0.213600, -0.921764 }},
-		{{ 1.258183, 2.440800, 0.209136 }},
-		{{ 1.258183, 2.440800, -0.209136 }},
-		{{ 1.263395, 2.494500, -0.657311 }},
-		{{ 1.263395, 2.494500, 0.657311 }},
-		{{ 1.266640, 1.774800, -1.266640 }},
-		{{ 1.266640, 1.774800, 1.266640 }},
-		{{ 1.267832, 0.046875, -0.210740 }},
-		{{ 1.267832, 0.046875, 0.210740 }},
-		{{ 1.274414, 2.242575, -0.935276 }},
-		{{ 1.274414, 2.242575, 0.935276 }},
-		{{ 1.274600, 2.440800, 0.000000 }},
-		{{ 1.274600, 2.440800, 0.000000 }},
-		{{ 1.280502, 2.482687, -0.666211 }},
-		{{ 1.280502, 2.482687, 0.666211 }},
-		{{ 1.283256, 2.400000, -0.213304 }},
-		{{ 1.283256, 2.400000, 0.213304 }},
-		{{ 1.284375, 0.046875, 0.000000 }},
-		{{ 1.284375, 0.046875, -0.000000 }},
-		{{ 1.286108, 0.084525, -0.669128 }},
-		{{ 1.286108, 0.084525, 0.669128 }},
-		{{ 1.295040, 0.463200, -1.295040 }},
-		{{ 1.295040, 0.463200, 1.295040 }},
-		{{ 1.298810, 2.463000, -0.675736 }},
-		{{ 1.298810, 2.463000, 0.675736 }},
-		{{ 1.300000, 2.400000, 0.000000 }},
-		{{ 1.300000, 2.400000, -0.000000 }},
-		{{ 1.301322, 0.260025, 0.955023 }},
-		{{ 1.301322, 0.260025, -0.955023 }},
-		{{ 1.309063, 1.621875, -1.309063 }},
-		{{ 1.309063, 1.621875, 1.309063 }},
-		{{ 1.311049, 2.463000, -0.440403 }},
-		{{ 1.311049, 2.463000, 0.440403 }},
-		{{ 1.312782, 2.482687, -0.440985 }},
-		{{ 1.312782, 2.482687, 0.440985 }},
-		{{ 1.312948, 0.064800, 0.441041 }},
-		{{ 1.312948, 0.064800, -0.441041 }},
-		{{ 1.316296, 2.435437, -0.442166 }},
-		{{ 1.316296, 2.435437, 0.442166 }},
-		{{ 1.317252, 2.435437, -0.685331 }},
-		{{ 1.317252, 2.435437, 0.685331 }},
-		{{ 1.317675, 0.105600, -0.685551 }},
-		{{ 1.317675, 0.105600, 0.685551 }},
-		{{ 1.320356, 2.494500, -0.443529 }},
-		{{ 1.320356, 2.494500, 0.443529 }},
-		{{ 1.329664, 2.400000, -0.446656 }},
-		{{ 1.329664, 2.400000, 0.446656 }},
-		{{ 1.331623, 0.127575, 0.692808 }},
-		{{ 1.331623, 0.127575, -0.692808 }},
-		{{ 1.332632, 2.498438, -0.447653 }},
-		{{ 1.332632, 2.498438, 0.447653 }},
-		{{ 1.333693, 2.085600, -0.978780 }},
-		{{ 1.333693, 2.085600, 0.978780 }},
-		{{ 1.334760, 0.150000, 0.694440 }},
-		{{ 1.334760, 0.150000, -0.694440 }},
-		{{ 1.334760, 0.150000, -0.694440 }},
-		{{ 1.334760, 0.150000, 0.694440 }},
-		{{ 1.334760, 2.400000, -0.694440 }},
-		{{ 1.334760, 2.400000, 0.694440 }},
-		{{ 1.343320, 0.553725, -1.343320 }},
-		{{ 1.343320, 0.553725, 1.343320 }},
-		{{ 1.346160, 1.471200, -1.346160 }},
-		{{ 1.346160, 1.471200, 1.346160 }},
-		{{ 1.347218, 0.177075, 0.700921 }},
-		{{ 1.347218, 0.177075, -0.700921 }},
-		{{ 1.348469, 2.494500, -0.452973 }},
-		{{ 1.348469, 2.494500, 0.452973 }},
-		{{ 1.356353, 0.316800, -0.995410 }},
-		{{ 1.356353, 0.316800, 0.995410 }},
-		{{ 1.362620, 2.463000, -0.226496 }},
-		{{ 1.362620, 2.463000, 0.226496 }},
-		{{ 1.364422, 2.482687, -0.226795 }},
-		{{ 1.364422, 2.482687, 0.226795 }},
-		{{ 1.364595, 0.064800, -0.226824 }},
-		{{ 1.364595, 0.064800, 0.226824 }},
-		{{ 1.366728, 2.482687, -0.459107 }},
-		{{ 1.366728, 2.482687, 0.459107 }},
-		{{ 1.368074, 2.435437, -0.227403 }},
-		{{ 1.368074, 2.435437, 0.227403 }},
-		{{ 1.372294, 2.494500, -0.228104 }},
-		{{ 1.372294, 2.494500, 0.228104 }},
-		{{ 1.372712, 0.084525, -0.461116 }},
-		{{ 1.372712, 0.084525, 0.461116 }},
-		{{ 1.376867, 1.323225, -1.376868 }},
-		{{ 1.376868, 1.323225, 1.376867 }},
-		{{ 1.380400, 2.463000, 0.000000 }},
-		{{ 1.380400, 2.463000, -0.000000 }},
-		{{ 1.381032, 0.213600, 0.718514 }},
-		{{ 1.381032, 0.213600, -0.718514 }},
-		{{ 1.381968, 2.400000, -0.229712 }},
-		{{ 1.381968, 2.400000, 0.229712 }},
-		{{ 1.382225, 2.482687, 0.000000 }},
-		{{ 1.382225, 2.482687, 0.000000 }},
-		{{ 1.382400, 0.064800, 0.000000 }},
-		{{ 1.382400, 0.064800, 0.000000 }},
-		{{ 1.383080, 0.656400, -1.383080 }},
-		{{ 1.383080, 0.656400, 1.383080 }},
-		{{ 1.385053, 2.498438, -0.230225 }},
-		{{ 1.385053, 2.498438, 0.230225 }},
-		{{ 1.385925, 2.435437, 0.000000 }},
-		{{ 1.385925, 2.435437, -0.000000 }},
-		{{ 1.386270, 2.463000, -0.465671 }},
-		{{ 1.386270, 2.463000, 0.465671 }},
-		{{ 1.390200, 2.494500, 0.000000 }},
-		{{ 1.390200, 2.494500, -0.000000 }},
-		{{ 1.390545, 1.929525, -1.020503 }},
-		{{ 1.390545, 1.929525, 1.020503 }},
-		{{ 1.400000, 2.400000, 0.000000 }},
-		{{ 1.400000, 2.400000, 0.000000 }},
-		{{ 1.400120, 1.178400, -1.400120 }},
-		{{ 1.400120, 1.178400, 1.400120 }},
-		{{ 1.401276, 2.242575, -0.729046 }},
-		{{ 1.401276, 2.242575, 0.729046 }},
-		{{ 1.401513, 2.494500, -0.232961 }},
-		{{ 1.401513, 2.494500, 0.232961 }},
-		{{ 1.403125, 2.498438, 0.000000 }},
-		{{ 1.403125, 2.498438, 0.000000 }},
-		{{ 1.405953, 2.435437, -0.472283 }},
-		{{ 1.405953, 2.435437, 0.472283 }},
-		{{ 1.406405, 0.105600, -0.472434 }},
-		{{ 1.406405, 0.105600, 0.472434 }},
-		{{ 1.410060, 0.771675, -1.410060 }},
-		{{ 1.410060, 0.771675, 1.410060 }},
-		{{ 1.414853, 1.037175, -1.414853 }},
-		{{ 1.414853, 1.037175, 1.414853 }},
-		{{ 1.416240, 0.384375, -1.039360 }},
-		{{ 1.416240, 0.384375, 1.039360 }},
-		{{ 1.419800, 2.494500, 0.000000 }},
-		{{ 1.419800, 2.494500, -0.000000 }},
-		{{ 1.420000, 0.900000, -1.420000 }},
-		{{ 1.420000, 0.900000, -1.420000 }},
-		{{ 1.420000, 0.900000, 1.420000 }},
-		{{ 1.420000, 0.900000, 1.420000 }},
-		{{ 1.420490, 2.482687, -0.236115 }},
-		{{ 1.420490, 2.482687, 0.236115 }},
-		{{ 1.421292, 0.127575, 0.477435 }},
-		{{ 1.421292, 0.127575, -0.477435 }},
-		{{ 1.424640, 0.150000, -0.478560 }},
-		{{ 1.424640, 0.150000, -0.478560 }},
-		{{ 1.424640, 0.150000, 0.478560 }},
-		{{ 1.424640, 0.150000, 0.478560 }},
-		{{ 1.424640, 2.400000, -0.478560 }},
-		{{ 1.424640, 2.400000, 0.478560 }},
-		{{ 1.426709, 0.084525, -0.237149 }},
-		{{ 1.426709, 0.084525, 0.237149 }},
-		{{ 1.430863, 0.260025, 0.744440 }},
-		{{ 1.430863, 0.260025, -0.744440 }},
-		{{ 1.437937, 0.177075, 0.483027 }},
-		{{ 1.437937, 0.177075, -0.483027 }},
-		{{ 1.439025, 2.482687, 0.000000 }},
-		{{ 1.440800, 2.463000, -0.239491 }},
-		{{ 1.440800, 2.463000, 0.239491 }},
-		{{ 1.443756, 1.774800, -1.059553 }},
-		{{ 1.443756, 1.774800, 1.059553 }},
-		{{ 1.445325, 0.084525, 0.000000 }},
-		{{ 1.445325, 0.084525, 0.000000 }},
-		{{ 1.459600, 2.463000, 0.000000 }},
-		{{ 1.459600, 2.463000, -0.000000 }},
-		{{ 1.461258, 2.435437, -0.242892 }},
-		{{ 1.461258, 2.435437, 0.242892 }},
-		{{ 1.461727, 0.105600, -0.242970 }},
-		{{ 1.461727, 0.105600, 0.242970 }},
-		{{ 1.466456, 2.085600, -0.762958 }},
-		{{ 1.466456, 2.085600, 0.762958 }},
-		{{ 1.474028, 0.213600, 0.495150 }},
-		{{ 1.474028, 0.213600, -0.495150 }},
-		{{ 1.476127, 0.463200, -1.083310 }},
-		{{ 1.476127, 0.463200, 1.083310 }},
-		{{ 1.477200, 0.127575, 0.245542 }},
-		{{ 1.477200, 0.127575, -0.245542 }},
-		{{ 1.480325, 2.435437, 0.000000 }},
-		{{ 1.480325, 2.435437, -0.000000 }},
-		{{ 1.480680, 0.150000, -0.246120 }},
-		{{ 1.480680, 0.150000, 0.246120 }},
-		{{ 1.480680, 0.150000, 0.246120 }},
-		{{ 1.480680, 0.150000, -0.246120 }},
-		{{ 1.480680, 2.400000, -0.246120 }},
-		{{ 1.480680, 2.400000, 0.246120 }},
-		{{ 1.480800, 0.105600, 0.000000 }},
-		{{ 1.480800, 0.105600, 0.000000 }},
-		{{ 1.491372, 0.316800, -0.775921 }},
-		{{ 1.491372, 0.316800, 0.775921 }},
-		{{ 1.492110, 1.621875, -1.095040 }},
-		{{ 1.492110, 1.621875, 1.095040 }},
-		{{ 1.494500, 0.177075, 0.248417 }},
-		{{ 1.494500, 0.177075, -0.248417 }},
-		{{ 1.495635, 2.242575, -0.502408 }},
-		{{ 1.495635, 2.242575, 0.502408 }},
-		{{ 1.496475, 0.127575, 0.000000 }},
-		{{ 1.496475, 0.127575, 0.000000 }},
-		{{ 1.500000, 0.150000, 0.000000 }},
-		{{ 1.500000, 0.150000, 0.000000 }},
-		{{ 1.500000, 2.400000, 0.000000 }},
-		{{ 1.500000, 2.400000, 0.000000 }},
-		{{ 1.514000, 0.177075, -0.000000 }},
-		{{ 1.514000, 0.177075, 0.000000 }},
-		{{ 1.527214, 0.260025, -0.513016 }},
-		{{ 1.527214, 0.260025, 0.513016 }},
-		{{ 1.528968, 1.929525, -0.795481 }},
-		{{ 1.528968, 1.929525, 0.795481 }},
-		{{ 1.531158, 0.553725, -1.123697 }},
-		{{ 1.531158, 0.553725, 1.123697 }},
-		{{ 1.532010, 0.213600, 0.254652 }},
-		{{ 1.532010, 0.213600, -0.254652 }},
-		{{ 1.534395, 1.471200, -1.126072 }},
-		{{ 1.534395, 1.471200, 1.126072 }},
-		{{ 1.552000, 0.213600, 0.000000 }},
-		{{ 1.552000, 0.213600, 0.000000 }},
-		{{ 1.554467, 2.242575, -0.258385 }},
-		{{ 1.554467, 2.242575, 0.258385 }},
-		{{ 1.557220, 0.384375, -0.810180 }},
-		{{ 1.557220, 0.384375, 0.810180 }},
-		{{ 1.565204, 2.085600, -0.525778 }},
-		{{ 1.565204, 2.085600, 0.525778 }},
-		{{ 1.569396, 1.323225, -1.151759 }},
-		{{ 1.569396, 1.323225, 1.151759 }},
-		{{ 1.574750, 2.242575, 0.000000 }},
-		{{ 1.574750, 2.242575, 0.000000 }},
-		{{ 1.576477, 0.656400, -1.156956 }},
-		{{ 1.576477, 0.656400, 1.156956 }},
-		{{ 1.587289, 0.260025, 0.263841 }},
-		{{ 1.587289, 0.260025, -0.263841 }},
-		{{ 1.587475, 1.774800, -0.825921 }},
-		{{ 1.587475, 1.774800, 0.825921 }},
-		{{ 1.591798, 0.316800, -0.534711 }},
-		{{ 1.591798, 0.316800, 0.534711 }},
-		{{ 1.595900, 1.178400, -1.171210 }},
-		{{ 1.595900, 1.178400, 1.171210 }},
-		{{ 1.607230, 0.771675, -1.179525 }},
-		{{ 1.607230, 0.771675, 1.179525 }},
-		{{ 1.608000, 0.260025, 0.000000 }},
-		{{ 1.608000, 0.260025, 0.000000 }},
-		{{ 1.612693, 1.037175, -1.183534 }},
-		{{ 1.612693, 1.037175, 1.183534 }},
-		{{ 1.618560, 0.900000, -1.187840 }},
-		{{ 1.618560, 0.900000, -1.187840 }},
-		{{ 1.618560, 0.900000, 1.187840 }},
-		{{ 1.618560, 0.900000, 1.187840 }},
-		{{ 1.623068, 0.463200, -0.844439 }},
-		{{ 1.623068, 0.463200, 0.844439 }},
-		{{ 1.626774, 2.085600, -0.270404 }},
-		{{ 1.626774, 2.085600, 0.270404 }},
-		{{ 1.631925, 1.929525, -0.548190 }},
-		{{ 1.631925, 1.929525, 0.548190 }},
-		{{ 1.640643, 1.621875, -0.853583 }},
-		{{ 1.640643, 1.621875, 0.853583 }},
-		{{ 1.648000, 2.085600, 0.000000 }},
-		{{ 1.648000, 2.085600, -0.000000 }},
-		{{ 1.654413, 0.316800, -0.274998 }},
-		{{ 1.654413, 0.316800, 0.274998 }},
-		{{ 1.662080, 0.384375, -0.558320 }},
-		{{ 1.662080, 0.384375, 0.558320 }},
-		{{ 1.676000, 0.316800, 0.000000 }},
-		{{ 1.676000, 0.316800, 0.000000 }},
-		{{ 1.683577, 0.553725, -0.875920 }},
-		{{ 1.683577, 0.553725, 0.875920 }},
-		{{ 1.687137, 1.471200, -0.877772 }},
-		{{ 1.687137, 1.471200, 0.877772 }},
-		{{ 1.694372, 1.774800, -0.569167 }},
-		{{ 1.694372, 1.774800, 0.569167 }},
-		{{ 1.696119, 1.929525, -0.281930 }},
-		{{ 1.696119, 1.929525, 0.281930 }},
-		{{ 1.700000, 0.600000, 0.000000 }},
-		{{ 1.700000, 0.600000, 0.000000 }},
-		{{ 1.700000, 0.623100, 0.178200 }},
-		{{ 1.700000, 0.623100, -0.178200 }},
-		{{ 1.700000, 0.685800, -0.316800 }},
-		{{ 1.700000, 0.685800, 0.316800 }},
-		{{ 1.700000, 0.778200, 0.415800 }},
-		{{ 1.700000, 0.778200, -0.415800 }},
-		{{ 1.700000, 0.890400, -0.475200 }},
-		{{ 1.700000, 0.890400, 0.475200 }},
-		{{ 1.700000, 1.012500, -0.495000 }},
-		{{ 1.700000, 1.012500, 0.495000 }},
-		{{ 1.700000, 1.134600, -0.475200 }},
-		{{ 1.700000, 1.134600, 0.475200 }},
-		{{ 1.700000, 1.246800, 0.415800 }},
-		{{ 1.700000, 1.246800, -0.415800 }},
-		{{ 1.700000, 1.339200, -0.316800 }},
-		{{ 1.700000, 1.339200, 0.316800 }},
-		{{ 1.700000, 1.401900, 0.178200 }},
-		{{ 1.700000, 1.401900, -0.178200 }},
-		{{ 1.700000, 1.425000, 0.000000 }},
-		{{ 1.700000, 1.425000, 0.000000 }},
-		{{ 1.718250, 1.929525, 0.000000 }},
-		{{ 1.718250, 1.929525, 0.000000 }},
-		{{ 1.725622, 1.323225, -0.897795 }},
-		{{ 1.725622, 1.323225, 0.897795 }},
-		{{ 1.727460, 0.384375, -0.287140 }},
-		{{ 1.727460, 0.384375, 0.287140 }},
-		{{ 1.732362, 0.463200, -0.581929 }},
-		{{ 1.732362, 0.463200, 0.581929 }},
-		{{ 1.733408, 0.656400, -0.901846 }},
-		{{ 1.733408, 0.656400, 0.901846 }},
-		{{ 1.750000, 0.384375, 0.000000 }},
-		{{ 1.750000, 0.384375, 0.000000 }},
-		{{ 1.751120, 1.621875, -0.588230 }},
-		{{ 1.751120, 1.621875, 0.588230 }},
-		{{ 1.754764, 1.178400, -0.912957 }},
-		{{ 1.754764, 1.178400, 0.912957 }},
-		{{ 1.761022, 1.774800, -0.292719 }},
-		{{ 1.761022, 1.774800, 0.292719 }},
-		{{ 1.767222, 0.771675, -0.919439 }},
-		{{ 1.767222, 0.771675, 0.919439 }},
-		{{ 1.773229, 1.037175, -0.922564 }},
-		{{ 1.773229, 1.037175, 0.922564 }},
-		{{ 1.779680, 0.900000, -0.925920 }},
-		{{ 1.779680, 0.900000, -0.925920 }},
-		{{ 1.779680, 0.900000, 0.925920 }},
-		{{ 1.779680, 0.900000, 0.925920 }},
-		{{ 1.784000, 1.774800, 0.000000 }},
-		{{ 1.784000, 1.774800, 0.000000 }},
-		{{ 1.796946, 0.553725, -0.603624 }},
-		{{ 1.796946, 0.553725, 0.603624 }},
-		{{ 1.800507, 0.463200, -0.299282 }},
-		{{ 1.800507, 0.463200, 0.299282 }},
-		{{ 1.800745, 1.471200, -0.604900 }},
-		{{ 1.800745, 1.471200, 0.604900 }},
-		{{ 1.820003, 1.621875, -0.302523 }},
-		{{ 1.820003, 1.621875, 0.302522 }},
-		{{ 1.824000, 0.463200, 0.000000 }},
-		{{ 1.824000, 0.463200, 0.000000 }},
-		{{ 1.841822, 1.323225, -0.618698 }},
-		{{ 1.841822, 1.323225, 0.618698 }},
-		{{ 1.843750, 1.621875, 0.000000 }},
-		{{ 1.843750, 1.621875, -0.000000 }},
-		{{ 1.850132, 0.656400, -0.621490 }},
-		{{ 1.850132, 0.656400, 0.621490 }},
-		{{ 1.867631, 0.553725, -0.310439 }},
-		{{ 1.867631, 0.553725, 0.310439 }},
-		{{ 1.871580, 1.471200, -0.311096 }},
-		{{ 1.871580, 1.471200, 0.311096 }},
-		{{ 1.872927, 1.178400, -0.629147 }},
-		{{ 1.872927, 1.178400, 0.629147 }},
-		{{ 1.886223, 0.771675, -0.633613 }},
-		{{ 1.886223, 0.771675, 0.633613 }},
-		{{ 1.892000, 0.553725, 0.000000 }},
-		{{ 1.892000, 0.553725, -0.000000 }},
-		{{ 1.892634, 1.037175, -0.635767 }},
-		{{ 1.892634, 1.037175, 0.635767 }},
-		{{ 1.896000, 1.471200, 0.000000 }},
-		{{ 1.896000, 1.471200, 0.000000 }},
-		{{ 1.899520, 0.900000, -0.638080 }},
-		{{ 1.899520, 0.900000, -0.638080 }},
-		{{ 1.899520, 0.900000, 0.638080 }},
-		{{ 1.899520, 0.900000, 0.638080 }},
-		{{ 1.914272, 1.323225, -0.318192 }},
-		{{ 1.914272, 1.323225, 0.318192 }},
-		{{ 1.922910, 0.656400, -0.319628 }},
-		{{ 1.922910, 0.656400, 0.319628 }},
-		{{ 1.935900, 1.444200, 0.000000 }},
-		{{ 1.935900, 1.444200, 0.000000 }},
-		{{ 1.939250, 1.323225, 0.000000 }},
-		{{ 1.939250, 1.323225, -0.000000 }},
-		{{ 1.939394, 1.423221, -0.175100 }},
-		{{ 1.939394, 1.423221, 0.175100 }},
-		{{ 1.946601, 1.178400, -0.323566 }},
-		{{ 1.946601, 1.178400, 0.323566 }},
-		{{ 1.948000, 0.656400, 0.000000 }},
-		{{ 1.948000, 0.656400, -0.000000 }},
-		{{ 1.948879, 1.366278, -0.311290 }},
-		{{ 1.948879, 1.366278, 0.311290 }},
-		{{ 1.960420, 0.771675, -0.325863 }},
-		{{ 1.960420, 0.771675, 0.325863 }},
-		{{ 1.962857, 1.282362, -0.408568 }},
-		{{ 1.962857, 1.282362, 0.408568 }},
-		{{ 1.967083, 1.037175, -0.326970 }},
-		{{ 1.967083, 1.037175, 0.326970 }},
-		{{ 1.972000, 1.178400, 0.000000 }},
-		{{ 1.972000, 1.178400, 0.000000 }},
-		{{ 1.974240, 0.900000, -0.328160 }},
-		{{ 1.974240, 0.900000, 0.328160 }},
-		{{ 1.974240, 0.900000, 0.328160 }},
-		{{ 1.979830, 1.180464, -0.466934 }},
-		{{ 1.979830, 1.180464, 0.466934 }},
-		{{ 1.986000, 0.771675, 0.000000 }},
-		{{ 1.986000, 0.771675, -0.000000 }},
-		{{ 1.992750, 1.037175, 0.000000 }},
-		{{ 1.992750, 1.037175, 0.000000 }},
-		{{ 1.998300, 1.069575, -0.486390 }},
-		{{ 1.998300, 1.069575, 0.486390 }},
-		{{ 2.000000, 0.900000, 0.000000 }},
-		{{ 2.000000, 0.900000, 0.000000 }},
-		{{ 2.016770, 0.958686, -0.466934 }},
-		{{ 2.016770, 0.958686, 0.466934 }},
-		{{ 2.033743, 0.856788, -0.408568 }},
-		{{ 2.033743, 0.856788, 0.408568 }},
-		{{ 2.047721, 0.772872, 0.311290 }},
-		{{ 2.047721, 0.772872, -0.311290 }},
-		{{ 2.057206, 0.715929, 0.175100 }},
-		{{ 2.057206, 0.715929, -0.175100 }},
-		{{ 2.060700, 0.694950, 0.000000 }},
-		{{ 2.060700, 0.694950, 0.000000 }},
-		{{ 2.111200, 1.497600, 0.000000 }},
-		{{ 2.111200, 1.497600, 0.000000 }},
-		{{ 2.116979, 1.479120, -0.166687 }},
-		{{ 2.116979, 1.479120, 0.166687 }},
-		{{ 2.132666, 1.428960, -0.296333 }},
-		{{ 2.132666, 1.428960, 0.296333 }},
-		{{ 2.155782, 1.355040, -0.388937 }},
-		{{ 2.155782, 1.355040, 0.388937 }},
-		{{ 2.183853, 1.265280, -0.444499 }},
-		{{ 2.183853, 1.265280, 0.444499 }},
-		{{ 2.214400, 1.167600, -0.463020 }},
-		{{ 2.214400, 1.167600, 0.463020 }},
-		{{ 2.237300, 1.578900, 0.000000 }},
-		{{ 2.237300, 1.578900, 0.000000 }},
-		{{ 2.244457, 1.563171, -0.154289 }},
-		{{ 2.244457, 1.563171, 0.154289 }},
-		{{ 2.244947, 1.069920, -0.444499 }},
-		{{ 2.244947, 1.069920, 0.444499 }},
-		{{ 2.263882, 1.520478, -0.274291 }},
-		{{ 2.263882, 1.520478, 0.274291 }},
-		{{ 2.273018, 0.980160, -0.388937 }},
-		{{ 2.273018, 0.980160, 0.388937 }},
-		{{ 2.292510, 1.457562, -0.360007 }},
-		{{ 2.292510, 1.457562, 0.360007 }},
-		{{ 2.296134, 0.906240, -0.296333 }},
-		{{ 2.296134, 0.906240, 0.296333 }},
-		{{ 2.311821, 0.856080, -0.166687 }},
-		{{ 2.311821, 0.856080, 0.166687 }},
-		{{ 2.317600, 0.837600, 0.000000 }},
-		{{ 2.317600, 0.837600, 0.000000 }},
-		{{ 2.325600, 1.681800, 0.000000 }},
-		{{ 2.325600, 1.681800, 0.000000 }},
-		{{ 2.327271, 1.381164, -0.411437 }},
-		{{ 2.327271, 1.381164, 0.411437 }},
-		{{ 2.333530, 1.668948, -0.139234 }},
-		{{ 2.333530, 1.668948, 0.139234 }},
-		{{ 2.355053, 1.634064, -0.247526 }},
-		{{ 2.355053, 1.634064, 0.247526 }},
-		{{ 2.365100, 1.298025, -0.428580 }},
-		{{ 2.365100, 1.298025, 0.428580 }},
-		{{ 2.386771, 1.582656, -0.324878 }},
-		{{ 2.386771, 1.582656, 0.324878 }},
-		{{ 2.387500, 1.800000, 0.000000 }},
-		{{ 2.387500, 1.800000, 0.000000 }},
-		{{ 2.395900, 1.790025, 0.122850 }},
-		{{ 2.395900, 1.790025, -0.122850 }},
-		{{ 2.402929, 1.214886, -0.411437 }},
-		{{ 2.402929, 1.214886, 0.411437 }},
-		{{ 2.418700, 1.762950, -0.218400 }},
-		{{ 2.418700, 1.762950, 0.218400 }},
-		{{ 2.425286, 1.520232, -0.371290 }},
-		{{ 2.425286, 1.520232, 0.371290 }},
-		{{ 2.434400, 1.927200, 0.000000 }},
-		{{ 2.434400, 1.927200, 0.000000 }},
-		{{ 2.437690, 1.138488, -0.360007 }},
-		{{ 2.437690, 1.138488, 0.360007 }},
-		{{ 2.443270, 1.919976, 0.106466 }},
-		{{ 2.443270, 1.919976, -0.106466 }},
-		{{ 2.452300, 1.723050, -0.286650 }},
-		{{ 2.452300, 1.723050, 0.286650 }},
-		{{ 2.466318, 1.075572, -0.274291 }},
-		{{ 2.466318, 1.075572, 0.274291 }},
-		{{ 2.467200, 1.452300, -0.386760 }},
-		{{ 2.467200, 1.452300, 0.386760 }},
-		{{ 2.467347, 1.900368, 0.189274 }},
-		{{ 2.467347, 1.900368, -0.189274 }},
-		{{ 2.477700, 2.057100, 0.000000 }},
-		{{ 2.477700, 2.057100, 0.000000 }},
-		{{ 2.485743, 1.032879, -0.154289 }},
-		{{ 2.485743, 1.032879, 0.154289 }},
-		{{ 2.487343, 2.052375, -0.091411 }},
-		{{ 2.487343, 2.052375, 0.091411 }},
-		{{ 2.492900, 1.017150, 0.000000 }},
-		{{ 2.492900, 1.017150, 0.000000 }},
-		{{ 2.493100, 1.674600, -0.327600 }},
-		{{ 2.493100, 1.674600, 0.327600 }},
-		{{ 2.502829, 1.871472, 0.248422 }},
-		{{ 2.502829, 1.871472, -0.248422 }},
-		{{ 2.509114, 1.384368, -0.371290 }},
-		{{ 2.509114, 1.384368, 0.371290 }},
-		{{ 2.513518, 2.039550, 0.162509 }},
-		{{ 2.513518, 2.039550, -0.162509 }},
-		{{ 2.528800, 2.183400, 0.000000 }},
-		{{ 2.537500, 1.621875, -0.341250 }},
-		{{ 2.537500, 1.621875, 0.341250 }},
-		{{ 2.539821, 2.180796, -0.079013 }},
-		{{ 2.539821, 2.180796, 0.079013 }},
-		{{ 2.545914, 1.836384, -0.283910 }},
-		{{ 2.545914, 1.836384, 0.283910 }},
-		{{ 2.547629, 1.321944, -0.324878 }},
-		{{ 2.547629, 1.321944, 0.324878 }},
-		{{ 2.552090, 2.020650, -0.213293 }},
-		{{ 2.552090, 2.020650, 0.213293 }},
-		{{ 2.569734, 2.173728, -0.140467 }},
-		{{ 2.569734, 2.173728, 0.140467 }},
-		{{ 2.579347, 1.270536, -0.247526 }},
-		{{ 2.579347, 1.270536, 0.247526 }},
-		{{ 2.581900, 1.569150, -0.327600 }},
-		{{ 2.581900, 1.569150, 0.327600 }},
-		{{ 2.592800, 1.798200, -0.295740 }},
-		{{ 2.592800, 1.798200, 0.295740 }},
-		{{ 2.598929, 1.997700, -0.243763 }},
-		{{ 2.598929, 1.997700, 0.243763 }},
-		{{ 2.599100, 2.299800, 0.000000 }},
-		{{ 2.599100, 2.299800, 0.000000 }},
-		{{ 2.600870, 1.235652, -0.139234 }},
-		{{ 2.600870, 1.235652, 0.139234 }},
-		{{ 2.608800, 1.222800, 0.000000 }},
-		{{ 2.608800, 1.222800, 0.000000 }},
-		{{ 2.612406, 2.298813, 0.070600 }},
-		{{ 2.612406, 2.298813, -0.070600 }},
-		{{ 2.613818, 2.163312, -0.184363 }},
-		{{ 2.613818, 2.163312, 0.184363 }},
-		{{ 2.622700, 1.520700, -0.286650 }},
-		{{ 2.622700, 1.520700, 0.286650 }},
-		{{ 2.639686, 1.760016, -0.283910 }},
-		{{ 2.639686, 1.760016, 0.283910 }},
-		{{ 2.648521, 2.296134, 0.125510 }},
-		{{ 2.648521, 2.296134, -0.125510 }},
-		{{ 2.649900, 1.972725, 0.253920 }},
-		{{ 2.649900, 1.972725, -0.253920 }},
-		{{ 2.656300, 1.480800, -0.218400 }},
-		{{ 2.656300, 1.480800, 0.218400 }},
-		{{ 2.667347, 2.150664, -0.210701 }},
-		{{ 2.667347, 2.150664, 0.210701 }},
-		{{ 2.679100, 1.453725, 0.122850 }},
-		{{ 2.679100, 1.453725, -0.122850 }},
-		{{ 2.682771, 1.724928, 0.248422 }},
-		{{ 2.682771, 1.724928, -0.248422 }},
-		{{ 2.687500, 1.443750, 0.000000 }},
-		{{ 2.687500, 1.443750, 0.000000 }},
-		{{ 2.700000, 2.400000, 0.000000 }},
-		{{ 2.700000, 2.400000, 0.000000 }},
-		{{ 2.700000, 2.400000, 0.000000 }},
-		{{ 2.700871, 1.947750, -0.243763 }},
-		{{ 2.700871, 1.947750, 0.243763 }},
-		{{ 2.701743, 2.292186, 0.164732 }},
-		{{ 2.701743, 2.292186, -0.164732 }},
-		{{ 2.716800, 2.400000, 0.067500 }},
-		{{ 2.716800, 2.400000, -0.067500 }},
-		{{ 2.716800, 2.400000, -0.067500 }},
-		{{ 2.716800, 2.400000, 0.067500 }},
-		{{ 2.718253, 1.696032, 0.189274 }},
-		{{ 2.718253, 1.696032, -0.189274 }},
-		{{ 2.725600, 2.136900, -0.219480 }},
-		{{ 2.725600, 2.136900, 0.219480 }},
-		{{ 2.729800, 2.420250, 0.000000 }},
-		{{ 2.742330, 1.676424, 0.106466 }},
-		{{ 2.742330, 1.676424, -0.106466 }},
-		{{ 2.747407, 2.420406, -0.066744 }},
-		{{ 2.747407, 2.420406, 0.066744 }},
-		{{ 2.747710, 1.924800, -0.213293 }},
-		{{ 2.747710, 1.924800, 0.213293 }},
-		{{ 2.751200, 1.669200, 0.000000 }},
-		{{ 2.751200, 1.669200, 0.000000 }},
-		{{ 2.758400, 2.436000, 0.000000 }},
-		{{ 2.762400, 2.400000, 0.120000 }},
-		{{ 2.762400, 2.400000, -0.120000 }},
-		{{ 2.762400, 2.400000, -0.120000 }},
-		{{ 2.762400, 2.400000, 0.120000 }},
-		{{ 2.766370, 2.287392, 0.188266 }},
-		{{ 2.766370, 2.287392, -0.188266 }},
-		{{ 2.776365, 2.436302, -0.064692 }},
-		{{ 2.776365, 2.436302, 0.064692 }},
-		{{ 2.783853, 2.123136, -0.210701 }},
-		{{ 2.783853, 2.123136, 0.210701 }},
-		{{ 2.784600, 2.447250, 0.000000 }},
-		{{ 2.784600, 2.447250, 0.000000 }},
-		{{ 2.786282, 1.905900, 0.162509 }},
-		{{ 2.786282, 1.905900, -0.162509 }},
-		{{ 2.795198, 2.420829, -0.118656 }},
-		{{ 2.795198, 2.420829, 0.118656 }},
-		{{ 2.800000, 2.400000, 0.000000 }},
-		{{ 2.802528, 2.447680, -0.061668 }},
-		{{ 2.802528, 2.447680, 0.061668 }},
-		{{ 2.807200, 2.454000, 0.000000 }},
-		{{ 2.811200, 2.400000, -0.040500 }},
-		{{ 2.811200, 2.400000, 0.040500 }},
-		{{ 2.812457, 1.893075, 0.091411 }},
-		{{ 2.812457, 1.893075, -0.091411 }},
-		{{ 2.822100, 1.888350, 0.000000 }},
-		{{ 2.822100, 1.888350, 0.000000 }},
-		{{ 2.824200, 2.420250, 0.000000 }},
-		{{ 2.824200, 2.420250, 0.000000 }},
-		{{ 2.824750, 2.454529, -0.057996 }},
-		{{ 2.824750, 2.454529, 0.057996 }},
-		{{ 2.825000, 2.456250, 0.000000 }},
-		{{ 2.825000, 2.456250, 0.000000 }},
-		{{ 2.825126, 2.437123, -0.115008 }},
-		{{ 2.825126, 2.437123, 0.115008 }},
-		{{ 2.829600, 2.400000, 0.157500 }},
-		{{ 2.829600, 2.400000, -0.157500 }},
-		{{ 2.829600, 2.400000, -0.157500 }},
-		{{ 2.829600, 2.400000, 0.157500 }},
-		{{ 2.836672, 2.420519, -0.041256 }},
-		{{ 2.836672, 2.420519, 0.041256 }},
-		{{ 2.836700, 2.282175, 0.196110 }},
-		{{ 2.836700, 2.282175, -0.196110 }},
-		{{ 2.836800, 2.454000, 0.000000 }},
-		{{ 2.836800, 2.454000, 0.000000 }},
-		{{ 2.837382, 2.110488, -0.184363 }},
-		{{ 2.837382, 2.110488, 0.184363 }},
-		{{ 2.837600, 2.436000, 0.000000 }},
-		{{ 2.837600, 2.436000, 0.000000 }},
-		{{ 2.841400, 2.447250, 0.000000 }},
-		{{ 2.841400, 2.447250, 0.000000 }},
-		{{ 2.841600, 2.400000, -0.072000 }},
-		{{ 2.841600, 2.400000, 0.072000 }},
-		{{ 2.841887, 2.456841, -0.054000 }},
-		{{ 2.841887, 2.456841, 0.054000 }},
-		{{ 2.851189, 2.448847, -0.109632 }},
-		{{ 2.851189, 2.448847, 0.109632 }},
-		{{ 2.851331, 2.436454, -0.043308 }},
-		{{ 2.851331, 2.436454, 0.043308 }},
-		{{ 2.852794, 2.454605, -0.050004 }},
-		{{ 2.852794, 2.454605, 0.050004 }},
-		{{ 2.856323, 2.447812, -0.046332 }},
-		{{ 2.856323, 2.447812, 0.046332 }},
-		{{ 2.865626, 2.421453, -0.155736 }},
-		{{ 2.865626, 2.421453, 0.155736 }},
-		{{ 2.870524, 2.421250, -0.073344 }},
-		{{ 2.870524, 2.421250, 0.073344 }},
-		{{ 2.872387, 2.455966, -0.103104 }},
-		{{ 2.872387, 2.455966, 0.103104 }},
-		{{ 2.881466, 2.100072, -0.140467 }},
-		{{ 2.881466, 2.100072, 0.140467 }},
-		{{ 2.886400, 2.400000, -0.094500 }},
-		{{ 2.886400, 2.400000, 0.094500 }},
-		{{ 2.887725, 2.458444, -0.096000 }},
-		{{ 2.887725, 2.458444, 0.096000 }},
-		{{ 2.888602, 2.437685, -0.076992 }},
-		{{ 2.888602, 2.437685, 0.076992 }},
-		{{ 2.896205, 2.456246, 0.088896 }},
-		{{ 2.896205, 2.456246, -0.088896 }},
-		{{ 2.896829, 2.449338, -0.082368 }},
-		{{ 2.896829, 2.449338, 0.082368 }},
-		{{ 2.896986, 2.438333, -0.150948 }},
-		{{ 2.896986, 2.438333, 0.150948 }},
-		{{ 2.907030, 2.276958, 0.188266 }},
-		{{ 2.907030, 2.276958, -0.188266 }},
-		{{ 2.911200, 2.400000, -0.180000 }},
-		{{ 2.911200, 2.400000, -0.180000 }},
-		{{ 2.911200, 2.400000, 0.180000 }},
-		{{ 2.911379, 2.093004, -0.079013 }},
-		{{ 2.911379, 2.093004, 0.079013 }},
-		{{ 2.920412, 2.422328, -0.096264 }},
-		{{ 2.920412, 2.422328, 0.096264 }},
-		{{ 2.922400, 2.090400, 0.000000 }},
-		{{ 2.922899, 2.450567, -0.143892 }},
-		{{ 2.922899, 2.450567, 0.143892 }},
-		{{ 2.940800, 2.400000, -0.108000 }},
-		{{ 2.940800, 2.400000, 0.108000 }},
-		{{ 2.942589, 2.458082, -0.135324 }},
-		{{ 2.942589, 2.458082, 0.135324 }},
-		{{ 2.943526, 2.439499, -0.101052 }},
-		{{ 2.943526, 2.439499, 0.101052 }},
-		{{ 2.951146, 2.422210, -0.177984 }},
-		{{ 2.951146, 2.422210, 0.177984 }},
-		{{ 2.955275, 2.460806, -0.126000 }},
-		{{ 2.955275, 2.460806, 0.126000 }},
-		{{ 2.956523, 2.451588, -0.108108 }},
-		{{ 2.956523, 2.451588, 0.108108 }},
-		{{ 2.960179, 2.458666, -0.116676 }},
-		{{ 2.960179, 2.458666, 0.116676 }},
-		{{ 2.971657, 2.272164, 0.164732 }},
-		{{ 2.971657, 2.272164, -0.164732 }},
-		{{ 2.980990, 2.423636, 0.110016 }},
-		{{ 2.980990, 2.423636, -0.110016 }},
-		{{ 2.984243, 2.439802, -0.172512 }},
-		{{ 2.984243, 2.439802, 0.172512 }},
-		{{ 3.000000, 2.400000, -0.187500 }},
-		{{ 3.000000, 2.400000, -0.187500 }},
-		{{ 3.000000, 2.400000, -0.112500 }},
-		{{ 3.000000, 2.400000, 0.112500 }},
-		{{ 3.000000, 2.400000, 0.187500 }},
-		{{ 3.009977, 2.452655, -0.164448 }},
-		{{ 3.009977, 2.452655, 0.164448 }},
-		{{ 3.010221, 2.441702, -0.115488 }},
-		{{ 3.010221, 2.441702, 0.115488 }},
-		{{ 3.024879, 2.268216, 0.125510 }},
-		{{ 3.024879, 2.268216, -0.125510 }},
-		{{ 3.027834, 2.460653, -0.154656 }},
-		{{ 3.027834, 2.460653, 0.154656 }},
-		{{ 3.029007, 2.454319, -0.123552 }},
-		{{ 3.029007, 2.454319, 0.123552 }},
-		{{ 3.037300, 2.463675, -0.144000 }},
-		{{ 3.037300, 2.463675, 0.144000 }},
-		{{ 3.037862, 2.461603, 0.133344 }},
-		{{ 3.037862, 2.461603, -0.133344 }},
-		{{ 3.044212, 2.423034, -0.185400 }},
-		{{ 3.044212, 2.423034, 0.185400 }},
-		{{ 3.046912, 2.425059, 0.114600 }},
-		{{ 3.046912, 2.425059, -0.114600 }},
-		{{ 3.059200, 2.400000, -0.108000 }},
-		{{ 3.059200, 2.400000, 0.108000 }},
-		{{ 3.060994, 2.265537, 0.070600 }},
-		{{ 3.060994, 2.265537, -0.070600 }},
-		{{ 3.074300, 2.264550, 0.000000 }},
-		{{ 3.074300, 2.264550, 0.000000 }},
-		{{ 3.079200, 2.441400, -0.179700 }},
-		{{ 3.079200, 2.441400, 0.179700 }},
-		{{ 3.082800, 2.444100, -0.120300 }},
-		{{ 3.082800, 2.444100, 0.120300 }},
-		{{ 3.088800, 2.400000, -0.180000 }},
-		{{ 3.088800, 2.400000, -0.180000 }},
-		{{ 3.088800, 2.400000, 0.180000 }},
-		{{ 3.104737, 2.454928, -0.171300 }},
-		{{ 3.104738, 2.454928, 0.171300 }},
-		{{ 3.107887, 2.457291, -0.128700 }},
-		{{ 3.107887, 2.457291, 0.128700 }},
-		{{ 3.112835, 2.426483, 0.110016 }},
-		{{ 3.112835, 2.426483, -0.110016 }},
-		{{ 3.113600, 2.400000, -0.094500 }},
-		{{ 3.113600, 2.400000, 0.094500 }},
-		{{ 3.120600, 2.463450, 0.161100 }},
-		{{ 3.120600, 2.463450, -0.161100 }},
-		{{ 3.122400, 2.464800, 0.138900 }},
-		{{ 3.122400, 2.464800, -0.138900 }},
-		{{ 3.126562, 2.466797, -0.150000 }},
-		{{ 3.126562, 2.466797, 0.150000 }},
-		{{ 3.137279, 2.423859, -0.177984 }},
-		{{ 3.137279, 2.423859, 0.177984 }},
-		{{ 3.155379, 2.446498, -0.115488 }},
-		{{ 3.155379, 2.446498, 0.115488 }},
-		{{ 3.158400, 2.400000, -0.072000 }},
-		{{ 3.158400, 2.400000, 0.072000 }},
-		{{ 3.170400, 2.400000, -0.157500 }},
-		{{ 3.170400, 2.400000, 0.157500 }},
-		{{ 3.170400, 2.400000, -0.157500 }},
-		{{ 3.173413, 2.427791, -0.096264 }},
-		{{ 3.173413, 2.427791, 0.096264 }},
-		{{ 3.174157, 2.442998, -0.172512 }},
-		{{ 3.174157, 2.442998, 0.172512 }},
-		{{ 3.186768, 2.460263, -0.123552 }},
-		{{ 3.186768, 2.460263, 0.123552 }},
-		{{ 3.188800, 2.400000, -0.040500 }},
-		{{ 3.188800, 2.400000, 0.040500 }},
-		{{ 3.199498, 2.457201, -0.164448 }},
-		{{ 3.199498, 2.457201, 0.164448 }},
-		{{ 3.200000, 2.400000, 0.000000 }},
-		{{ 3.206938, 2.467997, 0.133344 }},
-		{{ 3.206938, 2.467997, -0.133344 }},
-		{{ 3.213366, 2.466247, -0.154656 }},
-		{{ 3.213366, 2.466247, 0.154656 }},
-		{{ 3.215825, 2.469919, -0.144000 }},
-		{{ 3.215825, 2.469919, 0.144000 }},
-		{{ 3.222074, 2.448701, -0.101052 }},
-		{{ 3.222074, 2.448701, 0.101052 }},
-		{{ 3.222799, 2.424616, -0.155736 }},
-		{{ 3.222799, 2.424616, 0.155736 }},
-		{{ 3.223301, 2.428868, -0.073344 }},
-		{{ 3.223301, 2.428868, 0.073344 }},
-		{{ 3.237600, 2.400000, -0.120000 }},
-		{{ 3.237600, 2.400000, 0.120000 }},
-		{{ 3.237600, 2.400000, -0.120000 }},
-		{{ 3.257153, 2.429599, -0.041256 }},
-		{{ 3.257153, 2.429599, 0.041256 }},
-		{{ 3.259252, 2.462994, -0.108108 }},
-		{{ 3.259252, 2.462994, 0.108108 }},
-		{{ 3.261414, 2.444467, -0.150948 }},
-		{{ 3.261414, 2.444467, 0.150948 }},
-		{{ 3.269625, 2.429869, 0.000000 }},
-		{{ 3.269625, 2.429869, 0.000000 }},
-		{{ 3.276998, 2.450515, -0.076992 }},
-		{{ 3.276998, 2.450515, 0.076992 }},
-		{{ 3.283200, 2.400000, -0.067500 }},
-		{{ 3.283200, 2.400000, 0.067500 }},
-		{{ 3.283200, 2.400000, -0.067500 }},
-		{{ 3.284621, 2.470934, -0.116676 }},
-		{{ 3.284621, 2.470934, 0.116676 }},
-		{{ 3.286576, 2.459289, -0.143892 }},
-		{{ 3.286576, 2.459289, 0.143892 }},
-		{{ 3.293227, 2.425240, -0.118656 }},
-		{{ 3.293227, 2.425240, 0.118656 }},
-		{{ 3.297850, 2.472787, -0.126000 }},
-		{{ 3.297850, 2.472788, 0.126000 }},
-		{{ 3.298611, 2.468818, -0.135324 }},
-		{{ 3.298611, 2.468818, 0.135324 }},
-		{{ 3.300000, 2.400000, 0.000000 }},
-		{{ 3.300000, 2.400000, 0.000000 }},
-		{{ 3.314269, 2.451746, -0.043308 }},
-		{{ 3.314269, 2.451746, 0.043308 }},
-		{{ 3.318946, 2.465243, -0.082368 }},
-		{{ 3.318946, 2.465243, 0.082368 }},
-		{{ 3.328000, 2.452200, 0.000000 }},
-		{{ 3.328000, 2.452200, 0.000000 }},
-		{{ 3.333274, 2.445677, -0.115008 }},
-		{{ 3.333274, 2.445677, 0.115008 }},
-		{{ 3.341018, 2.425663, -0.066744 }},
-		{{ 3.341018, 2.425663, 0.066744 }},
-		{{ 3.348595, 2.473354, 0.088896 }},
-		{{ 3.348595, 2.473354, -0.088896 }},
-		{{ 3.358286, 2.461009, -0.109632 }},
-		{{ 3.358286, 2.461009, 0.109632 }},
-		{{ 3.358625, 2.425819, 0.000000 }},
-		{{ 3.359452, 2.466769, -0.046332 }},
-		{{ 3.359452, 2.466769, 0.046332 }},
-		{{ 3.365400, 2.475150, -0.096000 }},
-		{{ 3.365400, 2.475150, 0.096000 }},
-		{{ 3.368813, 2.470934, -0.103104 }},
-		{{ 3.368813, 2.470934, 0.103104 }},
-		{{ 3.374375, 2.467331, 0.000000 }},
-		{{ 3.374375, 2.467331, 0.000000 }},
-		{{ 3.382035, 2.446498, -0.064692 }},
-		{{ 3.382035, 2.446498, 0.064692 }},
-		{{ 3.392006, 2.474995, -0.050004 }},
-		{{ 3.392006, 2.474995, 0.050004 }},
-		{{ 3.400000, 2.446800, 0.000000 }},
-		{{ 3.406947, 2.462176, -0.061668 }},
-		{{ 3.406947, 2.462176, 0.061668 }},
-		{{ 3.408000, 2.475600, 0.000000 }},
-		{{ 3.408000, 2.475600, 0.000000 }},
-		{{ 3.411237, 2.476753, -0.054000 }},
-		{{ 3.411237, 2.476753, 0.054000 }},
-		{{ 3.416450, 2.472371, -0.057996 }},
-		{{ 3.416450, 2.472371, 0.057996 }},
-		{{ 3.424875, 2.462606, 0.000000 }},
-		{{ 3.428125, 2.477344, 0.000000 }},
-		{{ 3.428125, 2.477344, 0.000000 }},
-		{{ 3.434000, 2.472900, 0.000000 }}
-	},
-	.f = {
-		{{ 2909, 2921, 2939 }},
-		{{ 2939, 2931, 2909 }},
-		{{ 2869, 2877, 2921 }},
-		{{ 2921, 2909, 2869 }},
-		{{ 2819, 2827, 2877 }},
-		{{ 2877, 2869, 2819 }},
-		{{ 2737, 2747, 2827 }},
-		{{ 2827, 2819, 2737 }},
-		{{ 2669, 2673, 2747 }},
-		{{ 2747, 2737, 2669 }},
-		{{ 2567, 2575, 2673 }},
-		{{ 2673, 2669, 2567 }},
-		{{ 2476, 2480, 2575 }},
-		{{ 2575, 2567, 2476 }},
-		{{ 2358, 2362, 2480 }},
-		{{ 2480, 2476, 2358 }},
-		{{ 2158, 2162, 2362 }},
-		{{ 2362, 2358, 2158 }},
-		{{ 1715, 1812, 2162 }},
-		{{ 2162, 2158, 1715 }},
-		{{ 2901, 2909, 2931 }},
-		{{ 2931, 2917, 2901 }},
-		{{ 2863, 2869, 2909 }},
-		{{ 2909, 2901, 2863 }},
-		{{ 2813, 2819, 2869 }},
-		{{ 2869, 2863, 2813 }},
-		{{ 2729, 2737, 2819 }},
-		{{ 2819, 2813, 2729 }},
-		{{ 2663, 2669, 2737 }},
-		{{ 2737, 2729, 2663 }},
-		{{ 2561, 2567, 2669 }},
-		{{ 2669, 2663, 2561 }},
-		{{ 2468, 2476, 2567 }},
-		{{ 2567, 2561, 2468 }},
-		{{ 2350, 2358, 2476 }},
-		{{ 2476, 2468, 2350 }},
-		{{ 2152, 2158, 2358 }},
-		{{ 2358, 2350, 2152 }},
-		{{ 1717, 1715, 2158 }},
-		{{ 2158, 2152, 1717 }},
-		{{ 2903, 2901, 2917 }},
-		{{ 2917, 2923, 2903 }},
-		{{ 2865, 2863, 2901 }},
-		{{ 2901, 2903, 2865 }},
-		{{ 2815, 2813, 2863 }},
-		{{ 2863, 2865, 2815 }},
-		{{ 2733, 2729, 2813 }},
-		{{ 2813, 2815, 2733 }},
-		{{ 2665, 2663, 2729 }},
-		{{ 2729, 2733, 2665 }},
-		{{ 2564, 2561, 2663 }},
-		{{ 2663, 2665, 2564 }},
-		{{ 2473, 2468, 2561 }},
-		{{ 2561, 2564, 2473 }},
-		{{ 2354, 2350, 2468 }},
-		{{ 2468, 2473, 2354 }},
-		{{ 2155, 2152, 2350 }},
-		{{ 2350, 2354, 2155 }},
-		{{ 1927, 1717, 2152 }},
-		{{ 2152, 2155, 1927 }},
-		{{ 2911, 2903, 2923 }},
-		{{ 2923, 2935, 2911 }},
-		{{ 2875, 2865, 2903 }},
-		{{ 2903, 2911, 2875 }},
-		{{ 2823, 2815, 2865 }},
-		{{ 2865, 2875, 2823 }},
-		{{ 2741, 2733, 2815 }},
-		{{ 2815, 2823, 2741 }},
-		{{ 2671, 2665, 2733 }},
-		{{ 2733, 2741, 2671 }},
-		{{ 2571, 2564, 2665 }},
-		{{ 2665, 2671, 2571 }},
-		{{ 2478, 2473, 2564 }},
-		{{ 2564, 2571, 2478 }},
-		{{ 2360, 2354, 2473 }},
-		{{ 2473, 2478, 2360 }},
-		{{ 2160, 2155, 2354 }},
-		{{ 2354, 2360, 2160 }},
-		{{ 1718, 1927, 2155 }},
-		{{ 2155, 2160, 1718 }},
-		{{ 2929, 2911, 2935 }},
-		{{ 2935, 2947, 2929 }},
-		{{ 2881, 2875, 2911 }},
-		{{ 2911, 2929, 2881 }},
-		{{ 2829, 2823, 2875 }},
-		{{ 2875, 2881, 2829 }},
-		{{ 2751, 2741, 2823 }},
-		{{ 2823, 2829, 2751 }},
-		{{ 2677, 2671, 2741 }},
-		{{ 2741, 2751, 2677 }},
-		{{ 2577, 2571, 2671 }},
-		{{ 2671, 2677, 2577 }},
-		{{ 2482, 2478, 2571 }},
-		{{ 2571, 2577, 2482 }},
-		{{ 2364, 2360, 2478 }},
-		{{ 2478, 2482, 2364 }},
-		{{ 2164, 2160, 2360 }},
-		{{ 2360, 2364, 2164 }},
-		{{ 1842, 1718, 2160 }},
-		{{ 2160, 2164, 1842 }},
-		{{ 2945, 2929, 2947 }},
-		{{ 2947, 2959, 2945 }},
-		{{ 2897, 2881, 2929 }},
-		{{ 2929, 2945, 2897 }},
-		{{ 2835, 2829, 2881 }},
-		{{ 2881, 2897, 2835 }},
-		{{ 2761, 2751, 2829 }},
-		{{ 2829, 2835, 2761 }},
-		{{ 2679, 2677, 2751 }},
-		{{ 2751, 2761, 2679 }},
-		{{ 2579, 2577, 2677 }},
-		{{ 2677, 2679, 2579 }},
-		{{ 2486, 2482, 2577 }},
-		{{ 2577, 2579, 2486 }},
-		{{ 2368, 2364, 2482 }},
-		{{ 2482, 2486, 2368 }},
-		{{ 2172, 2164, 2364 }},
-		{{ 2364, 2368, 2172 }},
-		{{ 1725, 1842, 2164 }},
-		{{ 2164, 2172, 1725 }},
-		{{ 2965, 2945, 2959 }},
-		{{ 2959, 2981, 2965 }},
-		{{ 2907, 2897, 2945 }},
-		{{ 2945, 2965, 2907 }},
-		{{ 2845, 2835, 2897 }},
-		{{ 2897, 2907, 2845 }},
-		{{ 2769, 2761, 2835 }},
-		{{ 2835, 2845, 2769 }},
-		{{ 2685, 2679, 2761 }},
-		{{ 2761, 2769, 2685 }},
-		{{ 2587, 2579, 2679 }},
-		{{ 2679, 2685, 2587 }},
-		{{ 2491, 2486, 2579 }},
-		{{ 2579, 2587, 2491 }},
-		{{ 2370, 2368, 2486 }},
-		{{ 2486, 2491, 2370 }},
-		{{ 2174, 2172, 2368 }},
-		{{ 2368, 2370, 2174 }},
-		{{ 1834, 1725, 2172 }},
-		{{ 2172, 2174, 1834 }},
-		{{ 2982, 2965, 2981 }},
-		{{ 2981, 2988, 2982 }},
-		{{ 2933, 2907, 2965 }},
-		{{ 2965, 2982, 2933 }},
-		{{ 2855, 2845, 2907 }},
-		{{ 2907, 2933, 2855 }},
-		{{ 2779, 2769, 2845 }},
-		{{ 2845, 2855, 2779 }},
-		{{ 2691, 2685, 2769 }},
-		{{ 2769, 2779, 2691 }},
-		{{ 2595, 2587, 2685 }},
-		{{ 2685, 2691, 2595 }},
-		{{ 2500, 2491, 2587 }},
-		{{ 2587, 2595, 2500 }},
-		{{ 2374, 2370, 2491 }},
-		{{ 2491, 2500, 2374 }},
-		{{ 2178, 2174, 2370 }},
-		{{ 2370, 2374, 2178 }},
-		{{ 1716, 1834, 2174 }},
-		{{ 2174, 2178, 1716 }},
-		{{ 2990, 2982, 2988 }},
-		{{ 2988, 3002, 2990 }},
-		{{ 2949, 2933, 2982 }},
-		{{ 2982, 2990, 2949 }},
-		{{ 2871, 2855, 2933 }},
-		{{ 2933, 2949, 2871 }},
-		{{ 2791, 2779, 2855 }},
-		{{ 2855, 2871, 2791 }},
-		{{ 2699, 2691, 2779 }},
-		{{ 2779, 2791, 2699 }},
-		{{ 2601, 2595, 2691 }},
-		{{ 2691, 2699, 2601 }},
-		{{ 2506, 2500, 2595 }},
-		{{ 2595, 2601, 2506 }},
-		{{ 2378, 2374, 2500 }},
-		{{ 2500, 2506, 2378 }},
-		{{ 2180, 2178, 2374 }},
-		{{ 2374, 2378, 2180 }},
-		{{ 1714, 1716, 2178 }},
-		{{ 2178, 2180, 1714 }},
-		{{ 3008, 2990, 3002 }},
-		{{ 3002, 3024, 3008 }},
-		{{ 2973, 2949, 2990 }},
-		{{ 2990, 3008, 2973 }},
-		{{ 2889, 2871, 2949 }},
-		{{ 2949, 2973, 2889 }},
-		{{ 2805, 2791, 2871 }},
-		{{ 2871, 2889, 2805 }},
-		{{ 2711, 2699, 2791 }},
-		{{ 2791, 2805, 2711 }},
-		{{ 2611, 2601, 2699 }},
-		{{ 2699, 2711, 2611 }},
-		{{ 2521, 2506, 2601 }},
-		{{ 2601, 2611, 2521 }},
-		{{ 2387, 2378, 2506 }},
-		{{ 2506, 2521, 2387 }},
-		{{ 2191, 2180, 2378 }},
-		{{ 2378, 2387, 2191 }},
-		{{ 1810, 1714, 2180 }},
-		{{ 2180, 2191, 1810 }},
-		{{ 1464, 1460, 1813 }},
-		{{ 1813, 1821, 1464 }},
-		{{ 1264, 1260, 1460 }},
-		{{ 1460, 1464, 1264 }},
-		{{ 1146, 1142, 1260 }},
-		{{ 1260, 1264, 1146 }},
-		{{ 1055, 1047, 1142 }},
-		{{ 1142, 1146, 1055 }},
-		{{ 953, 949, 1047 }},
-		{{ 1047, 1055, 953 }},
-		{{ 885, 875, 949 }},
-		{{ 949, 953, 885 }},
-		{{ 803, 795, 875 }},
-		{{ 875, 885, 803 }},
-		{{ 753, 745, 795 }},
-		{{ 795, 803, 753 }},
-		{{ 713, 701, 745 }},
-		{{ 745, 753, 713 }},
-		{{ 691, 683, 701 }},
-		{{ 701, 713, 691 }},
-		{{ 1470, 1464, 1821 }},
-		{{ 1821, 1829, 1470 }},
-		{{ 1272, 1264, 1464 }},
-		{{ 1464, 1470, 1272 }},
-		{{ 1154, 1146, 1264 }},
-		{{ 1264, 1272, 1154 }},
-		{{ 1061, 1055, 1146 }},
-		{{ 1146, 1154, 1061 }},
-		{{ 959, 953, 1055 }},
-		{{ 1055, 1061, 959 }},
-		{{ 893, 885, 953 }},
-		{{ 953, 959, 893 }},
-		{{ 809, 803, 885 }},
-		{{ 885, 893, 809 }},
-		{{ 759, 753, 803 }},
-		{{ 803, 809, 759 }},
-		{{ 721, 713, 753 }},
-		{{ 753, 759, 721 }},
-		{{ 705, 691, 713 }},
-		{{ 713, 721, 705 }},
-		{{ 1469, 1470, 1829 }},
-		{{ 1829, 1835, 1469 }},
-		{{ 1268, 1272, 1470 }},
-		{{ 1470, 1469, 1268 }},
-		{{ 1151, 1154, 1272 }},
-		{{ 1272, 1268, 1151 }},
-		{{ 1060, 1061, 1154 }},
-		{{ 1154, 1151, 1060 }},
-		{{ 957, 959, 1061 }},
-		{{ 1061, 1060, 957 }},
-		{{ 889, 893, 959 }},
-		{{ 959, 957, 889 }},
-		{{ 807, 809, 893 }},
-		{{ 893, 889, 807 }},
-		{{ 757, 759, 809 }},
-		{{ 809, 807, 757 }},
-		{{ 719, 721, 759 }},
-		{{ 759, 757, 719 }},
-		{{ 699, 705, 721 }},
-		{{ 721, 719, 699 }},
-		{{ 1462, 1469, 1835 }},
-		{{ 1835, 1839, 1462 }},
-		{{ 1262, 1268, 1469 }},
-		{{ 1469, 1462, 1262 }},
-		{{ 1144, 1151, 1268 }},
-		{{ 1268, 1262, 1144 }},
-		{{ 1051, 1060, 1151 }},
-		{{ 1151, 1144, 1051 }},
-		{{ 951, 957, 1060 }},
-		{{ 1060, 1051, 951 }},
-		{{ 881, 889, 957 }},
-		{{ 957, 951, 881 }},
-		{{ 799, 807, 889 }},
-		{{ 889, 881, 799 }},
-		{{ 747, 757, 807 }},
-		{{ 807, 799, 747 }},
-		{{ 711, 719, 757 }},
-		{{ 757, 747, 711 }},
-		{{ 687, 699, 719 }},
-		{{ 719, 711, 687 }},
-		{{ 1458, 1462, 1839 }},
-		{{ 1839, 1843, 1458 }},
-		{{ 1258, 1262, 1462 }},
-		{{ 1462, 1458, 1258 }},
-		{{ 1140, 1144, 1262 }},
-		{{ 1262, 1258, 1140 }},
-		{{ 1045, 1051, 1144 }},
-		{{ 1144, 1140, 1045 }},
-		{{ 945, 951, 1051 }},
-		{{ 1051, 1045, 945 }},
-		{{ 871, 881, 951 }},
-		{{ 951, 945, 871 }},
-		{{ 793, 799, 881 }},
-		{{ 881, 871, 793 }},
-		{{ 741, 747, 799 }},
-		{{ 799, 793, 741 }},
-		{{ 693, 711, 747 }},
-		{{ 747, 741, 693 }},
-		{{ 675, 687, 711 }},
-		{{ 711, 693, 675 }},
-		{{ 1450, 1458, 1843 }},
-		{{ 1843, 1838, 1450 }},
-		{{ 1254, 1258, 1458 }},
-		{{ 1458, 1450, 1254 }},
-		{{ 1136, 1140, 1258 }},
-		{{ 1258, 1254, 1136 }},
-		{{ 1043, 1045, 1140 }},
-		{{ 1140, 1136, 1043 }},
-		{{ 943, 945, 1045 }},
-		{{ 1045, 1043, 943 }},
-		{{ 861, 871, 945 }},
-		{{ 945, 943, 861 }},
-		{{ 787, 793, 871 }},
-		{{ 871, 861, 787 }},
-		{{ 725, 741, 793 }},
-		{{ 793, 787, 725 }},
-		{{ 677, 693, 741 }},
-		{{ 741, 725, 677 }},
-		{{ 663, 675, 693 }},
-		{{ 693, 677, 663 }},
-		{{ 1448, 1450, 1838 }},
-		{{ 1838, 1834, 1448 }},
-		{{ 1252, 1254, 1450 }},
-		{{ 1450, 1448, 1252 }},
-		{{ 1133, 1136, 1254 }},
-		{{ 1254, 1252, 1133 }},
-		{{ 1035, 1043, 1136 }},
-		{{ 1136, 1133, 1035 }},
-		{{ 937, 943, 1043 }},
-		{{ 1043, 1035, 937 }},
-		{{ 853, 861, 943 }},
-		{{ 943, 937, 853 }},
-		{{ 777, 787, 861 }},
-		{{ 861, 853, 777 }},
-		{{ 715, 725, 787 }},
-		{{ 787, 777, 715 }},
-		{{ 657, 677, 725 }},
-		{{ 725, 715, 657 }},
-		{{ 642, 663, 677 }},
-		{{ 677, 657, 642 }},
-		{{ 1444, 1448, 1834 }},
-		{{ 1834, 1828, 1444 }},
-		{{ 1248, 1252, 1448 }},
-		{{ 1448, 1444, 1248 }},
-		{{ 1122, 1133, 1252 }},
-		{{ 1252, 1248, 1122 }},
-		{{ 1027, 1035, 1133 }},
-		{{ 1133, 1122, 1027 }},
-		{{ 931, 937, 1035 }},
-		{{ 1035, 1027, 931 }},
-		{{ 843, 853, 937 }},
-		{{ 937, 931, 843 }},
-		{{ 767, 777, 853 }},
-		{{ 853, 843, 767 }},
-		{{ 689, 715, 777 }},
-		{{ 777, 767, 689 }},
-		{{ 640, 657, 715 }},
-		{{ 715, 689, 640 }},
-		{{ 634, 642, 657 }},
-		{{ 657, 640, 634 }},
-		{{ 1442, 1444, 1828 }},
-		{{ 1828, 1820, 1442 }},
-		{{ 1244, 1248, 1444 }},
-		{{ 1444, 1442, 1244 }},
-		{{ 1116, 1122, 1248 }},
-		{{ 1248, 1244, 1116 }},
-		{{ 1021, 1027, 1122 }},
-		{{ 1122, 1116, 1021 }},
-		{{ 923, 931, 1027 }},
-		{{ 1027, 1021, 923 }},
-		{{ 831, 843, 931 }},
-		{{ 931, 923, 831 }},
-		{{ 751, 767, 843 }},
-		{{ 843, 831, 751 }},
-		{{ 673, 689, 767 }},
-		{{ 767, 751, 673 }},
-		{{ 632, 640, 689 }},
-		{{ 689, 673, 632 }},
-		{{ 620, 634, 640 }},
-		{{ 640, 632, 620 }},
-		{{ 1429, 1442, 1820 }},
-		{{ 1820, 1811, 1429 }},
-		{{ 1233, 1244, 1442 }},
-		{{ 1442, 1429, 1233 }},
-		{{ 1106, 1116, 1244 }},
-		{{ 1244, 1233, 1106 }},
-		{{ 1011, 1021, 1116 }},
-		{{ 1116, 1106, 1011 }},
-		{{ 911, 923, 1021 }},
-		{{ 1021, 1011, 911 }},
-		{{ 817, 831, 923 }},
-		{{ 923, 911, 817 }},
-		{{ 733, 751, 831 }},
-		{{ 831, 817, 733 }},
-		{{ 649, 673, 751 }},
-		{{ 751, 733, 649 }},
-		{{ 614, 632, 673 }},
-		{{ 673, 649, 614 }},
-		{{ 597, 620, 632 }},
-		{{ 632, 614, 597 }},
-		{{ 714, 702, 684 }},
-		{{ 684, 692, 714 }},
-		{{ 754, 746, 702 }},
-		{{ 702, 714, 754 }},
-		{{ 804, 796, 746 }},
-		{{ 746, 754, 804 }},
-		{{ 886, 876, 796 }},
-		{{ 796, 804, 886 }},
-		{{ 954, 950, 876 }},
-		{{ 876, 886, 954 }},
-		{{ 1056, 1048, 950 }},
-		{{ 950, 954, 1056 }},
-		{{ 1147, 1143, 1048 }},
-		{{ 1048, 1056, 1147 }},
-		{{ 1265, 1261, 1143 }},
-		{{ 1143, 1147, 1265 }},
-		{{ 1465, 1461, 1261 }},
-		{{ 1261, 1265, 1465 }},
-		{{ 1915, 1817, 1461 }},
-		{{ 1461, 1465, 1915 }},
-		{{ 722, 714, 692 }},
-		{{ 692, 706, 722 }},
-		{{ 760, 754, 714 }},
-		{{ 714, 722, 760 }},
-		{{ 810, 804, 754 }},
-		{{ 754, 760, 810 }},
-		{{ 894, 886, 804 }},
-		{{ 804, 810, 894 }},
-		{{ 960, 954, 886 }},
-		{{ 886, 894, 960 }},
-		{{ 1062, 1056, 954 }},
-		{{ 954, 960, 1062 }},
-		{{ 1155, 1147, 1056 }},
-		{{ 1056, 1062, 1155 }},
-		{{ 1273, 1265, 1147 }},
-		{{ 1147, 1155, 1273 }},
-		{{ 1471, 1465, 1265 }},
-		{{ 1265, 1273, 1471 }},
-		{{ 1917, 1915, 1465 }},
-		{{ 1465, 1471, 1917 }},
-		{{ 720, 722, 706 }},
-		{{ 706, 700, 720 }},
-		{{ 758, 760, 722 }},
-		{{ 722, 720, 758 }},
-		{{ 808, 810, 760 }},
-		{{ 760, 758, 808 }},
-		{{ 890, 894, 810 }},
-		{{ 810, 808, 890 }},
-		{{ 958, 960, 894 }},
-		{{ 894, 890, 958 }},
-		{{ 1059, 1062, 960 }},
-		{{ 960, 958, 1059 }},
-		{{ 1150, 1155, 1062 }},
-		{{ 1062, 1059, 1150 }},
-		{{ 1269, 1273, 1155 }},
-		{{ 1155, 1150, 1269 }},
-		{{ 1468, 1471, 1273 }},
-		{{ 1273, 1269, 1468 }},
-		{{ 1697, 1917, 1471 }},
-		{{ 1471, 1468, 1697 }},
-		{{ 712, 720, 700 }},
-		{{ 700, 688, 712 }},
-		{{ 748, 758, 720 }},
-		{{ 720, 712, 748 }},
-		{{ 800, 808, 758 }},
-		{{ 758, 748, 800 }},
-		{{ 882, 890, 808 }},
-		{{ 808, 800, 882 }},
-		{{ 952, 958, 890 }},
-		{{ 890, 882, 952 }},
-		{{ 1052, 1059, 958 }},
-		{{ 958, 952, 1052 }},
-		{{ 1145, 1150, 1059 }},
-		{{ 1059, 1052, 1145 }},
-		{{ 1263, 1269, 1150 }},
-		{{ 1150, 1145, 1263 }},
-		{{ 1463, 1468, 1269 }},
-		{{ 1269, 1263, 1463 }},
-		{{ 1919, 1697, 1468 }},
-		{{ 1468, 1463, 1919 }},
-		{{ 694, 712, 688 }},
-		{{ 688, 676, 694 }},
-		{{ 742, 748, 712 }},
-		{{ 712, 694, 742 }},
-		{{ 794, 800, 748 }},
-		{{ 748, 742, 794 }},
-		{{ 872, 882, 800 }},
-		{{ 800, 794, 872 }},
-		{{ 946, 952, 882 }},
-		{{ 882, 872, 946 }},
-		{{ 1046, 1052, 952 }},
-		{{ 952, 946, 1046 }},
-		{{ 1141, 1145, 1052 }},
-		{{ 1052, 1046, 1141 }},
-		{{ 1259, 1263, 1145 }},
-		{{ 1145, 1141, 1259 }},
-		{{ 1459, 1463, 1263 }},
-		{{ 1263, 1259, 1459 }},
-		{{ 1845, 1919, 1463 }},
-		{{ 1463, 1459, 1845 }},
-		{{ 678, 694, 676 }},
-		{{ 676, 664, 678 }},
-		{{ 726, 742, 694 }},
-		{{ 694, 678, 726 }},
-		{{ 788, 794, 742 }},
-		{{ 742, 726, 788 }},
-		{{ 862, 872, 794 }},
-		{{ 794, 788, 862 }},
-		{{ 944, 946, 872 }},
-		{{ 872, 862, 944 }},
-		{{ 1044, 1046, 946 }},
-		{{ 946, 944, 1044 }},
-		{{ 1137, 1141, 1046 }},
-		{{ 1046, 1044, 1137 }},
-		{{ 1255, 1259, 1141 }},
-		{{ 1141, 1137, 1255 }},
-		{{ 1451, 1459, 1259 }},
-		{{ 1259, 1255, 1451 }},
-		{{ 1898, 1845, 1459 }},
-		{{ 1459, 1451, 1898 }},
-		{{ 658, 678, 664 }},
-		{{ 664, 642, 658 }},
-		{{ 716, 726, 678 }},
-		{{ 678, 658, 716 }},
-		{{ 778, 788, 726 }},
-		{{ 726, 716, 778 }},
-		{{ 854, 862, 788 }},
-		{{ 788, 778, 854 }},
-		{{ 938, 944, 862 }},
-		{{ 862, 854, 938 }},
-		{{ 1036, 1044, 944 }},
-		{{ 944, 938, 1036 }},
-		{{ 1132, 1137, 1044 }},
-		{{ 1044, 1036, 1132 }},
-		{{ 1253, 1255, 1137 }},
-		{{ 1137, 1132, 1253 }},
-		{{ 1449, 1451, 1255 }},
-		{{ 1255, 1253, 1449 }},
-		{{ 1837, 1898, 1451 }},
-		{{ 1451, 1449, 1837 }},
-		{{ 641, 658, 642 }},
-		{{ 642, 635, 641 }},
-		{{ 690, 716, 658 }},
-		{{ 658, 641, 690 }},
-		{{ 768, 778, 716 }},
-		{{ 716, 690, 768 }},
-		{{ 844, 854, 778 }},
-		{{ 778, 768, 844 }},
-		{{ 932, 938, 854 }},
-		{{ 854, 844, 932 }},
-		{{ 1028, 1036, 938 }},
-		{{ 938, 932, 1028 }},
-		{{ 1123, 1132, 1036 }},
-		{{ 1036, 1028, 1123 }},
-		{{ 1249, 1253, 1132 }},
-		{{ 1132, 1123, 1249 }},
-		{{ 1445, 1449, 1253 }},
-		{{ 1253, 1249, 1445 }},
-		{{ 1918, 1837, 1449 }},
-		{{ 1449, 1445, 1918 }},
-		{{ 633, 641, 635 }},
-		{{ 635, 621, 633 }},
-		{{ 674, 690, 641 }},
-		{{ 641, 633, 674 }},
-		{{ 752, 768, 690 }},
-		{{ 690, 674, 752 }},
-		{{ 832, 844, 768 }},
-		{{ 768, 752, 832 }},
-		{{ 924, 932, 844 }},
-		{{ 844, 832, 924 }},
-		{{ 1022, 1028, 932 }},
-		{{ 932, 924, 1022 }},
-		{{ 1117, 1123, 1028 }},
-		{{ 1028, 1022, 1117 }},
-		{{ 1245, 1249, 1123 }},
-		{{ 1123, 1117, 1245 }},
-		{{ 1443, 1445, 1249 }},
-		{{ 1249, 1245, 1443 }},
-		{{ 1916, 1918, 1445 }},
-		{{ 1445, 1443, 1916 }},
-		{{ 616, 633, 621 }},
-		{{ 621, 600, 616 }},
-		{{ 654, 674, 633 }},
-		{{ 633, 616, 654 }},
-		{{ 737, 752, 674 }},
-		{{ 674, 654, 737 }},
-		{{ 822, 832, 752 }},
-		{{ 752, 737, 822 }},
-		{{ 914, 924, 832 }},
-		{{ 832, 822, 914 }},
-		{{ 1014, 1022, 924 }},
-		{{ 924, 914, 1014 }},
-		{{ 1104, 1117, 1022 }},
-		{{ 1022, 1014, 1104 }},
-		{{ 1237, 1245, 1117 }},
-		{{ 1117, 1104, 1237 }},
-		{{ 1433, 1443, 1245 }},
-		{{ 1245, 1237, 1433 }},
-		{{ 1819, 1916, 1443 }},
-		{{ 1443, 1433, 1819 }},
-		{{ 2159, 2163, 1816 }},
-		{{ 1816, 1822, 2159 }},
-		{{ 2359, 2363, 2163 }},
-		{{ 2163, 2159, 2359 }},
-		{{ 2477, 2481, 2363 }},
-		{{ 2363, 2359, 2477 }},
-		{{ 2568, 2576, 2481 }},
-		{{ 2481, 2477, 2568 }},
-		{{ 2670, 2674, 2576 }},
-		{{ 2576, 2568, 2670 }},
-		{{ 2738, 2748, 2674 }},
-		{{ 2674, 2670, 2738 }},
-		{{ 2820, 2828, 2748 }},
-		{{ 2748, 2738, 2820 }},
-		{{ 2870, 2878, 2828 }},
-		{{ 2828, 2820, 2870 }},
-		{{ 2910, 2922, 2878 }},
-		{{ 2878, 2870, 2910 }},
-		{{ 2932, 2940, 2922 }},
-		{{ 2922, 2910, 2932 }},
-		{{ 2153, 2159, 1822 }},
-		{{ 1822, 1830, 2153 }},
-		{{ 2351, 2359, 2159 }},
-		{{ 2159, 2153, 2351 }},
-		{{ 2469, 2477, 2359 }},
-		{{ 2359, 2351, 2469 }},
-		{{ 2562, 2568, 2477 }},
-		{{ 2477, 2469, 2562 }},
-		{{ 2664, 2670, 2568 }},
-		{{ 2568, 2562, 2664 }},
-		{{ 2730, 2738, 2670 }},
-		{{ 2670, 2664, 2730 }},
-		{{ 2814, 2820, 2738 }},
-		{{ 2738, 2730, 2814 }},
-		{{ 2864, 2870, 2820 }},
-		{{ 2820, 2814, 2864 }},
-		{{ 2902, 2910, 2870 }},
-		{{ 2870, 2864, 2902 }},
-		{{ 2918, 2932, 2910 }},
-		{{ 2910, 2902, 2918 }},
-		{{ 2154, 2153, 1830 }},
-		{{ 1830, 1836, 2154 }},
-		{{ 2355, 2351, 2153 }},
-		{{ 2153, 2154, 2355 }},
-		{{ 2472, 2469, 2351 }},
-		{{ 2351, 2355, 2472 }},
-		{{ 2563, 2562, 2469 }},
-		{{ 2469, 2472, 2563 }},
-		{{ 2666, 2664, 2562 }},
-		{{ 2562, 2563, 2666 }},
-		{{ 2734, 2730, 2664 }},
-		{{ 2664, 2666, 2734 }},
-		{{ 2816, 2814, 2730 }},
-		{{ 2730, 2734, 2816 }},
-		{{ 2866, 2864, 2814 }},
-		{{ 2814, 2816, 2866 }},
-		{{ 2904, 2902, 2864 }},
-		{{ 2864, 2866, 2904 }},
-		{{ 2924, 2918, 2902 }},
-		{{ 2902, 2904, 2924 }},
-		{{ 2161, 2154, 1836 }},
-		{{ 1836, 1840, 2161 }},
-		{{ 2361, 2355, 2154 }},
-		{{ 2154, 2161, 2361 }},
-		{{ 2479, 2472, 2355 }},
-		{{ 2355, 2361, 2479 }},
-		{{ 2572, 2563, 2472 }},
-		{{ 2472, 2479, 2572 }},
-		{{ 2672, 2666, 2563 }},
-		{{ 2563, 2572, 2672 }},
-		{{ 2742, 2734, 2666 }},
-		{{ 2666, 2672, 2742 }},
-		{{ 2824, 2816, 2734 }},
-		{{ 2734, 2742, 2824 }},
-		{{ 2876, 2866, 2816 }},
-		{{ 2816, 2824, 2876 }},
-		{{ 2912, 2904, 2866 }},
-		{{ 2866, 2876, 2912 }},
-		{{ 2936, 2924, 2904 }},
-		{{ 2904, 2912, 2936 }},
-		{{ 2165, 2161, 1840 }},
-		{{ 1840, 1844, 2165 }},
-		{{ 2365, 2361, 2161 }},
-		{{ 2161, 2165, 2365 }},
-		{{ 2483, 2479, 2361 }},
-		{{ 2361, 2365, 2483 }},
-		{{ 2578, 2572, 2479 }},
-		{{ 2479, 2483, 2578 }},
-		{{ 2678, 2672, 2572 }},
-		{{ 2572, 2578, 2678 }},
-		{{ 2752, 2742, 2672 }},
-		{{ 2672, 2678, 2752 }},
-		{{ 2830, 2824, 2742 }},
-		{{ 2742, 2752, 2830 }},
-		{{ 2882, 2876, 2824 }},
-		{{ 2824, 2830, 2882 }},
-		{{ 2930, 2912, 2876 }},
-		{{ 2876, 2882, 2930 }},
-		{{ 2948, 2936, 2912 }},
-		{{ 2912, 2930, 2948 }},
-		{{ 2173, 2165, 1844 }},
-		{{ 1844, 1841, 2173 }},
-		{{ 2369, 2365, 2165 }},
-		{{ 2165, 2173, 2369 }},
-		{{ 2487, 2483, 2365 }},
-		{{ 2365, 2369, 2487 }},
-		{{ 2580, 2578, 2483 }},
-		{{ 2483, 2487, 2580 }},
-		{{ 2680, 2678, 2578 }},
-		{{ 2578, 2580, 2680 }},
-		{{ 2762, 2752, 2678 }},
-		{{ 2678, 2680, 2762 }},
-		{{ 2836, 2830, 2752 }},
-		{{ 2752, 2762, 2836 }},
-		{{ 2898, 2882, 2830 }},
-		{{ 2830, 2836, 2898 }},
-		{{ 2946, 2930, 2882 }},
-		{{ 2882, 2898, 2946 }},
-		{{ 2960, 2948, 2930 }},
-		{{ 2930, 2946, 2960 }},
-		{{ 2175, 2173, 1841 }},
-		{{ 1841, 1837, 2175 }},
-		{{ 2371, 2369, 2173 }},
-		{{ 2173, 2175, 2371 }},
-		{{ 2490, 2487, 2369 }},
-		{{ 2369, 2371, 2490 }},
-		{{ 2588, 2580, 2487 }},
-		{{ 2487, 2490, 2588 }},
-		{{ 2686, 2680, 2580 }},
-		{{ 2580, 2588, 2686 }},
-		{{ 2770, 2762, 2680 }},
-		{{ 2680, 2686, 2770 }},
-		{{ 2846, 2836, 2762 }},
-		{{ 2762, 2770, 2846 }},
-		{{ 2908, 2898, 2836 }},
-		{{ 2836, 2846, 2908 }},
-		{{ 2966, 2946, 2898 }},
-		{{ 2898, 2908, 2966 }},
-		{{ 2981, 2960, 2946 }},
-		{{ 2946, 2966, 2981 }},
-		{{ 2179, 2175, 1837 }},
-		{{ 1837, 1831, 2179 }},
-		{{ 2375, 2371, 2175 }},
-		{{ 2175, 2179, 2375 }},
-		{{ 2501, 2490, 2371 }},
-		{{ 2371, 2375, 2501 }},
-		{{ 2596, 2588, 2490 }},
-		{{ 2490, 2501, 2596 }},
-		{{ 2692, 2686, 2588 }},
-		{{ 2588, 2596, 2692 }},
-		{{ 2780, 2770, 2686 }},
-		{{ 2686, 2692, 2780 }},
-		{{ 2856, 2846, 2770 }},
-		{{ 2770, 2780, 2856 }},
-		{{ 2934, 2908, 2846 }},
-		{{ 2846, 2856, 2934 }},
-		{{ 2983, 2966, 2908 }},
-		{{ 2908, 2934, 2983 }},
-		{{ 2989, 2981, 2966 }},
-		{{ 2966, 2983, 2989 }},
-		{{ 2181, 2179, 1831 }},
-		{{ 1831, 1823, 2181 }},
-		{{ 2379, 2375, 2179 }},
-		{{ 2179, 2181, 2379 }},
-		{{ 2507, 2501, 2375 }},
-		{{ 2375, 2379, 2507 }},
-		{{ 2602, 2596, 2501 }},
-		{{ 2501, 2507, 2602 }},
-		{{ 2700, 2692, 2596 }},
-		{{ 2596, 2602, 2700 }},
-		{{ 2792, 2780, 2692 }},
-		{{ 2692, 2700, 2792 }},
-		{{ 2872, 2856, 2780 }},
-		{{ 2780, 2792, 2872 }},
-		{{ 2950, 2934, 2856 }},
-		{{ 2856, 2872, 2950 }},
-		{{ 2991, 2983, 2934 }},
-		{{ 2934, 2950, 2991 }},
-		{{ 3003, 2989, 2983 }},
-		{{ 2983, 2991, 3003 }},
-		{{ 2194, 2181, 1823 }},
-		{{ 1823, 1818, 2194 }},
-		{{ 2391, 2379, 2181 }},
-		{{ 2181, 2194, 2391 }},
-		{{ 2518, 2507, 2379 }},
-		{{ 2379, 2391, 2518 }},
-		{{ 2614, 2602, 2507 }},
-		{{ 2507, 2518, 2614 }},
-		{{ 2712, 2700, 2602 }},
-		{{ 2602, 2614, 2712 }},
-		{{ 2806, 2792, 2700 }},
-		{{ 2700, 2712, 2806 }},
-		{{ 2890, 2872, 2792 }},
-		{{ 2792, 2806, 2890 }},
-		{{ 2974, 2950, 2872 }},
-		{{ 2872, 2890, 2974 }},
-		{{ 3009, 2991, 2950 }},
-		{{ 2950, 2974, 3009 }},
-		{{ 3025, 3003, 2991 }},
-		{{ 2991, 3009, 3025 }},
-		{{ 3040, 3008, 3024 }},
-		{{ 3024, 3048, 3040 }},
-		{{ 3018, 2973, 3008 }},
-		{{ 3008, 3040, 3018 }},
-		{{ 2943, 2889, 2973 }},
-		{{ 2973, 3018, 2943 }},
-		{{ 2841, 2805, 2889 }},
-		{{ 2889, 2943, 2841 }},
-		{{ 2731, 2711, 2805 }},
-		{{ 2805, 2841, 2731 }},
-		{{ 2645, 2611, 2711 }},
-		{{ 2711, 2731, 2645 }},
-		{{ 2529, 2521, 2611 }},
-		{{ 2611, 2645, 2529 }},
-		{{ 2402, 2387, 2521 }},
-		{{ 2521, 2529, 2402 }},
-		{{ 2208, 2191, 2387 }},
-		{{ 2387, 2402, 2208 }},
-		{{ 1806, 1810, 2191 }},
-		{{ 2191, 2208, 1806 }},
-		{{ 3072, 3040, 3048 }},
-		{{ 3048, 3078, 3072 }},
-		{{ 3044, 3018, 3040 }},
-		{{ 3040, 3072, 3044 }},
-		{{ 2994, 2943, 3018 }},
-		{{ 3018, 3044, 2994 }},
-		{{ 2883, 2841, 2943 }},
-		{{ 2943, 2994, 2883 }},
-		{{ 2773, 2731, 2841 }},
-		{{ 2841, 2883, 2773 }},
-		{{ 2659, 2645, 2731 }},
-		{{ 2731, 2773, 2659 }},
-		{{ 2539, 2529, 2645 }},
-		{{ 2645, 2659, 2539 }},
-		{{ 2410, 2402, 2529 }},
-		{{ 2529, 2539, 2410 }},
-		{{ 2222, 2208, 2402 }},
-		{{ 2402, 2410, 2222 }},
-		{{ 1694, 1806, 2208 }},
-		{{ 2208, 2222, 1694 }},
-		{{ 3092, 3072, 3078 }},
-		{{ 3078, 3116, 3092 }},
-		{{ 3074, 3044, 3072 }},
-		{{ 3072, 3092, 3074 }},
-		{{ 3030, 2994, 3044 }},
-		{{ 3044, 3074, 3030 }},
-		{{ 2937, 2883, 2994 }},
-		{{ 2994, 3030, 2937 }},
-		{{ 2810, 2773, 2883 }},
-		{{ 2883, 2937, 2810 }},
-		{{ 2683, 2659, 2773 }},
-		{{ 2773, 2810, 2683 }},
-		{{ 2554, 2539, 2659 }},
-		{{ 2659, 2683, 2554 }},
-		{{ 2420, 2410, 2539 }},
-		{{ 2539, 2554, 2420 }},
-		{{ 2238, 2222, 2410 }},
-		{{ 2410, 2420, 2238 }},
-		{{ 1930, 1694, 2222 }},
-		{{ 2222, 2238, 1930 }},
-		{{ 3132, 3092, 3116 }},
-		{{ 3116, 3142, 3132 }},
-		{{ 3090, 3074, 3092 }},
-		{{ 3092, 3132, 3090 }},
-		{{ 3054, 3030, 3074 }},
-		{{ 3074, 3090, 3054 }},
-		{{ 2984, 2937, 3030 }},
-		{{ 3030, 3054, 2984 }},
-		{{ 2837, 2810, 2937 }},
-		{{ 2937, 2984, 2837 }},
-		{{ 2705, 2683, 2810 }},
-		{{ 2810, 2837, 2705 }},
-		{{ 2574, 2554, 2683 }},
-		{{ 2683, 2705, 2574 }},
-		{{ 2430, 2420, 2554 }},
-		{{ 2554, 2574, 2430 }},
-		{{ 2247, 2238, 2420 }},
-		{{ 2420, 2430, 2247 }},
-		{{ 1913, 1930, 2238 }},
-		{{ 2238, 2247, 1913 }},
-		{{ 3150, 3132, 3142 }},
-		{{ 3142, 3156, 3150 }},
-		{{ 3128, 3090, 3132 }},
-		{{ 3132, 3150, 3128 }},
-		{{ 3076, 3054, 3090 }},
-		{{ 3090, 3128, 3076 }},
-		{{ 3014, 2984, 3054 }},
-		{{ 3054, 3076, 3014 }},
-		{{ 2861, 2837, 2984 }},
-		{{ 2984, 3014, 2861 }},
-		{{ 2723, 2705, 2837 }},
-		{{ 2837, 2861, 2723 }},
-		{{ 2585, 2574, 2705 }},
-		{{ 2705, 2723, 2585 }},
-		{{ 2438, 2430, 2574 }},
-		{{ 2574, 2585, 2438 }},
-		{{ 2253, 2247, 2430 }},
-		{{ 2430, 2438, 2253 }},
-		{{ 1711, 1913, 2247 }},
-		{{ 2247, 2253, 1711 }},
-		{{ 3162, 3150, 3156 }},
-		{{ 3156, 3172, 3162 }},
-		{{ 3148, 3128, 3150 }},
-		{{ 3150, 3162, 3148 }},
-		{{ 3088, 3076, 3128 }},
-		{{ 3128, 3148, 3088 }},
-		{{ 3036, 3014, 3076 }},
-		{{ 3076, 3088, 3036 }},
-		{{ 2893, 2861, 3014 }},
-		{{ 3014, 3036, 2893 }},
-		{{ 2743, 2723, 2861 }},
-		{{ 2861, 2893, 2743 }},
-		{{ 2599, 2585, 2723 }},
-		{{ 2723, 2743, 2599 }},
-		{{ 2450, 2438, 2585 }},
-		{{ 2585, 2599, 2450 }},
-		{{ 2267, 2253, 2438 }},
-		{{ 2438, 2450, 2267 }},
-		{{ 1794, 1711, 2253 }},
-		{{ 2253, 2267, 1794 }},
-		{{ 3178, 3162, 3172 }},
-		{{ 3172, 3184, 3178 }},
-		{{ 3154, 3148, 3162 }},
-		{{ 3162, 3178, 3154 }},
-		{{ 3118, 3088, 3148 }},
-		{{ 3148, 3154, 3118 }},
-		{{ 3046, 3036, 3088 }},
-		{{ 3088, 3118, 3046 }},
-		{{ 2915, 2893, 3036 }},
-		{{ 3036, 3046, 2915 }},
-		{{ 2763, 2743, 2893 }},
-		{{ 2893, 2915, 2763 }},
-		{{ 2615, 2599, 2743 }},
-		{{ 2743, 2763, 2615 }},
-		{{ 2452, 2450, 2599 }},
-		{{ 2599, 2615, 2452 }},
-		{{ 2277, 2267, 2450 }},
-		{{ 2450, 2452, 2277 }},
-		{{ 1710, 1794, 2267 }},
-		{{ 2267, 2277, 1710 }},
-		{{ 3188, 3178, 3184 }},
-		{{ 3184, 3200, 3188 }},
-		{{ 3164, 3154, 3178 }},
-		{{ 3178, 3188, 3164 }},
-		{{ 3130, 3118, 3154 }},
-		{{ 3154, 3164, 3130 }},
-		{{ 3058, 3046, 3118 }},
-		{{ 3118, 3130, 3058 }},
-		{{ 2941, 2915, 3046 }},
-		{{ 3046, 3058, 2941 }},
-		{{ 2775, 2763, 2915 }},
-		{{ 2915, 2941, 2775 }},
-		{{ 2627, 2615, 2763 }},
-		{{ 2763, 2775, 2627 }},
-		{{ 2458, 2452, 2615 }},
-		{{ 2615, 2627, 2458 }},
-		{{ 2287, 2277, 2452 }},
-		{{ 2452, 2458, 2287 }},
-		{{ 1910, 1710, 2277 }},
-		{{ 2277, 2287, 1910 }},
-		{{ 3198, 3188, 3200 }},
-		{{ 3200, 3209, 3198 }},
-		{{ 3170, 3164, 3188 }},
-		{{ 3188, 3198, 3170 }},
-		{{ 3136, 3130, 3164 }},
-		{{ 3164, 3170, 3136 }},
-		{{ 3064, 3058, 3130 }},
-		{{ 3130, 3136, 3064 }},
-		{{ 2955, 2941, 3058 }},
-		{{ 3058, 3064, 2955 }},
-		{{ 2781, 2775, 2941 }},
-		{{ 2941, 2955, 2781 }},
-		{{ 2636, 2627, 2775 }},
-		{{ 2775, 2781, 2636 }},
-		{{ 2462, 2458, 2627 }},
-		{{ 2627, 2636, 2462 }},
-		{{ 2295, 2287, 2458 }},
-		{{ 2458, 2462, 2295 }},
-		{{ 1909, 1910, 2287 }},
-		{{ 2287, 2295, 1909 }},
-		{{ 3202, 3198, 3209 }},
-		{{ 3209, 3213, 3202 }},
-		{{ 3174, 3170, 3198 }},
-		{{ 3198, 3202, 3174 }},
-		{{ 3138, 3136, 3170 }},
-		{{ 3170, 3174, 3138 }},
-		{{ 3066, 3064, 3136 }},
-		{{ 3136, 3138, 3066 }},
-		{{ 2961, 2955, 3064 }},
-		{{ 3064, 3066, 2961 }},
-		{{ 2783, 2781, 2955 }},
-		{{ 2955, 2961, 2783 }},
-		{{ 2642, 2636, 2781 }},
-		{{ 2781, 2783, 2642 }},
-		{{ 2464, 2462, 2636 }},
-		{{ 2636, 2642, 2464 }},
-		{{ 2297, 2295, 2462 }},
-		{{ 2462, 2464, 2297 }},
-		{{ 1784, 1909, 2295 }},
-		{{ 2295, 2297, 1784 }},
-		{{ 1414, 1429, 1811 }},
-		{{ 1811, 1807, 1414 }},
-		{{ 1220, 1233, 1429 }},
-		{{ 1429, 1414, 1220 }},
-		{{ 1093, 1106, 1233 }},
-		{{ 1233, 1220, 1093 }},
-		{{ 977, 1011, 1106 }},
-		{{ 1106, 1093, 977 }},
-		{{ 891, 911, 1011 }},
-		{{ 1011, 977, 891 }},
-		{{ 781, 817, 911 }},
-		{{ 911, 891, 781 }},
-		{{ 679, 733, 817 }},
-		{{ 817, 781, 679 }},
-		{{ 604, 649, 733 }},
-		{{ 733, 679, 604 }},
-		{{ 571, 614, 649 }},
-		{{ 649, 604, 571 }},
-		{{ 561, 597, 614 }},
-		{{ 614, 571, 561 }},
-		{{ 1400, 1414, 1807 }},
-		{{ 1807, 1804, 1400 }},
-		{{ 1212, 1220, 1414 }},
-		{{ 1414, 1400, 1212 }},
-		{{ 1083, 1093, 1220 }},
-		{{ 1220, 1212, 1083 }},
-		{{ 963, 977, 1093 }},
-		{{ 1093, 1083, 963 }},
-		{{ 849, 891, 977 }},
-		{{ 977, 963, 849 }},
-		{{ 739, 781, 891 }},
-		{{ 891, 849, 739 }},
-		{{ 628, 679, 781 }},
-		{{ 781, 739, 628 }},
-		{{ 565, 604, 679 }},
-		{{ 679, 628, 565 }},
-		{{ 530, 571, 604 }},
-		{{ 604, 565, 530 }},
-		{{ 524, 561, 571 }},
-		{{ 571, 530, 524 }},
-		{{ 1386, 1400, 1804 }},
-		{{ 1804, 1802, 1386 }},
-		{{ 1202, 1212, 1400 }},
-		{{ 1400, 1386, 1202 }},
-		{{ 1070, 1083, 1212 }},
-		{{ 1212, 1202, 1070 }},
-		{{ 939, 963, 1083 }},
-		{{ 1083, 1070, 939 }},
-		{{ 814, 849, 963 }},
-		{{ 963, 939, 814 }},
-		{{ 685, 739, 849 }},
-		{{ 849, 814, 685 }},
-		{{ 585, 628, 739 }},
-		{{ 739, 685, 585 }},
-		{{ 528, 565, 628 }},
-		{{ 628, 585, 528 }},
-		{{ 510, 530, 565 }},
-		{{ 565, 528, 510 }},
-		{{ 508, 524, 530 }},
-		{{ 530, 510, 508 }},
-		{{ 1375, 1386, 1802 }},
-		{{ 1802, 1800, 1375 }},
-		{{ 1192, 1202, 1386 }},
-		{{ 1386, 1375, 1192 }},
-		{{ 1050, 1070, 1202 }},
-		{{ 1202, 1192, 1050 }},
-		{{ 917, 939, 1070 }},
-		{{ 1070, 1050, 917 }},
-		{{ 785, 814, 939 }},
-		{{ 939, 917, 785 }},
-		{{ 638, 685, 814 }},
-		{{ 814, 785, 638 }},
-		{{ 553, 585, 685 }},
-		{{ 685, 638, 553 }},
-		{{ 512, 528, 585 }},
-		{{ 585, 553, 512 }},
-		{{ 492, 510, 528 }},
-		{{ 528, 512, 492 }},
-		{{ 482, 508, 510 }},
-		{{ 510, 492, 482 }},
-		{{ 1369, 1375, 1800 }},
-		{{ 1800, 1798, 1369 }},
-		{{ 1184, 1192, 1375 }},
-		{{ 1375, 1369, 1184 }},
-		{{ 1037, 1050, 1192 }},
-		{{ 1192, 1184, 1037 }},
-		{{ 899, 917, 1050 }},
-		{{ 1050, 1037, 899 }},
-		{{ 761, 785, 917 }},
-		{{ 917, 899, 761 }},
-		{{ 608, 638, 785 }},
-		{{ 785, 761, 608 }},
-		{{ 526, 553, 638 }},
-		{{ 638, 608, 526 }},
-		{{ 496, 512, 553 }},
-		{{ 553, 526, 496 }},
-		{{ 454, 492, 512 }},
-		{{ 512, 496, 454 }},
-		{{ 448, 482, 492 }},
-		{{ 492, 454, 448 }},
-		{{ 1355, 1369, 1798 }},
-		{{ 1798, 1795, 1355 }},
-		{{ 1172, 1184, 1369 }},
-		{{ 1369, 1355, 1172 }},
-		{{ 1023, 1037, 1184 }},
-		{{ 1184, 1172, 1023 }},
-		{{ 879, 899, 1037 }},
-		{{ 1037, 1023, 879 }},
-		{{ 729, 761, 899 }},
-		{{ 899, 879, 729 }},
-		{{ 579, 608, 761 }},
-		{{ 761, 729, 579 }},
-		{{ 514, 526, 608 }},
-		{{ 608, 579, 514 }},
-		{{ 457, 496, 526 }},
-		{{ 526, 514, 457 }},
-		{{ 442, 454, 496 }},
-		{{ 496, 457, 442 }},
-		{{ 432, 448, 454 }},
-		{{ 454, 442, 432 }},
-		{{ 1345, 1355, 1795 }},
-		{{ 1795, 1792, 1345 }},
-		{{ 1170, 1172, 1355 }},
-		{{ 1355, 1345, 1170 }},
-		{{ 1007, 1023, 1172 }},
-		{{ 1172, 1170, 1007 }},
-		{{ 859, 879, 1023 }},
-		{{ 1023, 1007, 859 }},
-		{{ 707, 729, 879 }},
-		{{ 879, 859, 707 }},
-		{{ 563, 579, 729 }},
-		{{ 729, 707, 563 }},
-		{{ 506, 514, 579 }},
-		{{ 579, 563, 506 }},
-		{{ 450, 457, 514 }},
-		{{ 514, 506, 450 }},
-		{{ 420, 442, 457 }},
-		{{ 457, 450, 420 }},
-		{{ 412, 432, 442 }},
-		{{ 442, 420, 412 }},
-		{{ 1335, 1345, 1792 }},
-		{{ 1792, 1790, 1335 }},
-		{{ 1164, 1170, 1345 }},
-		{{ 1345, 1335, 1164 }},
-		{{ 995, 1007, 1170 }},
-		{{ 1170, 1164, 995 }},
-		{{ 847, 859, 1007 }},
-		{{ 1007, 995, 847 }},
-		{{ 681, 707, 859 }},
-		{{ 859, 847, 681 }},
-		{{ 547, 563, 707 }},
-		{{ 707, 681, 547 }},
-		{{ 494, 506, 563 }},
-		{{ 563, 547, 494 }},
-		{{ 440, 450, 506 }},
-		{{ 506, 494, 440 }},
-		{{ 410, 420, 450 }},
-		{{ 450, 440, 410 }},
-		{{ 398, 412, 420 }},
-		{{ 420, 410, 398 }},
-		{{ 1327, 1335, 1790 }},
-		{{ 1790, 1788, 1327 }},
-		{{ 1160, 1164, 1335 }},
-		{{ 1335, 1327, 1160 }},
-		{{ 988, 995, 1164 }},
-		{{ 1164, 1160, 988 }},
-		{{ 841, 847, 995 }},
-		{{ 995, 988, 841 }},
-		{{ 667, 681, 847 }},
-		{{ 847, 841, 667 }},
-		{{ 538, 547, 681 }},
-		{{ 681, 667, 538 }},
-		{{ 488, 494, 547 }},
-		{{ 547, 538, 488 }},
-		{{ 434, 440, 494 }},
-		{{ 494, 488, 434 }},
-		{{ 400, 410, 440 }},
-		{{ 440, 434, 400 }},
-		{{ 381, 398, 410 }},
-		{{ 410, 400, 381 }},
-		{{ 1324, 1327, 1788 }},
-		{{ 1788, 1785, 1324 }},
-		{{ 1156, 1160, 1327 }},
-		{{ 1327, 1324, 1156 }},
-		{{ 979, 988, 1160 }},
-		{{ 1160, 1156, 979 }},
-		{{ 837, 841, 988 }},
-		{{ 988, 979, 837 }},
-		{{ 659, 667, 841 }},
-		{{ 841, 837, 659 }},
-		{{ 534, 538, 667 }},
-		{{ 667, 659, 534 }},
-		{{ 484, 488, 538 }},
-		{{ 538, 534, 484 }},
-		{{ 428, 434, 488 }},
-		{{ 488, 484, 428 }},
-		{{ 395, 400, 434 }},
-		{{ 434, 428, 395 }},
-		{{ 374, 381, 400 }},
-		{{ 400, 395, 374 }},
-		{{ 572, 616, 600 }},
-		{{ 600, 562, 572 }},
-		{{ 605, 654, 616 }},
-		{{ 616, 572, 605 }},
-		{{ 680, 737, 654 }},
-		{{ 654, 605, 680 }},
-		{{ 782, 822, 737 }},
-		{{ 737, 680, 782 }},
-		{{ 892, 914, 822 }},
-		{{ 822, 782, 892 }},
-		{{ 978, 1014, 914 }},
-		{{ 914, 892, 978 }},
-		{{ 1094, 1104, 1014 }},
-		{{ 1014, 978, 1094 }},
-		{{ 1221, 1237, 1104 }},
-		{{ 1104, 1094, 1221 }},
-		{{ 1415, 1433, 1237 }},
-		{{ 1237, 1221, 1415 }},
-		{{ 1809, 1819, 1433 }},
-		{{ 1433, 1415, 1809 }},
-		{{ 531, 572, 562 }},
-		{{ 562, 525, 531 }},
-		{{ 566, 605, 572 }},
-		{{ 572, 531, 566 }},
-		{{ 629, 680, 605 }},
-		{{ 605, 566, 629 }},
-		{{ 740, 782, 680 }},
-		{{ 680, 629, 740 }},
-		{{ 850, 892, 782 }},
-		{{ 782, 740, 850 }},
-		{{ 964, 978, 892 }},
-		{{ 892, 850, 964 }},
-		{{ 1084, 1094, 978 }},
-		{{ 978, 964, 1084 }},
-		{{ 1213, 1221, 1094 }},
-		{{ 1094, 1084, 1213 }},
-		{{ 1401, 1415, 1221 }},
-		{{ 1221, 1213, 1401 }},
-		{{ 1931, 1809, 1415 }},
-		{{ 1415, 1401, 1931 }},
-		{{ 511, 531, 525 }},
-		{{ 525, 509, 511 }},
-		{{ 529, 566, 531 }},
-		{{ 531, 511, 529 }},
-		{{ 586, 629, 566 }},
-		{{ 566, 529, 586 }},
-		{{ 686, 740, 629 }},
-		{{ 629, 586, 686 }},
-		{{ 813, 850, 740 }},
-		{{ 740, 686, 813 }},
-		{{ 940, 964, 850 }},
-		{{ 850, 813, 940 }},
-		{{ 1069, 1084, 964 }},
-		{{ 964, 940, 1069 }},
-		{{ 1203, 1213, 1084 }},
-		{{ 1084, 1069, 1203 }},
-		{{ 1385, 1401, 1213 }},
-		{{ 1213, 1203, 1385 }},
-		{{ 1693, 1931, 1401 }},
-		{{ 1401, 1385, 1693 }},
-		{{ 493, 511, 509 }},
-		{{ 509, 483, 493 }},
-		{{ 513, 529, 511 }},
-		{{ 511, 493, 513 }},
-		{{ 554, 586, 529 }},
-		{{ 529, 513, 554 }},
-		{{ 639, 686, 586 }},
-		{{ 586, 554, 639 }},
-		{{ 786, 813, 686 }},
-		{{ 686, 639, 786 }},
-		{{ 918, 940, 813 }},
-		{{ 813, 786, 918 }},
-		{{ 1049, 1069, 940 }},
-		{{ 940, 918, 1049 }},
-		{{ 1193, 1203, 1069 }},
-		{{ 1069, 1049, 1193 }},
-		{{ 1376, 1385, 1203 }},
-		{{ 1203, 1193, 1376 }},
-		{{ 1712, 1693, 1385 }},
-		{{ 1385, 1376, 1712 }},
-		{{ 455, 493, 483 }},
-		{{ 483, 449, 455 }},
-		{{ 497, 513, 493 }},
-		{{ 493, 455, 497 }},
-		{{ 527, 554, 513 }},
-		{{ 513, 497, 527 }},
-		{{ 609, 639, 554 }},
-		{{ 554, 527, 609 }},
-		{{ 762, 786, 639 }},
-		{{ 639, 609, 762 }},
-		{{ 900, 918, 786 }},
-		{{ 786, 762, 900 }},
-		{{ 1038, 1049, 918 }},
-		{{ 918, 900, 1038 }},
-		{{ 1185, 1193, 1049 }},
-		{{ 1049, 1038, 1185 }},
-		{{ 1370, 1376, 1193 }},
-		{{ 1193, 1185, 1370 }},
-		{{ 1912, 1712, 1376 }},
-		{{ 1376, 1370, 1912 }},
-		{{ 443, 455, 449 }},
-		{{ 449, 433, 443 }},
-		{{ 458, 497, 455 }},
-		{{ 455, 443, 458 }},
-		{{ 515, 527, 497 }},
-		{{ 497, 458, 515 }},
-		{{ 580, 609, 527 }},
-		{{ 527, 515, 580 }},
-		{{ 730, 762, 609 }},
-		{{ 609, 580, 730 }},
-		{{ 880, 900, 762 }},
-		{{ 762, 730, 880 }},
-		{{ 1024, 1038, 900 }},
-		{{ 900, 880, 1024 }},
-		{{ 1173, 1185, 1038 }},
-		{{ 1038, 1024, 1173 }},
-		{{ 1356, 1370, 1185 }},
-		{{ 1185, 1173, 1356 }},
-		{{ 1797, 1912, 1370 }},
-		{{ 1370, 1356, 1797 }},
-		{{ 421, 443, 433 }},
-		{{ 433, 413, 421 }},
-		{{ 451, 458, 443 }},
-		{{ 443, 421, 451 }},
-		{{ 507, 515, 458 }},
-		{{ 458, 451, 507 }},
-		{{ 564, 580, 515 }},
-		{{ 515, 507, 564 }},
-		{{ 708, 730, 580 }},
-		{{ 580, 564, 708 }},
-		{{ 860, 880, 730 }},
-		{{ 730, 708, 860 }},
-		{{ 1008, 1024, 880 }},
-		{{ 880, 860, 1008 }},
-		{{ 1171, 1173, 1024 }},
-		{{ 1024, 1008, 1171 }},
-		{{ 1346, 1356, 1173 }},
-		{{ 1173, 1171, 1346 }},
-		{{ 1911, 1797, 1356 }},
-		{{ 1356, 1346, 1911 }},
-		{{ 411, 421, 413 }},
-		{{ 413, 399, 411 }},
-		{{ 441, 451, 421 }},
-		{{ 421, 411, 441 }},
-		{{ 495, 507, 451 }},
-		{{ 451, 441, 495 }},
-		{{ 548, 564, 507 }},
-		{{ 507, 495, 548 }},
-		{{ 682, 708, 564 }},
-		{{ 564, 548, 682 }},
-		{{ 848, 860, 708 }},
-		{{ 708, 682, 848 }},
-		{{ 996, 1008, 860 }},
-		{{ 860, 848, 996 }},
-		{{ 1165, 1171, 1008 }},
-		{{ 1008, 996, 1165 }},
-		{{ 1336, 1346, 1171 }},
-		{{ 1171, 1165, 1336 }},
-		{{ 1709, 1911, 1346 }},
-		{{ 1346, 1336, 1709 }},
-		{{ 401, 411, 399 }},
-		{{ 399, 382, 401 }},
-		{{ 435, 441, 411 }},
-		{{ 411, 401, 435 }},
-		{{ 489, 495, 441 }},
-		{{ 441, 435, 489 }},
-		{{ 539, 548, 495 }},
-		{{ 495, 489, 539 }},
-		{{ 668, 682, 548 }},
-		{{ 548, 539, 668 }},
-		{{ 842, 848, 682 }},
-		{{ 682, 668, 842 }},
-		{{ 987, 996, 848 }},
-		{{ 848, 842, 987 }},
-		{{ 1161, 1165, 996 }},
-		{{ 996, 987, 1161 }},
-		{{ 1328, 1336, 1165 }},
-		{{ 1165, 1161, 1328 }},
-		{{ 1708, 1709, 1336 }},
-		{{ 1336, 1328, 1708 }},
-		{{ 397, 401, 382 }},
-		{{ 382, 376, 397 }},
-		{{ 431, 435, 401 }},
-		{{ 401, 397, 431 }},
-		{{ 487, 489, 435 }},
-		{{ 435, 431, 487 }},
-		{{ 537, 539, 489 }},
-		{{ 489, 487, 537 }},
-		{{ 662, 668, 539 }},
-		{{ 539, 537, 662 }},
-		{{ 840, 842, 668 }},
-		{{ 668, 662, 840 }},
-		{{ 981, 987, 842 }},
-		{{ 842, 840, 981 }},
-		{{ 1159, 1161, 987 }},
-		{{ 987, 981, 1159 }},
-		{{ 1326, 1328, 1161 }},
-		{{ 1161, 1159, 1326 }},
-		{{ 1787, 1708, 1328 }},
-		{{ 1328, 1326, 1787 }},
-		{{ 2209, 2194, 1818 }},
-		{{ 1818, 1808, 2209 }},
-		{{ 2403, 2391, 2194 }},
-		{{ 2194, 2209, 2403 }},
-		{{ 2530, 2518, 2391 }},
-		{{ 2391, 2403, 2530 }},
-		{{ 2646, 2614, 2518 }},
-		{{ 2518, 2530, 2646 }},
-		{{ 2732, 2712, 2614 }},
-		{{ 2614, 2646, 2732 }},
-		{{ 2842, 2806, 2712 }},
-		{{ 2712, 2732, 2842 }},
-		{{ 2944, 2890, 2806 }},
-		{{ 2806, 2842, 2944 }},
-		{{ 3019, 2974, 2890 }},
-		{{ 2890, 2944, 3019 }},
-		{{ 3041, 3009, 2974 }},
-		{{ 2974, 3019, 3041 }},
-		{{ 3049, 3025, 3009 }},
-		{{ 3009, 3041, 3049 }},
-		{{ 2223, 2209, 1808 }},
-		{{ 1808, 1805, 2223 }},
-		{{ 2411, 2403, 2209 }},
-		{{ 2209, 2223, 2411 }},
-		{{ 2540, 2530, 2403 }},
-		{{ 2403, 2411, 2540 }},
-		{{ 2660, 2646, 2530 }},
-		{{ 2530, 2540, 2660 }},
-		{{ 2774, 2732, 2646 }},
-		{{ 2646, 2660, 2774 }},
-		{{ 2884, 2842, 2732 }},
-		{{ 2732, 2774, 2884 }},
-		{{ 2995, 2944, 2842 }},
-		{{ 2842, 2884, 2995 }},
-		{{ 3045, 3019, 2944 }},
-		{{ 2944, 2995, 3045 }},
-		{{ 3073, 3041, 3019 }},
-		{{ 3019, 3045, 3073 }},
-		{{ 3079, 3049, 3041 }},
-		{{ 3041, 3073, 3079 }},
-		{{ 2237, 2223, 1805 }},
-		{{ 1805, 1803, 2237 }},
-		{{ 2421, 2411, 2223 }},
-		{{ 2223, 2237, 2421 }},
-		{{ 2553, 2540, 2411 }},
-		{{ 2411, 2421, 2553 }},
-		{{ 2684, 2660, 2540 }},
-		{{ 2540, 2553, 2684 }},
-		{{ 2809, 2774, 2660 }},
-		{{ 2660, 2684, 2809 }},
-		{{ 2938, 2884, 2774 }},
-		{{ 2774, 2809, 2938 }},
-		{{ 3031, 2995, 2884 }},
-		{{ 2884, 2938, 3031 }},
-		{{ 3075, 3045, 2995 }},
-		{{ 2995, 3031, 3075 }},
-		{{ 3093, 3073, 3045 }},
-		{{ 3045, 3075, 3093 }},
-		{{ 3117, 3079, 3073 }},
-		{{ 3073, 3093, 3117 }},
-		{{ 2248, 2237, 1803 }},
-		{{ 1803, 1801, 2248 }},
-		{{ 2431, 2421, 2237 }},
-		{{ 2237, 2248, 2431 }},
-		{{ 2573, 2553, 2421 }},
-		{{ 2421, 2431, 2573 }},
-		{{ 2706, 2684, 2553 }},
-		{{ 2553, 2573, 2706 }},
-		{{ 2838, 2809, 2684 }},
-		{{ 2684, 2706, 2838 }},
-		{{ 2985, 2938, 2809 }},
-		{{ 2809, 2838, 2985 }},
-		{{ 3055, 3031, 2938 }},
-		{{ 2938, 2985, 3055 }},
-		{{ 3091, 3075, 3031 }},
-		{{ 3031, 3055, 3091 }},
-		{{ 3133, 3093, 3075 }},
-		{{ 3075, 3091, 3133 }},
-		{{ 3143, 3117, 3093 }},
-		{{ 3093, 3133, 3143 }},
-		{{ 2254, 2248, 1801 }},
-		{{ 1801, 1799, 2254 }},
-		{{ 2439, 2431, 2248 }},
-		{{ 2248, 2254, 2439 }},
-		{{ 2586, 2573, 2431 }},
-		{{ 2431, 2439, 2586 }},
-		{{ 2724, 2706, 2573 }},
-		{{ 2573, 2586, 2724 }},
-		{{ 2862, 2838, 2706 }},
-		{{ 2706, 2724, 2862 }},
-		{{ 3015, 2985, 2838 }},
-		{{ 2838, 2862, 3015 }},
-		{{ 3077, 3055, 2985 }},
-		{{ 2985, 3015, 3077 }},
-		{{ 3129, 3091, 3055 }},
-		{{ 3055, 3077, 3129 }},
-		{{ 3151, 3133, 3091 }},
-		{{ 3091, 3129, 3151 }},
-		{{ 3157, 3143, 3133 }},
-		{{ 3133, 3151, 3157 }},
-		{{ 2268, 2254, 1799 }},
-		{{ 1799, 1796, 2268 }},
-		{{ 2451, 2439, 2254 }},
-		{{ 2254, 2268, 2451 }},
-		{{ 2600, 2586, 2439 }},
-		{{ 2439, 2451, 2600 }},
-		{{ 2744, 2724, 2586 }},
-		{{ 2586, 2600, 2744 }},
-		{{ 2894, 2862, 2724 }},
-		{{ 2724, 2744, 2894 }},
-		{{ 3037, 3015, 2862 }},
-		{{ 2862, 2894, 3037 }},
-		{{ 3089, 3077, 3015 }},
-		{{ 3015, 3037, 3089 }},
-		{{ 3149, 3129, 3077 }},
-		{{ 3077, 3089, 3149 }},
-		{{ 3163, 3151, 3129 }},
-		{{ 3129, 3149, 3163 }},
-		{{ 3173, 3157, 3151 }},
-		{{ 3151, 3163, 3173 }},
-		{{ 2278, 2268, 1796 }},
-		{{ 1796, 1793, 2278 }},
-		{{ 2453, 2451, 2268 }},
-		{{ 2268, 2278, 2453 }},
-		{{ 2616, 2600, 2451 }},
-		{{ 2451, 2453, 2616 }},
-		{{ 2764, 2744, 2600 }},
-		{{ 2600, 2616, 2764 }},
-		{{ 2916, 2894, 2744 }},
-		{{ 2744, 2764, 2916 }},
-		{{ 3047, 3037, 2894 }},
-		{{ 2894, 2916, 3047 }},
-		{{ 3119, 3089, 3037 }},
-		{{ 3037, 3047, 3119 }},
-		{{ 3155, 3149, 3089 }},
-		{{ 3089, 3119, 3155 }},
-		{{ 3179, 3163, 3149 }},
-		{{ 3149, 3155, 3179 }},
-		{{ 3185, 3173, 3163 }},
-		{{ 3163, 3179, 3185 }},
-		{{ 2288, 2278, 1793 }},
-		{{ 1793, 1791, 2288 }},
-		{{ 2459, 2453, 2278 }},
-		{{ 2278, 2288, 2459 }},
-		{{ 2628, 2616, 2453 }},
-		{{ 2453, 2459, 2628 }},
-		{{ 2776, 2764, 2616 }},
-		{{ 2616, 2628, 2776 }},
-		{{ 2942, 2916, 2764 }},
-		{{ 2764, 2776, 2942 }},
-		{{ 3059, 3047, 2916 }},
-		{{ 2916, 2942, 3059 }},
-		{{ 3131, 3119, 3047 }},
-		{{ 3047, 3059, 3131 }},
-		{{ 3165, 3155, 3119 }},
-		{{ 3119, 3131, 3165 }},
-		{{ 3189, 3179, 3155 }},
-		{{ 3155, 3165, 3189 }},
-		{{ 3201, 3185, 3179 }},
-		{{ 3179, 3189, 3201 }},
-		{{ 2296, 2288, 1791 }},
-		{{ 1791, 1789, 2296 }},
-		{{ 2463, 2459, 2288 }},
-		{{ 2288, 2296, 2463 }},
-		{{ 2635, 2628, 2459 }},
-		{{ 2459, 2463, 2635 }},
-		{{ 2782, 2776, 2628 }},
-		{{ 2628, 2635, 2782 }},
-		{{ 2956, 2942, 2776 }},
-		{{ 2776, 2782, 2956 }},
-		{{ 3065, 3059, 2942 }},
-		{{ 2942, 2956, 3065 }},
-		{{ 3137, 3131, 3059 }},
-		{{ 3059, 3065, 3137 }},
-		{{ 3171, 3165, 3131 }},
-		{{ 3131, 3137, 3171 }},
-		{{ 3199, 3189, 3165 }},
-		{{ 3165, 3171, 3199 }},
-		{{ 3210, 3201, 3189 }},
-		{{ 3189, 3199, 3210 }},
-		{{ 2299, 2296, 1789 }},
-		{{ 1789, 1786, 2299 }},
-		{{ 2467, 2463, 2296 }},
-		{{ 2296, 2299, 2467 }},
-		{{ 2644, 2635, 2463 }},
-		{{ 2463, 2467, 2644 }},
-		{{ 2786, 2782, 2635 }},
-		{{ 2635, 2644, 2786 }},
-		{{ 2964, 2956, 2782 }},
-		{{ 2782, 2786, 2964 }},
-		{{ 3069, 3065, 2956 }},
-		{{ 2956, 2964, 3069 }},
-		{{ 3141, 3137, 3065 }},
-		{{ 3065, 3069, 3141 }},
-		{{ 3177, 3171, 3137 }},
-		{{ 3137, 3141, 3177 }},
-		{{ 3204, 3199, 3171 }},
-		{{ 3171, 3177, 3204 }},
-		{{ 3214, 3210, 3199 }},
-		{{ 3199, 3204, 3214 }},
-		{{ 3194, 3202, 3213 }},
-		{{ 3213, 3207, 3194 }},
-		{{ 3166, 3175, 3202 }},
-		{{ 3202, 3194, 3166 }},
-		{{ 3134, 3139, 3175 }},
-		{{ 3175, 3166, 3134 }},
-		{{ 3060, 3067, 3139 }},
-		{{ 3139, 3134, 3060 }},
-		{{ 2953, 2962, 3067 }},
-		{{ 3067, 3060, 2953 }},
-		{{ 2777, 2784, 2962 }},
-		{{ 2962, 2953, 2777 }},
-		{{ 2629, 2643, 2784 }},
-		{{ 2784, 2777, 2629 }},
-		{{ 2460, 2465, 2643 }},
-		{{ 2643, 2629, 2460 }},
-		{{ 2293, 2298, 2465 }},
-		{{ 2465, 2460, 2293 }},
-		{{ 1696, 1785, 2298 }},
-		{{ 2298, 2293, 1696 }},
-		{{ 3180, 3194, 3207 }},
-		{{ 3207, 3190, 3180 }},
-		{{ 3158, 3166, 3194 }},
-		{{ 3194, 3180, 3158 }},
-		{{ 3124, 3134, 3166 }},
-		{{ 3166, 3158, 3124 }},
-		{{ 3050, 3060, 3134 }},
-		{{ 3134, 3124, 3050 }},
-		{{ 2927, 2953, 3060 }},
-		{{ 3060, 3050, 2927 }},
-		{{ 2767, 2777, 2953 }},
-		{{ 2953, 2927, 2767 }},
-		{{ 2619, 2629, 2777 }},
-		{{ 2777, 2767, 2619 }},
-		{{ 2454, 2460, 2629 }},
-		{{ 2629, 2619, 2454 }},
-		{{ 2283, 2293, 2460 }},
-		{{ 2460, 2454, 2283 }},
-		{{ 1695, 1696, 2293 }},
-		{{ 2293, 2283, 1695 }},
-		{{ 3160, 3180, 3190 }},
-		{{ 3190, 3168, 3160 }},
-		{{ 3144, 3158, 3180 }},
-		{{ 3180, 3160, 3144 }},
-		{{ 3086, 3124, 3158 }},
-		{{ 3158, 3144, 3086 }},
-		{{ 3032, 3050, 3124 }},
-		{{ 3124, 3086, 3032 }},
-		{{ 2891, 2927, 3050 }},
-		{{ 3050, 3032, 2891 }},
-		{{ 2739, 2767, 2927 }},
-		{{ 2927, 2891, 2739 }},
-		{{ 2597, 2619, 2767 }},
-		{{ 2767, 2739, 2597 }},
-		{{ 2448, 2454, 2619 }},
-		{{ 2619, 2597, 2448 }},
-		{{ 2265, 2283, 2454 }},
-		{{ 2454, 2448, 2265 }},
-		{{ 1707, 1695, 2283 }},
-		{{ 2283, 2265, 1707 }},
-		{{ 3146, 3160, 3168 }},
-		{{ 3168, 3152, 3146 }},
-		{{ 3122, 3144, 3160 }},
-		{{ 3160, 3146, 3122 }},
-		{{ 3070, 3086, 3144 }},
-		{{ 3144, 3122, 3070 }},
-		{{ 2998, 3032, 3086 }},
-		{{ 3086, 3070, 2998 }},
-		{{ 2853, 2891, 3032 }},
-		{{ 3032, 2998, 2853 }},
-		{{ 2717, 2739, 2891 }},
-		{{ 2891, 2853, 2717 }},
-		{{ 2582, 2597, 2739 }},
-		{{ 2739, 2717, 2582 }},
-		{{ 2434, 2448, 2597 }},
-		{{ 2597, 2582, 2434 }},
-		{{ 2251, 2265, 2448 }},
-		{{ 2448, 2434, 2251 }},
-		{{ 1907, 1707, 2265 }},
-		{{ 2265, 2251, 1907 }},
-		{{ 3120, 3146, 3152 }},
-		{{ 3152, 3126, 3120 }},
-		{{ 3082, 3122, 3146 }},
-		{{ 3146, 3120, 3082 }},
-		{{ 3042, 3070, 3122 }},
-		{{ 3122, 3082, 3042 }},
-		{{ 2957, 2998, 3070 }},
-		{{ 3070, 3042, 2957 }},
-		{{ 2825, 2853, 2998 }},
-		{{ 2998, 2957, 2825 }},
-		{{ 2693, 2717, 2853 }},
-		{{ 2853, 2825, 2693 }},
-		{{ 2556, 2582, 2717 }},
-		{{ 2717, 2693, 2556 }},
-		{{ 2424, 2434, 2582 }},
-		{{ 2582, 2556, 2424 }},
-		{{ 2239, 2251, 2434 }},
-		{{ 2434, 2424, 2239 }},
-		{{ 1906, 1907, 2251 }},
-		{{ 2251, 2239, 1906 }},
-		{{ 3080, 3120, 3126 }},
-		{{ 3126, 3084, 3080 }},
-		{{ 3056, 3082, 3120 }},
-		{{ 3120, 3080, 3056 }},
-		{{ 3012, 3042, 3082 }},
-		{{ 3082, 3056, 3012 }},
-		{{ 2899, 2957, 3042 }},
-		{{ 3042, 3012, 2899 }},
-		{{ 2789, 2825, 2957 }},
-		{{ 2957, 2899, 2789 }},
-		{{ 2675, 2693, 2825 }},
-		{{ 2825, 2789, 2675 }},
-		{{ 2545, 2556, 2693 }},
-		{{ 2693, 2675, 2545 }},
-		{{ 2416, 2424, 2556 }},
-		{{ 2556, 2545, 2416 }},
-		{{ 2228, 2239, 2424 }},
-		{{ 2424, 2416, 2228 }},
-		{{ 1770, 1906, 2239 }},
-		{{ 2239, 2228, 1770 }},
-		{{ 3053, 3080, 3084 }},
-		{{ 3084, 3062, 3053 }},
-		{{ 3028, 3056, 3080 }},
-		{{ 3080, 3053, 3028 }},
-		{{ 2978, 3012, 3056 }},
-		{{ 3056, 3028, 2978 }},
-		{{ 2860, 2899, 3012 }},
-		{{ 3012, 2978, 2860 }},
-		{{ 2754, 2789, 2899 }},
-		{{ 2899, 2860, 2754 }},
-		{{ 2652, 2675, 2789 }},
-		{{ 2789, 2754, 2652 }},
-		{{ 2534, 2545, 2675 }},
-		{{ 2675, 2652, 2534 }},
-		{{ 2406, 2416, 2545 }},
-		{{ 2545, 2534, 2406 }},
-		{{ 2217, 2228, 2416 }},
-		{{ 2416, 2406, 2217 }},
-		{{ 1929, 1770, 2228 }},
-		{{ 2228, 2217, 1929 }},
-		{{ 3035, 3053, 3062 }},
-		{{ 3062, 3039, 3035 }},
-		{{ 2997, 3028, 3053 }},
-		{{ 3053, 3035, 2997 }},
-		{{ 2920, 2978, 3028 }},
-		{{ 3028, 2997, 2920 }},
-		{{ 2832, 2860, 2978 }},
-		{{ 2978, 2920, 2832 }},
-		{{ 2728, 2754, 2860 }},
-		{{ 2860, 2832, 2728 }},
-		{{ 2634, 2652, 2754 }},
-		{{ 2754, 2728, 2634 }},
-		{{ 2528, 2534, 2652 }},
-		{{ 2652, 2634, 2528 }},
-		{{ 2396, 2406, 2534 }},
-		{{ 2534, 2528, 2396 }},
-		{{ 2202, 2217, 2406 }},
-		{{ 2406, 2396, 2202 }},
-		{{ 1765, 1929, 2217 }},
-		{{ 2217, 2202, 1765 }},
-		{{ 3017, 3035, 3039 }},
-		{{ 3039, 3027, 3017 }},
-		{{ 2980, 2997, 3035 }},
-		{{ 3035, 3017, 2980 }},
-		{{ 2896, 2920, 2997 }},
-		{{ 2997, 2980, 2896 }},
-		{{ 2812, 2832, 2920 }},
-		{{ 2920, 2896, 2812 }},
-		{{ 2715, 2728, 2832 }},
-		{{ 2832, 2812, 2715 }},
-		{{ 2618, 2634, 2728 }},
-		{{ 2728, 2715, 2618 }},
-		{{ 2523, 2528, 2634 }},
-		{{ 2634, 2618, 2523 }},
-		{{ 2392, 2396, 2528 }},
-		{{ 2528, 2523, 2392 }},
-		{{ 2196, 2202, 2396 }},
-		{{ 2396, 2392, 2196 }},
-		{{ 1724, 1765, 2202 }},
-		{{ 2202, 2196, 1724 }},
-		{{ 3007, 3017, 3027 }},
-		{{ 3027, 3023, 3007 }},
-		{{ 2969, 2980, 3017 }},
-		{{ 3017, 3007, 2969 }},
-		{{ 2887, 2896, 2980 }},
-		{{ 2980, 2969, 2887 }},
-		{{ 2802, 2812, 2896 }},
-		{{ 2896, 2887, 2802 }},
-		{{ 2709, 2715, 2812 }},
-		{{ 2812, 2802, 2709 }},
-		{{ 2609, 2618, 2715 }},
-		{{ 2715, 2709, 2609 }},
-		{{ 2519, 2523, 2618 }},
-		{{ 2618, 2609, 2519 }},
-		{{ 2386, 2392, 2523 }},
-		{{ 2523, 2519, 2386 }},
-		{{ 2190, 2196, 2392 }},
-		{{ 2392, 2386, 2190 }},
-		{{ 1759, 1724, 2196 }},
-		{{ 2196, 2190, 1759 }},
-		{{ 1329, 1324, 1785 }},
-		{{ 1785, 1782, 1329 }},
-		{{ 1162, 1157, 1324 }},
-		{{ 1324, 1329, 1162 }},
-		{{ 993, 982, 1157 }},
-		{{ 1157, 1162, 993 }},
-		{{ 845, 838, 982 }},
-		{{ 982, 993, 845 }},
-		{{ 669, 660, 838 }},
-		{{ 838, 845, 669 }},
-		{{ 542, 535, 660 }},
-		{{ 660, 669, 542 }},
-		{{ 490, 485, 535 }},
-		{{ 535, 542, 490 }},
-		{{ 438, 429, 485 }},
-		{{ 485, 490, 438 }},
-		{{ 404, 396, 429 }},
-		{{ 429, 438, 404 }},
-		{{ 387, 376, 396 }},
-		{{ 396, 404, 387 }},
-		{{ 1339, 1329, 1782 }},
-		{{ 1782, 1780, 1339 }},
-		{{ 1168, 1162, 1329 }},
-		{{ 1329, 1339, 1168 }},
-		{{ 1003, 993, 1162 }},
-		{{ 1162, 1168, 1003 }},
-		{{ 855, 845, 993 }},
-		{{ 993, 1003, 855 }},
-		{{ 695, 669, 845 }},
-		{{ 845, 855, 695 }},
-		{{ 559, 542, 669 }},
-		{{ 669, 695, 559 }},
-		{{ 500, 490, 542 }},
-		{{ 542, 559, 500 }},
-		{{ 446, 438, 490 }},
-		{{ 490, 500, 446 }},
-		{{ 416, 404, 438 }},
-		{{ 438, 446, 416 }},
-		{{ 408, 387, 404 }},
-		{{ 404, 416, 408 }},
-		{{ 1357, 1339, 1780 }},
-		{{ 1780, 1778, 1357 }},
-		{{ 1174, 1168, 1339 }},
-		{{ 1339, 1357, 1174 }},
-		{{ 1025, 1003, 1168 }},
-		{{ 1168, 1174, 1025 }},
-		{{ 883, 855, 1003 }},
-		{{ 1003, 1025, 883 }},
-		{{ 731, 695, 855 }},
-		{{ 855, 883, 731 }},
-		{{ 583, 559, 695 }},
-		{{ 695, 731, 583 }},
-		{{ 516, 500, 559 }},
-		{{ 559, 583, 516 }},
-		{{ 467, 446, 500 }},
-		{{ 500, 516, 467 }},
-		{{ 444, 416, 446 }},
-		{{ 446, 467, 444 }},
-		{{ 436, 408, 416 }},
-		{{ 416, 444, 436 }},
-		{{ 1371, 1357, 1778 }},
-		{{ 1778, 1776, 1371 }},
-		{{ 1188, 1174, 1357 }},
-		{{ 1357, 1371, 1188 }},
-		{{ 1042, 1025, 1174 }},
-		{{ 1174, 1188, 1042 }},
-		{{ 905, 883, 1025 }},
-		{{ 1025, 1042, 905 }},
-		{{ 769, 731, 883 }},
-		{{ 883, 905, 769 }},
-		{{ 624, 583, 731 }},
-		{{ 731, 769, 624 }},
-		{{ 532, 516, 583 }},
-		{{ 583, 624, 532 }},
-		{{ 502, 467, 516 }},
-		{{ 516, 532, 502 }},
-		{{ 459, 444, 467 }},
-		{{ 467, 502, 459 }},
-		{{ 452, 436, 444 }},
-		{{ 444, 459, 452 }},
-		{{ 1383, 1371, 1776 }},
-		{{ 1776, 1774, 1383 }},
-		{{ 1198, 1188, 1371 }},
-		{{ 1371, 1383, 1198 }},
-		{{ 1068, 1042, 1188 }},
-		{{ 1188, 1198, 1068 }},
-		{{ 929, 905, 1042 }},
-		{{ 1042, 1068, 929 }},
-		{{ 797, 769, 905 }},
-		{{ 905, 929, 797 }},
-		{{ 665, 624, 769 }},
-		{{ 769, 797, 665 }},
-		{{ 569, 532, 624 }},
-		{{ 624, 665, 569 }},
-		{{ 520, 502, 532 }},
-		{{ 532, 569, 520 }},
-		{{ 504, 459, 502 }},
-		{{ 502, 520, 504 }},
-		{{ 498, 452, 459 }},
-		{{ 459, 504, 498 }},
-		{{ 1394, 1383, 1774 }},
-		{{ 1774, 1771, 1394 }},
-		{{ 1206, 1198, 1383 }},
-		{{ 1383, 1394, 1206 }},
-		{{ 1077, 1068, 1198 }},
-		{{ 1198, 1206, 1077 }},
-		{{ 947, 929, 1068 }},
-		{{ 1068, 1077, 947 }},
-		{{ 833, 797, 929 }},
-		{{ 929, 947, 833 }},
-		{{ 723, 665, 797 }},
-		{{ 797, 833, 723 }},
-		{{ 610, 569, 665 }},
-		{{ 665, 723, 610 }},
-		{{ 549, 520, 569 }},
-		{{ 569, 610, 549 }},
-		{{ 522, 504, 520 }},
-		{{ 520, 549, 522 }},
-		{{ 518, 498, 504 }},
-		{{ 504, 522, 518 }},
-		{{ 1407, 1394, 1771 }},
-		{{ 1771, 1768, 1407 }},
-		{{ 1216, 1206, 1394 }},
-		{{ 1394, 1407, 1216 }},
-		{{ 1090, 1077, 1206 }},
-		{{ 1206, 1216, 1090 }},
-		{{ 972, 947, 1077 }},
-		{{ 1077, 1090, 972 }},
-		{{ 870, 833, 947 }},
-		{{ 947, 972, 870 }},
-		{{ 764, 723, 833 }},
-		{{ 833, 870, 764 }},
-		{{ 646, 610, 723 }},
-		{{ 723, 764, 646 }},
-		{{ 587, 549, 610 }},
-		{{ 610, 646, 587 }},
-		{{ 556, 522, 549 }},
-		{{ 549, 587, 556 }},
-		{{ 540, 518, 522 }},
-		{{ 522, 556, 540 }},
-		{{ 1420, 1407, 1768 }},
-		{{ 1768, 1764, 1420 }},
-		{{ 1226, 1216, 1407 }},
-		{{ 1407, 1420, 1226 }},
-		{{ 1096, 1090, 1216 }},
-		{{ 1216, 1226, 1096 }},
-		{{ 990, 972, 1090 }},
-		{{ 1090, 1096, 990 }},
-		{{ 896, 870, 972 }},
-		{{ 972, 990, 896 }},
-		{{ 792, 764, 870 }},
-		{{ 870, 896, 792 }},
-		{{ 704, 646, 764 }},
-		{{ 764, 792, 704 }},
-		{{ 627, 587, 646 }},
-		{{ 646, 704, 627 }},
-		{{ 582, 556, 587 }},
-		{{ 587, 627, 582 }},
-		{{ 574, 540, 556 }},
-		{{ 556, 582, 574 }},
-		{{ 1426, 1420, 1764 }},
-		{{ 1764, 1762, 1426 }},
-		{{ 1230, 1226, 1420 }},
-		{{ 1420, 1426, 1230 }},
-		{{ 1101, 1096, 1226 }},
-		{{ 1226, 1230, 1101 }},
-		{{ 1006, 990, 1096 }},
-		{{ 1096, 1101, 1006 }},
-		{{ 907, 896, 990 }},
-		{{ 990, 1006, 907 }},
-		{{ 812, 792, 896 }},
-		{{ 896, 907, 812 }},
-		{{ 728, 704, 792 }},
-		{{ 792, 812, 728 }},
-		{{ 644, 627, 704 }},
-		{{ 704, 728, 644 }},
-		{{ 607, 582, 627 }},
-		{{ 627, 644, 607 }},
-		{{ 592, 574, 582 }},
-		{{ 582, 607, 592 }},
-		{{ 1430, 1426, 1762 }},
-		{{ 1762, 1758, 1430 }},
-		{{ 1234, 1230, 1426 }},
-		{{ 1426, 1430, 1234 }},
-		{{ 1107, 1101, 1230 }},
-		{{ 1230, 1234, 1107 }},
-		{{ 1012, 1006, 1101 }},
-		{{ 1101, 1107, 1012 }},
-		{{ 912, 907, 1006 }},
-		{{ 1006, 1012, 912 }},
-		{{ 819, 812, 907 }},
-		{{ 907, 912, 819 }},
-		{{ 738, 728, 812 }},
-		{{ 812, 819, 738 }},
-		{{ 651, 644, 728 }},
-		{{ 728, 738, 651 }},
-		{{ 618, 607, 644 }},
-		{{ 644, 651, 618 }},
-		{{ 601, 592, 607 }},
-		{{ 607, 618, 601 }},
-		{{ 405, 397, 376 }},
-		{{ 376, 388, 405 }},
-		{{ 439, 430, 397 }},
-		{{ 397, 405, 439 }},
-		{{ 491, 486, 430 }},
-		{{ 430, 439, 491 }},
-		{{ 543, 536, 486 }},
-		{{ 486, 491, 543 }},
-		{{ 670, 661, 536 }},
-		{{ 536, 543, 670 }},
-		{{ 846, 839, 661 }},
-		{{ 661, 670, 846 }},
-		{{ 994, 980, 839 }},
-		{{ 839, 846, 994 }},
-		{{ 1163, 1158, 980 }},
-		{{ 980, 994, 1163 }},
-		{{ 1330, 1325, 1158 }},
-		{{ 1158, 1163, 1330 }},
-		{{ 1926, 1786, 1325 }},
-		{{ 1325, 1330, 1926 }},
-		{{ 417, 405, 388 }},
-		{{ 388, 409, 417 }},
-		{{ 447, 439, 405 }},
-		{{ 405, 417, 447 }},
-		{{ 501, 491, 439 }},
-		{{ 439, 447, 501 }},
-		{{ 560, 543, 491 }},
-		{{ 491, 501, 560 }},
-		{{ 696, 670, 543 }},
-		{{ 543, 560, 696 }},
-		{{ 856, 846, 670 }},
-		{{ 670, 696, 856 }},
-		{{ 1004, 994, 846 }},
-		{{ 846, 856, 1004 }},
-		{{ 1169, 1163, 994 }},
-		{{ 994, 1004, 1169 }},
-		{{ 1340, 1330, 1163 }},
-		{{ 1163, 1169, 1340 }},
-		{{ 1925, 1926, 1330 }},
-		{{ 1330, 1340, 1925 }},
-		{{ 445, 417, 409 }},
-		{{ 409, 437, 445 }},
-		{{ 468, 447, 417 }},
-		{{ 417, 445, 468 }},
-		{{ 517, 501, 447 }},
-		{{ 447, 468, 517 }},
-		{{ 584, 560, 501 }},
-		{{ 501, 517, 584 }},
-		{{ 732, 696, 560 }},
-		{{ 560, 584, 732 }},
-		{{ 884, 856, 696 }},
-		{{ 696, 732, 884 }},
-		{{ 1026, 1004, 856 }},
-		{{ 856, 884, 1026 }},
-		{{ 1175, 1169, 1004 }},
-		{{ 1004, 1026, 1175 }},
-		{{ 1358, 1340, 1169 }},
-		{{ 1169, 1175, 1358 }},
-		{{ 1908, 1925, 1340 }},
-		{{ 1340, 1358, 1908 }},
-		{{ 460, 445, 437 }},
-		{{ 437, 453, 460 }},
-		{{ 503, 468, 445 }},
-		{{ 445, 460, 503 }},
-		{{ 533, 517, 468 }},
-		{{ 468, 503, 533 }},
-		{{ 625, 584, 517 }},
-		{{ 517, 533, 625 }},
-		{{ 770, 732, 584 }},
-		{{ 584, 625, 770 }},
-		{{ 906, 884, 732 }},
-		{{ 732, 770, 906 }},
-		{{ 1041, 1026, 884 }},
-		{{ 884, 906, 1041 }},
-		{{ 1189, 1175, 1026 }},
-		{{ 1026, 1041, 1189 }},
-		{{ 1372, 1358, 1175 }},
-		{{ 1175, 1189, 1372 }},
-		{{ 1706, 1908, 1358 }},
-		{{ 1358, 1372, 1706 }},
-		{{ 505, 460, 453 }},
-		{{ 453, 499, 505 }},
-		{{ 521, 503, 460 }},
-		{{ 460, 505, 521 }},
-		{{ 570, 533, 503 }},
-		{{ 503, 521, 570 }},
-		{{ 666, 625, 533 }},
-		{{ 533, 570, 666 }},
-		{{ 798, 770, 625 }},
-		{{ 625, 666, 798 }},
-		{{ 930, 906, 770 }},
-		{{ 770, 798, 930 }},
-		{{ 1067, 1041, 906 }},
-		{{ 906, 930, 1067 }},
-		{{ 1199, 1189, 1041 }},
-		{{ 1041, 1067, 1199 }},
-		{{ 1384, 1372, 1189 }},
-		{{ 1189, 1199, 1384 }},
-		{{ 1705, 1706, 1372 }},
-		{{ 1372, 1384, 1705 }},
-		{{ 523, 505, 499 }},
-		{{ 499, 519, 523 }},
-		{{ 550, 521, 505 }},
-		{{ 505, 523, 550 }},
-		{{ 611, 570, 521 }},
-		{{ 521, 550, 611 }},
-		{{ 724, 666, 570 }},
-		{{ 570, 611, 724 }},
-		{{ 834, 798, 666 }},
-		{{ 666, 724, 834 }},
-		{{ 948, 930, 798 }},
-		{{ 798, 834, 948 }},
-		{{ 1078, 1067, 930 }},
-		{{ 930, 948, 1078 }},
-		{{ 1207, 1199, 1067 }},
-		{{ 1067, 1078, 1207 }},
-		{{ 1395, 1384, 1199 }},
-		{{ 1199, 1207, 1395 }},
-		{{ 1773, 1705, 1384 }},
-		{{ 1384, 1395, 1773 }},
-		{{ 555, 523, 519 }},
-		{{ 519, 541, 555 }},
-		{{ 588, 550, 523 }},
-		{{ 523, 555, 588 }},
-		{{ 645, 611, 550 }},
-		{{ 550, 588, 645 }},
-		{{ 763, 724, 611 }},
-		{{ 611, 645, 763 }},
-		{{ 869, 834, 724 }},
-		{{ 724, 763, 869 }},
-		{{ 971, 948, 834 }},
-		{{ 834, 869, 971 }},
-		{{ 1089, 1078, 948 }},
-		{{ 948, 971, 1089 }},
-		{{ 1217, 1207, 1078 }},
-		{{ 1078, 1089, 1217 }},
-		{{ 1406, 1395, 1207 }},
-		{{ 1207, 1217, 1406 }},
-		{{ 1692, 1773, 1395 }},
-		{{ 1395, 1406, 1692 }},
-		{{ 581, 555, 541 }},
-		{{ 541, 573, 581 }},
-		{{ 626, 588, 555 }},
-		{{ 555, 581, 626 }},
-		{{ 703, 645, 588 }},
-		{{ 588, 626, 703 }},
-		{{ 791, 763, 645 }},
-		{{ 645, 703, 791 }},
-		{{ 895, 869, 763 }},
-		{{ 763, 791, 895 }},
-		{{ 989, 971, 869 }},
-		{{ 869, 895, 989 }},
-		{{ 1095, 1089, 971 }},
-		{{ 971, 989, 1095 }},
-		{{ 1227, 1217, 1089 }},
-		{{ 1089, 1095, 1227 }},
-		{{ 1421, 1406, 1217 }},
-		{{ 1217, 1227, 1421 }},
-		{{ 1766, 1692, 1406 }},
-		{{ 1406, 1421, 1766 }},
-		{{ 606, 581, 573 }},
-		{{ 573, 591, 606 }},
-		{{ 643, 626, 581 }},
-		{{ 581, 606, 643 }},
-		{{ 727, 703, 626 }},
-		{{ 626, 643, 727 }},
-		{{ 811, 791, 703 }},
-		{{ 703, 727, 811 }},
-		{{ 908, 895, 791 }},
-		{{ 791, 811, 908 }},
-		{{ 1005, 989, 895 }},
-		{{ 895, 908, 1005 }},
-		{{ 1100, 1095, 989 }},
-		{{ 989, 1005, 1100 }},
-		{{ 1231, 1227, 1095 }},
-		{{ 1095, 1100, 1231 }},
-		{{ 1427, 1421, 1227 }},
-		{{ 1227, 1231, 1427 }},
-		{{ 1897, 1766, 1421 }},
-		{{ 1421, 1427, 1897 }},
-		{{ 615, 606, 591 }},
-		{{ 591, 598, 615 }},
-		{{ 653, 643, 606 }},
-		{{ 606, 615, 653 }},
-		{{ 735, 727, 643 }},
-		{{ 643, 653, 735 }},
-		{{ 820, 811, 727 }},
-		{{ 727, 735, 820 }},
-		{{ 913, 908, 811 }},
-		{{ 811, 820, 913 }},
-		{{ 1013, 1005, 908 }},
-		{{ 908, 913, 1013 }},
-		{{ 1103, 1100, 1005 }},
-		{{ 1005, 1013, 1103 }},
-		{{ 1236, 1231, 1100 }},
-		{{ 1100, 1103, 1236 }},
-		{{ 1432, 1427, 1231 }},
-		{{ 1231, 1236, 1432 }},
-		{{ 1760, 1897, 1427 }},
-		{{ 1427, 1432, 1760 }},
-		{{ 2294, 2299, 1786 }},
-		{{ 1786, 1783, 2294 }},
-		{{ 2461, 2466, 2299 }},
-		{{ 2299, 2294, 2461 }},
-		{{ 2630, 2641, 2466 }},
-		{{ 2466, 2461, 2630 }},
-		{{ 2778, 2785, 2641 }},
-		{{ 2641, 2630, 2778 }},
-		{{ 2954, 2963, 2785 }},
-		{{ 2785, 2778, 2954 }},
-		{{ 3061, 3068, 2963 }},
-		{{ 2963, 2954, 3061 }},
-		{{ 3135, 3140, 3068 }},
-		{{ 3068, 3061, 3135 }},
-		{{ 3167, 3176, 3140 }},
-		{{ 3140, 3135, 3167 }},
-		{{ 3195, 3203, 3176 }},
-		{{ 3176, 3167, 3195 }},
-		{{ 3208, 3213, 3203 }},
-		{{ 3203, 3195, 3208 }},
-		{{ 2284, 2294, 1783 }},
-		{{ 1783, 1781, 2284 }},
-		{{ 2455, 2461, 2294 }},
-		{{ 2294, 2284, 2455 }},
-		{{ 2620, 2630, 2461 }},
-		{{ 2461, 2455, 2620 }},
-		{{ 2768, 2778, 2630 }},
-		{{ 2630, 2620, 2768 }},
-		{{ 2928, 2954, 2778 }},
-		{{ 2778, 2768, 2928 }},
-		{{ 3051, 3061, 2954 }},
-		{{ 2954, 2928, 3051 }},
-		{{ 3125, 3135, 3061 }},
-		{{ 3061, 3051, 3125 }},
-		{{ 3159, 3167, 3135 }},
-		{{ 3135, 3125, 3159 }},
-		{{ 3181, 3195, 3167 }},
-		{{ 3167, 3159, 3181 }},
-		{{ 3191, 3208, 3195 }},
-		{{ 3195, 3181, 3191 }},
-		{{ 2266, 2284, 1781 }},
-		{{ 1781, 1779, 2266 }},
-		{{ 2449, 2455, 2284 }},
-		{{ 2284, 2266, 2449 }},
-		{{ 2598, 2620, 2455 }},
-		{{ 2455, 2449, 2598 }},
-		{{ 2740, 2768, 2620 }},
-		{{ 2620, 2598, 2740 }},
-		{{ 2892, 2928, 2768 }},
-		{{ 2768, 2740, 2892 }},
-		{{ 3033, 3051, 2928 }},
-		{{ 2928, 2892, 3033 }},
-		{{ 3087, 3125, 3051 }},
-		{{ 3051, 3033, 3087 }},
-		{{ 3145, 3159, 3125 }},
-		{{ 3125, 3087, 3145 }},
-		{{ 3161, 3181, 3159 }},
-		{{ 3159, 3145, 3161 }},
-		{{ 3169, 3191, 3181 }},
-		{{ 3181, 3161, 3169 }},
-		{{ 2252, 2266, 1779 }},
-		{{ 1779, 1777, 2252 }},
-		{{ 2435, 2449, 2266 }},
-		{{ 2266, 2252, 2435 }},
-		{{ 2581, 2598, 2449 }},
-		{{ 2449, 2435, 2581 }},
-		{{ 2718, 2740, 2598 }},
-		{{ 2598, 2581, 2718 }},
-		{{ 2854, 2892, 2740 }},
-		{{ 2740, 2718, 2854 }},
-		{{ 2999, 3033, 2892 }},
-		{{ 2892, 2854, 2999 }},
-		{{ 3071, 3087, 3033 }},
-		{{ 3033, 2999, 3071 }},
-		{{ 3123, 3145, 3087 }},
-		{{ 3087, 3071, 3123 }},
-		{{ 3147, 3161, 3145 }},
-		{{ 3145, 3123, 3147 }},
-		{{ 3153, 3169, 3161 }},
-		{{ 3161, 3147, 3153 }},
-		{{ 2240, 2252, 1777 }},
-		{{ 1777, 1775, 2240 }},
-		{{ 2425, 2435, 2252 }},
-		{{ 2252, 2240, 2425 }},
-		{{ 2555, 2581, 2435 }},
-		{{ 2435, 2425, 2555 }},
-		{{ 2694, 2718, 2581 }},
-		{{ 2581, 2555, 2694 }},
-		{{ 2826, 2854, 2718 }},
-		{{ 2718, 2694, 2826 }},
-		{{ 2958, 2999, 2854 }},
-		{{ 2854, 2826, 2958 }},
-		{{ 3043, 3071, 2999 }},
-		{{ 2999, 2958, 3043 }},
-		{{ 3083, 3123, 3071 }},
-		{{ 3071, 3043, 3083 }},
-		{{ 3121, 3147, 3123 }},
-		{{ 3123, 3083, 3121 }},
-		{{ 3127, 3153, 3147 }},
-		{{ 3147, 3121, 3127 }},
-		{{ 2229, 2240, 1775 }},
-		{{ 1775, 1772, 2229 }},
-		{{ 2417, 2425, 2240 }},
-		{{ 2240, 2229, 2417 }},
-		{{ 2546, 2555, 2425 }},
-		{{ 2425, 2417, 2546 }},
-		{{ 2676, 2694, 2555 }},
-		{{ 2555, 2546, 2676 }},
-		{{ 2790, 2826, 2694 }},
-		{{ 2694, 2676, 2790 }},
-		{{ 2900, 2958, 2826 }},
-		{{ 2826, 2790, 2900 }},
-		{{ 3013, 3043, 2958 }},
-		{{ 2958, 2900, 3013 }},
-		{{ 3057, 3083, 3043 }},
-		{{ 3043, 3013, 3057 }},
-		{{ 3081, 3121, 3083 }},
-		{{ 3083, 3057, 3081 }},
-		{{ 3085, 3127, 3121 }},
-		{{ 3121, 3081, 3085 }},
-		{{ 2216, 2229, 1772 }},
-		{{ 1772, 1769, 2216 }},
-		{{ 2407, 2417, 2229 }},
-		{{ 2229, 2216, 2407 }},
-		{{ 2533, 2546, 2417 }},
-		{{ 2417, 2407, 2533 }},
-		{{ 2651, 2676, 2546 }},
-		{{ 2546, 2533, 2651 }},
-		{{ 2753, 2790, 2676 }},
-		{{ 2676, 2651, 2753 }},
-		{{ 2859, 2900, 2790 }},
-		{{ 2790, 2753, 2859 }},
-		{{ 2977, 3013, 2900 }},
-		{{ 2900, 2859, 2977 }},
-		{{ 3029, 3057, 3013 }},
-		{{ 3013, 2977, 3029 }},
-		{{ 3052, 3081, 3057 }},
-		{{ 3057, 3029, 3052 }},
-		{{ 3063, 3085, 3081 }},
-		{{ 3081, 3052, 3063 }},
-		{{ 2203, 2216, 1769 }},
-		{{ 1769, 1767, 2203 }},
-		{{ 2397, 2407, 2216 }},
-		{{ 2216, 2203, 2397 }},
-		{{ 2527, 2533, 2407 }},
-		{{ 2407, 2397, 2527 }},
-		{{ 2633, 2651, 2533 }},
-		{{ 2533, 2527, 2633 }},
-		{{ 2727, 2753, 2651 }},
-		{{ 2651, 2633, 2727 }},
-		{{ 2831, 2859, 2753 }},
-		{{ 2753, 2727, 2831 }},
-		{{ 2919, 2977, 2859 }},
-		{{ 2859, 2831, 2919 }},
-		{{ 2996, 3029, 2977 }},
-		{{ 2977, 2919, 2996 }},
-		{{ 3034, 3052, 3029 }},
-		{{ 3029, 2996, 3034 }},
-		{{ 3038, 3063, 3052 }},
-		{{ 3052, 3034, 3038 }},
-		{{ 2197, 2203, 1767 }},
-		{{ 1767, 1763, 2197 }},
-		{{ 2393, 2397, 2203 }},
-		{{ 2203, 2197, 2393 }},
-		{{ 2522, 2527, 2397 }},
-		{{ 2397, 2393, 2522 }},
-		{{ 2617, 2633, 2527 }},
-		{{ 2527, 2522, 2617 }},
-		{{ 2716, 2727, 2633 }},
-		{{ 2633, 2617, 2716 }},
-		{{ 2811, 2831, 2727 }},
-		{{ 2727, 2716, 2811 }},
-		{{ 2895, 2919, 2831 }},
-		{{ 2831, 2811, 2895 }},
-		{{ 2979, 2996, 2919 }},
-		{{ 2919, 2895, 2979 }},
-		{{ 3016, 3034, 2996 }},
-		{{ 2996, 2979, 3016 }},
-		{{ 3026, 3038, 3034 }},
-		{{ 3034, 3016, 3026 }},
-		{{ 2193, 2197, 1763 }},
-		{{ 1763, 1761, 2193 }},
-		{{ 2389, 2393, 2197 }},
-		{{ 2197, 2193, 2389 }},
-		{{ 2516, 2522, 2393 }},
-		{{ 2393, 2389, 2516 }},
-		{{ 2610, 2617, 2522 }},
-		{{ 2522, 2516, 2610 }},
-		{{ 2710, 2716, 2617 }},
-		{{ 2617, 2610, 2710 }},
-		{{ 2803, 2811, 2716 }},
-		{{ 2716, 2710, 2803 }},
-		{{ 2885, 2895, 2811 }},
-		{{ 2811, 2803, 2885 }},
-		{{ 2971, 2979, 2895 }},
-		{{ 2895, 2885, 2971 }},
-		{{ 3005, 3016, 2979 }},
-		{{ 2979, 2971, 3005 }},
-		{{ 3022, 3026, 3016 }},
-		{{ 3016, 3005, 3022 }},
-		{{ 461, 545, 544 }},
-		{{ 544, 456, 461 }},
-		{{ 463, 551, 545 }},
-		{{ 545, 461, 463 }},
-		{{ 465, 557, 551 }},
-		{{ 551, 463, 465 }},
-		{{ 469, 567, 557 }},
-		{{ 557, 465, 469 }},
-		{{ 471, 575, 567 }},
-		{{ 567, 469, 471 }},
-		{{ 473, 577, 575 }},
-		{{ 575, 471, 473 }},
-		{{ 475, 589, 577 }},
-		{{ 577, 473, 475 }},
-		{{ 477, 593, 589 }},
-		{{ 589, 475, 477 }},
-		{{ 479, 595, 593 }},
-		{{ 593, 477, 479 }},
-		{{ 481, 599, 595 }},
-		{{ 595, 479, 481 }},
-		{{ 389, 461, 456 }},
-		{{ 456, 392, 389 }},
-		{{ 386, 463, 461 }},
-		{{ 461, 389, 386 }},
-		{{ 379, 465, 463 }},
-		{{ 463, 386, 379 }},
-		{{ 373, 469, 465 }},
-		{{ 465, 379, 373 }},
-		{{ 371, 471, 469 }},
-		{{ 469, 373, 371 }},
-		{{ 369, 473, 471 }},
-		{{ 471, 371, 369 }},
-		{{ 366, 475, 473 }},
-		{{ 473, 369, 366 }},
-		{{ 364, 477, 475 }},
-		{{ 475, 366, 364 }},
-		{{ 362, 479, 477 }},
-		{{ 477, 364, 362 }},
-		{{ 361, 481, 479 }},
-		{{ 479, 362, 361 }},
-		{{ 335, 389, 392 }},
-		{{ 392, 337, 335 }},
-		{{ 333, 386, 389 }},
-		{{ 389, 335, 333 }},
-		{{ 331, 379, 386 }},
-		{{ 386, 333, 331 }},
-		{{ 329, 373, 379 }},
-		{{ 379, 331, 329 }},
-		{{ 328, 371, 373 }},
-		{{ 373, 329, 328 }},
-		{{ 325, 369, 371 }},
-		{{ 371, 328, 325 }},
-		{{ 323, 366, 369 }},
-		{{ 369, 325, 323 }},
-		{{ 321, 364, 366 }},
-		{{ 366, 323, 321 }},
-		{{ 319, 362, 364 }},
-		{{ 364, 321, 319 }},
-		{{ 316, 361, 362 }},
-		{{ 362, 319, 316 }},
-		{{ 298, 335, 337 }},
-		{{ 337, 302, 298 }},
-		{{ 290, 333, 335 }},
-		{{ 335, 298, 290 }},
-		{{ 288, 331, 333 }},
-		{{ 333, 290, 288 }},
-		{{ 286, 329, 331 }},
-		{{ 331, 288, 286 }},
-		{{ 281, 328, 329 }},
-		{{ 329, 286, 281 }},
-		{{ 275, 325, 328 }},
-		{{ 328, 281, 275 }},
-		{{ 265, 323, 325 }},
-		{{ 325, 275, 265 }},
-		{{ 259, 321, 323 }},
-		{{ 323, 265, 259 }},
-		{{ 255, 319, 321 }},
-		{{ 321, 259, 255 }},
-		{{ 249, 316, 319 }},
-		{{ 319, 255, 249 }},
-		{{ 269, 298, 302 }},
-		{{ 302, 271, 269 }},
-		{{ 261, 290, 298 }},
-		{{ 298, 269, 261 }},
-		{{ 251, 288, 290 }},
-		{{ 290, 261, 251 }},
-		{{ 238, 286, 288 }},
-		{{ 288, 251, 238 }},
-		{{ 230, 281, 286 }},
-		{{ 286, 238, 230 }},
-		{{ 218, 275, 281 }},
-		{{ 281, 230, 218 }},
-		{{ 208, 265, 275 }},
-		{{ 275, 218, 208 }},
-		{{ 196, 259, 265 }},
-		{{ 265, 208, 196 }},
-		{{ 186, 255, 259 }},
-		{{ 259, 196, 186 }},
-		{{ 181, 249, 255 }},
-		{{ 255, 186, 181 }},
-		{{ 228, 269, 271 }},
-		{{ 271, 234, 228 }},
-		{{ 222, 261, 269 }},
-		{{ 269, 228, 222 }},
-		{{ 212, 251, 261 }},
-		{{ 261, 222, 212 }},
-		{{ 200, 238, 251 }},
-		{{ 251, 212, 200 }},
-		{{ 177, 230, 238 }},
-		{{ 238, 200, 177 }},
-		{{ 160, 218, 230 }},
-		{{ 230, 177, 160 }},
-		{{ 134, 208, 218 }},
-		{{ 218, 160, 134 }},
-		{{ 112, 196, 208 }},
-		{{ 208, 134, 112 }},
-		{{ 102, 186, 196 }},
-		{{ 196, 112, 102 }},
-		{{ 96, 181, 186 }},
-		{{ 186, 102, 96 }},
-		{{ 198, 228, 234 }},
-		{{ 234, 205, 198 }},
-		{{ 182, 222, 228 }},
-		{{ 228, 198, 182 }},
-		{{ 168, 212, 222 }},
-		{{ 222, 182, 168 }},
-		{{ 146, 200, 212 }},
-		{{ 212, 168, 146 }},
-		{{ 118, 177, 200 }},
-		{{ 200, 146, 118 }},
-		{{ 92, 160, 177 }},
-		{{ 177, 118, 92 }},
-		{{ 74, 134, 160 }},
-		{{ 160, 92, 74 }},
-		{{ 63, 112, 134 }},
-		{{ 134, 74, 63 }},
-		{{ 53, 102, 112 }},
-		{{ 112, 63, 53 }},
-		{{ 50, 96, 102 }},
-		{{ 102, 53, 50 }},
-		{{ 167, 198, 205 }},
-		{{ 205, 170, 167 }},
-		{{ 154, 182, 198 }},
-		{{ 198, 167, 154 }},
-		{{ 126, 168, 182 }},
-		{{ 182, 154, 126 }},
-		{{ 100, 146, 168 }},
-		{{ 168, 126, 100 }},
-		{{ 83, 118, 146 }},
-		{{ 146, 100, 83 }},
-		{{ 61, 92, 118 }},
-		{{ 118, 83, 61 }},
-		{{ 46, 74, 92 }},
-		{{ 92, 61, 46 }},
-		{{ 32, 63, 74 }},
-		{{ 74, 46, 32 }},
-		{{ 25, 53, 63 }},
-		{{ 63, 32, 25 }},
-		{{ 21, 50, 53 }},
-		{{ 53, 25, 21 }},
-		{{ 143, 167, 170 }},
-		{{ 170, 150, 143 }},
-		{{ 124, 154, 167 }},
-		{{ 167, 143, 124 }},
-		{{ 104, 126, 154 }},
-		{{ 154, 124, 104 }},
-		{{ 84, 100, 126 }},
-		{{ 126, 104, 84 }},
-		{{ 65, 83, 100 }},
-		{{ 100, 84, 65 }},
-		{{ 44, 61, 83 }},
-		{{ 83, 65, 44 }},
-		{{ 30, 46, 61 }},
-		{{ 61, 44, 30 }},
-		{{ 17, 32, 46 }},
-		{{ 46, 30, 17 }},
-		{{ 9, 25, 32 }},
-		{{ 32, 17, 9 }},
-		{{ 5, 21, 25 }},
-		{{ 25, 9, 5 }},
-		{{ 132, 143, 150 }},
-		{{ 150, 140, 132 }},
-		{{ 116, 124, 143 }},
-		{{ 143, 132, 116 }},
-		{{ 94, 104, 124 }},
-		{{ 124, 116, 94 }},
-		{{ 76, 84, 104 }},
-		{{ 104, 94, 76 }},
-		{{ 55, 65, 84 }},
-		{{ 84, 76, 55 }},
-		{{ 40, 44, 65 }},
-		{{ 65, 55, 40 }},
-		{{ 22, 30, 44 }},
-		{{ 44, 40, 22 }},
-		{{ 11, 17, 30 }},
-		{{ 30, 22, 11 }},
-		{{ 2, 9, 17 }},
-		{{ 17, 11, 2 }},
-		{{ 1, 5, 9 }},
-		{{ 9, 2, 1 }},
-		{{ 480, 596, 599 }},
-		{{ 599, 481, 480 }},
-		{{ 478, 594, 596 }},
-		{{ 596, 480, 478 }},
-		{{ 476, 590, 594 }},
-		{{ 594, 478, 476 }},
-		{{ 474, 578, 590 }},
-		{{ 590, 476, 474 }},
-		{{ 472, 576, 578 }},
-		{{ 578, 474, 472 }},
-		{{ 470, 568, 576 }},
-		{{ 576, 472, 470 }},
-		{{ 466, 558, 568 }},
-		{{ 568, 470, 466 }},
-		{{ 464, 552, 558 }},
-		{{ 558, 466, 464 }},
-		{{ 462, 546, 552 }},
-		{{ 552, 464, 462 }},
-		{{ 456, 544, 546 }},
-		{{ 546, 462, 456 }},
-		{{ 363, 480, 481 }},
-		{{ 481, 360, 363 }},
-		{{ 365, 478, 480 }},
-		{{ 480, 363, 365 }},
-		{{ 367, 476, 478 }},
-		{{ 478, 365, 367 }},
-		{{ 368, 474, 476 }},
-		{{ 476, 367, 368 }},
-		{{ 370, 472, 474 }},
-		{{ 474, 368, 370 }},
-		{{ 372, 470, 472 }},
-		{{ 472, 370, 372 }},
-		{{ 380, 466, 470 }},
-		{{ 470, 372, 380 }},
-		{{ 385, 464, 466 }},
-		{{ 466, 380, 385 }},
-		{{ 390, 462, 464 }},
-		{{ 464, 385, 390 }},
-		{{ 391, 456, 462 }},
-		{{ 462, 390, 391 }},
-		{{ 320, 363, 360 }},
-		{{ 360, 316, 320 }},
-		{{ 322, 365, 363 }},
-		{{ 363, 320, 322 }},
-		{{ 324, 367, 365 }},
-		{{ 365, 322, 324 }},
-		{{ 326, 368, 367 }},
-		{{ 367, 324, 326 }},
-		{{ 327, 370, 368 }},
-		{{ 368, 326, 327 }},
-		{{ 330, 372, 370 }},
-		{{ 370, 327, 330 }},
-		{{ 332, 380, 372 }},
-		{{ 372, 330, 332 }},
-		{{ 334, 385, 380 }},
-		{{ 380, 332, 334 }},
-		{{ 336, 390, 385 }},
-		{{ 385, 334, 336 }},
-		{{ 337, 391, 390 }},
-		{{ 390, 336, 337 }},
-		{{ 256, 320, 316 }},
-		{{ 316, 250, 256 }},
-		{{ 260, 322, 320 }},
-		{{ 320, 256, 260 }},
-		{{ 266, 324, 322 }},
-		{{ 322, 260, 266 }},
-		{{ 276, 326, 324 }},
-		{{ 324, 266, 276 }},
-		{{ 282, 327, 326 }},
-		{{ 326, 276, 282 }},
-		{{ 287, 330, 327 }},
-		{{ 327, 282, 287 }},
-		{{ 289, 332, 330 }},
-		{{ 330, 287, 289 }},
-		{{ 291, 334, 332 }},
-		{{ 332, 289, 291 }},
-		{{ 299, 336, 334 }},
-		{{ 334, 291, 299 }},
-		{{ 303, 337, 336 }},
-		{{ 336, 299, 303 }},
-		{{ 187, 256, 250 }},
-		{{ 250, 181, 187 }},
-		{{ 197, 260, 256 }},
-		{{ 256, 187, 197 }},
-		{{ 209, 266, 260 }},
-		{{ 260, 197, 209 }},
-		{{ 219, 276, 266 }},
-		{{ 266, 209, 219 }},
-		{{ 231, 282, 276 }},
-		{{ 276, 219, 231 }},
-		{{ 239, 287, 282 }},
-		{{ 282, 231, 239 }},
-		{{ 252, 289, 287 }},
-		{{ 287, 239, 252 }},
-		{{ 262, 291, 289 }},
-		{{ 289, 252, 262 }},
-		{{ 270, 299, 291 }},
-		{{ 291, 262, 270 }},
-		{{ 272, 303, 299 }},
-		{{ 299, 270, 272 }},
-		{{ 103, 187, 181 }},
-		{{ 181, 97, 103 }},
-		{{ 113, 197, 187 }},
-		{{ 187, 103, 113 }},
-		{{ 135, 209, 197 }},
-		{{ 197, 113, 135 }},
-		{{ 161, 219, 209 }},
-		{{ 209, 135, 161 }},
-		{{ 178, 231, 219 }},
-		{{ 219, 161, 178 }},
-		{{ 201, 239, 231 }},
-		{{ 231, 178, 201 }},
-		{{ 213, 252, 239 }},
-		{{ 239, 201, 213 }},
-		{{ 223, 262, 252 }},
-		{{ 252, 213, 223 }},
-		{{ 229, 270, 262 }},
-		{{ 262, 223, 229 }},
-		{{ 235, 272, 270 }},
-		{{ 270, 229, 235 }},
-		{{ 54, 103, 97 }},
-		{{ 97, 50, 54 }},
-		{{ 64, 113, 103 }},
-		{{ 103, 54, 64 }},
-		{{ 75, 135, 113 }},
-		{{ 113, 64, 75 }},
-		{{ 93, 161, 135 }},
-		{{ 135, 75, 93 }},
-		{{ 119, 178, 161 }},
-		{{ 161, 93, 119 }},
-		{{ 147, 201, 178 }},
-		{{ 178, 119, 147 }},
-		{{ 169, 213, 201 }},
-		{{ 201, 147, 169 }},
-		{{ 183, 223, 213 }},
-		{{ 213, 169, 183 }},
-		{{ 199, 229, 223 }},
-		{{ 223, 183, 199 }},
-		{{ 205, 235, 229 }},
-		{{ 229, 199, 205 }},
-		{{ 24, 54, 50 }},
-		{{ 50, 21, 24 }},
-		{{ 33, 64, 54 }},
-		{{ 54, 24, 33 }},
-		{{ 47, 75, 64 }},
-		{{ 64, 33, 47 }},
-		{{ 62, 93, 75 }},
-		{{ 75, 47, 62 }},
-		{{ 82, 119, 93 }},
-		{{ 93, 62, 82 }},
-		{{ 101, 147, 119 }},
-		{{ 119, 82, 101 }},
-		{{ 127, 169, 147 }},
-		{{ 147, 101, 127 }},
-		{{ 155, 183, 169 }},
-		{{ 169, 127, 155 }},
-		{{ 166, 199, 183 }},
-		{{ 183, 155, 166 }},
-		{{ 171, 205, 199 }},
-		{{ 199, 166, 171 }},
-		{{ 10, 24, 21 }},
-		{{ 21, 6, 10 }},
-		{{ 18, 33, 24 }},
-		{{ 24, 10, 18 }},
-		{{ 31, 47, 33 }},
-		{{ 33, 18, 31 }},
-		{{ 45, 62, 47 }},
-		{{ 47, 31, 45 }},
-		{{ 66, 82, 62 }},
-		{{ 62, 45, 66 }},
-		{{ 85, 101, 82 }},
-		{{ 82, 66, 85 }},
-		{{ 105, 127, 101 }},
-		{{ 101, 85, 105 }},
-		{{ 125, 155, 127 }},
-		{{ 127, 105, 125 }},
-		{{ 144, 166, 155 }},
-		{{ 155, 125, 144 }},
-		{{ 151, 171, 166 }},
-		{{ 166, 144, 151 }},
-		{{ 3, 10, 6 }},
-		{{ 6, 1, 3 }},
-		{{ 12, 18, 10 }},
-		{{ 10, 3, 12 }},
-		{{ 23, 31, 18 }},
-		{{ 18, 12, 23 }},
-		{{ 41, 45, 31 }},
-		{{ 31, 23, 41 }},
-		{{ 56, 66, 45 }},
-		{{ 45, 41, 56 }},
-		{{ 77, 85, 66 }},
-		{{ 66, 56, 77 }},
-		{{ 95, 105, 85 }},
-		{{ 85, 77, 95 }},
-		{{ 117, 125, 105 }},
-		{{ 105, 95, 117 }},
-		{{ 133, 144, 125 }},
-		{{ 125, 117, 133 }},
-		{{ 140, 151, 144 }},
-		{{ 144, 133, 140 }},
-		{{ 138, 132, 140 }},
-		{{ 140, 145, 138 }},
-		{{ 122, 116, 132 }},
-		{{ 132, 138, 122 }},
-		{{ 98, 94, 116 }},
-		{{ 116, 122, 98 }},
-		{{ 80, 76, 94 }},
-		{{ 94, 98, 80 }},
-		{{ 60, 55, 76 }},
-		{{ 76, 80, 60 }},
-		{{ 42, 40, 55 }},
-		{{ 55, 60, 42 }},
-		{{ 28, 22, 40 }},
-		{{ 40, 42, 28 }},
-		{{ 13, 11, 22 }},
-		{{ 22, 28, 13 }},
-		{{ 7, 2, 11 }},
-		{{ 11, 13, 7 }},
-		{{ 4, 1, 2 }},
-		{{ 2, 7, 4 }},
-		{{ 152, 138, 145 }},
-		{{ 145, 158, 152 }},
-		{{ 136, 122, 138 }},
-		{{ 138, 152, 136 }},
-		{{ 108, 98, 122 }},
-		{{ 122, 136, 108 }},
-		{{ 89, 80, 98 }},
-		{{ 98, 108, 89 }},
-		{{ 70, 60, 80 }},
-		{{ 80, 89, 70 }},
-		{{ 52, 42, 60 }},
-		{{ 60, 70, 52 }},
-		{{ 38, 28, 42 }},
-		{{ 42, 52, 38 }},
-		{{ 26, 13, 28 }},
-		{{ 28, 38, 26 }},
-		{{ 19, 7, 13 }},
-		{{ 13, 26, 19 }},
-		{{ 15, 4, 7 }},
-		{{ 7, 19, 15 }},
-		{{ 173, 152, 158 }},
-		{{ 158, 176, 173 }},
-		{{ 162, 136, 152 }},
-		{{ 152, 173, 162 }},
-		{{ 142, 108, 136 }},
-		{{ 136, 162, 142 }},
-		{{ 111, 89, 108 }},
-		{{ 108, 142, 111 }},
-		{{ 91, 70, 89 }},
-		{{ 89, 111, 91 }},
-		{{ 73, 52, 70 }},
-		{{ 70, 91, 73 }},
-		{{ 58, 38, 52 }},
-		{{ 52, 73, 58 }},
-		{{ 48, 26, 38 }},
-		{{ 38, 58, 48 }},
-		{{ 37, 19, 26 }},
-		{{ 26, 48, 37 }},
-		{{ 35, 15, 19 }},
-		{{ 19, 37, 35 }},
-		{{ 194, 173, 176 }},
-		{{ 176, 202, 194 }},
-		{{ 184, 162, 173 }},
-		{{ 173, 194, 184 }},
-		{{ 174, 142, 162 }},
-		{{ 162, 184, 174 }},
-		{{ 156, 111, 142 }},
-		{{ 142, 174, 156 }},
-		{{ 128, 91, 111 }},
-		{{ 111, 156, 128 }},
-		{{ 106, 73, 91 }},
-		{{ 91, 128, 106 }},
-		{{ 86, 58, 73 }},
-		{{ 73, 106, 86 }},
-		{{ 78, 48, 58 }},
-		{{ 58, 86, 78 }},
-		{{ 68, 37, 48 }},
-		{{ 48, 78, 68 }},
-		{{ 67, 35, 37 }},
-		{{ 37, 68, 67 }},
-		{{ 221, 194, 202 }},
-		{{ 202, 225, 221 }},
-		{{ 216, 184, 194 }},
-		{{ 194, 221, 216 }},
-		{{ 206, 174, 184 }},
-		{{ 184, 216, 206 }},
-		{{ 192, 156, 174 }},
-		{{ 174, 206, 192 }},
-		{{ 180, 128, 156 }},
-		{{ 156, 192, 180 }},
-		{{ 164, 106, 128 }},
-		{{ 128, 180, 164 }},
-		{{ 148, 86, 106 }},
-		{{ 106, 164, 148 }},
-		{{ 130, 78, 86 }},
-		{{ 86, 148, 130 }},
-		{{ 121, 68, 78 }},
-		{{ 78, 130, 121 }},
-		{{ 115, 67, 68 }},
-		{{ 68, 121, 115 }},
-		{{ 244, 221, 225 }},
-		{{ 225, 247, 244 }},
-		{{ 240, 216, 221 }},
-		{{ 221, 244, 240 }},
-		{{ 236, 206, 216 }},
-		{{ 216, 240, 236 }},
-		{{ 233, 192, 206 }},
-		{{ 206, 236, 233 }},
-		{{ 227, 180, 192 }},
-		{{ 192, 233, 227 }},
-		{{ 215, 164, 180 }},
-		{{ 180, 227, 215 }},
-		{{ 210, 148, 164 }},
-		{{ 164, 215, 210 }},
-		{{ 203, 130, 148 }},
-		{{ 148, 210, 203 }},
-		{{ 191, 121, 130 }},
-		{{ 130, 203, 191 }},
-		{{ 188, 115, 121 }},
-		{{ 121, 191, 188 }},
-		{{ 284, 244, 247 }},
-		{{ 247, 285, 284 }},
-		{{ 279, 240, 244 }},
-		{{ 244, 284, 279 }},
-		{{ 277, 236, 240 }},
-		{{ 240, 279, 277 }},
-		{{ 273, 233, 236 }},
-		{{ 236, 277, 273 }},
-		{{ 267, 227, 233 }},
-		{{ 233, 273, 267 }},
-		{{ 263, 215, 227 }},
-		{{ 227, 267, 263 }},
-		{{ 258, 210, 215 }},
-		{{ 215, 263, 258 }},
-		{{ 253, 203, 210 }},
-		{{ 210, 258, 253 }},
-		{{ 245, 191, 203 }},
-		{{ 203, 253, 245 }},
-		{{ 242, 188, 191 }},
-		{{ 191, 245, 242 }},
-		{{ 315, 284, 285 }},
-		{{ 285, 318, 315 }},
-		{{ 312, 279, 284 }},
-		{{ 284, 315, 312 }},
-		{{ 311, 277, 279 }},
-		{{ 279, 312, 311 }},
-		{{ 309, 273, 277 }},
-		{{ 277, 311, 309 }},
-		{{ 307, 267, 273 }},
-		{{ 273, 309, 307 }},
-		{{ 305, 263, 267 }},
-		{{ 267, 307, 305 }},
-		{{ 301, 258, 263 }},
-		{{ 263, 305, 301 }},
-		{{ 297, 253, 258 }},
-		{{ 258, 301, 297 }},
-		{{ 295, 245, 253 }},
-		{{ 253, 297, 295 }},
-		{{ 293, 242, 245 }},
-		{{ 245, 295, 293 }},
-		{{ 341, 315, 318 }},
-		{{ 318, 339, 341 }},
-		{{ 343, 312, 315 }},
-		{{ 315, 341, 343 }},
-		{{ 345, 311, 312 }},
-		{{ 312, 343, 345 }},
-		{{ 347, 309, 311 }},
-		{{ 311, 345, 347 }},
-		{{ 349, 307, 309 }},
-		{{ 309, 347, 349 }},
-		{{ 351, 305, 307 }},
-		{{ 307, 349, 351 }},
-		{{ 353, 301, 305 }},
-		{{ 305, 351, 353 }},
-		{{ 355, 297, 301 }},
-		{{ 301, 353, 355 }},
-		{{ 357, 295, 297 }},
-		{{ 297, 355, 357 }},
-		{{ 359, 293, 295 }},
-		{{ 295, 357, 359 }},
-		{{ 378, 341, 339 }},
-		{{ 339, 376, 378 }},
-		{{ 384, 343, 341 }},
-		{{ 341, 378, 384 }},
-		{{ 394, 345, 343 }},
-		{{ 343, 384, 394 }},
-		{{ 403, 347, 345 }},
-		{{ 345, 394, 403 }},
-		{{ 406, 349, 347 }},
-		{{ 347, 403, 406 }},
-		{{ 415, 351, 349 }},
-		{{ 349, 406, 415 }},
-		{{ 419, 353, 351 }},
-		{{ 351, 415, 419 }},
-		{{ 423, 355, 353 }},
-		{{ 353, 419, 423 }},
-		{{ 425, 357, 355 }},
-		{{ 355, 423, 425 }},
-		{{ 427, 359, 357 }},
-		{{ 357, 425, 427 }},
-		{{ 8, 3, 1 }},
-		{{ 1, 4, 8 }},
-		{{ 14, 12, 3 }},
-		{{ 3, 8, 14 }},
-		{{ 29, 23, 12 }},
-		{{ 12, 14, 29 }},
-		{{ 43, 41, 23 }},
-		{{ 23, 29, 43 }},
-		{{ 59, 56, 41 }},
-		{{ 41, 43, 59 }},
-		{{ 81, 77, 56 }},
-		{{ 56, 59, 81 }},
-		{{ 99, 95, 77 }},
-		{{ 77, 81, 99 }},
-		{{ 123, 117, 95 }},
-		{{ 95, 99, 123 }},
-		{{ 139, 133, 117 }},
-		{{ 117, 123, 139 }},
-		{{ 145, 140, 133 }},
-		{{ 133, 139, 145 }},
-		{{ 20, 8, 4 }},
-		{{ 4, 16, 20 }},
-		{{ 27, 14, 8 }},
-		{{ 8, 20, 27 }},
-		{{ 39, 29, 14 }},
-		{{ 14, 27, 39 }},
-		{{ 51, 43, 29 }},
-		{{ 29, 39, 51 }},
-		{{ 71, 59, 43 }},
-		{{ 43, 51, 71 }},
-		{{ 88, 81, 59 }},
-		{{ 59, 71, 88 }},
-		{{ 109, 99, 81 }},
-		{{ 81, 88, 109 }},
-		{{ 137, 123, 99 }},
-		{{ 99, 109, 137 }},
-		{{ 153, 139, 123 }},
-		{{ 123, 137, 153 }},
-		{{ 159, 145, 139 }},
-		{{ 139, 153, 159 }},
-		{{ 36, 20, 16 }},
-		{{ 16, 34, 36 }},
-		{{ 49, 27, 20 }},
-		{{ 20, 36, 49 }},
-		{{ 57, 39, 27 }},
-		{{ 27, 49, 57 }},
-		{{ 72, 51, 39 }},
-		{{ 39, 57, 72 }},
-		{{ 90, 71, 51 }},
-		{{ 51, 72, 90 }},
-		{{ 110, 88, 71 }},
-		{{ 71, 90, 110 }},
-		{{ 141, 109, 88 }},
-		{{ 88, 110, 141 }},
-		{{ 163, 137, 109 }},
-		{{ 109, 141, 163 }},
-		{{ 172, 153, 137 }},
-		{{ 137, 163, 172 }},
-		{{ 176, 159, 153 }},
-		{{ 153, 172, 176 }},
-		{{ 69, 36, 34 }},
-		{{ 34, 67, 69 }},
-		{{ 79, 49, 36 }},
-		{{ 36, 69, 79 }},
-		{{ 87, 57, 49 }},
-		{{ 49, 79, 87 }},
-		{{ 107, 72, 57 }},
-		{{ 57, 87, 107 }},
-		{{ 129, 90, 72 }},
-		{{ 72, 107, 129 }},
-		{{ 157, 110, 90 }},
-		{{ 90, 129, 157 }},
-		{{ 175, 141, 110 }},
-		{{ 110, 157, 175 }},
-		{{ 185, 163, 141 }},
-		{{ 141, 175, 185 }},
-		{{ 195, 172, 163 }},
-		{{ 163, 185, 195 }},
-		{{ 202, 176, 172 }},
-		{{ 172, 195, 202 }},
-		{{ 120, 69, 67 }},
-		{{ 67, 114, 120 }},
-		{{ 131, 79, 69 }},
-		{{ 69, 120, 131 }},
-		{{ 149, 87, 79 }},
-		{{ 79, 131, 149 }},
-		{{ 165, 107, 87 }},
-		{{ 87, 149, 165 }},
-		{{ 179, 129, 107 }},
-		{{ 107, 165, 179 }},
-		{{ 193, 157, 129 }},
-		{{ 129, 179, 193 }},
-		{{ 207, 175, 157 }},
-		{{ 157, 193, 207 }},
-		{{ 217, 185, 175 }},
-		{{ 175, 207, 217 }},
-		{{ 220, 195, 185 }},
-		{{ 185, 217, 220 }},
-		{{ 224, 202, 195 }},
-		{{ 195, 220, 224 }},
-		{{ 190, 120, 114 }},
-		{{ 114, 189, 190 }},
-		{{ 204, 131, 120 }},
-		{{ 120, 190, 204 }},
-		{{ 211, 149, 131 }},
-		{{ 131, 204, 211 }},
-		{{ 214, 165, 149 }},
-		{{ 149, 211, 214 }},
-		{{ 226, 179, 165 }},
-		{{ 165, 214, 226 }},
-		{{ 232, 193, 179 }},
-		{{ 179, 226, 232 }},
-		{{ 237, 207, 193 }},
-		{{ 193, 232, 237 }},
-		{{ 241, 217, 207 }},
-		{{ 207, 237, 241 }},
-		{{ 243, 220, 217 }},
-		{{ 217, 241, 243 }},
-		{{ 248, 224, 220 }},
-		{{ 220, 243, 248 }},
-		{{ 246, 190, 189 }},
-		{{ 189, 242, 246 }},
-		{{ 254, 204, 190 }},
-		{{ 190, 246, 254 }},
-		{{ 257, 211, 204 }},
-		{{ 204, 254, 257 }},
-		{{ 264, 214, 211 }},
-		{{ 211, 257, 264 }},
-		{{ 268, 226, 214 }},
-		{{ 214, 264, 268 }},
-		{{ 274, 232, 226 }},
-		{{ 226, 268, 274 }},
-		{{ 278, 237, 232 }},
-		{{ 232, 274, 278 }},
-		{{ 280, 241, 237 }},
-		{{ 237, 278, 280 }},
-		{{ 283, 243, 241 }},
-		{{ 241, 280, 283 }},
-		{{ 285, 248, 243 }},
-		{{ 243, 283, 285 }},
-		{{ 294, 246, 242 }},
-		{{ 242, 292, 294 }},
-		{{ 296, 254, 246 }},
-		{{ 246, 294, 296 }},
-		{{ 300, 257, 254 }},
-		{{ 254, 296, 300 }},
-		{{ 304, 264, 257 }},
-		{{ 257, 300, 304 }},
-		{{ 306, 268, 264 }},
-		{{ 264, 304, 306 }},
-		{{ 308, 274, 268 }},
-		{{ 268, 306, 308 }},
-		{{ 310, 278, 274 }},
-		{{ 274, 308, 310 }},
-		{{ 313, 280, 278 }},
-		{{ 278, 310, 313 }},
-		{{ 314, 283, 280 }},
-		{{ 280, 313, 314 }},
-		{{ 317, 285, 283 }},
-		{{ 283, 314, 317 }},
-		{{ 356, 294, 292 }},
-		{{ 292, 358, 356 }},
-		{{ 354, 296, 294 }},
-		{{ 294, 356, 354 }},
-		{{ 352, 300, 296 }},
-		{{ 296, 354, 352 }},
-		{{ 350, 304, 300 }},
-		{{ 300, 352, 350 }},
-		{{ 348, 306, 304 }},
-		{{ 304, 350, 348 }},
-		{{ 346, 308, 306 }},
-		{{ 306, 348, 346 }},
-		{{ 344, 310, 308 }},
-		{{ 308, 346, 344 }},
-		{{ 342, 313, 310 }},
-		{{ 310, 344, 342 }},
-		{{ 340, 314, 313 }},
-		{{ 313, 342, 340 }},
-		{{ 338, 317, 314 }},
-		{{ 314, 340, 338 }},
-		{{ 424, 356, 358 }},
-		{{ 358, 426, 424 }},
-		{{ 422, 354, 356 }},
-		{{ 356, 424, 422 }},
-		{{ 418, 352, 354 }},
-		{{ 354, 422, 418 }},
-		{{ 414, 350, 352 }},
-		{{ 352, 418, 414 }},
-		{{ 407, 348, 350 }},
-		{{ 350, 414, 407 }},
-		{{ 402, 346, 348 }},
-		{{ 348, 407, 402 }},
-		{{ 393, 344, 346 }},
-		{{ 346, 402, 393 }},
-		{{ 383, 342, 344 }},
-		{{ 344, 393, 383 }},
-		{{ 377, 340, 342 }},
-		{{ 342, 383, 377 }},
-		{{ 375, 338, 340 }},
-		{{ 340, 377, 375 }},
-		{{ 3186, 3113, 3115 }},
-		{{ 3115, 3182, 3186 }},
-		{{ 3192, 3110, 3113 }},
-		{{ 3113, 3186, 3192 }},
-		{{ 3196, 3109, 3110 }},
-		{{ 3110, 3192, 3196 }},
-		{{ 3205, 3106, 3109 }},
-		{{ 3109, 3196, 3205 }},
-		{{ 3211, 3104, 3106 }},
-		{{ 3106, 3205, 3211 }},
-		{{ 3215, 3102, 3104 }},
-		{{ 3104, 3211, 3215 }},
-		{{ 3217, 3101, 3102 }},
-		{{ 3102, 3215, 3217 }},
-		{{ 3220, 3098, 3101 }},
-		{{ 3101, 3217, 3220 }},
-		{{ 3222, 3097, 3098 }},
-		{{ 3098, 3220, 3222 }},
-		{{ 3223, 3095, 3097 }},
-		{{ 3097, 3222, 3223 }},
-		{{ 3227, 3186, 3182 }},
-		{{ 3182, 3225, 3227 }},
-		{{ 3229, 3192, 3186 }},
-		{{ 3186, 3227, 3229 }},
-		{{ 3231, 3196, 3192 }},
-		{{ 3192, 3229, 3231 }},
-		{{ 3233, 3205, 3196 }},
-		{{ 3196, 3231, 3233 }},
-		{{ 3235, 3211, 3205 }},
-		{{ 3205, 3233, 3235 }},
-		{{ 3241, 3215, 3211 }},
-		{{ 3211, 3235, 3241 }},
-		{{ 3245, 3217, 3215 }},
-		{{ 3215, 3241, 3245 }},
-		{{ 3249, 3220, 3217 }},
-		{{ 3217, 3245, 3249 }},
-		{{ 3251, 3222, 3220 }},
-		{{ 3220, 3249, 3251 }},
-		{{ 3253, 3223, 3222 }},
-		{{ 3222, 3251, 3253 }},
-		{{ 3239, 3227, 3225 }},
-		{{ 3225, 3237, 3239 }},
-		{{ 3243, 3229, 3227 }},
-		{{ 3227, 3239, 3243 }},
-		{{ 3247, 3231, 3229 }},
-		{{ 3229, 3243, 3247 }},
-		{{ 3257, 3233, 3231 }},
-		{{ 3231, 3247, 3257 }},
-		{{ 3263, 3235, 3233 }},
-		{{ 3233, 3257, 3263 }},
-		{{ 3271, 3241, 3235 }},
-		{{ 3235, 3263, 3271 }},
-		{{ 3279, 3245, 3241 }},
-		{{ 3241, 3271, 3279 }},
-		{{ 3285, 3249, 3245 }},
-		{{ 3245, 3279, 3285 }},
-		{{ 3293, 3251, 3249 }},
-		{{ 3249, 3285, 3293 }},
-		{{ 3297, 3253, 3251 }},
-		{{ 3251, 3293, 3297 }},
-		{{ 3259, 3239, 3237 }},
-		{{ 3237, 3255, 3259 }},
-		{{ 3261, 3243, 3239 }},
-		{{ 3239, 3259, 3261 }},
-		{{ 3265, 3247, 3243 }},
-		{{ 3243, 3261, 3265 }},
-		{{ 3275, 3257, 3247 }},
-		{{ 3247, 3265, 3275 }},
-		{{ 3287, 3263, 3257 }},
-		{{ 3257, 3275, 3287 }},
-		{{ 3303, 3271, 3263 }},
-		{{ 3263, 3287, 3303 }},
-		{{ 3314, 3279, 3271 }},
-		{{ 3271, 3303, 3314 }},
-		{{ 3320, 3285, 3279 }},
-		{{ 3279, 3314, 3320 }},
-		{{ 3330, 3293, 3285 }},
-		{{ 3285, 3320, 3330 }},
-		{{ 3332, 3297, 3293 }},
-		{{ 3293, 3330, 3332 }},
-		{{ 3270, 3259, 3255 }},
-		{{ 3255, 3268, 3270 }},
-		{{ 3273, 3261, 3259 }},
-		{{ 3259, 3270, 3273 }},
-		{{ 3283, 3265, 3261 }},
-		{{ 3261, 3273, 3283 }},
-		{{ 3299, 3275, 3265 }},
-		{{ 3265, 3283, 3299 }},
-		{{ 3308, 3287, 3275 }},
-		{{ 3275, 3299, 3308 }},
-		{{ 3322, 3303, 3287 }},
-		{{ 3287, 3308, 3322 }},
-		{{ 3338, 3314, 3303 }},
-		{{ 3303, 3322, 3338 }},
-		{{ 3346, 3320, 3314 }},
-		{{ 3314, 3338, 3346 }},
-		{{ 3351, 3330, 3320 }},
-		{{ 3320, 3346, 3351 }},
-		{{ 3355, 3332, 3330 }},
-		{{ 3330, 3351, 3355 }},
-		{{ 3282, 3270, 3268 }},
-		{{ 3268, 3278, 3282 }},
-		{{ 3290, 3273, 3270 }},
-		{{ 3270, 3282, 3290 }},
-		{{ 3302, 3283, 3273 }},
-		{{ 3273, 3290, 3302 }},
-		{{ 3312, 3299, 3283 }},
-		{{ 3283, 3302, 3312 }},
-		{{ 3324, 3308, 3299 }},
-		{{ 3299, 3312, 3324 }},
-		{{ 3340, 3322, 3308 }},
-		{{ 3308, 3324, 3340 }},
-		{{ 3353, 3338, 3322 }},
-		{{ 3322, 3340, 3353 }},
-		{{ 3368, 3346, 3338 }},
-		{{ 3338, 3353, 3368 }},
-		{{ 3373, 3351, 3346 }},
-		{{ 3346, 3368, 3373 }},
-		{{ 3379, 3355, 3351 }},
-		{{ 3351, 3373, 3379 }},
-		{{ 3295, 3282, 3278 }},
-		{{ 3278, 3292, 3295 }},
-		{{ 3306, 3290, 3282 }},
-		{{ 3282, 3295, 3306 }},
-		{{ 3316, 3302, 3290 }},
-		{{ 3290, 3306, 3316 }},
-		{{ 3326, 3312, 3302 }},
-		{{ 3302, 3316, 3326 }},
-		{{ 3345, 3324, 3312 }},
-		{{ 3312, 3326, 3345 }},
-		{{ 3359, 3340, 3324 }},
-		{{ 3324, 3345, 3359 }},
-		{{ 3376, 3353, 3340 }},
-		{{ 3340, 3359, 3376 }},
-		{{ 3394, 3368, 3353 }},
-		{{ 3353, 3376, 3394 }},
-		{{ 3404, 3373, 3368 }},
-		{{ 3368, 3394, 3404 }},
-		{{ 3406, 3379, 3373 }},
-		{{ 3373, 3404, 3406 }},
-		{{ 3310, 3295, 3292 }},
-		{{ 3292, 3307, 3310 }},
-		{{ 3318, 3306, 3295 }},
-		{{ 3295, 3310, 3318 }},
-		{{ 3336, 3316, 3306 }},
-		{{ 3306, 3318, 3336 }},
-		{{ 3348, 3326, 3316 }},
-		{{ 3316, 3336, 3348 }},
-		{{ 3369, 3345, 3326 }},
-		{{ 3326, 3348, 3369 }},
-		{{ 3389, 3359, 3345 }},
-		{{ 3345, 3369, 3389 }},
-		{{ 3425, 3376, 3359 }},
-		{{ 3359, 3389, 3425 }},
-		{{ 3449, 3394, 3376 }},
-		{{ 3376, 3425, 3449 }},
-		{{ 3468, 3404, 3394 }},
-		{{ 3394, 3449, 3468 }},
-		{{ 3472, 3406, 3404 }},
-		{{ 3404, 3468, 3472 }},
-		{{ 3335, 3310, 3307 }},
-		{{ 3307, 3329, 3335 }},
-		{{ 3343, 3318, 3310 }},
-		{{ 3310, 3335, 3343 }},
-		{{ 3362, 3336, 3318 }},
-		{{ 3318, 3343, 3362 }},
-		{{ 3386, 3348, 3336 }},
-		{{ 3336, 3362, 3386 }},
-		{{ 3422, 3369, 3348 }},
-		{{ 3348, 3386, 3422 }},
-		{{ 3464, 3389, 3369 }},
-		{{ 3369, 3422, 3464 }},
-		{{ 3490, 3425, 3389 }},
-		{{ 3389, 3464, 3490 }},
-		{{ 3505, 3449, 3425 }},
-		{{ 3425, 3490, 3505 }},
-		{{ 3521, 3468, 3449 }},
-		{{ 3449, 3505, 3521 }},
-		{{ 3523, 3472, 3468 }},
-		{{ 3468, 3521, 3523 }},
-		{{ 3364, 3335, 3329 }},
-		{{ 3329, 3357, 3364 }},
-		{{ 3382, 3343, 3335 }},
-		{{ 3335, 3364, 3382 }},
-		{{ 3416, 3362, 3343 }},
-		{{ 3343, 3382, 3416 }},
-		{{ 3465, 3386, 3362 }},
-		{{ 3362, 3416, 3465 }},
-		{{ 3495, 3422, 3386 }},
-		{{ 3386, 3465, 3495 }},
-		{{ 3528, 3464, 3422 }},
-		{{ 3422, 3495, 3528 }},
-		{{ 3553, 3490, 3464 }},
-		{{ 3464, 3528, 3553 }},
-		{{ 3579, 3505, 3490 }},
-		{{ 3490, 3553, 3579 }},
-		{{ 3592, 3521, 3505 }},
-		{{ 3505, 3579, 3592 }},
-		{{ 3604, 3523, 3521 }},
-		{{ 3521, 3592, 3604 }},
-		{{ 3221, 3096, 3094 }},
-		{{ 3094, 3224, 3221 }},
-		{{ 3219, 3099, 3096 }},
-		{{ 3096, 3221, 3219 }},
-		{{ 3218, 3100, 3099 }},
-		{{ 3099, 3219, 3218 }},
-		{{ 3216, 3103, 3100 }},
-		{{ 3100, 3218, 3216 }},
-		{{ 3212, 3105, 3103 }},
-		{{ 3103, 3216, 3212 }},
-		{{ 3206, 3107, 3105 }},
-		{{ 3105, 3212, 3206 }},
-		{{ 3197, 3108, 3107 }},
-		{{ 3107, 3206, 3197 }},
-		{{ 3193, 3111, 3108 }},
-		{{ 3108, 3197, 3193 }},
-		{{ 3187, 3112, 3111 }},
-		{{ 3111, 3193, 3187 }},
-		{{ 3183, 3114, 3112 }},
-		{{ 3112, 3187, 3183 }},
-		{{ 3252, 3221, 3224 }},
-		{{ 3224, 3254, 3252 }},
-		{{ 3250, 3219, 3221 }},
-		{{ 3221, 3252, 3250 }},
-		{{ 3246, 3218, 3219 }},
-		{{ 3219, 3250, 3246 }},
-		{{ 3242, 3216, 3218 }},
-		{{ 3218, 3246, 3242 }},
-		{{ 3236, 3212, 3216 }},
-		{{ 3216, 3242, 3236 }},
-		{{ 3234, 3206, 3212 }},
-		{{ 3212, 3236, 3234 }},
-		{{ 3232, 3197, 3206 }},
-		{{ 3206, 3234, 3232 }},
-		{{ 3230, 3193, 3197 }},
-		{{ 3197, 3232, 3230 }},
-		{{ 3228, 3187, 3193 }},
-		{{ 3193, 3230, 3228 }},
-		{{ 3226, 3183, 3187 }},
-		{{ 3187, 3228, 3226 }},
-		{{ 3294, 3252, 3254 }},
-		{{ 3254, 3298, 3294 }},
-		{{ 3286, 3250, 3252 }},
-		{{ 3252, 3294, 3286 }},
-		{{ 3280, 3246, 3250 }},
-		{{ 3250, 3286, 3280 }},
-		{{ 3272, 3242, 3246 }},
-		{{ 3246, 3280, 3272 }},
-		{{ 3264, 3236, 3242 }},
-		{{ 3242, 3272, 3264 }},
-		{{ 3258, 3234, 3236 }},
-		{{ 3236, 3264, 3258 }},
-		{{ 3248, 3232, 3234 }},
-		{{ 3234, 3258, 3248 }},
-		{{ 3244, 3230, 3232 }},
-		{{ 3232, 3248, 3244 }},
-		{{ 3240, 3228, 3230 }},
-		{{ 3230, 3244, 3240 }},
-		{{ 3238, 3226, 3228 }},
-		{{ 3228, 3240, 3238 }},
-		{{ 3331, 3294, 3298 }},
-		{{ 3298, 3333, 3331 }},
-		{{ 3321, 3286, 3294 }},
-		{{ 3294, 3331, 3321 }},
-		{{ 3315, 3280, 3286 }},
-		{{ 3286, 3321, 3315 }},
-		{{ 3304, 3272, 3280 }},
-		{{ 3280, 3315, 3304 }},
-		{{ 3288, 3264, 3272 }},
-		{{ 3272, 3304, 3288 }},
-		{{ 3276, 3258, 3264 }},
-		{{ 3264, 3288, 3276 }},
-		{{ 3266, 3248, 3258 }},
-		{{ 3258, 3276, 3266 }},
-		{{ 3262, 3244, 3248 }},
-		{{ 3248, 3266, 3262 }},
-		{{ 3260, 3240, 3244 }},
-		{{ 3244, 3262, 3260 }},
-		{{ 3256, 3238, 3240 }},
-		{{ 3240, 3260, 3256 }},
-		{{ 3350, 3331, 3333 }},
-		{{ 3333, 3354, 3350 }},
-		{{ 3347, 3321, 3331 }},
-		{{ 3331, 3350, 3347 }},
-		{{ 3339, 3315, 3321 }},
-		{{ 3321, 3347, 3339 }},
-		{{ 3323, 3304, 3315 }},
-		{{ 3315, 3339, 3323 }},
-		{{ 3309, 3288, 3304 }},
-		{{ 3304, 3323, 3309 }},
-		{{ 3300, 3276, 3288 }},
-		{{ 3288, 3309, 3300 }},
-		{{ 3284, 3266, 3276 }},
-		{{ 3276, 3300, 3284 }},
-		{{ 3274, 3262, 3266 }},
-		{{ 3266, 3284, 3274 }},
-		{{ 3269, 3260, 3262 }},
-		{{ 3262, 3274, 3269 }},
-		{{ 3267, 3256, 3260 }},
-		{{ 3260, 3269, 3267 }},
-		{{ 3372, 3350, 3354 }},
-		{{ 3354, 3378, 3372 }},
-		{{ 3367, 3347, 3350 }},
-		{{ 3350, 3372, 3367 }},
-		{{ 3352, 3339, 3347 }},
-		{{ 3347, 3367, 3352 }},
-		{{ 3341, 3323, 3339 }},
-		{{ 3339, 3352, 3341 }},
-		{{ 3325, 3309, 3323 }},
-		{{ 3323, 3341, 3325 }},
-		{{ 3313, 3300, 3309 }},
-		{{ 3309, 3325, 3313 }},
-		{{ 3301, 3284, 3300 }},
-		{{ 3300, 3313, 3301 }},
-		{{ 3289, 3274, 3284 }},
-		{{ 3284, 3301, 3289 }},
-		{{ 3281, 3269, 3274 }},
-		{{ 3274, 3289, 3281 }},
-		{{ 3277, 3267, 3269 }},
-		{{ 3269, 3281, 3277 }},
-		{{ 3403, 3372, 3378 }},
-		{{ 3378, 3405, 3403 }},
-		{{ 3393, 3367, 3372 }},
-		{{ 3372, 3403, 3393 }},
-		{{ 3377, 3352, 3367 }},
-		{{ 3367, 3393, 3377 }},
-		{{ 3360, 3341, 3352 }},
-		{{ 3352, 3377, 3360 }},
-		{{ 3344, 3325, 3341 }},
-		{{ 3341, 3360, 3344 }},
-		{{ 3327, 3313, 3325 }},
-		{{ 3325, 3344, 3327 }},
-		{{ 3317, 3301, 3313 }},
-		{{ 3313, 3327, 3317 }},
-		{{ 3305, 3289, 3301 }},
-		{{ 3301, 3317, 3305 }},
-		{{ 3296, 3281, 3289 }},
-		{{ 3289, 3305, 3296 }},
-		{{ 3291, 3277, 3281 }},
-		{{ 3281, 3296, 3291 }},
-		{{ 3469, 3403, 3405 }},
-		{{ 3405, 3472, 3469 }},
-		{{ 3450, 3393, 3403 }},
-		{{ 3403, 3469, 3450 }},
-		{{ 3426, 3377, 3393 }},
-		{{ 3393, 3450, 3426 }},
-		{{ 3390, 3360, 3377 }},
-		{{ 3377, 3426, 3390 }},
-		{{ 3370, 3344, 3360 }},
-		{{ 3360, 3390, 3370 }},
-		{{ 3349, 3327, 3344 }},
-		{{ 3344, 3370, 3349 }},
-		{{ 3337, 3317, 3327 }},
-		{{ 3327, 3349, 3337 }},
-		{{ 3319, 3305, 3317 }},
-		{{ 3317, 3337, 3319 }},
-		{{ 3311, 3296, 3305 }},
-		{{ 3305, 3319, 3311 }},
-		{{ 3307, 3291, 3296 }},
-		{{ 3296, 3311, 3307 }},
-		{{ 3520, 3469, 3472 }},
-		{{ 3472, 3522, 3520 }},
-		{{ 3504, 3450, 3469 }},
-		{{ 3469, 3520, 3504 }},
-		{{ 3489, 3426, 3450 }},
-		{{ 3450, 3504, 3489 }},
-		{{ 3463, 3390, 3426 }},
-		{{ 3426, 3489, 3463 }},
-		{{ 3421, 3370, 3390 }},
-		{{ 3390, 3463, 3421 }},
-		{{ 3385, 3349, 3370 }},
-		{{ 3370, 3421, 3385 }},
-		{{ 3361, 3337, 3349 }},
-		{{ 3349, 3385, 3361 }},
-		{{ 3342, 3319, 3337 }},
-		{{ 3337, 3361, 3342 }},
-		{{ 3334, 3311, 3319 }},
-		{{ 3319, 3342, 3334 }},
-		{{ 3328, 3307, 3311 }},
-		{{ 3311, 3334, 3328 }},
-		{{ 3591, 3520, 3522 }},
-		{{ 3522, 3603, 3591 }},
-		{{ 3578, 3504, 3520 }},
-		{{ 3520, 3591, 3578 }},
-		{{ 3552, 3489, 3504 }},
-		{{ 3504, 3578, 3552 }},
-		{{ 3530, 3463, 3489 }},
-		{{ 3489, 3552, 3530 }},
-		{{ 3499, 3421, 3463 }},
-		{{ 3463, 3530, 3499 }},
-		{{ 3467, 3385, 3421 }},
-		{{ 3421, 3499, 3467 }},
-		{{ 3415, 3361, 3385 }},
-		{{ 3385, 3467, 3415 }},
-		{{ 3381, 3342, 3361 }},
-		{{ 3361, 3415, 3381 }},
-		{{ 3363, 3334, 3342 }},
-		{{ 3342, 3381, 3363 }},
-		{{ 3356, 3328, 3334 }},
-		{{ 3334, 3363, 3356 }},
-		{{ 3374, 3365, 3358 }},
-		{{ 3358, 3371, 3374 }},
-		{{ 3395, 3383, 3365 }},
-		{{ 3365, 3374, 3395 }},
-		{{ 3443, 3417, 3383 }},
-		{{ 3383, 3395, 3443 }},
-		{{ 3481, 3466, 3417 }},
-		{{ 3417, 3443, 3481 }},
-		{{ 3514, 3496, 3466 }},
-		{{ 3466, 3481, 3514 }},
-		{{ 3545, 3529, 3496 }},
-		{{ 3496, 3514, 3545 }},
-		{{ 3573, 3551, 3529 }},
-		{{ 3529, 3545, 3573 }},
-		{{ 3597, 3577, 3551 }},
-		{{ 3551, 3573, 3597 }},
-		{{ 3613, 3590, 3577 }},
-		{{ 3577, 3597, 3613 }},
-		{{ 3619, 3603, 3590 }},
-		{{ 3590, 3613, 3619 }},
-		{{ 3387, 3374, 3371 }},
-		{{ 3371, 3380, 3387 }},
-		{{ 3413, 3395, 3374 }},
-		{{ 3374, 3387, 3413 }},
-		{{ 3461, 3443, 3395 }},
-		{{ 3395, 3413, 3461 }},
-		{{ 3493, 3481, 3443 }},
-		{{ 3443, 3461, 3493 }},
-		{{ 3524, 3514, 3481 }},
-		{{ 3481, 3493, 3524 }},
-		{{ 3556, 3545, 3514 }},
-		{{ 3514, 3524, 3556 }},
-		{{ 3584, 3573, 3545 }},
-		{{ 3545, 3556, 3584 }},
-		{{ 3611, 3597, 3573 }},
-		{{ 3573, 3584, 3611 }},
-		{{ 3628, 3613, 3597 }},
-		{{ 3597, 3611, 3628 }},
-		{{ 3632, 3619, 3613 }},
-		{{ 3613, 3628, 3632 }},
-		{{ 3398, 3387, 3380 }},
-		{{ 3380, 3391, 3398 }},
-		{{ 3435, 3413, 3387 }},
-		{{ 3387, 3398, 3435 }},
-		{{ 3473, 3461, 3413 }},
-		{{ 3413, 3435, 3473 }},
-		{{ 3500, 3493, 3461 }},
-		{{ 3461, 3473, 3500 }},
-		{{ 3531, 3524, 3493 }},
-		{{ 3493, 3500, 3531 }},
-		{{ 3562, 3556, 3524 }},
-		{{ 3524, 3531, 3562 }},
-		{{ 3595, 3584, 3556 }},
-		{{ 3556, 3562, 3595 }},
-		{{ 3617, 3611, 3584 }},
-		{{ 3584, 3595, 3617 }},
-		{{ 3633, 3628, 3611 }},
-		{{ 3611, 3617, 3633 }},
-		{{ 3641, 3632, 3628 }},
-		{{ 3628, 3633, 3641 }},
-		{{ 3409, 3398, 3391 }},
-		{{ 3391, 3400, 3409 }},
-		{{ 3447, 3435, 3398 }},
-		{{ 3398, 3409, 3447 }},
-		{{ 3477, 3473, 3435 }},
-		{{ 3435, 3447, 3477 }},
-		{{ 3506, 3500, 3473 }},
-		{{ 3473, 3477, 3506 }},
-		{{ 3540, 3531, 3500 }},
-		{{ 3500, 3506, 3540 }},
-		{{ 3567, 3562, 3531 }},
-		{{ 3531, 3540, 3567 }},
-		{{ 3601, 3595, 3562 }},
-		{{ 3562, 3567, 3601 }},
-		{{ 3624, 3617, 3595 }},
-		{{ 3595, 3601, 3624 }},
-		{{ 3639, 3633, 3617 }},
-		{{ 3617, 3624, 3639 }},
-		{{ 3644, 3641, 3633 }},
-		{{ 3633, 3639, 3644 }},
-		{{ 3433, 3409, 3400 }},
-		{{ 3400, 3411, 3433 }},
-		{{ 3453, 3447, 3409 }},
-		{{ 3409, 3433, 3453 }},
-		{{ 3483, 3477, 3447 }},
-		{{ 3447, 3453, 3483 }},
-		{{ 3510, 3506, 3477 }},
-		{{ 3477, 3483, 3510 }},
-		{{ 3543, 3540, 3506 }},
-		{{ 3506, 3510, 3543 }},
-		{{ 3569, 3567, 3540 }},
-		{{ 3540, 3543, 3569 }},
-		{{ 3599, 3601, 3567 }},
-		{{ 3567, 3569, 3599 }},
-		{{ 3622, 3624, 3601 }},
-		{{ 3601, 3599, 3622 }},
-		{{ 3637, 3639, 3624 }},
-		{{ 3624, 3622, 3637 }},
-		{{ 3642, 3644, 3639 }},
-		{{ 3639, 3637, 3642 }},
-		{{ 3439, 3433, 3411 }},
-		{{ 3411, 3424, 3439 }},
-		{{ 3458, 3453, 3433 }},
-		{{ 3433, 3439, 3458 }},
-		{{ 3487, 3483, 3453 }},
-		{{ 3453, 3458, 3487 }},
-		{{ 3513, 3510, 3483 }},
-		{{ 3483, 3487, 3513 }},
-		{{ 3542, 3543, 3510 }},
-		{{ 3510, 3513, 3542 }},
-		{{ 3566, 3569, 3543 }},
-		{{ 3543, 3542, 3566 }},
-		{{ 3593, 3599, 3569 }},
-		{{ 3569, 3566, 3593 }},
-		{{ 3616, 3622, 3599 }},
-		{{ 3599, 3593, 3616 }},
-		{{ 3630, 3637, 3622 }},
-		{{ 3622, 3616, 3630 }},
-		{{ 3636, 3642, 3637 }},
-		{{ 3637, 3630, 3636 }},
-		{{ 3441, 3439, 3424 }},
-		{{ 3424, 3429, 3441 }},
-		{{ 3459, 3458, 3439 }},
-		{{ 3439, 3441, 3459 }},
-		{{ 3485, 3487, 3458 }},
-		{{ 3458, 3459, 3485 }},
-		{{ 3508, 3513, 3487 }},
-		{{ 3487, 3485, 3508 }},
-		{{ 3533, 3542, 3513 }},
-		{{ 3513, 3508, 3533 }},
-		{{ 3558, 3566, 3542 }},
-		{{ 3542, 3533, 3558 }},
-		{{ 3582, 3593, 3566 }},
-		{{ 3566, 3558, 3582 }},
-		{{ 3607, 3616, 3593 }},
-		{{ 3593, 3582, 3607 }},
-		{{ 3620, 3630, 3616 }},
-		{{ 3616, 3607, 3620 }},
-		{{ 3626, 3636, 3630 }},
-		{{ 3630, 3620, 3626 }},
-		{{ 3437, 3441, 3429 }},
-		{{ 3429, 3427, 3437 }},
-		{{ 3455, 3459, 3441 }},
-		{{ 3441, 3437, 3455 }},
-		{{ 3479, 3485, 3459 }},
-		{{ 3459, 3455, 3479 }},
-		{{ 3502, 3508, 3485 }},
-		{{ 3485, 3479, 3502 }},
-		{{ 3526, 3533, 3508 }},
-		{{ 3508, 3502, 3526 }},
-		{{ 3547, 3558, 3533 }},
-		{{ 3533, 3526, 3547 }},
-		{{ 3571, 3582, 3558 }},
-		{{ 3558, 3547, 3571 }},
-		{{ 3588, 3607, 3582 }},
-		{{ 3582, 3571, 3588 }},
-		{{ 3605, 3620, 3607 }},
-		{{ 3607, 3588, 3605 }},
-		{{ 3609, 3626, 3620 }},
-		{{ 3620, 3605, 3609 }},
-		{{ 3419, 3437, 3427 }},
-		{{ 3427, 3408, 3419 }},
-		{{ 3445, 3455, 3437 }},
-		{{ 3437, 3419, 3445 }},
-		{{ 3470, 3479, 3455 }},
-		{{ 3455, 3445, 3470 }},
-		{{ 3492, 3502, 3479 }},
-		{{ 3479, 3470, 3492 }},
-		{{ 3517, 3526, 3502 }},
-		{{ 3502, 3492, 3517 }},
-		{{ 3536, 3547, 3526 }},
-		{{ 3526, 3517, 3536 }},
-		{{ 3554, 3571, 3547 }},
-		{{ 3547, 3536, 3554 }},
-		{{ 3575, 3588, 3571 }},
-		{{ 3571, 3554, 3575 }},
-		{{ 3580, 3605, 3588 }},
-		{{ 3588, 3575, 3580 }},
-		{{ 3587, 3609, 3605 }},
-		{{ 3605, 3580, 3587 }},
-		{{ 3401, 3419, 3408 }},
-		{{ 3408, 3397, 3401 }},
-		{{ 3431, 3445, 3419 }},
-		{{ 3419, 3401, 3431 }},
-		{{ 3451, 3470, 3445 }},
-		{{ 3445, 3431, 3451 }},
-		{{ 3475, 3492, 3470 }},
-		{{ 3470, 3451, 3475 }},
-		{{ 3497, 3517, 3492 }},
-		{{ 3492, 3475, 3497 }},
-		{{ 3518, 3536, 3517 }},
-		{{ 3517, 3497, 3518 }},
-		{{ 3537, 3554, 3536 }},
-		{{ 3536, 3518, 3537 }},
-		{{ 3549, 3575, 3554 }},
-		{{ 3554, 3537, 3549 }},
-		{{ 3560, 3580, 3575 }},
-		{{ 3575, 3549, 3560 }},
-		{{ 3564, 3587, 3580 }},
-		{{ 3580, 3560, 3564 }},
-		{{ 3614, 3591, 3603 }},
-		{{ 3603, 3619, 3614 }},
-		{{ 3598, 3578, 3591 }},
-		{{ 3591, 3614, 3598 }},
-		{{ 3574, 3552, 3578 }},
-		{{ 3578, 3598, 3574 }},
-		{{ 3546, 3530, 3552 }},
-		{{ 3552, 3574, 3546 }},
-		{{ 3515, 3499, 3530 }},
-		{{ 3530, 3546, 3515 }},
-		{{ 3482, 3467, 3499 }},
-		{{ 3499, 3515, 3482 }},
-		{{ 3444, 3418, 3467 }},
-		{{ 3467, 3482, 3444 }},
-		{{ 3396, 3384, 3418 }},
-		{{ 3418, 3444, 3396 }},
-		{{ 3375, 3366, 3384 }},
-		{{ 3384, 3396, 3375 }},
-		{{ 3371, 3358, 3366 }},
-		{{ 3366, 3375, 3371 }},
-		{{ 3629, 3614, 3619 }},
-		{{ 3619, 3632, 3629 }},
-		{{ 3612, 3598, 3614 }},
-		{{ 3614, 3629, 3612 }},
-		{{ 3585, 3574, 3598 }},
-		{{ 3598, 3612, 3585 }},
-		{{ 3557, 3546, 3574 }},
-		{{ 3574, 3585, 3557 }},
-		{{ 3525, 3515, 3546 }},
-		{{ 3546, 3557, 3525 }},
-		{{ 3494, 3482, 3515 }},
-		{{ 3515, 3525, 3494 }},
-		{{ 3462, 3444, 3482 }},
-		{{ 3482, 3494, 3462 }},
-		{{ 3414, 3396, 3444 }},
-		{{ 3444, 3462, 3414 }},
-		{{ 3388, 3375, 3396 }},
-		{{ 3396, 3414, 3388 }},
-		{{ 3380, 3371, 3375 }},
-		{{ 3375, 3388, 3380 }},
-		{{ 3634, 3629, 3632 }},
-		{{ 3632, 3641, 3634 }},
-		{{ 3618, 3612, 3629 }},
-		{{ 3629, 3634, 3618 }},
-		{{ 3596, 3585, 3612 }},
-		{{ 3612, 3618, 3596 }},
-		{{ 3563, 3557, 3585 }},
-		{{ 3585, 3596, 3563 }},
-		{{ 3532, 3525, 3557 }},
-		{{ 3557, 3563, 3532 }},
-		{{ 3501, 3494, 3525 }},
-		{{ 3525, 3532, 3501 }},
-		{{ 3474, 3462, 3494 }},
-		{{ 3494, 3501, 3474 }},
-		{{ 3436, 3414, 3462 }},
-		{{ 3462, 3474, 3436 }},
-		{{ 3399, 3388, 3414 }},
-		{{ 3414, 3436, 3399 }},
-		{{ 3392, 3380, 3388 }},
-		{{ 3388, 3399, 3392 }},
-		{{ 3640, 3634, 3641 }},
-		{{ 3641, 3644, 3640 }},
-		{{ 3625, 3618, 3634 }},
-		{{ 3634, 3640, 3625 }},
-		{{ 3602, 3596, 3618 }},
-		{{ 3618, 3625, 3602 }},
-		{{ 3568, 3563, 3596 }},
-		{{ 3596, 3602, 3568 }},
-		{{ 3539, 3532, 3563 }},
-		{{ 3563, 3568, 3539 }},
-		{{ 3507, 3501, 3532 }},
-		{{ 3532, 3539, 3507 }},
-		{{ 3478, 3474, 3501 }},
-		{{ 3501, 3507, 3478 }},
-		{{ 3448, 3436, 3474 }},
-		{{ 3474, 3478, 3448 }},
-		{{ 3410, 3399, 3436 }},
-		{{ 3436, 3448, 3410 }},
-		{{ 3400, 3392, 3399 }},
-		{{ 3399, 3410, 3400 }},
-		{{ 3638, 3640, 3644 }},
-		{{ 3644, 3643, 3638 }},
-		{{ 3623, 3625, 3640 }},
-		{{ 3640, 3638, 3623 }},
-		{{ 3600, 3602, 3625 }},
-		{{ 3625, 3623, 3600 }},
-		{{ 3570, 3568, 3602 }},
-		{{ 3602, 3600, 3570 }},
-		{{ 3544, 3539, 3568 }},
-		{{ 3568, 3570, 3544 }},
-		{{ 3511, 3507, 3539 }},
-		{{ 3539, 3544, 3511 }},
-		{{ 3484, 3478, 3507 }},
-		{{ 3507, 3511, 3484 }},
-		{{ 3454, 3448, 3478 }},
-		{{ 3478, 3484, 3454 }},
-		{{ 3434, 3410, 3448 }},
-		{{ 3448, 3454, 3434 }},
-		{{ 3412, 3400, 3410 }},
-		{{ 3410, 3434, 3412 }},
-		{{ 3631, 3638, 3643 }},
-		{{ 3643, 3635, 3631 }},
-		{{ 3615, 3623, 3638 }},
-		{{ 3638, 3631, 3615 }},
-		{{ 3594, 3600, 3623 }},
-		{{ 3623, 3615, 3594 }},
-		{{ 3565, 3570, 3600 }},
-		{{ 3600, 3594, 3565 }},
-		{{ 3541, 3544, 3570 }},
-		{{ 3570, 3565, 3541 }},
-		{{ 3512, 3511, 3544 }},
-		{{ 3544, 3541, 3512 }},
-		{{ 3488, 3484, 3511 }},
-		{{ 3511, 3512, 3488 }},
-		{{ 3457, 3454, 3484 }},
-		{{ 3484, 3488, 3457 }},
-		{{ 3440, 3434, 3454 }},
-		{{ 3454, 3457, 3440 }},
-		{{ 3423, 3412, 3434 }},
-		{{ 3434, 3440, 3423 }},
-		{{ 3621, 3631, 3635 }},
-		{{ 3635, 3627, 3621 }},
-		{{ 3608, 3615, 3631 }},
-		{{ 3631, 3621, 3608 }},
-		{{ 3583, 3594, 3615 }},
-		{{ 3615, 3608, 3583 }},
-		{{ 3559, 3565, 3594 }},
-		{{ 3594, 3583, 3559 }},
-		{{ 3534, 3541, 3565 }},
-		{{ 3565, 3559, 3534 }},
-		{{ 3509, 3512, 3541 }},
-		{{ 3541, 3534, 3509 }},
-		{{ 3486, 3488, 3512 }},
-		{{ 3512, 3509, 3486 }},
-		{{ 3460, 3457, 3488 }},
-		{{ 3488, 3486, 3460 }},
-		{{ 3442, 3440, 3457 }},
-		{{ 3457, 3460, 3442 }},
-		{{ 3430, 3423, 3440 }},
-		{{ 3440, 3442, 3430 }},
-		{{ 3606, 3621, 3627 }},
-		{{ 3627, 3610, 3606 }},
-		{{ 3589, 3608, 3621 }},
-		{{ 3621, 3606, 3589 }},
-		{{ 3572, 3583, 3608 }},
-		{{ 3608, 3589, 3572 }},
-		{{ 3548, 3559, 3583 }},
-		{{ 3583, 3572, 3548 }},
-		{{ 3527, 3534, 3559 }},
-		{{ 3559, 3548, 3527 }},
-		{{ 3503, 3509, 3534 }},
-		{{ 3534, 3527, 3503 }},
-		{{ 3480, 3486, 3509 }},
-		{{ 3509, 3503, 3480 }},
-		{{ 3456, 3460, 3486 }},
-		{{ 3486, 3480, 3456 }},
-		{{ 3438, 3442, 3460 }},
-		{{ 3460, 3456, 3438 }},
-		{{ 3428, 3430, 3442 }},
-		{{ 3442, 3438, 3428 }},
-		{{ 3581, 3606, 3610 }},
-		{{ 3610, 3586, 3581 }},
-		{{ 3576, 3589, 3606 }},
-		{{ 3606, 3581, 3576 }},
-		{{ 3555, 3572, 3589 }},
-		{{ 3589, 3576, 3555 }},
-		{{ 3535, 3548, 3572 }},
-		{{ 3572, 3555, 3535 }},
-		{{ 3516, 3527, 3548 }},
-		{{ 3548, 3535, 3516 }},
-		{{ 3491, 3503, 3527 }},
-		{{ 3527, 3516, 3491 }},
-		{{ 3471, 3480, 3503 }},
-		{{ 3503, 3491, 3471 }},
-		{{ 3446, 3456, 3480 }},
-		{{ 3480, 3471, 3446 }},
-		{{ 3420, 3438, 3456 }},
-		{{ 3456, 3446, 3420 }},
-		{{ 3407, 3428, 3438 }},
-		{{ 3438, 3420, 3407 }},
-		{{ 3561, 3581, 3586 }},
-		{{ 3586, 3564, 3561 }},
-		{{ 3550, 3576, 3581 }},
-		{{ 3581, 3561, 3550 }},
-		{{ 3538, 3555, 3576 }},
-		{{ 3576, 3550, 3538 }},
-		{{ 3519, 3535, 3555 }},
-		{{ 3555, 3538, 3519 }},
-		{{ 3498, 3516, 3535 }},
-		{{ 3535, 3519, 3498 }},
-		{{ 3476, 3491, 3516 }},
-		{{ 3516, 3498, 3476 }},
-		{{ 3452, 3471, 3491 }},
-		{{ 3491, 3476, 3452 }},
-		{{ 3432, 3446, 3471 }},
-		{{ 3471, 3452, 3432 }},
-		{{ 3402, 3420, 3446 }},
-		{{ 3446, 3432, 3402 }},
-		{{ 3397, 3407, 3420 }},
-		{{ 3420, 3402, 3397 }},
-		{{ 1888, 2110, 2104 }},
-		{{ 1888, 2104, 2096 }},
-		{{ 1888, 2096, 2076 }},
-		{{ 1888, 2076, 2048 }},
-		{{ 1888, 2048, 2030 }},
-		{{ 1888, 2030, 2006 }},
-		{{ 1888, 2006, 1982 }},
-		{{ 1888, 1982, 1960 }},
-		{{ 1888, 1960, 1936 }},
-		{{ 1888, 1936, 1732 }},
-		{{ 2257, 2104, 2110 }},
-		{{ 2110, 2261, 2257 }},
-		{{ 2249, 2096, 2104 }},
-		{{ 2104, 2257, 2249 }},
-		{{ 2226, 2076, 2096 }},
-		{{ 2096, 2249, 2226 }},
-		{{ 2200, 2048, 2076 }},
-		{{ 2076, 2226, 2200 }},
-		{{ 2142, 2030, 2048 }},
-		{{ 2048, 2200, 2142 }},
-		{{ 2094, 2006, 2030 }},
-		{{ 2030, 2142, 2094 }},
-		{{ 2036, 1982, 2006 }},
-		{{ 2006, 2094, 2036 }},
-		{{ 1988, 1960, 1982 }},
-		{{ 1982, 2036, 1988 }},
-		{{ 1948, 1936, 1960 }},
-		{{ 1960, 1988, 1948 }},
-		{{ 1728, 1732, 1936 }},
-		{{ 1936, 1948, 1728 }},
-		{{ 2310, 2257, 2261 }},
-		{{ 2261, 2315, 2310 }},
-		{{ 2300, 2249, 2257 }},
-		{{ 2257, 2310, 2300 }},
-		{{ 2279, 2226, 2249 }},
-		{{ 2249, 2300, 2279 }},
-		{{ 2243, 2200, 2226 }},
-		{{ 2226, 2279, 2243 }},
-		{{ 2204, 2142, 2200 }},
-		{{ 2200, 2243, 2204 }},
-		{{ 2132, 2094, 2142 }},
-		{{ 2142, 2204, 2132 }},
-		{{ 2067, 2036, 2094 }},
-		{{ 2094, 2132, 2067 }},
-		{{ 2000, 1988, 2036 }},
-		{{ 2036, 2067, 2000 }},
-		{{ 1956, 1948, 1988 }},
-		{{ 1988, 2000, 1956 }},
-		{{ 1734, 1728, 1948 }},
-		{{ 1948, 1956, 1734 }},
-		{{ 2312, 2310, 2315 }},
-		{{ 2315, 2316, 2312 }},
-		{{ 2302, 2300, 2310 }},
-		{{ 2310, 2312, 2302 }},
-		{{ 2281, 2279, 2300 }},
-		{{ 2300, 2302, 2281 }},
-		{{ 2245, 2243, 2279 }},
-		{{ 2279, 2281, 2245 }},
-		{{ 2206, 2204, 2243 }},
-		{{ 2243, 2245, 2206 }},
-		{{ 2134, 2132, 2204 }},
-		{{ 2204, 2206, 2134 }},
-		{{ 2068, 2067, 2132 }},
-		{{ 2132, 2134, 2068 }},
-		{{ 2002, 2000, 2067 }},
-		{{ 2067, 2068, 2002 }},
-		{{ 1958, 1956, 2000 }},
-		{{ 2000, 2002, 1958 }},
-		{{ 1878, 1734, 1956 }},
-		{{ 1956, 1958, 1878 }},
-		{{ 2285, 2312, 2316 }},
-		{{ 2316, 2289, 2285 }},
-		{{ 2259, 2302, 2312 }},
-		{{ 2312, 2285, 2259 }},
-		{{ 2241, 2281, 2302 }},
-		{{ 2302, 2259, 2241 }},
-		{{ 2214, 2245, 2281 }},
-		{{ 2281, 2241, 2214 }},
-		{{ 2168, 2206, 2245 }},
-		{{ 2245, 2214, 2168 }},
-		{{ 2106, 2134, 2206 }},
-		{{ 2206, 2168, 2106 }},
-		{{ 2042, 2068, 2134 }},
-		{{ 2134, 2106, 2042 }},
-		{{ 1994, 2002, 2068 }},
-		{{ 2068, 2042, 1994 }},
-		{{ 1952, 1958, 2002 }},
-		{{ 2002, 1994, 1952 }},
-		{{ 1731, 1878, 1958 }},
-		{{ 1958, 1952, 1731 }},
-		{{ 2220, 2285, 2289 }},
-		{{ 2289, 2225, 2220 }},
-		{{ 2210, 2259, 2285 }},
-		{{ 2285, 2220, 2210 }},
-		{{ 2186, 2241, 2259 }},
-		{{ 2259, 2210, 2186 }},
-		{{ 2146, 2214, 2241 }},
-		{{ 2241, 2186, 2146 }},
-		{{ 2108, 2168, 2214 }},
-		{{ 2214, 2146, 2108 }},
-		{{ 2060, 2106, 2168 }},
-		{{ 2168, 2108, 2060 }},
-		{{ 2018, 2042, 2106 }},
-		{{ 2106, 2060, 2018 }},
-		{{ 1978, 1994, 2042 }},
-		{{ 2042, 2018, 1978 }},
-		{{ 1944, 1952, 1994 }},
-		{{ 1994, 1978, 1944 }},
-		{{ 1727, 1731, 1952 }},
-		{{ 1952, 1944, 1727 }},
-		{{ 2141, 2220, 2225 }},
-		{{ 2225, 2145, 2141 }},
-		{{ 2127, 2210, 2220 }},
-		{{ 2220, 2141, 2127 }},
-		{{ 2112, 2186, 2210 }},
-		{{ 2210, 2127, 2112 }},
-		{{ 2084, 2146, 2186 }},
-		{{ 2186, 2112, 2084 }},
-		{{ 2044, 2108, 2146 }},
-		{{ 2146, 2084, 2044 }},
-		{{ 2024, 2060, 2108 }},
-		{{ 2108, 2044, 2024 }},
-		{{ 1992, 2018, 2060 }},
-		{{ 2060, 2024, 1992 }},
-		{{ 1970, 1978, 2018 }},
-		{{ 2018, 1992, 1970 }},
-		{{ 1942, 1944, 1978 }},
-		{{ 1978, 1970, 1942 }},
-		{{ 1721, 1727, 1944 }},
-		{{ 1944, 1942, 1721 }},
-		{{ 2079, 2141, 2145 }},
-		{{ 2145, 2087, 2079 }},
-		{{ 2075, 2127, 2141 }},
-		{{ 2141, 2079, 2075 }},
-		{{ 2055, 2112, 2127 }},
-		{{ 2127, 2075, 2055 }},
-		{{ 2039, 2084, 2112 }},
-		{{ 2112, 2055, 2039 }},
-		{{ 2021, 2044, 2084 }},
-		{{ 2084, 2039, 2021 }},
-		{{ 1996, 2024, 2044 }},
-		{{ 2044, 2021, 1996 }},
-		{{ 1974, 1992, 2024 }},
-		{{ 2024, 1996, 1974 }},
-		{{ 1954, 1970, 1992 }},
-		{{ 1992, 1974, 1954 }},
-		{{ 1934, 1942, 1970 }},
-		{{ 1970, 1954, 1934 }},
-		{{ 1720, 1721, 1942 }},
-		{{ 1942, 1934, 1720 }},
-		{{ 2063, 2079, 2087 }},
-		{{ 2087, 2071, 2063 }},
-		{{ 2051, 2075, 2079 }},
-		{{ 2079, 2063, 2051 }},
-		{{ 2041, 2055, 2075 }},
-		{{ 2075, 2051, 2041 }},
-		{{ 2029, 2039, 2055 }},
-		{{ 2055, 2041, 2029 }},
-		{{ 2013, 2021, 2039 }},
-		{{ 2039, 2029, 2013 }},
-		{{ 1991, 1996, 2021 }},
-		{{ 2021, 2013, 1991 }},
-		{{ 1972, 1974, 1996 }},
-		{{ 1996, 1991, 1972 }},
-		{{ 1950, 1954, 1974 }},
-		{{ 1974, 1972, 1950 }},
-		{{ 1932, 1934, 1954 }},
-		{{ 1954, 1950, 1932 }},
-		{{ 1701, 1720, 1934 }},
-		{{ 1934, 1932, 1701 }},
-		{{ 2115, 2063, 2071 }},
-		{{ 2071, 2123, 2115 }},
-		{{ 2101, 2051, 2063 }},
-		{{ 2063, 2115, 2101 }},
-		{{ 2081, 2041, 2051 }},
-		{{ 2051, 2101, 2081 }},
-		{{ 2057, 2029, 2041 }},
-		{{ 2041, 2081, 2057 }},
-		{{ 2033, 2013, 2029 }},
-		{{ 2029, 2057, 2033 }},
-		{{ 2009, 1991, 2013 }},
-		{{ 2013, 2033, 2009 }},
-		{{ 1984, 1972, 1991 }},
-		{{ 1991, 2009, 1984 }},
-		{{ 1964, 1950, 1972 }},
-		{{ 1972, 1984, 1964 }},
-		{{ 1938, 1932, 1950 }},
-		{{ 1950, 1964, 1938 }},
-		{{ 1698, 1701, 1932 }},
-		{{ 1932, 1938, 1698 }},
-		{{ 1888, 1886, 1686 }},
-		{{ 1888, 1686, 1662 }},
-		{{ 1888, 1662, 1640 }},
-		{{ 1888, 1640, 1616 }},
-		{{ 1888, 1616, 1592 }},
-		{{ 1888, 1592, 1574 }},
-		{{ 1888, 1574, 1546 }},
-		{{ 1888, 1546, 1526 }},
-		{{ 1888, 1526, 1518 }},
-		{{ 1888, 1518, 1512 }},
-		{{ 1674, 1686, 1886 }},
-		{{ 1886, 1884, 1674 }},
-		{{ 1634, 1662, 1686 }},
-		{{ 1686, 1674, 1634 }},
-		{{ 1586, 1640, 1662 }},
-		{{ 1662, 1634, 1586 }},
-		{{ 1528, 1616, 1640 }},
-		{{ 1640, 1586, 1528 }},
-		{{ 1480, 1592, 1616 }},
-		{{ 1616, 1528, 1480 }},
-		{{ 1422, 1574, 1592 }},
-		{{ 1592, 1480, 1422 }},
-		{{ 1396, 1546, 1574 }},
-		{{ 1574, 1422, 1396 }},
-		{{ 1373, 1526, 1546 }},
-		{{ 1546, 1396, 1373 }},
-		{{ 1365, 1518, 1526 }},
-		{{ 1526, 1373, 1365 }},
-		{{ 1361, 1512, 1518 }},
-		{{ 1518, 1365, 1361 }},
-		{{ 1666, 1674, 1884 }},
-		{{ 1884, 1882, 1666 }},
-		{{ 1622, 1634, 1674 }},
-		{{ 1674, 1666, 1622 }},
-		{{ 1557, 1586, 1634 }},
-		{{ 1634, 1622, 1557 }},
-		{{ 1490, 1528, 1586 }},
-		{{ 1586, 1557, 1490 }},
-		{{ 1418, 1480, 1528 }},
-		{{ 1528, 1490, 1418 }},
-		{{ 1379, 1422, 1480 }},
-		{{ 1480, 1418, 1379 }},
-		{{ 1343, 1396, 1422 }},
-		{{ 1422, 1379, 1343 }},
-		{{ 1322, 1373, 1396 }},
-		{{ 1396, 1343, 1322 }},
-		{{ 1312, 1365, 1373 }},
-		{{ 1373, 1322, 1312 }},
-		{{ 1309, 1361, 1365 }},
-		{{ 1365, 1312, 1309 }},
-		{{ 1664, 1666, 1882 }},
-		{{ 1882, 1879, 1664 }},
-		{{ 1620, 1622, 1666 }},
-		{{ 1666, 1664, 1620 }},
-		{{ 1554, 1557, 1622 }},
-		{{ 1622, 1620, 1554 }},
-		{{ 1488, 1490, 1557 }},
-		{{ 1557, 1554, 1488 }},
-		{{ 1416, 1418, 1490 }},
-		{{ 1490, 1488, 1416 }},
-		{{ 1377, 1379, 1418 }},
-		{{ 1418, 1416, 1377 }},
-		{{ 1341, 1343, 1379 }},
-		{{ 1379, 1377, 1341 }},
-		{{ 1320, 1322, 1343 }},
-		{{ 1343, 1341, 1320 }},
-		{{ 1310, 1312, 1322 }},
-		{{ 1322, 1320, 1310 }},
-		{{ 1306, 1309, 1312 }},
-		{{ 1312, 1310, 1306 }},
-		{{ 1670, 1664, 1879 }},
-		{{ 1879, 1876, 1670 }},
-		{{ 1628, 1620, 1664 }},
-		{{ 1664, 1670, 1628 }},
-		{{ 1580, 1554, 1620 }},
-		{{ 1620, 1628, 1580 }},
-		{{ 1516, 1488, 1554 }},
-		{{ 1554, 1580, 1516 }},
-		{{ 1454, 1416, 1488 }},
-		{{ 1488, 1516, 1454 }},
-		{{ 1408, 1377, 1416 }},
-		{{ 1416, 1454, 1408 }},
-		{{ 1381, 1341, 1377 }},
-		{{ 1377, 1408, 1381 }},
-		{{ 1363, 1320, 1341 }},
-		{{ 1341, 1381, 1363 }},
-		{{ 1337, 1310, 1320 }},
-		{{ 1320, 1363, 1337 }},
-		{{ 1333, 1306, 1310 }},
-		{{ 1310, 1337, 1333 }},
-		{{ 1678, 1670, 1876 }},
-		{{ 1876, 1874, 1678 }},
-		{{ 1644, 1628, 1670 }},
-		{{ 1670, 1678, 1644 }},
-		{{ 1604, 1580, 1628 }},
-		{{ 1628, 1644, 1604 }},
-		{{ 1562, 1516, 1580 }},
-		{{ 1580, 1604, 1562 }},
-		{{ 1514, 1454, 1516 }},
-		{{ 1516, 1562, 1514 }},
-		{{ 1476, 1408, 1454 }},
-		{{ 1454, 1514, 1476 }},
-		{{ 1436, 1381, 1408 }},
-		{{ 1408, 1476, 1436 }},
-		{{ 1412, 1363, 1381 }},
-		{{ 1381, 1436, 1412 }},
-		{{ 1402, 1337, 1363 }},
-		{{ 1363, 1412, 1402 }},
-		{{ 1399, 1333, 1337 }},
-		{{ 1337, 1402, 1399 }},
-		{{ 1680, 1678, 1874 }},
-		{{ 1874, 1872, 1680 }},
-		{{ 1652, 1644, 1678 }},
-		{{ 1678, 1680, 1652 }},
-		{{ 1630, 1604, 1644 }},
-		{{ 1644, 1652, 1630 }},
-		{{ 1598, 1562, 1604 }},
-		{{ 1604, 1630, 1598 }},
-		{{ 1578, 1514, 1562 }},
-		{{ 1562, 1598, 1578 }},
-		{{ 1538, 1476, 1514 }},
-		{{ 1514, 1578, 1538 }},
-		{{ 1510, 1436, 1476 }},
-		{{ 1476, 1538, 1510 }},
-		{{ 1497, 1412, 1436 }},
-		{{ 1436, 1510, 1497 }},
-		{{ 1483, 1402, 1412 }},
-		{{ 1412, 1497, 1483 }},
-		{{ 1479, 1399, 1402 }},
-		{{ 1402, 1483, 1479 }},
-		{{ 1688, 1680, 1872 }},
-		{{ 1872, 1870, 1688 }},
-		{{ 1668, 1652, 1680 }},
-		{{ 1680, 1688, 1668 }},
-		{{ 1648, 1630, 1652 }},
-		{{ 1652, 1668, 1648 }},
-		{{ 1626, 1598, 1630 }},
-		{{ 1630, 1648, 1626 }},
-		{{ 1603, 1578, 1598 }},
-		{{ 1598, 1626, 1603 }},
-		{{ 1585, 1538, 1578 }},
-		{{ 1578, 1603, 1585 }},
-		{{ 1569, 1510, 1538 }},
-		{{ 1538, 1585, 1569 }},
-		{{ 1549, 1497, 1510 }},
-		{{ 1510, 1569, 1549 }},
-		{{ 1545, 1483, 1497 }},
-		{{ 1497, 1549, 1545 }},
-		{{ 1537, 1479, 1483 }},
-		{{ 1483, 1545, 1537 }},
-		{{ 1690, 1688, 1870 }},
-		{{ 1870, 1868, 1690 }},
-		{{ 1672, 1668, 1688 }},
-		{{ 1688, 1690, 1672 }},
-		{{ 1650, 1648, 1668 }},
-		{{ 1668, 1672, 1650 }},
-		{{ 1633, 1626, 1648 }},
-		{{ 1648, 1650, 1633 }},
-		{{ 1611, 1603, 1626 }},
-		{{ 1626, 1633, 1611 }},
-		{{ 1595, 1585, 1603 }},
-		{{ 1603, 1611, 1595 }},
-		{{ 1583, 1569, 1585 }},
-		{{ 1585, 1595, 1583 }},
-		{{ 1573, 1549, 1569 }},
-		{{ 1569, 1583, 1573 }},
-		{{ 1561, 1545, 1549 }},
-		{{ 1549, 1573, 1561 }},
-		{{ 1553, 1537, 1545 }},
-		{{ 1545, 1561, 1553 }},
-		{{ 1684, 1690, 1868 }},
-		{{ 1868, 1865, 1684 }},
-		{{ 1658, 1672, 1690 }},
-		{{ 1690, 1684, 1658 }},
-		{{ 1638, 1650, 1672 }},
-		{{ 1672, 1658, 1638 }},
-		{{ 1615, 1633, 1650 }},
-		{{ 1650, 1638, 1615 }},
-		{{ 1591, 1611, 1633 }},
-		{{ 1633, 1615, 1591 }},
-		{{ 1567, 1595, 1611 }},
-		{{ 1611, 1591, 1567 }},
-		{{ 1543, 1583, 1595 }},
-		{{ 1595, 1567, 1543 }},
-		{{ 1523, 1573, 1583 }},
-		{{ 1583, 1543, 1523 }},
-		{{ 1509, 1561, 1573 }},
-		{{ 1573, 1523, 1509 }},
-		{{ 1501, 1553, 1561 }},
-		{{ 1561, 1509, 1501 }},
-		{{ 1888, 1513, 1519 }},
-		{{ 1888, 1519, 1527 }},
-		{{ 1888, 1527, 1547 }},
-		{{ 1888, 1547, 1575 }},
-		{{ 1888, 1575, 1593 }},
-		{{ 1888, 1593, 1617 }},
-		{{ 1888, 1617, 1641 }},
-		{{ 1888, 1641, 1663 }},
-		{{ 1888, 1663, 1687 }},
-		{{ 1888, 1687, 1894 }},
-		{{ 1366, 1519, 1513 }},
-		{{ 1513, 1362, 1366 }},
-		{{ 1374, 1527, 1519 }},
-		{{ 1519, 1366, 1374 }},
-		{{ 1397, 1547, 1527 }},
-		{{ 1527, 1374, 1397 }},
-		{{ 1423, 1575, 1547 }},
-		{{ 1547, 1397, 1423 }},
-		{{ 1481, 1593, 1575 }},
-		{{ 1575, 1423, 1481 }},
-		{{ 1529, 1617, 1593 }},
-		{{ 1593, 1481, 1529 }},
-		{{ 1587, 1641, 1617 }},
-		{{ 1617, 1529, 1587 }},
-		{{ 1635, 1663, 1641 }},
-		{{ 1641, 1587, 1635 }},
-		{{ 1675, 1687, 1663 }},
-		{{ 1663, 1635, 1675 }},
-		{{ 1895, 1894, 1687 }},
-		{{ 1687, 1675, 1895 }},
-		{{ 1313, 1366, 1362 }},
-		{{ 1362, 1308, 1313 }},
-		{{ 1323, 1374, 1366 }},
-		{{ 1366, 1313, 1323 }},
-		{{ 1344, 1397, 1374 }},
-		{{ 1374, 1323, 1344 }},
-		{{ 1380, 1423, 1397 }},
-		{{ 1397, 1344, 1380 }},
-		{{ 1419, 1481, 1423 }},
-		{{ 1423, 1380, 1419 }},
-		{{ 1491, 1529, 1481 }},
-		{{ 1481, 1419, 1491 }},
-		{{ 1556, 1587, 1529 }},
-		{{ 1529, 1491, 1556 }},
-		{{ 1623, 1635, 1587 }},
-		{{ 1587, 1556, 1623 }},
-		{{ 1667, 1675, 1635 }},
-		{{ 1635, 1623, 1667 }},
-		{{ 1890, 1895, 1675 }},
-		{{ 1675, 1667, 1890 }},
-		{{ 1311, 1313, 1308 }},
-		{{ 1308, 1307, 1311 }},
-		{{ 1321, 1323, 1313 }},
-		{{ 1313, 1311, 1321 }},
-		{{ 1342, 1344, 1323 }},
-		{{ 1323, 1321, 1342 }},
-		{{ 1378, 1380, 1344 }},
-		{{ 1344, 1342, 1378 }},
-		{{ 1417, 1419, 1380 }},
-		{{ 1380, 1378, 1417 }},
-		{{ 1489, 1491, 1419 }},
-		{{ 1419, 1417, 1489 }},
-		{{ 1555, 1556, 1491 }},
-		{{ 1491, 1489, 1555 }},
-		{{ 1621, 1623, 1556 }},
-		{{ 1556, 1555, 1621 }},
-		{{ 1665, 1667, 1623 }},
-		{{ 1623, 1621, 1665 }},
-		{{ 1881, 1890, 1667 }},
-		{{ 1667, 1665, 1881 }},
-		{{ 1338, 1311, 1307 }},
-		{{ 1307, 1334, 1338 }},
-		{{ 1364, 1321, 1311 }},
-		{{ 1311, 1338, 1364 }},
-		{{ 1382, 1342, 1321 }},
-		{{ 1321, 1364, 1382 }},
-		{{ 1409, 1378, 1342 }},
-		{{ 1342, 1382, 1409 }},
-		{{ 1455, 1417, 1378 }},
-		{{ 1378, 1409, 1455 }},
-		{{ 1517, 1489, 1417 }},
-		{{ 1417, 1455, 1517 }},
-		{{ 1581, 1555, 1489 }},
-		{{ 1489, 1517, 1581 }},
-		{{ 1629, 1621, 1555 }},
-		{{ 1555, 1581, 1629 }},
-		{{ 1671, 1665, 1621 }},
-		{{ 1621, 1629, 1671 }},
-		{{ 1893, 1881, 1665 }},
-		{{ 1665, 1671, 1893 }},
-		{{ 1403, 1338, 1334 }},
-		{{ 1334, 1398, 1403 }},
-		{{ 1413, 1364, 1338 }},
-		{{ 1338, 1403, 1413 }},
-		{{ 1437, 1382, 1364 }},
-		{{ 1364, 1413, 1437 }},
-		{{ 1477, 1409, 1382 }},
-		{{ 1382, 1437, 1477 }},
-		{{ 1515, 1455, 1409 }},
-		{{ 1409, 1477, 1515 }},
-		{{ 1563, 1517, 1455 }},
-		{{ 1455, 1515, 1563 }},
-		{{ 1605, 1581, 1517 }},
-		{{ 1517, 1563, 1605 }},
-		{{ 1645, 1629, 1581 }},
-		{{ 1581, 1605, 1645 }},
-		{{ 1679, 1671, 1629 }},
-		{{ 1629, 1645, 1679 }},
-		{{ 1900, 1893, 1671 }},
-		{{ 1671, 1679, 1900 }},
-		{{ 1482, 1403, 1398 }},
-		{{ 1398, 1478, 1482 }},
-		{{ 1496, 1413, 1403 }},
-		{{ 1403, 1482, 1496 }},
-		{{ 1511, 1437, 1413 }},
-		{{ 1413, 1496, 1511 }},
-		{{ 1539, 1477, 1437 }},
-		{{ 1437, 1511, 1539 }},
-		{{ 1579, 1515, 1477 }},
-		{{ 1477, 1539, 1579 }},
-		{{ 1599, 1563, 1515 }},
-		{{ 1515, 1579, 1599 }},
-		{{ 1631, 1605, 1563 }},
-		{{ 1563, 1599, 1631 }},
-		{{ 1653, 1645, 1605 }},
-		{{ 1605, 1631, 1653 }},
-		{{ 1681, 1679, 1645 }},
-		{{ 1645, 1653, 1681 }},
-		{{ 1902, 1900, 1679 }},
-		{{ 1679, 1681, 1902 }},
-		{{ 1544, 1482, 1478 }},
-		{{ 1478, 1536, 1544 }},
-		{{ 1548, 1496, 1482 }},
-		{{ 1482, 1544, 1548 }},
-		{{ 1568, 1511, 1496 }},
-		{{ 1496, 1548, 1568 }},
-		{{ 1584, 1539, 1511 }},
-		{{ 1511, 1568, 1584 }},
-		{{ 1602, 1579, 1539 }},
-		{{ 1539, 1584, 1602 }},
-		{{ 1627, 1599, 1579 }},
-		{{ 1579, 1602, 1627 }},
-		{{ 1649, 1631, 1599 }},
-		{{ 1599, 1627, 1649 }},
-		{{ 1669, 1653, 1631 }},
-		{{ 1631, 1649, 1669 }},
-		{{ 1689, 1681, 1653 }},
-		{{ 1653, 1669, 1689 }},
-		{{ 1921, 1902, 1681 }},
-		{{ 1681, 1689, 1921 }},
-		{{ 1560, 1544, 1536 }},
-		{{ 1536, 1552, 1560 }},
-		{{ 1572, 1548, 1544 }},
-		{{ 1544, 1560, 1572 }},
-		{{ 1582, 1568, 1548 }},
-		{{ 1548, 1572, 1582 }},
-		{{ 1594, 1584, 1568 }},
-		{{ 1568, 1582, 1594 }},
-		{{ 1610, 1602, 1584 }},
-		{{ 1584, 1594, 1610 }},
-		{{ 1632, 1627, 1602 }},
-		{{ 1602, 1610, 1632 }},
-		{{ 1651, 1649, 1627 }},
-		{{ 1627, 1632, 1651 }},
-		{{ 1673, 1669, 1649 }},
-		{{ 1649, 1651, 1673 }},
-		{{ 1691, 1689, 1669 }},
-		{{ 1669, 1673, 1691 }},
-		{{ 1922, 1921, 1689 }},
-		{{ 1689, 1691, 1922 }},
-		{{ 1508, 1560, 1552 }},
-		{{ 1552, 1500, 1508 }},
-		{{ 1522, 1572, 1560 }},
-		{{ 1560, 1508, 1522 }},
-		{{ 1542, 1582, 1572 }},
-		{{ 1572, 1522, 1542 }},
-		{{ 1566, 1594, 1582 }},
-		{{ 1582, 1542, 1566 }},
-		{{ 1590, 1610, 1594 }},
-		{{ 1594, 1566, 1590 }},
-		{{ 1614, 1632, 1610 }},
-		{{ 1610, 1590, 1614 }},
-		{{ 1639, 1651, 1632 }},
-		{{ 1632, 1614, 1639 }},
-		{{ 1659, 1673, 1651 }},
-		{{ 1651, 1639, 1659 }},
-		{{ 1685, 1691, 1673 }},
-		{{ 1673, 1659, 1685 }},
-		{{ 1928, 1922, 1691 }},
-		{{ 1691, 1685, 1928 }},
-		{{ 1888, 1887, 1937 }},
-		{{ 1888, 1937, 1961 }},
-		{{ 1888, 1961, 1983 }},
-		{{ 1888, 1983, 2007 }},
-		{{ 1888, 2007, 2031 }},
-		{{ 1888, 2031, 2049 }},
-		{{ 1888, 2049, 2077 }},
-		{{ 1888, 2077, 2097 }},
-		{{ 1888, 2097, 2105 }},
-		{{ 1888, 2105, 2111 }},
-		{{ 1949, 1937, 1887 }},
-		{{ 1887, 1885, 1949 }},
-		{{ 1989, 1961, 1937 }},
-		{{ 1937, 1949, 1989 }},
-		{{ 2037, 1983, 1961 }},
-		{{ 1961, 1989, 2037 }},
-		{{ 2095, 2007, 1983 }},
-		{{ 1983, 2037, 2095 }},
-		{{ 2143, 2031, 2007 }},
-		{{ 2007, 2095, 2143 }},
-		{{ 2201, 2049, 2031 }},
-		{{ 2031, 2143, 2201 }},
-		{{ 2227, 2077, 2049 }},
-		{{ 2049, 2201, 2227 }},
-		{{ 2250, 2097, 2077 }},
-		{{ 2077, 2227, 2250 }},
-		{{ 2258, 2105, 2097 }},
-		{{ 2097, 2250, 2258 }},
-		{{ 2262, 2111, 2105 }},
-		{{ 2105, 2258, 2262 }},
-		{{ 1957, 1949, 1885 }},
-		{{ 1885, 1883, 1957 }},
-		{{ 2001, 1989, 1949 }},
-		{{ 1949, 1957, 2001 }},
-		{{ 2066, 2037, 1989 }},
-		{{ 1989, 2001, 2066 }},
-		{{ 2133, 2095, 2037 }},
-		{{ 2037, 2066, 2133 }},
-		{{ 2205, 2143, 2095 }},
-		{{ 2095, 2133, 2205 }},
-		{{ 2244, 2201, 2143 }},
-		{{ 2143, 2205, 2244 }},
-		{{ 2280, 2227, 2201 }},
-		{{ 2201, 2244, 2280 }},
-		{{ 2301, 2250, 2227 }},
-		{{ 2227, 2280, 2301 }},
-		{{ 2311, 2258, 2250 }},
-		{{ 2250, 2301, 2311 }},
-		{{ 2314, 2262, 2258 }},
-		{{ 2258, 2311, 2314 }},
-		{{ 1959, 1957, 1883 }},
-		{{ 1883, 1880, 1959 }},
-		{{ 2003, 2001, 1957 }},
-		{{ 1957, 1959, 2003 }},
-		{{ 2069, 2066, 2001 }},
-		{{ 2001, 2003, 2069 }},
-		{{ 2135, 2133, 2066 }},
-		{{ 2066, 2069, 2135 }},
-		{{ 2207, 2205, 2133 }},
-		{{ 2133, 2135, 2207 }},
-		{{ 2246, 2244, 2205 }},
-		{{ 2205, 2207, 2246 }},
-		{{ 2282, 2280, 2244 }},
-		{{ 2244, 2246, 2282 }},
-		{{ 2303, 2301, 2280 }},
-		{{ 2280, 2282, 2303 }},
-		{{ 2313, 2311, 2301 }},
-		{{ 2301, 2303, 2313 }},
-		{{ 2317, 2314, 2311 }},
-		{{ 2311, 2313, 2317 }},
-		{{ 1953, 1959, 1880 }},
-		{{ 1880, 1877, 1953 }},
-		{{ 1995, 2003, 1959 }},
-		{{ 1959, 1953, 1995 }},
-		{{ 2043, 2069, 2003 }},
-		{{ 2003, 1995, 2043 }},
-		{{ 2107, 2135, 2069 }},
-		{{ 2069, 2043, 2107 }},
-		{{ 2169, 2207, 2135 }},
-		{{ 2135, 2107, 2169 }},
-		{{ 2215, 2246, 2207 }},
-		{{ 2207, 2169, 2215 }},
-		{{ 2242, 2282, 2246 }},
-		{{ 2246, 2215, 2242 }},
-		{{ 2260, 2303, 2282 }},
-		{{ 2282, 2242, 2260 }},
-		{{ 2286, 2313, 2303 }},
-		{{ 2303, 2260, 2286 }},
-		{{ 2290, 2317, 2313 }},
-		{{ 2313, 2286, 2290 }},
-		{{ 1945, 1953, 1877 }},
-		{{ 1877, 1875, 1945 }},
-		{{ 1979, 1995, 1953 }},
-		{{ 1953, 1945, 1979 }},
-		{{ 2019, 2043, 1995 }},
-		{{ 1995, 1979, 2019 }},
-		{{ 2061, 2107, 2043 }},
-		{{ 2043, 2019, 2061 }},
-		{{ 2109, 2169, 2107 }},
-		{{ 2107, 2061, 2109 }},
-		{{ 2147, 2215, 2169 }},
-		{{ 2169, 2109, 2147 }},
-		{{ 2187, 2242, 2215 }},
-		{{ 2215, 2147, 2187 }},
-		{{ 2211, 2260, 2242 }},
-		{{ 2242, 2187, 2211 }},
-		{{ 2221, 2286, 2260 }},
-		{{ 2260, 2211, 2221 }},
-		{{ 2224, 2290, 2286 }},
-		{{ 2286, 2221, 2224 }},
-		{{ 1943, 1945, 1875 }},
-		{{ 1875, 1873, 1943 }},
-		{{ 1971, 1979, 1945 }},
-		{{ 1945, 1943, 1971 }},
-		{{ 1993, 2019, 1979 }},
-		{{ 1979, 1971, 1993 }},
-		{{ 2025, 2061, 2019 }},
-		{{ 2019, 1993, 2025 }},
-		{{ 2045, 2109, 2061 }},
-		{{ 2061, 2025, 2045 }},
-		{{ 2085, 2147, 2109 }},
-		{{ 2109, 2045, 2085 }},
-		{{ 2113, 2187, 2147 }},
-		{{ 2147, 2085, 2113 }},
-		{{ 2126, 2211, 2187 }},
-		{{ 2187, 2113, 2126 }},
-		{{ 2140, 2221, 2211 }},
-		{{ 2211, 2126, 2140 }},
-		{{ 2144, 2224, 2221 }},
-		{{ 2221, 2140, 2144 }},
-		{{ 1935, 1943, 1873 }},
-		{{ 1873, 1871, 1935 }},
-		{{ 1955, 1971, 1943 }},
-		{{ 1943, 1935, 1955 }},
-		{{ 1975, 1993, 1971 }},
-		{{ 1971, 1955, 1975 }},
-		{{ 1997, 2025, 1993 }},
-		{{ 1993, 1975, 1997 }},
-		{{ 2020, 2045, 2025 }},
-		{{ 2025, 1997, 2020 }},
-		{{ 2038, 2085, 2045 }},
-		{{ 2045, 2020, 2038 }},
-		{{ 2054, 2113, 2085 }},
-		{{ 2085, 2038, 2054 }},
-		{{ 2074, 2126, 2113 }},
-		{{ 2113, 2054, 2074 }},
-		{{ 2078, 2140, 2126 }},
-		{{ 2126, 2074, 2078 }},
-		{{ 2086, 2144, 2140 }},
-		{{ 2140, 2078, 2086 }},
-		{{ 1933, 1935, 1871 }},
-		{{ 1871, 1869, 1933 }},
-		{{ 1951, 1955, 1935 }},
-		{{ 1935, 1933, 1951 }},
-		{{ 1973, 1975, 1955 }},
-		{{ 1955, 1951, 1973 }},
-		{{ 1990, 1997, 1975 }},
-		{{ 1975, 1973, 1990 }},
-		{{ 2012, 2020, 1997 }},
-		{{ 1997, 1990, 2012 }},
-		{{ 2028, 2038, 2020 }},
-		{{ 2020, 2012, 2028 }},
-		{{ 2040, 2054, 2038 }},
-		{{ 2038, 2028, 2040 }},
-		{{ 2050, 2074, 2054 }},
-		{{ 2054, 2040, 2050 }},
-		{{ 2062, 2078, 2074 }},
-		{{ 2074, 2050, 2062 }},
-		{{ 2070, 2086, 2078 }},
-		{{ 2078, 2062, 2070 }},
-		{{ 1939, 1933, 1869 }},
-		{{ 1869, 1866, 1939 }},
-		{{ 1965, 1951, 1933 }},
-		{{ 1933, 1939, 1965 }},
-		{{ 1985, 1973, 1951 }},
-		{{ 1951, 1965, 1985 }},
-		{{ 2008, 1990, 1973 }},
-		{{ 1973, 1985, 2008 }},
-		{{ 2032, 2012, 1990 }},
-		{{ 1990, 2008, 2032 }},
-		{{ 2056, 2028, 2012 }},
-		{{ 2012, 2032, 2056 }},
-		{{ 2080, 2040, 2028 }},
-		{{ 2028, 2056, 2080 }},
-		{{ 2100, 2050, 2040 }},
-		{{ 2040, 2080, 2100 }},
-		{{ 2114, 2062, 2050 }},
-		{{ 2050, 2100, 2114 }},
-		{{ 2122, 2070, 2062 }},
-		{{ 2062, 2114, 2122 }},
-		{{ 2232, 2116, 2124 }},
-		{{ 2124, 2236, 2232 }},
-		{{ 2218, 2102, 2116 }},
-		{{ 2116, 2232, 2218 }},
-		{{ 2199, 2082, 2102 }},
-		{{ 2102, 2218, 2199 }},
-		{{ 2150, 2058, 2082 }},
-		{{ 2082, 2199, 2150 }},
-		{{ 2120, 2034, 2058 }},
-		{{ 2058, 2150, 2120 }},
-		{{ 2064, 2010, 2034 }},
-		{{ 2034, 2120, 2064 }},
-		{{ 2023, 1986, 2010 }},
-		{{ 2010, 2064, 2023 }},
-		{{ 1980, 1966, 1986 }},
-		{{ 1986, 2023, 1980 }},
-		{{ 1946, 1940, 1966 }},
-		{{ 1966, 1980, 1946 }},
-		{{ 1862, 1730, 1940 }},
-		{{ 1940, 1946, 1862 }},
-		{{ 2332, 2232, 2236 }},
-		{{ 2236, 2336, 2332 }},
-		{{ 2322, 2218, 2232 }},
-		{{ 2232, 2332, 2322 }},
-		{{ 2306, 2199, 2218 }},
-		{{ 2218, 2322, 2306 }},
-		{{ 2275, 2150, 2199 }},
-		{{ 2199, 2306, 2275 }},
-		{{ 2234, 2120, 2150 }},
-		{{ 2150, 2275, 2234 }},
-		{{ 2170, 2064, 2120 }},
-		{{ 2120, 2234, 2170 }},
-		{{ 2093, 2023, 2064 }},
-		{{ 2064, 2170, 2093 }},
-		{{ 2016, 1980, 2023 }},
-		{{ 2023, 2093, 2016 }},
-		{{ 1968, 1946, 1980 }},
-		{{ 1980, 2016, 1968 }},
-		{{ 1858, 1862, 1946 }},
-		{{ 1946, 1968, 1858 }},
-		{{ 2409, 2332, 2336 }},
-		{{ 2336, 2413, 2409 }},
-		{{ 2400, 2322, 2332 }},
-		{{ 2332, 2409, 2400 }},
-		{{ 2376, 2306, 2322 }},
-		{{ 2322, 2400, 2376 }},
-		{{ 2349, 2275, 2306 }},
-		{{ 2306, 2376, 2349 }},
-		{{ 2324, 2234, 2275 }},
-		{{ 2275, 2349, 2324 }},
-		{{ 2271, 2170, 2234 }},
-		{{ 2234, 2324, 2271 }},
-		{{ 2185, 2093, 2170 }},
-		{{ 2170, 2271, 2185 }},
-		{{ 2072, 2016, 2093 }},
-		{{ 2093, 2185, 2072 }},
-		{{ 1976, 1968, 2016 }},
-		{{ 2016, 2072, 1976 }},
-		{{ 1729, 1858, 1968 }},
-		{{ 1968, 1976, 1729 }},
-		{{ 2488, 2409, 2413 }},
-		{{ 2413, 2498, 2488 }},
-		{{ 2470, 2400, 2409 }},
-		{{ 2409, 2488, 2470 }},
-		{{ 2444, 2376, 2400 }},
-		{{ 2400, 2470, 2444 }},
-		{{ 2418, 2349, 2376 }},
-		{{ 2376, 2444, 2418 }},
-		{{ 2384, 2324, 2349 }},
-		{{ 2349, 2418, 2384 }},
-		{{ 2338, 2271, 2324 }},
-		{{ 2324, 2384, 2338 }},
-		{{ 2269, 2185, 2271 }},
-		{{ 2271, 2338, 2269 }},
-		{{ 2138, 2072, 2185 }},
-		{{ 2185, 2269, 2138 }},
-		{{ 1998, 1976, 2072 }},
-		{{ 2072, 2138, 1998 }},
-		{{ 1722, 1729, 1976 }},
-		{{ 1976, 1998, 1722 }},
-		{{ 2559, 2488, 2498 }},
-		{{ 2498, 2569, 2559 }},
-		{{ 2549, 2470, 2488 }},
-		{{ 2488, 2559, 2549 }},
-		{{ 2531, 2444, 2470 }},
-		{{ 2470, 2549, 2531 }},
-		{{ 2492, 2418, 2444 }},
-		{{ 2444, 2531, 2492 }},
-		{{ 2436, 2384, 2418 }},
-		{{ 2418, 2492, 2436 }},
-		{{ 2394, 2338, 2384 }},
-		{{ 2384, 2436, 2394 }},
-		{{ 2326, 2269, 2338 }},
-		{{ 2338, 2394, 2326 }},
-		{{ 2212, 2138, 2269 }},
-		{{ 2269, 2326, 2212 }},
-		{{ 2026, 1998, 2138 }},
-		{{ 2138, 2212, 2026 }},
-		{{ 1850, 1722, 1998 }},
-		{{ 1998, 2026, 1850 }},
-		{{ 2653, 2559, 2569 }},
-		{{ 2569, 2655, 2653 }},
-		{{ 2631, 2549, 2559 }},
-		{{ 2559, 2653, 2631 }},
-		{{ 2593, 2531, 2549 }},
-		{{ 2549, 2631, 2593 }},
-		{{ 2551, 2492, 2531 }},
-		{{ 2531, 2593, 2551 }},
-		{{ 2510, 2436, 2492 }},
-		{{ 2492, 2551, 2510 }},
-		{{ 2432, 2394, 2436 }},
-		{{ 2436, 2510, 2432 }},
-		{{ 2366, 2326, 2394 }},
-		{{ 2394, 2432, 2366 }},
-		{{ 2263, 2212, 2326 }},
-		{{ 2326, 2366, 2263 }},
-		{{ 2052, 2026, 2212 }},
-		{{ 2212, 2263, 2052 }},
-		{{ 1726, 1850, 2026 }},
-		{{ 2026, 2052, 1726 }},
-		{{ 2720, 2653, 2655 }},
-		{{ 2655, 2726, 2720 }},
-		{{ 2697, 2631, 2653 }},
-		{{ 2653, 2720, 2697 }},
-		{{ 2662, 2593, 2631 }},
-		{{ 2631, 2697, 2662 }},
-		{{ 2607, 2551, 2593 }},
-		{{ 2593, 2662, 2607 }},
-		{{ 2547, 2510, 2551 }},
-		{{ 2551, 2607, 2547 }},
-		{{ 2484, 2432, 2510 }},
-		{{ 2510, 2547, 2484 }},
-		{{ 2405, 2366, 2432 }},
-		{{ 2432, 2484, 2405 }},
-		{{ 2308, 2263, 2366 }},
-		{{ 2366, 2405, 2308 }},
-		{{ 2090, 2052, 2263 }},
-		{{ 2263, 2308, 2090 }},
-		{{ 1719, 1726, 2052 }},
-		{{ 2052, 2090, 1719 }},
-		{{ 2787, 2720, 2726 }},
-		{{ 2726, 2795, 2787 }},
-		{{ 2759, 2697, 2720 }},
-		{{ 2720, 2787, 2759 }},
-		{{ 2713, 2662, 2697 }},
-		{{ 2697, 2759, 2713 }},
-		{{ 2657, 2607, 2662 }},
-		{{ 2662, 2713, 2657 }},
-		{{ 2589, 2547, 2607 }},
-		{{ 2607, 2657, 2589 }},
-		{{ 2525, 2484, 2547 }},
-		{{ 2547, 2589, 2525 }},
-		{{ 2422, 2405, 2484 }},
-		{{ 2484, 2525, 2422 }},
-		{{ 2330, 2308, 2405 }},
-		{{ 2405, 2422, 2330 }},
-		{{ 2118, 2090, 2308 }},
-		{{ 2308, 2330, 2118 }},
-		{{ 1700, 1719, 2090 }},
-		{{ 2090, 2118, 1700 }},
-		{{ 2834, 2787, 2795 }},
-		{{ 2795, 2844, 2834 }},
-		{{ 2798, 2759, 2787 }},
-		{{ 2787, 2834, 2798 }},
-		{{ 2750, 2713, 2759 }},
-		{{ 2759, 2798, 2750 }},
-		{{ 2690, 2657, 2713 }},
-		{{ 2713, 2750, 2690 }},
-		{{ 2624, 2589, 2657 }},
-		{{ 2657, 2690, 2624 }},
-		{{ 2536, 2525, 2589 }},
-		{{ 2589, 2624, 2536 }},
-		{{ 2441, 2422, 2525 }},
-		{{ 2525, 2536, 2441 }},
-		{{ 2340, 2330, 2422 }},
-		{{ 2422, 2441, 2340 }},
-		{{ 2128, 2118, 2330 }},
-		{{ 2330, 2340, 2128 }},
-		{{ 1825, 1700, 2118 }},
-		{{ 2118, 2128, 1825 }},
-		{{ 2847, 2834, 2844 }},
-		{{ 2844, 2857, 2847 }},
-		{{ 2821, 2798, 2834 }},
-		{{ 2834, 2847, 2821 }},
-		{{ 2765, 2750, 2798 }},
-		{{ 2798, 2821, 2765 }},
-		{{ 2703, 2690, 2750 }},
-		{{ 2750, 2765, 2703 }},
-		{{ 2637, 2624, 2690 }},
-		{{ 2690, 2703, 2637 }},
-		{{ 2543, 2536, 2624 }},
-		{{ 2624, 2637, 2543 }},
-		{{ 2446, 2441, 2536 }},
-		{{ 2536, 2543, 2446 }},
-		{{ 2344, 2340, 2441 }},
-		{{ 2441, 2446, 2344 }},
-		{{ 2136, 2128, 2340 }},
-		{{ 2340, 2344, 2136 }},
-		{{ 1713, 1825, 2128 }},
-		{{ 2128, 2136, 1713 }},
-		{{ 1676, 1682, 1864 }},
-		{{ 1864, 1862, 1676 }},
-		{{ 1642, 1656, 1682 }},
-		{{ 1682, 1676, 1642 }},
-		{{ 1601, 1636, 1656 }},
-		{{ 1656, 1642, 1601 }},
-		{{ 1558, 1612, 1636 }},
-		{{ 1636, 1601, 1558 }},
-		{{ 1502, 1588, 1612 }},
-		{{ 1612, 1558, 1502 }},
-		{{ 1472, 1564, 1588 }},
-		{{ 1588, 1502, 1472 }},
-		{{ 1425, 1540, 1564 }},
-		{{ 1564, 1472, 1425 }},
-		{{ 1404, 1520, 1540 }},
-		{{ 1540, 1425, 1404 }},
-		{{ 1390, 1506, 1520 }},
-		{{ 1520, 1404, 1390 }},
-		{{ 1387, 1498, 1506 }},
-		{{ 1506, 1390, 1387 }},
-		{{ 1654, 1676, 1862 }},
-		{{ 1862, 1859, 1654 }},
-		{{ 1606, 1642, 1676 }},
-		{{ 1676, 1654, 1606 }},
-		{{ 1531, 1601, 1642 }},
-		{{ 1642, 1606, 1531 }},
-		{{ 1452, 1558, 1601 }},
-		{{ 1601, 1531, 1452 }},
-		{{ 1388, 1502, 1558 }},
-		{{ 1558, 1452, 1388 }},
-		{{ 1347, 1472, 1502 }},
-		{{ 1502, 1388, 1347 }},
-		{{ 1316, 1425, 1472 }},
-		{{ 1472, 1347, 1316 }},
-		{{ 1300, 1404, 1425 }},
-		{{ 1425, 1316, 1300 }},
-		{{ 1290, 1390, 1404 }},
-		{{ 1404, 1300, 1290 }},
-		{{ 1286, 1387, 1390 }},
-		{{ 1390, 1290, 1286 }},
-		{{ 1646, 1654, 1859 }},
-		{{ 1859, 1856, 1646 }},
-		{{ 1550, 1606, 1654 }},
-		{{ 1654, 1646, 1550 }},
-		{{ 1439, 1531, 1606 }},
-		{{ 1606, 1550, 1439 }},
-		{{ 1351, 1452, 1531 }},
-		{{ 1531, 1439, 1351 }},
-		{{ 1298, 1388, 1452 }},
-		{{ 1452, 1351, 1298 }},
-		{{ 1275, 1347, 1388 }},
-		{{ 1388, 1298, 1275 }},
-		{{ 1246, 1316, 1347 }},
-		{{ 1347, 1275, 1246 }},
-		{{ 1222, 1300, 1316 }},
-		{{ 1316, 1246, 1222 }},
-		{{ 1215, 1290, 1300 }},
-		{{ 1300, 1222, 1215 }},
-		{{ 1211, 1286, 1290 }},
-		{{ 1290, 1215, 1211 }},
-		{{ 1624, 1646, 1856 }},
-		{{ 1856, 1854, 1624 }},
-		{{ 1484, 1550, 1646 }},
-		{{ 1646, 1624, 1484 }},
-		{{ 1353, 1439, 1550 }},
-		{{ 1550, 1484, 1353 }},
-		{{ 1284, 1351, 1439 }},
-		{{ 1439, 1353, 1284 }},
-		{{ 1238, 1298, 1351 }},
-		{{ 1351, 1284, 1238 }},
-		{{ 1204, 1275, 1298 }},
-		{{ 1298, 1238, 1204 }},
-		{{ 1178, 1246, 1275 }},
-		{{ 1275, 1204, 1178 }},
-		{{ 1152, 1222, 1246 }},
-		{{ 1246, 1178, 1152 }},
-		{{ 1134, 1215, 1222 }},
-		{{ 1222, 1152, 1134 }},
-		{{ 1124, 1211, 1215 }},
-		{{ 1215, 1134, 1124 }},
-		{{ 1596, 1624, 1854 }},
-		{{ 1854, 1851, 1596 }},
-		{{ 1410, 1484, 1624 }},
-		{{ 1624, 1596, 1410 }},
-		{{ 1296, 1353, 1484 }},
-		{{ 1484, 1410, 1296 }},
-		{{ 1228, 1284, 1353 }},
-		{{ 1353, 1296, 1228 }},
-		{{ 1186, 1238, 1284 }},
-		{{ 1284, 1228, 1186 }},
-		{{ 1130, 1204, 1238 }},
-		{{ 1238, 1186, 1130 }},
-		{{ 1091, 1178, 1204 }},
-		{{ 1204, 1130, 1091 }},
-		{{ 1073, 1152, 1178 }},
-		{{ 1178, 1091, 1073 }},
-		{{ 1063, 1134, 1152 }},
-		{{ 1152, 1073, 1063 }},
-		{{ 1053, 1124, 1134 }},
-		{{ 1134, 1063, 1053 }},
-		{{ 1570, 1596, 1851 }},
-		{{ 1851, 1848, 1570 }},
-		{{ 1359, 1410, 1596 }},
-		{{ 1596, 1570, 1359 }},
-		{{ 1256, 1296, 1410 }},
-		{{ 1410, 1359, 1256 }},
-		{{ 1190, 1228, 1296 }},
-		{{ 1296, 1256, 1190 }},
-		{{ 1112, 1186, 1228 }},
-		{{ 1228, 1190, 1112 }},
-		{{ 1071, 1130, 1186 }},
-		{{ 1186, 1112, 1071 }},
-		{{ 1029, 1091, 1130 }},
-		{{ 1130, 1071, 1029 }},
-		{{ 991, 1073, 1091 }},
-		{{ 1091, 1029, 991 }},
-		{{ 969, 1063, 1073 }},
-		{{ 1073, 991, 969 }},
-		{{ 967, 1053, 1063 }},
-		{{ 1063, 969, 967 }},
-		{{ 1532, 1570, 1848 }},
-		{{ 1848, 1846, 1532 }},
-		{{ 1314, 1359, 1570 }},
-		{{ 1570, 1532, 1314 }},
-		{{ 1219, 1256, 1359 }},
-		{{ 1359, 1314, 1219 }},
-		{{ 1138, 1190, 1256 }},
-		{{ 1256, 1219, 1138 }},
-		{{ 1075, 1112, 1190 }},
-		{{ 1190, 1138, 1075 }},
-		{{ 1015, 1071, 1112 }},
-		{{ 1112, 1075, 1015 }},
-		{{ 962, 1029, 1071 }},
-		{{ 1071, 1015, 962 }},
-		{{ 925, 991, 1029 }},
-		{{ 1029, 962, 925 }},
-		{{ 904, 969, 991 }},
-		{{ 991, 925, 904 }},
-		{{ 898, 967, 969 }},
-		{{ 969, 904, 898 }},
-		{{ 1504, 1532, 1846 }},
-		{{ 1846, 1832, 1504 }},
-		{{ 1292, 1314, 1532 }},
-		{{ 1532, 1504, 1292 }},
-		{{ 1200, 1219, 1314 }},
-		{{ 1314, 1292, 1200 }},
-		{{ 1097, 1138, 1219 }},
-		{{ 1219, 1200, 1097 }},
-		{{ 1033, 1075, 1138 }},
-		{{ 1138, 1097, 1033 }},
-		{{ 965, 1015, 1075 }},
-		{{ 1075, 1033, 965 }},
-		{{ 909, 962, 1015 }},
-		{{ 1015, 965, 909 }},
-		{{ 863, 925, 962 }},
-		{{ 962, 909, 863 }},
-		{{ 835, 904, 925 }},
-		{{ 925, 863, 835 }},
-		{{ 827, 898, 904 }},
-		{{ 904, 835, 827 }},
-		{{ 1494, 1504, 1832 }},
-		{{ 1832, 1824, 1494 }},
-		{{ 1282, 1292, 1504 }},
-		{{ 1504, 1494, 1282 }},
-		{{ 1183, 1200, 1292 }},
-		{{ 1292, 1282, 1183 }},
-		{{ 1088, 1097, 1200 }},
-		{{ 1200, 1183, 1088 }},
-		{{ 1000, 1033, 1097 }},
-		{{ 1097, 1088, 1000 }},
-		{{ 934, 965, 1033 }},
-		{{ 1033, 1000, 934 }},
-		{{ 874, 909, 965 }},
-		{{ 965, 934, 874 }},
-		{{ 826, 863, 909 }},
-		{{ 909, 874, 826 }},
-		{{ 790, 835, 863 }},
-		{{ 863, 826, 790 }},
-		{{ 780, 827, 835 }},
-		{{ 835, 790, 780 }},
-		{{ 1486, 1494, 1824 }},
-		{{ 1824, 1814, 1486 }},
-		{{ 1278, 1282, 1494 }},
-		{{ 1494, 1486, 1278 }},
-		{{ 1176, 1183, 1282 }},
-		{{ 1282, 1278, 1176 }},
-		{{ 1079, 1088, 1183 }},
-		{{ 1183, 1176, 1079 }},
-		{{ 985, 1000, 1088 }},
-		{{ 1088, 1079, 985 }},
-		{{ 919, 934, 1000 }},
-		{{ 1000, 985, 919 }},
-		{{ 857, 874, 934 }},
-		{{ 934, 919, 857 }},
-		{{ 801, 826, 874 }},
-		{{ 874, 857, 801 }},
-		{{ 775, 790, 826 }},
-		{{ 826, 801, 775 }},
-		{{ 765, 780, 790 }},
-		{{ 790, 775, 765 }},
-		{{ 1391, 1507, 1499 }},
-		{{ 1499, 1387, 1391 }},
-		{{ 1405, 1521, 1507 }},
-		{{ 1507, 1391, 1405 }},
-		{{ 1424, 1541, 1521 }},
-		{{ 1521, 1405, 1424 }},
-		{{ 1473, 1565, 1541 }},
-		{{ 1541, 1424, 1473 }},
-		{{ 1503, 1589, 1565 }},
-		{{ 1565, 1473, 1503 }},
-		{{ 1559, 1613, 1589 }},
-		{{ 1589, 1503, 1559 }},
-		{{ 1600, 1637, 1613 }},
-		{{ 1613, 1559, 1600 }},
-		{{ 1643, 1657, 1637 }},
-		{{ 1637, 1600, 1643 }},
-		{{ 1677, 1683, 1657 }},
-		{{ 1657, 1643, 1677 }},
-		{{ 1863, 1892, 1683 }},
-		{{ 1683, 1677, 1863 }},
-		{{ 1291, 1391, 1387 }},
-		{{ 1387, 1287, 1291 }},
-		{{ 1301, 1405, 1391 }},
-		{{ 1391, 1291, 1301 }},
-		{{ 1317, 1424, 1405 }},
-		{{ 1405, 1301, 1317 }},
-		{{ 1348, 1473, 1424 }},
-		{{ 1424, 1317, 1348 }},
-		{{ 1389, 1503, 1473 }},
-		{{ 1473, 1348, 1389 }},
-		{{ 1453, 1559, 1503 }},
-		{{ 1503, 1389, 1453 }},
-		{{ 1530, 1600, 1559 }},
-		{{ 1559, 1453, 1530 }},
-		{{ 1607, 1643, 1600 }},
-		{{ 1600, 1530, 1607 }},
-		{{ 1655, 1677, 1643 }},
-		{{ 1643, 1607, 1655 }},
-		{{ 1861, 1863, 1677 }},
-		{{ 1677, 1655, 1861 }},
-		{{ 1214, 1291, 1287 }},
-		{{ 1287, 1210, 1214 }},
-		{{ 1223, 1301, 1291 }},
-		{{ 1291, 1214, 1223 }},
-		{{ 1247, 1317, 1301 }},
-		{{ 1301, 1223, 1247 }},
-		{{ 1274, 1348, 1317 }},
-		{{ 1317, 1247, 1274 }},
-		{{ 1299, 1389, 1348 }},
-		{{ 1348, 1274, 1299 }},
-		{{ 1352, 1453, 1389 }},
-		{{ 1389, 1299, 1352 }},
-		{{ 1438, 1530, 1453 }},
-		{{ 1453, 1352, 1438 }},
-		{{ 1551, 1607, 1530 }},
-		{{ 1530, 1438, 1551 }},
-		{{ 1647, 1655, 1607 }},
-		{{ 1607, 1551, 1647 }},
-		{{ 1891, 1861, 1655 }},
-		{{ 1655, 1647, 1891 }},
-		{{ 1135, 1214, 1210 }},
-		{{ 1210, 1125, 1135 }},
-		{{ 1153, 1223, 1214 }},
-		{{ 1214, 1135, 1153 }},
-		{{ 1179, 1247, 1223 }},
-		{{ 1223, 1153, 1179 }},
-		{{ 1205, 1274, 1247 }},
-		{{ 1247, 1179, 1205 }},
-		{{ 1239, 1299, 1274 }},
-		{{ 1274, 1205, 1239 }},
-		{{ 1285, 1352, 1299 }},
-		{{ 1299, 1239, 1285 }},
-		{{ 1354, 1438, 1352 }},
-		{{ 1352, 1285, 1354 }},
-		{{ 1485, 1551, 1438 }},
-		{{ 1438, 1354, 1485 }},
-		{{ 1625, 1647, 1551 }},
-		{{ 1551, 1485, 1625 }},
-		{{ 1901, 1891, 1647 }},
-		{{ 1647, 1625, 1901 }},
-		{{ 1064, 1135, 1125 }},
-		{{ 1125, 1054, 1064 }},
-		{{ 1074, 1153, 1135 }},
-		{{ 1135, 1064, 1074 }},
-		{{ 1092, 1179, 1153 }},
-		{{ 1153, 1074, 1092 }},
-		{{ 1131, 1205, 1179 }},
-		{{ 1179, 1092, 1131 }},
-		{{ 1187, 1239, 1205 }},
-		{{ 1205, 1131, 1187 }},
-		{{ 1229, 1285, 1239 }},
-		{{ 1239, 1187, 1229 }},
-		{{ 1297, 1354, 1285 }},
-		{{ 1285, 1229, 1297 }},
-		{{ 1411, 1485, 1354 }},
-		{{ 1354, 1297, 1411 }},
-		{{ 1597, 1625, 1485 }},
-		{{ 1485, 1411, 1597 }},
-		{{ 1853, 1901, 1625 }},
-		{{ 1625, 1597, 1853 }},
-		{{ 970, 1064, 1054 }},
-		{{ 1054, 968, 970 }},
-		{{ 992, 1074, 1064 }},
-		{{ 1064, 970, 992 }},
-		{{ 1030, 1092, 1074 }},
-		{{ 1074, 992, 1030 }},
-		{{ 1072, 1131, 1092 }},
-		{{ 1092, 1030, 1072 }},
-		{{ 1113, 1187, 1131 }},
-		{{ 1131, 1072, 1113 }},
-		{{ 1191, 1229, 1187 }},
-		{{ 1187, 1113, 1191 }},
-		{{ 1257, 1297, 1229 }},
-		{{ 1229, 1191, 1257 }},
-		{{ 1360, 1411, 1297 }},
-		{{ 1297, 1257, 1360 }},
-		{{ 1571, 1597, 1411 }},
-		{{ 1411, 1360, 1571 }},
-		{{ 1899, 1853, 1597 }},
-		{{ 1597, 1571, 1899 }},
-		{{ 903, 970, 968 }},
-		{{ 968, 897, 903 }},
-		{{ 926, 992, 970 }},
-		{{ 970, 903, 926 }},
-		{{ 961, 1030, 992 }},
-		{{ 992, 926, 961 }},
-		{{ 1016, 1072, 1030 }},
-		{{ 1030, 961, 1016 }},
-		{{ 1076, 1113, 1072 }},
-		{{ 1072, 1016, 1076 }},
-		{{ 1139, 1191, 1113 }},
-		{{ 1113, 1076, 1139 }},
-		{{ 1218, 1257, 1191 }},
-		{{ 1191, 1139, 1218 }},
-		{{ 1315, 1360, 1257 }},
-		{{ 1257, 1218, 1315 }},
-		{{ 1533, 1571, 1360 }},
-		{{ 1360, 1315, 1533 }},
-		{{ 1920, 1899, 1571 }},
-		{{ 1571, 1533, 1920 }},
-		{{ 836, 903, 897 }},
-		{{ 897, 828, 836 }},
-		{{ 864, 926, 903 }},
-		{{ 903, 836, 864 }},
-		{{ 910, 961, 926 }},
-		{{ 926, 864, 910 }},
-		{{ 966, 1016, 961 }},
-		{{ 961, 910, 966 }},
-		{{ 1034, 1076, 1016 }},
-		{{ 1016, 966, 1034 }},
-		{{ 1098, 1139, 1076 }},
-		{{ 1076, 1034, 1098 }},
-		{{ 1201, 1218, 1139 }},
-		{{ 1139, 1098, 1201 }},
-		{{ 1293, 1315, 1218 }},
-		{{ 1218, 1201, 1293 }},
-		{{ 1505, 1533, 1315 }},
-		{{ 1315, 1293, 1505 }},
-		{{ 1924, 1920, 1533 }},
-		{{ 1533, 1505, 1924 }},
-		{{ 789, 836, 828 }},
-		{{ 828, 779, 789 }},
-		{{ 825, 864, 836 }},
-		{{ 836, 789, 825 }},
-		{{ 873, 910, 864 }},
-		{{ 864, 825, 873 }},
-		{{ 933, 966, 910 }},
-		{{ 910, 873, 933 }},
-		{{ 999, 1034, 966 }},
-		{{ 966, 933, 999 }},
-		{{ 1087, 1098, 1034 }},
-		{{ 1034, 999, 1087 }},
-		{{ 1182, 1201, 1098 }},
-		{{ 1098, 1087, 1182 }},
-		{{ 1283, 1293, 1201 }},
-		{{ 1201, 1182, 1283 }},
-		{{ 1495, 1505, 1293 }},
-		{{ 1293, 1283, 1495 }},
-		{{ 1826, 1924, 1505 }},
-		{{ 1505, 1495, 1826 }},
-		{{ 776, 789, 779 }},
-		{{ 779, 766, 776 }},
-		{{ 802, 825, 789 }},
-		{{ 789, 776, 802 }},
-		{{ 858, 873, 825 }},
-		{{ 825, 802, 858 }},
-		{{ 920, 933, 873 }},
-		{{ 873, 858, 920 }},
-		{{ 986, 999, 933 }},
-		{{ 933, 920, 986 }},
-		{{ 1080, 1087, 999 }},
-		{{ 999, 986, 1080 }},
-		{{ 1177, 1182, 1087 }},
-		{{ 1087, 1080, 1177 }},
-		{{ 1279, 1283, 1182 }},
-		{{ 1182, 1177, 1279 }},
-		{{ 1487, 1495, 1283 }},
-		{{ 1283, 1279, 1487 }},
-		{{ 1914, 1826, 1495 }},
-		{{ 1495, 1487, 1914 }},
-		{{ 1947, 1941, 1867 }},
-		{{ 1867, 1863, 1947 }},
-		{{ 1981, 1967, 1941 }},
-		{{ 1941, 1947, 1981 }},
-		{{ 2022, 1987, 1967 }},
-		{{ 1967, 1981, 2022 }},
-		{{ 2065, 2011, 1987 }},
-		{{ 1987, 2022, 2065 }},
-		{{ 2121, 2035, 2011 }},
-		{{ 2011, 2065, 2121 }},
-		{{ 2151, 2059, 2035 }},
-		{{ 2035, 2121, 2151 }},
-		{{ 2198, 2083, 2059 }},
-		{{ 2059, 2151, 2198 }},
-		{{ 2219, 2103, 2083 }},
-		{{ 2083, 2198, 2219 }},
-		{{ 2233, 2117, 2103 }},
-		{{ 2103, 2219, 2233 }},
-		{{ 2236, 2125, 2117 }},
-		{{ 2117, 2233, 2236 }},
-		{{ 1969, 1947, 1863 }},
-		{{ 1863, 1860, 1969 }},
-		{{ 2017, 1981, 1947 }},
-		{{ 1947, 1969, 2017 }},
-		{{ 2092, 2022, 1981 }},
-		{{ 1981, 2017, 2092 }},
-		{{ 2171, 2065, 2022 }},
-		{{ 2022, 2092, 2171 }},
-		{{ 2235, 2121, 2065 }},
-		{{ 2065, 2171, 2235 }},
-		{{ 2276, 2151, 2121 }},
-		{{ 2121, 2235, 2276 }},
-		{{ 2307, 2198, 2151 }},
-		{{ 2151, 2276, 2307 }},
-		{{ 2323, 2219, 2198 }},
-		{{ 2198, 2307, 2323 }},
-		{{ 2333, 2233, 2219 }},
-		{{ 2219, 2323, 2333 }},
-		{{ 2337, 2236, 2233 }},
-		{{ 2233, 2333, 2337 }},
-		{{ 1977, 1969, 1860 }},
-		{{ 1860, 1857, 1977 }},
-		{{ 2073, 2017, 1969 }},
-		{{ 1969, 1977, 2073 }},
-		{{ 2184, 2092, 2017 }},
-		{{ 2017, 2073, 2184 }},
-		{{ 2272, 2171, 2092 }},
-		{{ 2092, 2184, 2272 }},
-		{{ 2325, 2235, 2171 }},
-		{{ 2171, 2272, 2325 }},
-		{{ 2348, 2276, 2235 }},
-		{{ 2235, 2325, 2348 }},
-		{{ 2377, 2307, 2276 }},
-		{{ 2276, 2348, 2377 }},
-		{{ 2401, 2323, 2307 }},
-		{{ 2307, 2377, 2401 }},
-		{{ 2408, 2333, 2323 }},
-		{{ 2323, 2401, 2408 }},
-		{{ 2412, 2337, 2333 }},
-		{{ 2333, 2408, 2412 }},
-		{{ 1999, 1977, 1857 }},
-		{{ 1857, 1855, 1999 }},
-		{{ 2139, 2073, 1977 }},
-		{{ 1977, 1999, 2139 }},
-		{{ 2270, 2184, 2073 }},
-		{{ 2073, 2139, 2270 }},
-		{{ 2339, 2272, 2184 }},
-		{{ 2184, 2270, 2339 }},
-		{{ 2385, 2325, 2272 }},
-		{{ 2272, 2339, 2385 }},
-		{{ 2419, 2348, 2325 }},
-		{{ 2325, 2385, 2419 }},
-		{{ 2445, 2377, 2348 }},
-		{{ 2348, 2419, 2445 }},
-		{{ 2471, 2401, 2377 }},
-		{{ 2377, 2445, 2471 }},
-		{{ 2489, 2408, 2401 }},
-		{{ 2401, 2471, 2489 }},
-		{{ 2499, 2412, 2408 }},
-		{{ 2408, 2489, 2499 }},
-		{{ 2027, 1999, 1855 }},
-		{{ 1855, 1852, 2027 }},
-		{{ 2213, 2139, 1999 }},
-		{{ 1999, 2027, 2213 }},
-		{{ 2327, 2270, 2139 }},
-		{{ 2139, 2213, 2327 }},
-		{{ 2395, 2339, 2270 }},
-		{{ 2270, 2327, 2395 }},
-		{{ 2437, 2385, 2339 }},
-		{{ 2339, 2395, 2437 }},
-		{{ 2493, 2419, 2385 }},
-		{{ 2385, 2437, 2493 }},
-		{{ 2532, 2445, 2419 }},
-		{{ 2419, 2493, 2532 }},
-		{{ 2550, 2471, 2445 }},
-		{{ 2445, 2532, 2550 }},
-		{{ 2560, 2489, 2471 }},
-		{{ 2471, 2550, 2560 }},
-		{{ 2570, 2499, 2489 }},
-		{{ 2489, 2560, 2570 }},
-		{{ 2053, 2027, 1852 }},
-		{{ 1852, 1849, 2053 }},
-		{{ 2264, 2213, 2027 }},
-		{{ 2027, 2053, 2264 }},
-		{{ 2367, 2327, 2213 }},
-		{{ 2213, 2264, 2367 }},
-		{{ 2433, 2395, 2327 }},
-		{{ 2327, 2367, 2433 }},
-		{{ 2511, 2437, 2395 }},
-		{{ 2395, 2433, 2511 }},
-		{{ 2552, 2493, 2437 }},
-		{{ 2437, 2511, 2552 }},
-		{{ 2594, 2532, 2493 }},
-		{{ 2493, 2552, 2594 }},
-		{{ 2632, 2550, 2532 }},
-		{{ 2532, 2594, 2632 }},
-		{{ 2654, 2560, 2550 }},
-		{{ 2550, 2632, 2654 }},
-		{{ 2656, 2570, 2560 }},
-		{{ 2560, 2654, 2656 }},
-		{{ 2091, 2053, 1849 }},
-		{{ 1849, 1847, 2091 }},
-		{{ 2309, 2264, 2053 }},
-		{{ 2053, 2091, 2309 }},
-		{{ 2404, 2367, 2264 }},
-		{{ 2264, 2309, 2404 }},
-		{{ 2485, 2433, 2367 }},
-		{{ 2367, 2404, 2485 }},
-		{{ 2548, 2511, 2433 }},
-		{{ 2433, 2485, 2548 }},
-		{{ 2608, 2552, 2511 }},
-		{{ 2511, 2548, 2608 }},
-		{{ 2661, 2594, 2552 }},
-		{{ 2552, 2608, 2661 }},
-		{{ 2698, 2632, 2594 }},
-		{{ 2594, 2661, 2698 }},
-		{{ 2719, 2654, 2632 }},
-		{{ 2632, 2698, 2719 }},
-		{{ 2725, 2656, 2654 }},
-		{{ 2654, 2719, 2725 }},
-		{{ 2119, 2091, 1847 }},
-		{{ 1847, 1833, 2119 }},
-		{{ 2331, 2309, 2091 }},
-		{{ 2091, 2119, 2331 }},
-		{{ 2423, 2404, 2309 }},
-		{{ 2309, 2331, 2423 }},
-		{{ 2526, 2485, 2404 }},
-		{{ 2404, 2423, 2526 }},
-		{{ 2590, 2548, 2485 }},
-		{{ 2485, 2526, 2590 }},
-		{{ 2658, 2608, 2548 }},
-		{{ 2548, 2590, 2658 }},
-		{{ 2714, 2661, 2608 }},
-		{{ 2608, 2658, 2714 }},
-		{{ 2760, 2698, 2661 }},
-		{{ 2661, 2714, 2760 }},
-		{{ 2788, 2719, 2698 }},
-		{{ 2698, 2760, 2788 }},
-		{{ 2796, 2725, 2719 }},
-		{{ 2719, 2788, 2796 }},
-		{{ 2129, 2119, 1833 }},
-		{{ 1833, 1827, 2129 }},
-		{{ 2341, 2331, 2119 }},
-		{{ 2119, 2129, 2341 }},
-		{{ 2440, 2423, 2331 }},
-		{{ 2331, 2341, 2440 }},
-		{{ 2535, 2526, 2423 }},
-		{{ 2423, 2440, 2535 }},
-		{{ 2623, 2590, 2526 }},
-		{{ 2526, 2535, 2623 }},
-		{{ 2689, 2658, 2590 }},
-		{{ 2590, 2623, 2689 }},
-		{{ 2749, 2714, 2658 }},
-		{{ 2658, 2689, 2749 }},
-		{{ 2797, 2760, 2714 }},
-		{{ 2714, 2749, 2797 }},
-		{{ 2833, 2788, 2760 }},
-		{{ 2760, 2797, 2833 }},
-		{{ 2843, 2796, 2788 }},
-		{{ 2788, 2833, 2843 }},
-		{{ 2137, 2129, 1827 }},
-		{{ 1827, 1815, 2137 }},
-		{{ 2345, 2341, 2129 }},
-		{{ 2129, 2137, 2345 }},
-		{{ 2447, 2440, 2341 }},
-		{{ 2341, 2345, 2447 }},
-		{{ 2544, 2535, 2440 }},
-		{{ 2440, 2447, 2544 }},
-		{{ 2638, 2623, 2535 }},
-		{{ 2535, 2544, 2638 }},
-		{{ 2704, 2689, 2623 }},
-		{{ 2623, 2638, 2704 }},
-		{{ 2766, 2749, 2689 }},
-		{{ 2689, 2704, 2766 }},
-		{{ 2822, 2797, 2749 }},
-		{{ 2749, 2766, 2822 }},
-		{{ 2848, 2833, 2797 }},
-		{{ 2797, 2822, 2848 }},
-		{{ 2858, 2843, 2833 }},
-		{{ 2833, 2848, 2858 }},
-		{{ 1735, 2334, 2329 }},
-		{{ 1735, 2329, 2321 }},
-		{{ 1735, 2321, 2305 }},
-		{{ 1735, 2305, 2274 }},
-		{{ 1735, 2274, 2231 }},
-		{{ 1735, 2231, 2167 }},
-		{{ 1735, 2167, 2089 }},
-		{{ 1735, 2089, 2014 }},
-		{{ 1735, 2014, 1962 }},
-		{{ 1735, 1962, 1733 }},
-		{{ 2515, 2329, 2334 }},
-		{{ 2334, 2524, 2515 }},
-		{{ 2495, 2321, 2329 }},
-		{{ 2329, 2515, 2495 }},
-		{{ 2456, 2305, 2321 }},
-		{{ 2321, 2495, 2456 }},
-		{{ 2429, 2274, 2305 }},
-		{{ 2305, 2456, 2429 }},
-		{{ 2399, 2231, 2274 }},
-		{{ 2274, 2429, 2399 }},
-		{{ 2347, 2167, 2231 }},
-		{{ 2231, 2399, 2347 }},
-		{{ 2292, 2089, 2167 }},
-		{{ 2167, 2347, 2292 }},
-		{{ 2148, 2014, 2089 }},
-		{{ 2089, 2292, 2148 }},
-		{{ 2004, 1962, 2014 }},
-		{{ 2014, 2148, 2004 }},
-		{{ 1739, 1733, 1962 }},
-		{{ 1962, 2004, 1739 }},
-		{{ 2647, 2515, 2524 }},
-		{{ 2524, 2649, 2647 }},
-		{{ 2621, 2495, 2515 }},
-		{{ 2515, 2647, 2621 }},
-		{{ 2584, 2456, 2495 }},
-		{{ 2495, 2621, 2584 }},
-		{{ 2541, 2429, 2456 }},
-		{{ 2456, 2584, 2541 }},
-		{{ 2502, 2399, 2429 }},
-		{{ 2429, 2541, 2502 }},
-		{{ 2426, 2347, 2399 }},
-		{{ 2399, 2502, 2426 }},
-		{{ 2352, 2292, 2347 }},
-		{{ 2347, 2426, 2352 }},
-		{{ 2255, 2148, 2292 }},
-		{{ 2292, 2352, 2255 }},
-		{{ 2046, 2004, 2148 }},
-		{{ 2148, 2255, 2046 }},
-		{{ 1702, 1739, 2004 }},
-		{{ 2004, 2046, 1702 }},
-		{{ 2746, 2647, 2649 }},
-		{{ 2649, 2757, 2746 }},
-		{{ 2721, 2621, 2647 }},
-		{{ 2647, 2746, 2721 }},
-		{{ 2681, 2584, 2621 }},
-		{{ 2621, 2721, 2681 }},
-		{{ 2639, 2541, 2584 }},
-		{{ 2584, 2681, 2639 }},
-		{{ 2557, 2502, 2541 }},
-		{{ 2541, 2639, 2557 }},
-		{{ 2505, 2426, 2502 }},
-		{{ 2502, 2557, 2505 }},
-		{{ 2415, 2352, 2426 }},
-		{{ 2426, 2505, 2415 }},
-		{{ 2318, 2255, 2352 }},
-		{{ 2352, 2415, 2318 }},
-		{{ 2098, 2046, 2255 }},
-		{{ 2255, 2318, 2098 }},
-		{{ 1745, 1702, 2046 }},
-		{{ 2046, 2098, 1745 }},
-		{{ 2840, 2746, 2757 }},
-		{{ 2757, 2849, 2840 }},
-		{{ 2808, 2721, 2746 }},
-		{{ 2746, 2840, 2808 }},
-		{{ 2756, 2681, 2721 }},
-		{{ 2721, 2808, 2756 }},
-		{{ 2696, 2639, 2681 }},
-		{{ 2681, 2756, 2696 }},
-		{{ 2626, 2557, 2639 }},
-		{{ 2639, 2696, 2626 }},
-		{{ 2538, 2505, 2557 }},
-		{{ 2557, 2626, 2538 }},
-		{{ 2443, 2415, 2505 }},
-		{{ 2505, 2538, 2443 }},
-		{{ 2342, 2318, 2415 }},
-		{{ 2415, 2443, 2342 }},
-		{{ 2131, 2098, 2318 }},
-		{{ 2318, 2342, 2131 }},
-		{{ 1904, 1745, 2098 }},
-		{{ 2098, 2131, 1904 }},
-		{{ 2906, 2840, 2849 }},
-		{{ 2849, 2925, 2906 }},
-		{{ 2867, 2808, 2840 }},
-		{{ 2840, 2906, 2867 }},
-		{{ 2818, 2756, 2808 }},
-		{{ 2808, 2867, 2818 }},
-		{{ 2736, 2696, 2756 }},
-		{{ 2756, 2818, 2736 }},
-		{{ 2667, 2626, 2696 }},
-		{{ 2696, 2736, 2667 }},
-		{{ 2565, 2538, 2626 }},
-		{{ 2626, 2667, 2565 }},
-		{{ 2475, 2443, 2538 }},
-		{{ 2538, 2565, 2475 }},
-		{{ 2356, 2342, 2443 }},
-		{{ 2443, 2475, 2356 }},
-		{{ 2156, 2131, 2342 }},
-		{{ 2342, 2356, 2156 }},
-		{{ 1704, 1904, 2131 }},
-		{{ 2131, 2156, 1704 }},
-		{{ 2976, 2906, 2925 }},
-		{{ 2925, 2987, 2976 }},
-		{{ 2914, 2867, 2906 }},
-		{{ 2906, 2976, 2914 }},
-		{{ 2852, 2818, 2867 }},
-		{{ 2867, 2914, 2852 }},
-		{{ 2772, 2736, 2818 }},
-		{{ 2818, 2852, 2772 }},
-		{{ 2688, 2667, 2736 }},
-		{{ 2736, 2772, 2688 }},
-		{{ 2592, 2565, 2667 }},
-		{{ 2667, 2688, 2592 }},
-		{{ 2497, 2475, 2565 }},
-		{{ 2565, 2592, 2497 }},
-		{{ 2372, 2356, 2475 }},
-		{{ 2475, 2497, 2372 }},
-		{{ 2176, 2156, 2356 }},
-		{{ 2356, 2372, 2176 }},
-		{{ 1752, 1704, 2156 }},
-		{{ 2156, 2176, 1752 }},
-		{{ 2993, 2976, 2987 }},
-		{{ 2987, 3011, 2993 }},
-		{{ 2952, 2914, 2976 }},
-		{{ 2976, 2993, 2952 }},
-		{{ 2874, 2852, 2914 }},
-		{{ 2914, 2952, 2874 }},
-		{{ 2794, 2772, 2852 }},
-		{{ 2852, 2874, 2794 }},
-		{{ 2702, 2688, 2772 }},
-		{{ 2772, 2794, 2702 }},
-		{{ 2604, 2592, 2688 }},
-		{{ 2688, 2702, 2604 }},
-		{{ 2509, 2497, 2592 }},
-		{{ 2592, 2604, 2509 }},
-		{{ 2380, 2372, 2497 }},
-		{{ 2497, 2509, 2380 }},
-		{{ 2182, 2176, 2372 }},
-		{{ 2372, 2380, 2182 }},
-		{{ 1723, 1752, 2176 }},
-		{{ 2176, 2182, 1723 }},
-		{{ 3000, 2993, 3011 }},
-		{{ 3011, 3020, 3000 }},
-		{{ 2967, 2952, 2993 }},
-		{{ 2993, 3000, 2967 }},
-		{{ 2879, 2874, 2952 }},
-		{{ 2952, 2967, 2879 }},
-		{{ 2799, 2794, 2874 }},
-		{{ 2874, 2879, 2799 }},
-		{{ 2707, 2702, 2794 }},
-		{{ 2794, 2799, 2707 }},
-		{{ 2605, 2604, 2702 }},
-		{{ 2702, 2707, 2605 }},
-		{{ 2512, 2509, 2604 }},
-		{{ 2604, 2605, 2512 }},
-		{{ 2382, 2380, 2509 }},
-		{{ 2509, 2512, 2382 }},
-		{{ 2188, 2182, 2380 }},
-		{{ 2380, 2382, 2188 }},
-		{{ 1699, 1723, 2182 }},
-		{{ 2182, 2188, 1699 }},
-		{{ 3006, 3000, 3020 }},
-		{{ 3020, 3022, 3006 }},
-		{{ 2972, 2967, 3000 }},
-		{{ 3000, 3006, 2972 }},
-		{{ 2888, 2879, 2967 }},
-		{{ 2967, 2972, 2888 }},
-		{{ 2804, 2799, 2879 }},
-		{{ 2879, 2888, 2804 }},
-		{{ 2710, 2707, 2799 }},
-		{{ 2799, 2804, 2710 }},
-		{{ 2613, 2605, 2707 }},
-		{{ 2707, 2710, 2613 }},
-		{{ 2520, 2512, 2605 }},
-		{{ 2605, 2613, 2520 }},
-		{{ 2388, 2382, 2512 }},
-		{{ 2512, 2520, 2388 }},
-		{{ 2192, 2188, 2382 }},
-		{{ 2382, 2388, 2192 }},
-		{{ 1760, 1699, 2188 }},
-		{{ 2188, 2192, 1760 }},
-		{{ 1735, 1737, 1660 }},
-		{{ 1735, 1660, 1608 }},
-		{{ 1735, 1608, 1535 }},
-		{{ 1735, 1535, 1457 }},
-		{{ 1735, 1457, 1393 }},
-		{{ 1735, 1393, 1350 }},
-		{{ 1735, 1350, 1319 }},
-		{{ 1735, 1319, 1303 }},
-		{{ 1735, 1303, 1295 }},
-		{{ 1735, 1295, 1288 }},
-		{{ 1618, 1660, 1737 }},
-		{{ 1737, 1739, 1618 }},
-		{{ 1474, 1608, 1660 }},
-		{{ 1660, 1618, 1474 }},
-		{{ 1332, 1535, 1608 }},
-		{{ 1608, 1474, 1332 }},
-		{{ 1277, 1457, 1535 }},
-		{{ 1535, 1332, 1277 }},
-		{{ 1225, 1393, 1457 }},
-		{{ 1457, 1277, 1225 }},
-		{{ 1195, 1350, 1393 }},
-		{{ 1393, 1225, 1195 }},
-		{{ 1166, 1319, 1350 }},
-		{{ 1350, 1195, 1166 }},
-		{{ 1129, 1303, 1319 }},
-		{{ 1319, 1166, 1129 }},
-		{{ 1109, 1295, 1303 }},
-		{{ 1303, 1129, 1109 }},
-		{{ 1099, 1288, 1295 }},
-		{{ 1295, 1109, 1099 }},
-		{{ 1576, 1618, 1739 }},
-		{{ 1739, 1741, 1576 }},
-		{{ 1367, 1474, 1618 }},
-		{{ 1618, 1576, 1367 }},
-		{{ 1270, 1332, 1474 }},
-		{{ 1474, 1367, 1270 }},
-		{{ 1196, 1277, 1332 }},
-		{{ 1332, 1270, 1196 }},
-		{{ 1120, 1225, 1277 }},
-		{{ 1277, 1196, 1120 }},
-		{{ 1081, 1195, 1225 }},
-		{{ 1225, 1120, 1081 }},
-		{{ 1040, 1166, 1195 }},
-		{{ 1195, 1081, 1040 }},
-		{{ 1001, 1129, 1166 }},
-		{{ 1166, 1040, 1001 }},
-		{{ 975, 1109, 1129 }},
-		{{ 1129, 1001, 975 }},
-		{{ 973, 1099, 1109 }},
-		{{ 1109, 975, 973 }},
-		{{ 1524, 1576, 1741 }},
-		{{ 1741, 1744, 1524 }},
-		{{ 1304, 1367, 1576 }},
-		{{ 1576, 1524, 1304 }},
-		{{ 1209, 1270, 1367 }},
-		{{ 1367, 1304, 1209 }},
-		{{ 1119, 1196, 1270 }},
-		{{ 1270, 1209, 1119 }},
-		{{ 1065, 1120, 1196 }},
-		{{ 1196, 1119, 1065 }},
-		{{ 983, 1081, 1120 }},
-		{{ 1120, 1065, 983 }},
-		{{ 941, 1040, 1081 }},
-		{{ 1081, 983, 941 }},
-		{{ 901, 1001, 1040 }},
-		{{ 1040, 941, 901 }},
-		{{ 878, 975, 1001 }},
-		{{ 1001, 901, 878 }},
-		{{ 865, 973, 975 }},
-		{{ 975, 878, 865 }},
-		{{ 1493, 1524, 1744 }},
-		{{ 1744, 1747, 1493 }},
-		{{ 1280, 1304, 1524 }},
-		{{ 1524, 1493, 1280 }},
-		{{ 1181, 1209, 1304 }},
-		{{ 1304, 1280, 1181 }},
-		{{ 1086, 1119, 1209 }},
-		{{ 1209, 1181, 1086 }},
-		{{ 998, 1065, 1119 }},
-		{{ 1119, 1086, 998 }},
-		{{ 928, 983, 1065 }},
-		{{ 1065, 998, 928 }},
-		{{ 868, 941, 983 }},
-		{{ 983, 928, 868 }},
-		{{ 816, 901, 941 }},
-		{{ 941, 868, 816 }},
-		{{ 784, 878, 901 }},
-		{{ 901, 816, 784 }},
-		{{ 773, 865, 878 }},
-		{{ 878, 784, 773 }},
-		{{ 1466, 1493, 1747 }},
-		{{ 1747, 1749, 1466 }},
-		{{ 1266, 1280, 1493 }},
-		{{ 1493, 1466, 1266 }},
-		{{ 1149, 1181, 1280 }},
-		{{ 1280, 1266, 1149 }},
-		{{ 1057, 1086, 1181 }},
-		{{ 1181, 1149, 1057 }},
-		{{ 955, 998, 1086 }},
-		{{ 1086, 1057, 955 }},
-		{{ 888, 928, 998 }},
-		{{ 998, 955, 888 }},
-		{{ 806, 868, 928 }},
-		{{ 928, 888, 806 }},
-		{{ 755, 816, 868 }},
-		{{ 868, 806, 755 }},
-		{{ 718, 784, 816 }},
-		{{ 816, 755, 718 }},
-		{{ 697, 773, 784 }},
-		{{ 784, 718, 697 }},
-		{{ 1446, 1466, 1749 }},
-		{{ 1749, 1753, 1446 }},
-		{{ 1250, 1266, 1466 }},
-		{{ 1466, 1446, 1250 }},
-		{{ 1127, 1149, 1266 }},
-		{{ 1266, 1250, 1127 }},
-		{{ 1032, 1057, 1149 }},
-		{{ 1149, 1127, 1032 }},
-		{{ 936, 955, 1057 }},
-		{{ 1057, 1032, 936 }},
-		{{ 852, 888, 955 }},
-		{{ 955, 936, 852 }},
-		{{ 772, 806, 888 }},
-		{{ 888, 852, 772 }},
-		{{ 710, 755, 806 }},
-		{{ 806, 772, 710 }},
-		{{ 648, 718, 755 }},
-		{{ 755, 710, 648 }},
-		{{ 637, 697, 718 }},
-		{{ 718, 648, 637 }},
-		{{ 1440, 1446, 1753 }},
-		{{ 1753, 1755, 1440 }},
-		{{ 1242, 1250, 1446 }},
-		{{ 1446, 1440, 1242 }},
-		{{ 1115, 1127, 1250 }},
-		{{ 1250, 1242, 1115 }},
-		{{ 1020, 1032, 1127 }},
-		{{ 1127, 1115, 1020 }},
-		{{ 922, 936, 1032 }},
-		{{ 1032, 1020, 922 }},
-		{{ 830, 852, 936 }},
-		{{ 936, 922, 830 }},
-		{{ 750, 772, 852 }},
-		{{ 852, 830, 750 }},
-		{{ 672, 710, 772 }},
-		{{ 772, 750, 672 }},
-		{{ 631, 648, 710 }},
-		{{ 710, 672, 631 }},
-		{{ 613, 637, 648 }},
-		{{ 648, 631, 613 }},
-		{{ 1434, 1440, 1755 }},
-		{{ 1755, 1757, 1434 }},
-		{{ 1240, 1242, 1440 }},
-		{{ 1440, 1434, 1240 }},
-		{{ 1110, 1115, 1242 }},
-		{{ 1242, 1240, 1110 }},
-		{{ 1017, 1020, 1115 }},
-		{{ 1115, 1110, 1017 }},
-		{{ 915, 922, 1020 }},
-		{{ 1020, 1017, 915 }},
-		{{ 823, 830, 922 }},
-		{{ 922, 915, 823 }},
-		{{ 743, 750, 830 }},
-		{{ 830, 823, 743 }},
-		{{ 655, 672, 750 }},
-		{{ 750, 743, 655 }},
-		{{ 622, 631, 672 }},
-		{{ 672, 655, 622 }},
-		{{ 602, 613, 631 }},
-		{{ 631, 622, 602 }},
-		{{ 1428, 1434, 1757 }},
-		{{ 1757, 1760, 1428 }},
-		{{ 1232, 1240, 1434 }},
-		{{ 1434, 1428, 1232 }},
-		{{ 1105, 1110, 1240 }},
-		{{ 1240, 1232, 1105 }},
-		{{ 1010, 1017, 1110 }},
-		{{ 1110, 1105, 1010 }},
-		{{ 913, 915, 1017 }},
-		{{ 1017, 1010, 913 }},
-		{{ 821, 823, 915 }},
-		{{ 915, 913, 821 }},
-		{{ 736, 743, 823 }},
-		{{ 823, 821, 736 }},
-		{{ 652, 655, 743 }},
-		{{ 743, 736, 652 }},
-		{{ 619, 622, 655 }},
-		{{ 655, 652, 619 }},
-		{{ 601, 602, 622 }},
-		{{ 622, 619, 601 }},
-		{{ 1735, 1289, 1294 }},
-		{{ 1735, 1294, 1302 }},
-		{{ 1735, 1302, 1318 }},
-		{{ 1735, 1318, 1349 }},
-		{{ 1735, 1349, 1392 }},
-		{{ 1735, 1392, 1456 }},
-		{{ 1735, 1456, 1534 }},
-		{{ 1735, 1534, 1609 }},
-		{{ 1735, 1609, 1661 }},
-		{{ 1735, 1661, 1889 }},
-		{{ 1108, 1294, 1289 }},
-		{{ 1289, 1099, 1108 }},
-		{{ 1128, 1302, 1294 }},
-		{{ 1294, 1108, 1128 }},
-		{{ 1167, 1318, 1302 }},
-		{{ 1302, 1128, 1167 }},
-		{{ 1194, 1349, 1318 }},
-		{{ 1318, 1167, 1194 }},
-		{{ 1224, 1392, 1349 }},
-		{{ 1349, 1194, 1224 }},
-		{{ 1276, 1456, 1392 }},
-		{{ 1392, 1224, 1276 }},
-		{{ 1331, 1534, 1456 }},
-		{{ 1456, 1276, 1331 }},
-		{{ 1475, 1609, 1534 }},
-		{{ 1534, 1331, 1475 }},
-		{{ 1619, 1661, 1609 }},
-		{{ 1609, 1475, 1619 }},
-		{{ 1738, 1889, 1661 }},
-		{{ 1661, 1619, 1738 }},
-		{{ 976, 1108, 1099 }},
-		{{ 1099, 974, 976 }},
-		{{ 1002, 1128, 1108 }},
-		{{ 1108, 976, 1002 }},
-		{{ 1039, 1167, 1128 }},
-		{{ 1128, 1002, 1039 }},
-		{{ 1082, 1194, 1167 }},
-		{{ 1167, 1039, 1082 }},
-		{{ 1121, 1224, 1194 }},
-		{{ 1194, 1082, 1121 }},
-		{{ 1197, 1276, 1224 }},
-		{{ 1224, 1121, 1197 }},
-		{{ 1271, 1331, 1276 }},
-		{{ 1276, 1197, 1271 }},
-		{{ 1368, 1475, 1331 }},
-		{{ 1331, 1271, 1368 }},
-		{{ 1577, 1619, 1475 }},
-		{{ 1475, 1368, 1577 }},
-		{{ 1903, 1738, 1619 }},
-		{{ 1619, 1577, 1903 }},
-		{{ 877, 976, 974 }},
-		{{ 974, 866, 877 }},
-		{{ 902, 1002, 976 }},
-		{{ 976, 877, 902 }},
-		{{ 942, 1039, 1002 }},
-		{{ 1002, 902, 942 }},
-		{{ 984, 1082, 1039 }},
-		{{ 1039, 942, 984 }},
-		{{ 1066, 1121, 1082 }},
-		{{ 1082, 984, 1066 }},
-		{{ 1118, 1197, 1121 }},
-		{{ 1121, 1066, 1118 }},
-		{{ 1208, 1271, 1197 }},
-		{{ 1197, 1118, 1208 }},
-		{{ 1305, 1368, 1271 }},
-		{{ 1271, 1208, 1305 }},
-		{{ 1525, 1577, 1368 }},
-		{{ 1368, 1305, 1525 }},
-		{{ 1742, 1903, 1577 }},
-		{{ 1577, 1525, 1742 }},
-		{{ 783, 877, 866 }},
-		{{ 866, 774, 783 }},
-		{{ 815, 902, 877 }},
-		{{ 877, 783, 815 }},
-		{{ 867, 942, 902 }},
-		{{ 902, 815, 867 }},
-		{{ 927, 984, 942 }},
-		{{ 942, 867, 927 }},
-		{{ 997, 1066, 984 }},
-		{{ 984, 927, 997 }},
-		{{ 1085, 1118, 1066 }},
-		{{ 1066, 997, 1085 }},
-		{{ 1180, 1208, 1118 }},
-		{{ 1118, 1085, 1180 }},
-		{{ 1281, 1305, 1208 }},
-		{{ 1208, 1180, 1281 }},
-		{{ 1492, 1525, 1305 }},
-		{{ 1305, 1281, 1492 }},
-		{{ 1703, 1742, 1525 }},
-		{{ 1525, 1492, 1703 }},
-		{{ 717, 783, 774 }},
-		{{ 774, 698, 717 }},
-		{{ 756, 815, 783 }},
-		{{ 783, 717, 756 }},
-		{{ 805, 867, 815 }},
-		{{ 815, 756, 805 }},
-		{{ 887, 927, 867 }},
-		{{ 867, 805, 887 }},
-		{{ 956, 997, 927 }},
-		{{ 927, 887, 956 }},
-		{{ 1058, 1085, 997 }},
-		{{ 997, 956, 1058 }},
-		{{ 1148, 1180, 1085 }},
-		{{ 1085, 1058, 1148 }},
-		{{ 1267, 1281, 1180 }},
-		{{ 1180, 1148, 1267 }},
-		{{ 1467, 1492, 1281 }},
-		{{ 1281, 1267, 1467 }},
-		{{ 1905, 1703, 1492 }},
-		{{ 1492, 1467, 1905 }},
-		{{ 647, 717, 698 }},
-		{{ 698, 636, 647 }},
-		{{ 709, 756, 717 }},
-		{{ 717, 647, 709 }},
-		{{ 771, 805, 756 }},
-		{{ 756, 709, 771 }},
-		{{ 851, 887, 805 }},
-		{{ 805, 771, 851 }},
-		{{ 935, 956, 887 }},
-		{{ 887, 851, 935 }},
-		{{ 1031, 1058, 956 }},
-		{{ 956, 935, 1031 }},
-		{{ 1126, 1148, 1058 }},
-		{{ 1058, 1031, 1126 }},
-		{{ 1251, 1267, 1148 }},
-		{{ 1148, 1126, 1251 }},
-		{{ 1447, 1467, 1267 }},
-		{{ 1267, 1251, 1447 }},
-		{{ 1751, 1905, 1467 }},
-		{{ 1467, 1447, 1751 }},
-		{{ 630, 647, 636 }},
-		{{ 636, 612, 630 }},
-		{{ 671, 709, 647 }},
-		{{ 647, 630, 671 }},
-		{{ 749, 771, 709 }},
-		{{ 709, 671, 749 }},
-		{{ 829, 851, 771 }},
-		{{ 771, 749, 829 }},
-		{{ 921, 935, 851 }},
-		{{ 851, 829, 921 }},
-		{{ 1019, 1031, 935 }},
-		{{ 935, 921, 1019 }},
-		{{ 1114, 1126, 1031 }},
-		{{ 1031, 1019, 1114 }},
-		{{ 1243, 1251, 1126 }},
-		{{ 1126, 1114, 1243 }},
-		{{ 1441, 1447, 1251 }},
-		{{ 1251, 1243, 1441 }},
-		{{ 1896, 1751, 1447 }},
-		{{ 1447, 1441, 1896 }},
-		{{ 623, 630, 612 }},
-		{{ 612, 603, 623 }},
-		{{ 656, 671, 630 }},
-		{{ 630, 623, 656 }},
-		{{ 744, 749, 671 }},
-		{{ 671, 656, 744 }},
-		{{ 824, 829, 749 }},
-		{{ 749, 744, 824 }},
-		{{ 916, 921, 829 }},
-		{{ 829, 824, 916 }},
-		{{ 1018, 1019, 921 }},
-		{{ 921, 916, 1018 }},
-		{{ 1111, 1114, 1019 }},
-		{{ 1019, 1018, 1111 }},
-		{{ 1241, 1243, 1114 }},
-		{{ 1114, 1111, 1241 }},
-		{{ 1435, 1441, 1243 }},
-		{{ 1243, 1241, 1435 }},
-		{{ 1923, 1896, 1441 }},
-		{{ 1441, 1435, 1923 }},
-		{{ 617, 623, 603 }},
-		{{ 603, 601, 617 }},
-		{{ 650, 656, 623 }},
-		{{ 623, 617, 650 }},
-		{{ 734, 744, 656 }},
-		{{ 656, 650, 734 }},
-		{{ 818, 824, 744 }},
-		{{ 744, 734, 818 }},
-		{{ 912, 916, 824 }},
-		{{ 824, 818, 912 }},
-		{{ 1009, 1018, 916 }},
-		{{ 916, 912, 1009 }},
-		{{ 1102, 1111, 1018 }},
-		{{ 1018, 1009, 1102 }},
-		{{ 1235, 1241, 1111 }},
-		{{ 1111, 1102, 1235 }},
-		{{ 1431, 1435, 1241 }},
-		{{ 1241, 1235, 1431 }},
-		{{ 1759, 1923, 1435 }},
-		{{ 1435, 1431, 1759 }},
-		{{ 1735, 1736, 1963 }},
-		{{ 1735, 1963, 2015 }},
-		{{ 1735, 2015, 2088 }},
-		{{ 1735, 2088, 2166 }},
-		{{ 1735, 2166, 2230 }},
-		{{ 1735, 2230, 2273 }},
-		{{ 1735, 2273, 2304 }},
-		{{ 1735, 2304, 2320 }},
-		{{ 1735, 2320, 2328 }},
-		{{ 1735, 2328, 2335 }},
-		{{ 2005, 1963, 1736 }},
-		{{ 1736, 1738, 2005 }},
-		{{ 2149, 2015, 1963 }},
-		{{ 1963, 2005, 2149 }},
-		{{ 2291, 2088, 2015 }},
-		{{ 2015, 2149, 2291 }},
-		{{ 2346, 2166, 2088 }},
-		{{ 2088, 2291, 2346 }},
-		{{ 2398, 2230, 2166 }},
-		{{ 2166, 2346, 2398 }},
-		{{ 2428, 2273, 2230 }},
-		{{ 2230, 2398, 2428 }},
-		{{ 2457, 2304, 2273 }},
-		{{ 2273, 2428, 2457 }},
-		{{ 2494, 2320, 2304 }},
-		{{ 2304, 2457, 2494 }},
-		{{ 2514, 2328, 2320 }},
-		{{ 2320, 2494, 2514 }},
-		{{ 2524, 2335, 2328 }},
-		{{ 2328, 2514, 2524 }},
-		{{ 2047, 2005, 1738 }},
-		{{ 1738, 1740, 2047 }},
-		{{ 2256, 2149, 2005 }},
-		{{ 2005, 2047, 2256 }},
-		{{ 2353, 2291, 2149 }},
-		{{ 2149, 2256, 2353 }},
-		{{ 2427, 2346, 2291 }},
-		{{ 2291, 2353, 2427 }},
-		{{ 2503, 2398, 2346 }},
-		{{ 2346, 2427, 2503 }},
-		{{ 2542, 2428, 2398 }},
-		{{ 2398, 2503, 2542 }},
-		{{ 2583, 2457, 2428 }},
-		{{ 2428, 2542, 2583 }},
-		{{ 2622, 2494, 2457 }},
-		{{ 2457, 2583, 2622 }},
-		{{ 2648, 2514, 2494 }},
-		{{ 2494, 2622, 2648 }},
-		{{ 2650, 2524, 2514 }},
-		{{ 2514, 2648, 2650 }},
-		{{ 2099, 2047, 1740 }},
-		{{ 1740, 1743, 2099 }},
-		{{ 2319, 2256, 2047 }},
-		{{ 2047, 2099, 2319 }},
-		{{ 2414, 2353, 2256 }},
-		{{ 2256, 2319, 2414 }},
-		{{ 2504, 2427, 2353 }},
-		{{ 2353, 2414, 2504 }},
-		{{ 2558, 2503, 2427 }},
-		{{ 2427, 2504, 2558 }},
-		{{ 2640, 2542, 2503 }},
-		{{ 2503, 2558, 2640 }},
-		{{ 2682, 2583, 2542 }},
-		{{ 2542, 2640, 2682 }},
-		{{ 2722, 2622, 2583 }},
-		{{ 2583, 2682, 2722 }},
-		{{ 2745, 2648, 2622 }},
-		{{ 2622, 2722, 2745 }},
-		{{ 2758, 2650, 2648 }},
-		{{ 2648, 2745, 2758 }},
-		{{ 2130, 2099, 1743 }},
-		{{ 1743, 1746, 2130 }},
-		{{ 2343, 2319, 2099 }},
-		{{ 2099, 2130, 2343 }},
-		{{ 2442, 2414, 2319 }},
-		{{ 2319, 2343, 2442 }},
-		{{ 2537, 2504, 2414 }},
-		{{ 2414, 2442, 2537 }},
-		{{ 2625, 2558, 2504 }},
-		{{ 2504, 2537, 2625 }},
-		{{ 2695, 2640, 2558 }},
-		{{ 2558, 2625, 2695 }},
-		{{ 2755, 2682, 2640 }},
-		{{ 2640, 2695, 2755 }},
-		{{ 2807, 2722, 2682 }},
-		{{ 2682, 2755, 2807 }},
-		{{ 2839, 2745, 2722 }},
-		{{ 2722, 2807, 2839 }},
-		{{ 2850, 2758, 2745 }},
-		{{ 2745, 2839, 2850 }},
-		{{ 2157, 2130, 1746 }},
-		{{ 1746, 1748, 2157 }},
-		{{ 2357, 2343, 2130 }},
-		{{ 2130, 2157, 2357 }},
-		{{ 2474, 2442, 2343 }},
-		{{ 2343, 2357, 2474 }},
-		{{ 2566, 2537, 2442 }},
-		{{ 2442, 2474, 2566 }},
-		{{ 2668, 2625, 2537 }},
-		{{ 2537, 2566, 2668 }},
-		{{ 2735, 2695, 2625 }},
-		{{ 2625, 2668, 2735 }},
-		{{ 2817, 2755, 2695 }},
-		{{ 2695, 2735, 2817 }},
-		{{ 2868, 2807, 2755 }},
-		{{ 2755, 2817, 2868 }},
-		{{ 2905, 2839, 2807 }},
-		{{ 2807, 2868, 2905 }},
-		{{ 2926, 2850, 2839 }},
-		{{ 2839, 2905, 2926 }},
-		{{ 2177, 2157, 1748 }},
-		{{ 1748, 1750, 2177 }},
-		{{ 2373, 2357, 2157 }},
-		{{ 2157, 2177, 2373 }},
-		{{ 2496, 2474, 2357 }},
-		{{ 2357, 2373, 2496 }},
-		{{ 2591, 2566, 2474 }},
-		{{ 2474, 2496, 2591 }},
-		{{ 2687, 2668, 2566 }},
-		{{ 2566, 2591, 2687 }},
-		{{ 2771, 2735, 2668 }},
-		{{ 2668, 2687, 2771 }},
-		{{ 2851, 2817, 2735 }},
-		{{ 2735, 2771, 2851 }},
-		{{ 2913, 2868, 2817 }},
-		{{ 2817, 2851, 2913 }},
-		{{ 2975, 2905, 2868 }},
-		{{ 2868, 2913, 2975 }},
-		{{ 2986, 2926, 2905 }},
-		{{ 2905, 2975, 2986 }},
-		{{ 2183, 2177, 1750 }},
-		{{ 1750, 1754, 2183 }},
-		{{ 2381, 2373, 2177 }},
-		{{ 2177, 2183, 2381 }},
-		{{ 2508, 2496, 2373 }},
-		{{ 2373, 2381, 2508 }},
-		{{ 2603, 2591, 2496 }},
-		{{ 2496, 2508, 2603 }},
-		{{ 2701, 2687, 2591 }},
-		{{ 2591, 2603, 2701 }},
-		{{ 2793, 2771, 2687 }},
-		{{ 2687, 2701, 2793 }},
-		{{ 2873, 2851, 2771 }},
-		{{ 2771, 2793, 2873 }},
-		{{ 2951, 2913, 2851 }},
-		{{ 2851, 2873, 2951 }},
-		{{ 2992, 2975, 2913 }},
-		{{ 2913, 2951, 2992 }},
-		{{ 3010, 2986, 2975 }},
-		{{ 2975, 2992, 3010 }},
-		{{ 2189, 2183, 1754 }},
-		{{ 1754, 1756, 2189 }},
-		{{ 2383, 2381, 2183 }},
-		{{ 2183, 2189, 2383 }},
-		{{ 2513, 2508, 2381 }},
-		{{ 2381, 2383, 2513 }},
-		{{ 2606, 2603, 2508 }},
-		{{ 2508, 2513, 2606 }},
-		{{ 2708, 2701, 2603 }},
-		{{ 2603, 2606, 2708 }},
-		{{ 2800, 2793, 2701 }},
-		{{ 2701, 2708, 2800 }},
-		{{ 2880, 2873, 2793 }},
-		{{ 2793, 2800, 2880 }},
-		{{ 2968, 2951, 2873 }},
-		{{ 2873, 2880, 2968 }},
-		{{ 3001, 2992, 2951 }},
-		{{ 2951, 2968, 3001 }},
-		{{ 3021, 3010, 2992 }},
-		{{ 2992, 3001, 3021 }},
-		{{ 2195, 2189, 1756 }},
-		{{ 1756, 1759, 2195 }},
-		{{ 2390, 2383, 2189 }},
-		{{ 2189, 2195, 2390 }},
-		{{ 2517, 2513, 2383 }},
-		{{ 2383, 2390, 2517 }},
-		{{ 2612, 2606, 2513 }},
-		{{ 2513, 2517, 2612 }},
-		{{ 2709, 2708, 2606 }},
-		{{ 2606, 2612, 2709 }},
-		{{ 2801, 2800, 2708 }},
-		{{ 2708, 2709, 2801 }},
-		{{ 2886, 2880, 2800 }},
-		{{ 2800, 2801, 2886 }},
-		{{ 2970, 2968, 2880 }},
-		{{ 2880, 2886, 2970 }},
-		{{ 3004, 3001, 2968 }},
-		{{ 2968, 2970, 3004 }},
-		{{ 3022, 3021, 3001 }},
-		{{ 3001, 3004, 3022 }}
-	}
-};
-
-#endif /* ASSET_TEAPOT_H */
@@ -1,7 +1,16 @@
+// gcc -o xobjtoc objToC.c ../src/obj.c ../src/jobs.c ../src/vcache.c ../src/simplify.c -lm -pthread
+
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "../inc/meshfile.h"
+#include "../inc/obj.h"
+#include "../inc/vcache.h"
+#include "../inc/simplify.h"
 
 static void make_guard(char *dst, size_t dst_size, const char *base) {
 
@@ -15,16 +24,371 @@ static void make_guard(char *dst, size_t dst_size, const char *base) {
 	}
 }
 
+// must match inc/mesh.h
+#define MESHLET_MAX_VERTICES  64
+#define MESHLET_MAX_TRIANGLES 124
+// how many new vertices a face may cost for pointing the same way as its meshlet
+#define MESHLET_CONE_WEIGHT   1.0f
+// no level of detail gets fewer faces than this
+#define LOD_MIN_FACES         32
+
+typedef struct {
+	unsigned v_offset, v_count;
+	unsigned t_offset, t_count;
+	float center[3];
+	float radius;
+	float cone_axis[3];
+	float cone_cutoff;
+} Meshlet;
+
+_Static_assert(sizeof(Meshlet) == 48, "mesh files store the meshlets of inc/mesh.h");
+
+typedef struct {
+	Meshlet*       m;
+	size_t         m_count;
+	unsigned*      mv;  // 0-based vertex of every meshlet vertex
+	size_t         mv_count;
+	unsigned char* mt;  // three meshlet local vertices per triangle
+} Meshlets;
+
+// unit normal of a counter-clockwise face, zero if it has no area
+static void face_normal(float* n, const unsigned* face, const float* v) {
+
+	const float* a = &v[3 * face[0]];
+	const float* b = &v[3 * face[1]];
+	const float* c = &v[3 * face[2]];
+	float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+	float e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+	n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+	n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+	n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+
+	float len = sqrtf(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+	for (int k = 0; k < 3; k++) n[k] = len > 0.0f ? n[k] / len : 0.0f;
+}
+
+static void meshlet_bounds(Meshlet* m, const unsigned* mv, const unsigned* faces, const float* normals, const float* v) {
+
+	float lo[3] = {  INFINITY,  INFINITY,  INFINITY };
+	float hi[3] = { -INFINITY, -INFINITY, -INFINITY };
+	for (unsigned i = 0; i < m->v_count; i++) {
+		const float* p = &v[3 * mv[m->v_offset + i]];
+		for (int k = 0; k < 3; k++) {
+			lo[k] = fminf(lo[k], p[k]);
+			hi[k] = fmaxf(hi[k], p[k]);
+		}
+	}
+
+	float radius2 = 0.0f;
+	for (int k = 0; k < 3; k++) m->center[k] = 0.5f * (lo[k] + hi[k]);
+	for (unsigned i = 0; i < m->v_count; i++) {
+		const float* p = &v[3 * mv[m->v_offset + i]];
+		float dx = p[0] - m->center[0], dy = p[1] - m->center[1], dz = p[2] - m->center[2];
+		radius2 = fmaxf(radius2, dx*dx + dy*dy + dz*dz);
+	}
+	m->radius = sqrtf(radius2) + 1e-5f;
+
+	// normal cone: the average of the face normals and the widest angle to one of them,
+	// counter-clockwise faces point their normal out like the .obj convention
+	float axis[3] = { 0.0f, 0.0f, 0.0f };
+	for (unsigned t = 0; t < m->t_count; t++) {
+		const float* n = &normals[3 * faces[m->t_offset + t]];
+		for (int k = 0; k < 3; k++) axis[k] += n[k];
+	}
+
+	float len = sqrtf(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+	float min_dot = 1.0f;
+	for (int k = 0; k < 3; k++) m->cone_axis[k] = len > 0.0f ? axis[k] / len : 0.0f;
+	for (unsigned t = 0; t < m->t_count; t++) {
+		const float* n = &normals[3 * faces[m->t_offset + t]];
+		if (n[0] * n[0] + n[1] * n[1] + n[2] * n[2] <= 0.0f) continue;
+		min_dot = fminf(min_dot, n[0] * m->cone_axis[0] + n[1] * m->cone_axis[1] + n[2] * m->cone_axis[2]);
+	}
+
+	// wider than about 84 degrees is never entirely back facing in practice
+	m->cone_cutoff = (len <= 0.0f || min_dot <= 0.1f) ? 1.0f : sqrtf(1.0f - min_dot * min_dot);
+}
+
+// Greedy clustering: a meshlet grows by the unassigned face next to it that adds
+// the fewest new vertices, faces turned away from the meshlet's average normal
+// count extra so the normal cones stay narrow. A new one starts at the first
+// unassigned face.
+static bool meshlets_build(Meshlets* out, const unsigned* f, size_t f_count, const float* v, size_t v_count) {
+
+	*out = (Meshlets) {0};
+
+	// faces around every vertex
+	size_t*   start = calloc(v_count + 1, sizeof *start);
+	size_t*   fill  = calloc(v_count + 1, sizeof *fill);
+	unsigned* adj   = malloc((3 * f_count + 1) * sizeof *adj);
+	int*      local = malloc((v_count + 1) * sizeof *local);
+	char*     used  = calloc(f_count + 1, 1);
+	unsigned* order = malloc((f_count + 1) * sizeof *order);
+	float*    fn    = malloc((3 * f_count + 1) * sizeof *fn);
+	out->m  = malloc((f_count + 1) * sizeof *out->m);
+	out->mv = malloc((3 * f_count + 1) * sizeof *out->mv);
+	out->mt = malloc((3 * f_count + 1) * sizeof *out->mt);
+	if (!start || !fill || !adj || !local || !used || !order || !fn || !out->m || !out->mv || !out->mt) {
+		free(start);
+		free(fill);
+		free(adj);
+		free(local);
+		free(used);
+		free(order);
+		free(fn);
+		free(out->m);
+		free(out->mv);
+		free(out->mt);
+		return false;
+	}
+
+	for (size_t i = 0; i < 3 * f_count; i++) start[f[i] + 1]++;
+	for (size_t i = 0; i < v_count; i++) start[i + 1] += start[i];
+	for (size_t i = 0; i < 3 * f_count; i++) {
+		unsigned vi = f[i];
+		adj[start[vi] + fill[vi]++] = (unsigned) (i / 3);
+	}
+	for (size_t i = 0; i < v_count; i++) local[i] = -1;
+	for (size_t i = 0; i < f_count; i++) face_normal(&fn[3 * i], &f[3 * i], v);
+
+	size_t seed    = 0;
+	size_t t_total = 0;
+	for (;;) {
+		while (seed < f_count && used[seed]) seed++;
+		if (seed == f_count) break;
+
+		Meshlet* m = &out->m[out->m_count++];
+		*m = (Meshlet) { .v_offset = (unsigned) out->mv_count, .t_offset = (unsigned) t_total };
+
+		float  normal[3] = { 0.0f, 0.0f, 0.0f };
+		size_t next = seed;
+		while (next != (size_t) -1) {
+			used[next] = 1;
+			order[t_total + m->t_count] = (unsigned) next;
+			for (int k = 0; k < 3; k++) normal[k] += fn[3 * next + k];
+			for (int k = 0; k < 3; k++) {
+				unsigned vi = f[3 * next + k];
+				if (local[vi] < 0) {
+					local[vi] = (int) m->v_count++;
+					out->mv[out->mv_count++] = vi;
+				}
+				out->mt[3 * (m->t_offset + m->t_count) + k] = (unsigned char) local[vi];
+			}
+			m->t_count++;
+
+			if (m->t_count == MESHLET_MAX_TRIANGLES) break;
+
+			// the neighbour that adds the fewest vertices and still fits
+			float len = sqrtf(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+			float best = INFINITY;
+			next = (size_t) -1;
+			for (unsigned i = 0; i < m->v_count; i++) {
+				unsigned vi = out->mv[m->v_offset + i];
+				for (size_t a = start[vi]; a < start[vi + 1]; a++) {
+					unsigned t = adj[a];
+					if (used[t]) continue;
+
+					int fresh = 0;
+					for (int k = 0; k < 3; k++) fresh += local[f[3 * t + k]] < 0;
+					if (m->v_count + fresh > MESHLET_MAX_VERTICES) continue;
+
+					const float* n = &fn[3 * t];
+					float spread = len > 0.0f ? 1.0f - (n[0]*normal[0] + n[1]*normal[1] + n[2]*normal[2]) / len : 0.0f;
+					float score  = (float) fresh + MESHLET_CONE_WEIGHT * spread;
+					if (score < best) {
+						best = score;
+						next = t;
+					}
+				}
+			}
+		}
+
+		for (unsigned i = 0; i < m->v_count; i++) local[out->mv[m->v_offset + i]] = -1;
+		t_total += m->t_count;
+		meshlet_bounds(m, out->mv, order, fn, v);
+	}
+
+	free(start);
+	free(fill);
+	free(adj);
+	free(local);
+	free(used);
+	free(order);
+	free(fn);
+	return true;
+}
+
+// next multiple of MESH_FILE_ALIGN, the gap is zero filled
+static bool file_align(FILE* out, uint64_t* offset) {
+
+	static const char zeros[MESH_FILE_ALIGN];
+	size_t pad = (size_t) (MESH_FILE_ALIGN - *offset % MESH_FILE_ALIGN) % MESH_FILE_ALIGN;
+	*offset += pad;
+	return fwrite(zeros, 1, pad, out) == pad;
+}
+
+static bool block_write(FILE* out, MeshFileBlock* block, const void* data, size_t size, uint64_t* offset) {
+
+	if (!file_align(out, offset)) return false;
+	block->offset = *offset;
+	block->size   = size;
+	*offset += size;
+	return fwrite(data, 1, size, out) == size;
+}
+
+// Mesh file positions are steps of 1/65535 of the box on every axis. A flat
+// box gets a zero scale and every position lands on its offset.
+static void quantization_get(float* offset, float* scale, const float* box_min, const float* box_max) {
+
+	for (int k = 0; k < 3; k++) {
+		offset[k] = box_min[k];
+		scale[k]  = (box_max[k] - box_min[k]) / (float) UINT16_MAX;
+	}
+}
+
+static uint16_t quantize(float p, float offset, float scale) {
+
+	float q = scale > 0.0f ? roundf((p - offset) / scale) : 0.0f;
+	return (uint16_t) fminf(fmaxf(q, 0.0f), (float) UINT16_MAX);
+}
+
+// indices of a 1-based block, 16 bit ones if wide is false
+static void* indices_pack(const unsigned* indices, size_t count, bool wide, unsigned base) {
+
+	void* out = malloc((count + 1) * (wide ? sizeof(uint32_t) : sizeof(uint16_t)));
+	if (!out) return NULL;
+
+	for (size_t i = 0; i < count; i++) {
+		if (wide) ((uint32_t*) out)[i] = indices[i] + base;
+		else      ((uint16_t*) out)[i] = (uint16_t) (indices[i] + base);
+	}
+	return out;
+}
+
+// one level of the LOD chain
+typedef struct {
+	V3f*     v;        // only the vertices the faces use
+	size_t   v_count;
+	V3u*     f;        // 1-based
+	size_t   f_count;
+	Meshlets meshlets;
+	float    error;    // distance to the surface of level 0
+} Lod;
+
+static void lod_free(Lod* lod) {
+
+	free(lod->v);
+	free(lod->f);
+	free(lod->meshlets.m);
+	free(lod->meshlets.mv);
+	free(lod->meshlets.mt);
+	*lod = (Lod) {0};
+}
+
+// Takes over v and f: reorders them for the vertex cache, drops the vertices
+// no face uses and builds the meshlets.
+static bool lod_finish(Lod* lod, V3f* v, size_t v_count, V3u* f, size_t f_count, float error) {
+
+	*lod = (Lod) { .v = v, .f = f, .f_count = f_count, .error = error };
+
+	// faces in post-transform cache order, vertices in the order they are fetched
+	if (!vcache_optimize(f, f_count, v_count) || !vfetch_optimize(v, v_count, f, f_count)) {
+		fprintf(stderr, "Failed to reorder a level, keeping the file order.\n");
+	}
+	for (size_t i = 0; i < f_count; i++) {
+		for (int k = 0; k < 3; k++) lod->v_count = f[i].arr[k] > lod->v_count ? f[i].arr[k] : lod->v_count;
+	}
+
+	unsigned* faces = malloc((3 * f_count + 1) * sizeof *faces);
+	if (!faces) return false;
+	for (size_t i = 0; i < 3 * f_count; i++) faces[i] = f[i / 3].arr[i % 3] - 1;
+
+	bool ok = meshlets_build(&lod->meshlets, faces, f_count, v[0].arr, lod->v_count);
+	free(faces);
+	return ok;
+}
+
+// The mesh file for mesh_load, see inc/meshfile.h. Indices are 1-based there
+// like in the generated headers, 16 bit wide if every level allows it.
+static bool mesh_file_write(const char* path, const Lod* lods, size_t lod_count, const float* box_min,
+			    const float* box_max, const float* center, float radius) {
+
+	FILE* out = fopen(path, "wb");
+	if (!out) return false;
+
+	bool wide = false;
+	for (size_t i = 0; i < lod_count; i++) wide = wide || lods[i].v_count > UINT16_MAX;
+
+	MeshFileHeader h = {
+		.magic           = MESH_FILE_MAGIC,
+		.version         = MESH_FILE_VERSION,
+		.radius          = radius,
+		.position_format = MESH_FILE_POSITION_U16,
+		.index_format    = wide ? MESH_FILE_INDEX_U32 : MESH_FILE_INDEX_U16,
+		.lod_count       = (uint32_t) lod_count
+	};
+	memcpy(h.aabb_min, box_min, sizeof h.aabb_min);
+	memcpy(h.aabb_max, box_max, sizeof h.aabb_max);
+	memcpy(h.center,   center,  sizeof h.center);
+	quantization_get(h.q_offset, h.q_scale, box_min, box_max);
+
+	// the header is written again once the blocks are placed
+	size_t   index_size = wide ? sizeof(uint32_t) : sizeof(uint16_t);
+	uint64_t offset     = sizeof h;
+	bool ok = fwrite(&h, sizeof h, 1, out) == 1;
+	for (size_t i = 0; ok && i < lod_count; i++) {
+		const Lod*      lod = &lods[i];
+		const Meshlets* m   = &lod->meshlets;
+		MeshFileLod*    l   = &h.lod[i];
+
+		uint16_t (*v)[3] = malloc((lod->v_count + 1) * sizeof *v);
+		void*    f       = indices_pack(lod->f[0].arr, 3 * lod->f_count, wide, 0);
+		void*    mv      = indices_pack(m->mv, m->mv_count, wide, 1);
+		if (!v || !f || !mv) {
+			free(v);
+			free(f);
+			free(mv);
+			ok = false;
+			break;
+		}
+		for (size_t k = 0; k < lod->v_count; k++) {
+			for (int c = 0; c < 3; c++) v[k][c] = quantize(lod->v[k].arr[c], h.q_offset[c], h.q_scale[c]);
+		}
+
+		*l = (MeshFileLod) {
+			.v_count  = (uint32_t) lod->v_count,
+			.f_count  = (uint32_t) lod->f_count,
+			.m_count  = (uint32_t) m->m_count,
+			.mv_count = (uint32_t) m->mv_count,
+			.error    = lod->error
+		};
+		ok = block_write(out, &l->v,  v,     lod->v_count * sizeof *v,             &offset) &&
+		     block_write(out, &l->f,  f,     3 * lod->f_count * index_size,        &offset) &&
+		     block_write(out, &l->m,  m->m,  m->m_count * sizeof(Meshlet),         &offset) &&
+		     block_write(out, &l->mv, mv,    m->mv_count * index_size,             &offset) &&
+		     block_write(out, &l->mt, m->mt, 3 * lod->f_count,                     &offset);
+		free(v);
+		free(f);
+		free(mv);
+	}
+
+	h.file_size = offset;
+	ok = ok && fseek(out, 0, SEEK_SET) == 0 && fwrite(&h, sizeof h, 1, out) == 1;
+	ok = fclose(out) == 0 && ok;
+	return ok;
+}
+
 int main(int argc, char **argv) {
 
-	if (argc < 2) {
-		fprintf(stderr, "usage: %s file.obj\n", argv[0]);
-		return EXIT_FAILURE;
+	// -b writes a mesh file for mesh_load instead of a header
+	bool binary = argc > 1 && strcmp(argv[1], "-b") == 0;
+	if (binary) {
+		argv++;
+		argc--;
 	}
 
-	FILE* in_obj = fopen(argv[1], "r");
-	if (!in_obj) {
-		perror("fopen input");
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s [-b] file.obj\n", argv[0]);
 		return EXIT_FAILURE;
 	}
 
@@ -49,30 +413,127 @@ int main(int argc, char **argv) {
 	char guard[256];
 	make_guard(guard, sizeof(guard), base);
 
-	FILE *out_h = fopen(header_file, "w");
-	if (!out_h) {
+	char mesh_file[256];
+	snprintf(mesh_file, sizeof(mesh_file), "%s.srm", base);
+
+	FILE *out_h = binary ? NULL : fopen(header_file, "w");
+	if (!binary && !out_h) {
 		perror("fopen output");
-		fclose(in_obj);
+		free(base_dup);
 		return EXIT_FAILURE;
 	}
 
-	// first pass: count vertices and faces
-	size_t vertex_count = 0;
-	size_t face_count = 0;
+	// the meshes only have positions, so only equal positions are welded
+	Jobs* jobs = calloc(1, sizeof *jobs);
+	long  cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	ObjMesh obj;
+	if (!jobs || !jobs_create(jobs, cpus > 0 ? (uint32_t) cpus : 1) || !obj_load(&obj, argv[1], 0, jobs)) {
+		fprintf(stderr, "Failed to load %s.\n", argv[1]);
+		if (out_h) fclose(out_h);
+		free(jobs);
+		free(base_dup);
+		return EXIT_FAILURE;
+	}
+	jobs_destroy(jobs);
+	free(jobs);
+
+	float box_min[3], box_max[3];
+	memcpy(box_min, obj.aabb_min.arr, sizeof box_min);
+	memcpy(box_max, obj.aabb_max.arr, sizeof box_max);
+
+	// Mesh files only keep the quantized positions, so everything is built
+	// from them: the meshlet bounds and the simplifier see what gets drawn.
+	if (binary) {
+		float q_offset[3], q_scale[3];
+		quantization_get(q_offset, q_scale, box_min, box_max);
+		for (size_t i = 0; i < obj.v_count; i++) {
+			float* p = obj.v[i].arr;
+			for (int k = 0; k < 3; k++) p[k] = q_offset[k] + q_scale[k] * quantize(p[k], q_offset[k], q_scale[k]);
+		}
+	}
 
-	char *line = NULL;
-	size_t len = 0;
-	ssize_t read;
+	// bounding sphere around the box center
+	float center[3];
+	for (int i = 0; i < 3; i++) center[i] = 0.5f * (box_min[i] + box_max[i]);
 
-	while ((read = getline(&line, &len, in_obj)) != -1) {
-		if (read == 0) continue;
-		if (line[0] == 'v' && line[1] == ' ') {
-		    vertex_count++;
-		} else if (line[0] == 'f' && line[1] == ' ') {
-		    face_count++;
+	float radius2 = 0.0f;
+	for (size_t i = 0; i < obj.v_count; i++) {
+		const float* p = obj.v[i].arr;
+		float dx = p[0] - center[0], dy = p[1] - center[1], dz = p[2] - center[2];
+		radius2 = fmaxf(radius2, dx*dx + dy*dy + dz*dz);
+	}
+
+	// Level 0 is the imported mesh, every further one is simplified from it
+	// to half the faces of the one before. The chain ends once a level is
+	// small or the simplifier can't get close to the target anymore.
+	Lod    lods[MESH_FILE_LOD_MAX] = {0};
+	size_t lod_count = 0;
+
+	V3f* v0 = malloc((obj.v_count + 1) * sizeof *v0);
+	V3u* f0 = malloc((obj.f_count + 1) * sizeof *f0);
+	if (v0 && f0) {
+		memcpy(v0, obj.v, obj.v_count * sizeof *v0);
+		memcpy(f0, obj.f, obj.f_count * sizeof *f0);
+	}
+	bool built = v0 && f0 && lod_finish(&lods[lod_count++], v0, obj.v_count, f0, obj.f_count, 0.0f);
+	if (!v0 || !f0) {
+		free(v0);
+		free(f0);
+	}
+
+	while (built && binary && lod_count < MESH_FILE_LOD_MAX) {
+		size_t target = lods[lod_count - 1].f_count / 2;
+		if (target < LOD_MIN_FACES) break;
+
+		V3f* v = malloc((obj.v_count + 1) * sizeof *v);
+		V3u* f = malloc((obj.f_count + 1) * sizeof *f);
+		if (!v || !f) {
+			free(v);
+			free(f);
+			break;
+		}
+		memcpy(v, obj.v, obj.v_count * sizeof *v);
+
+		float  error;
+		size_t f_count = simplify(f, obj.v, obj.v_count, obj.f, obj.f_count, target, INFINITY, &error);
+		if (f_count > target + target / 2) {
+			free(v);
+			free(f);
+			break;
 		}
+
+		// coarser levels never claim to be closer to the surface
+		error = fmaxf(error, lods[lod_count - 1].error);
+		if (!lod_finish(&lods[lod_count], v, obj.v_count, f, f_count, error)) {
+			lod_free(&lods[lod_count]);
+			break;
+		}
+		lod_count++;
+	}
+
+	if (!built) fprintf(stderr, "Failed to build the meshlets.\n");
+	for (size_t i = 0; i < lod_count; i++) {
+		fprintf(stderr, "level %zu: %zu vertices, %zu faces, %zu meshlets, error %f\n", i,
+			lods[i].v_count, lods[i].f_count, lods[i].meshlets.m_count, lods[i].error);
+	}
+
+	if (binary) {
+		bool written = built && mesh_file_write(mesh_file, lods, lod_count, box_min, box_max,
+							center, sqrtf(radius2) + 1e-5f);
+		if (!written) fprintf(stderr, "Failed to write %s.\n", mesh_file);
+
+		for (size_t i = 0; i < lod_count; i++) lod_free(&lods[i]);
+		free(base_dup);
+		obj_free(&obj);
+		return written ? EXIT_SUCCESS : EXIT_FAILURE;
 	}
 
+	// the header only gets level 0
+	size_t    vertex_count = lods[0].v_count;
+	size_t    face_count   = lods[0].f_count;
+	float*    positions    = lods[0].v ? lods[0].v[0].arr : NULL;
+	Meshlets  meshlets     = lods[0].meshlets;
+
 	// prepare header
 	fprintf(out_h, "// This asset was automatically generated by objToC.\n\n");
 	fprintf(out_h, "#ifndef %s\n#define %s\n\n", guard, guard);
@@ -80,92 +541,74 @@ int main(int argc, char **argv) {
 	fprintf(out_h, "typedef struct {\n");
 	fprintf(out_h, "\tsize_t v_count;\n");
 	fprintf(out_h, "\tsize_t f_count;\n");
+	fprintf(out_h, "\tV3f aabb_min;\n");
+	fprintf(out_h, "\tV3f aabb_max;\n");
+	fprintf(out_h, "\tV3f center;\n");
+	fprintf(out_h, "\tfloat radius;\n");
 	fprintf(out_h, "\tV3f v[%zu];\n", vertex_count);
+	fprintf(out_h, "\tsize_t m_count;\n");
+	fprintf(out_h, "\tsize_t mv_count;\n");
 	fprintf(out_h, "\tV3u f[%zu];\n", face_count);
+	fprintf(out_h, "\tMeshlet m[%zu];\n", meshlets.m_count);
+	fprintf(out_h, "\tuint32_t mv[%zu];\n", meshlets.mv_count);
+	fprintf(out_h, "\tuint8_t mt[%zu][3];\n", face_count);
 	fprintf(out_h, "} %s;\n\n", type_name);
 
 	fprintf(out_h, "static const %s asset_%s = {\n", type_name, base);
 	fprintf(out_h, "\t.v_count = %zu,\n", vertex_count);
 	fprintf(out_h, "\t.f_count = %zu,\n", face_count);
+	fprintf(out_h, "\t.aabb_min = {{ %f, %f, %f }},\n", box_min[0], box_min[1], box_min[2]);
+	fprintf(out_h, "\t.aabb_max = {{ %f, %f, %f }},\n", box_max[0], box_max[1], box_max[2]);
+	fprintf(out_h, "\t.center = {{ %f, %f, %f }},\n", center[0], center[1], center[2]);
+	// rounded up so the printed value still encloses every vertex
+	fprintf(out_h, "\t.radius = %f,\n", sqrtf(radius2) + 1e-5f);
+	fprintf(out_h, "\t.m_count = %zu,\n", meshlets.m_count);
+	fprintf(out_h, "\t.mv_count = %zu,\n", meshlets.mv_count);
+
+	// enough digits to give back the same floats
+	fprintf(out_h, "\t.v = {\n");
+	for (size_t i = 0; i < vertex_count; i++) {
+		const float* p = &positions[3 * i];
+		fprintf(out_h, "\t\t{{ %.9g, %.9g, %.9g }}%s\n", p[0], p[1], p[2], i + 1 < vertex_count ? "," : "");
+	}
+	fprintf(out_h, "\t},\n");
 
-	// second pass: output data
-	rewind(in_obj);
-
-	size_t count = 0;
-	while ((read = getline(&line, &len, in_obj)) != -1) {
-
-		if (read == 0) continue;
-
-		if (line[0] == 'v' && line[1] == ' ') {
-
-			if (count == 0) fprintf(out_h, "\t.v = {\n");
-
-			char* buf = strdup(line);
-			if (!buf) {
-				perror("strdup");
-				break;
-			}
-
-			char* tok0 = strtok(buf,  " \n\t");
-			char* tok1 = strtok(NULL, " \n\t");
-			char* tok2 = strtok(NULL, " \n\t");
-			char* tok3 = strtok(NULL, " \n\t");
-
-			if (!tok1 || !tok2 || !tok3) {
-				fprintf(stderr, "Malformed vertex line: %s", line);
-				free(buf);
-				continue;
-			}
-
-			if (count < vertex_count - 1) {
-				fprintf(out_h, "\t\t{{ %s, %s, %s }},\n", tok1, tok2, tok3);
-				count += 1;
-			} else {
-				fprintf(out_h, "\t\t{{ %s, %s, %s }}\n", tok1, tok2, tok3);
-				fprintf(out_h, "\t},\n");
-				count = 0;
-			}
-
-			free(buf);
-
-		} else if (line[0] == 'f' && line[1] == ' ') {
-
-			if (count == 0) fprintf(out_h, "\t.f = {\n");
-
-			char* buf = strdup(line);
-			if (!buf) {
-				perror("strdup");
-				break;
-			}
-
-			char* tok0 = strtok(buf,  " \n\t");
-			char* tok1 = strtok(NULL, " \n\t");
-			char* tok2 = strtok(NULL, " \n\t");
-			char* tok3 = strtok(NULL, " \n\t");
-
-			if (strchr(tok1, '/')) {
-				tok1 = strtok(tok1, "/");
-				tok2 = strtok(tok2, "/");
-				tok3 = strtok(tok3, "/");
-			}
+	fprintf(out_h, "\t.f = {\n");
+	for (size_t i = 0; i < face_count; i++) {
+		V3u f = lods[0].f[i];
+		fprintf(out_h, "\t\t{{ %u, %u, %u }}%s\n", f.x, f.y, f.z, i + 1 < face_count ? "," : "");
+	}
+	fprintf(out_h, "\t},\n");
+
+	// meshlets, their vertices as 1-based indices into v like f and their triangles
+	fprintf(out_h, "\t.m = {\n");
+	for (size_t i = 0; i < meshlets.m_count; i++) {
+		const Meshlet* m = &meshlets.m[i];
+		fprintf(out_h, "\t\t{ %u, %u, %u, %u, {{ %f, %f, %f }}, %f, {{ %f, %f, %f }}, %f },\n",
+			m->v_offset, m->v_count, m->t_offset, m->t_count,
+			m->center[0], m->center[1], m->center[2], m->radius,
+			m->cone_axis[0], m->cone_axis[1], m->cone_axis[2], m->cone_cutoff);
+	}
+	fprintf(out_h, "\t},\n");
 
-			if (count < face_count - 1) {
-				fprintf(out_h, "\t\t{{ %s, %s, %s }},\n", tok1, tok2, tok3);
-				count += 1;
-			} else {
-				fprintf(out_h, "\t\t{{ %s, %s, %s }}\n", tok1, tok2, tok3);
-				fprintf(out_h, "\t}\n");
-				count = 0;
-			}
+	fprintf(out_h, "\t.mv = {");
+	for (size_t i = 0; i < meshlets.mv_count; i++) {
+		fprintf(out_h, "%s%u,", i % 16 ? " " : "\n\t\t", meshlets.mv[i] + 1);
+	}
+	fprintf(out_h, "\n\t},\n");
 
-			free(buf);
-		}
+	fprintf(out_h, "\t.mt = {");
+	for (size_t i = 0; i < face_count && meshlets.mt; i++) {
+		const unsigned char* t = &meshlets.mt[3 * i];
+		fprintf(out_h, "%s{ %u, %u, %u },", i % 8 ? " " : "\n\t\t", t[0], t[1], t[2]);
 	}
+	fprintf(out_h, "\n\t}\n");
 
 	fprintf(out_h, "};\n\n#endif /* %s */\n", guard);
 
-	free(line);
-	fclose(in_obj);
+	lod_free(&lods[0]);
+	free(base_dup);
+	obj_free(&obj);
 	fclose(out_h);
 	return EXIT_SUCCESS;
 }
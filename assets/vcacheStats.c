@@ -0,0 +1,63 @@
+// gcc -o xvcachestats vcacheStats.c ../src/obj.c ../src/jobs.c ../src/vcache.c -lm -pthread
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../inc/obj.h"
+#include "../inc/vcache.h"
+
+// Reports how many vertex transforms the face order of an .obj file costs
+// through FIFO caches of a few sizes, as in the file and after the
+// optimization objToC applies.
+
+static const uint32_t cache_sizes[] = { 8, 16, 32 };
+
+static void report(const char* label, const ObjMesh* obj) {
+
+	printf("%-10s", label);
+	for (size_t i = 0; i < sizeof cache_sizes / sizeof *cache_sizes; i++) {
+		VcacheStats s = vcache_analyze(obj->f, obj->f_count, obj->v_count, cache_sizes[i]);
+		printf("  acmr %5.3f atvr %5.3f", s.acmr, s.atvr);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s file.obj\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Jobs* jobs = calloc(1, sizeof *jobs);
+	long  cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	ObjMesh obj;
+	if (!jobs || !jobs_create(jobs, cpus > 0 ? (uint32_t) cpus : 1) || !obj_load(&obj, argv[1], 0, jobs)) {
+		fprintf(stderr, "Failed to load %s.\n", argv[1]);
+		free(jobs);
+		return EXIT_FAILURE;
+	}
+	jobs_destroy(jobs);
+	free(jobs);
+
+	printf("%s: %zu vertices, %zu faces\n%-10s", argv[1], obj.v_count, obj.f_count, "");
+	for (size_t i = 0; i < sizeof cache_sizes / sizeof *cache_sizes; i++) {
+		char column[32];
+		snprintf(column, sizeof column, "cache %u", cache_sizes[i]);
+		printf("  %-21s", column);
+	}
+	printf("\n");
+
+	report("file", &obj);
+	if (!vcache_optimize(obj.f, obj.f_count, obj.v_count) ||
+	    !vfetch_optimize(obj.v, obj.v_count, obj.f, obj.f_count)) {
+		fprintf(stderr, "Failed to optimize %s.\n", argv[1]);
+		obj_free(&obj);
+		return EXIT_FAILURE;
+	}
+	report("optimized", &obj);
+
+	obj_free(&obj);
+	return EXIT_SUCCESS;
+}
@@ -1,12 +1,34 @@
 #!/bin/bash
 
+# add -DTRACE for the timing markers of inc/trace.h, see -T
+
 gcc -o xsrend \
-	src/main.c src/camera.c src/text.c\
+	src/main.c src/camera.c src/text.c src/raster.c src/framebuffer.c src/binner.c src/jobs.c src/mesh.c src/vertex.c src/clip.c src/cull.c src/render.c src/trace.c\
 	lib/libSDL2.a \
 	-g -fsanitize=address \
-	-lm \
+	-lm -pthread \
+	-Wall -Wextra -Wfloat-equal -Wshadow -Wpointer-arith \
+	-Wcast-align -Wstrict-prototypes -Wwrite-strings \
+	-Wswitch-default -Winit-self -Wold-style-definition \
+	-Wno-format-truncation -Wformat \
+	-O3\
+
+# headless benchmark, no SDL and no sanitizers so the timings mean something
+gcc -o xbench \
+	src/bench.c src/camera.c src/raster.c src/framebuffer.c src/binner.c src/jobs.c src/mesh.c src/vertex.c src/clip.c src/cull.c src/render.c src/trace.c\
+	-lm -pthread \
+	-Wall -Wextra -Wfloat-equal -Wshadow -Wpointer-arith \
+	-Wcast-align -Wstrict-prototypes -Wwrite-strings \
+	-Wswitch-default -Winit-self -Wold-style-definition \
+	-Wno-format-truncation -Wformat \
+	-O3
+
+# golden image regression, compares fixed frames against assets/golden
+gcc -o xgolden \
+	src/golden.c src/camera.c src/raster.c src/framebuffer.c src/binner.c src/jobs.c src/mesh.c src/vertex.c src/clip.c src/cull.c src/render.c src/trace.c\
+	-lm -pthread \
 	-Wall -Wextra -Wfloat-equal -Wshadow -Wpointer-arith \
 	-Wcast-align -Wstrict-prototypes -Wwrite-strings \
 	-Wswitch-default -Winit-self -Wold-style-definition \
 	-Wno-format-truncation -Wformat \
-	-march=native -O3\
+	-O3
@@ -0,0 +1,66 @@
+#ifndef BINNER_H
+#define BINNER_H
+
+#include "./lalg.h"
+#include "./color.h"
+#include "./framebuffer.h"
+#include "./raster.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// screen tiles the sort-middle rasterizer distributes across threads
+#define BIN_TILE_BITS 6
+#define BIN_TILE_SIZE (1 << BIN_TILE_BITS)
+
+typedef enum {
+	PRIMITIVE_LINE,
+	PRIMITIVE_TRIANGLE
+} PrimitiveType;
+
+// screen space primitive, z holds the value for the depth buffer
+typedef struct {
+	V3f      v[3];
+	Color    color;
+	uint32_t type;
+} Primitive;
+
+typedef struct {
+	uint32_t* items;
+	uint32_t  count;
+	uint32_t  capacity;
+} Bin;
+
+// every producer owns its primitives and bins, so binning takes no locks
+typedef struct {
+	Primitive* prims;
+	size_t     prim_count;
+	size_t     prim_capacity;
+	size_t     line_count;
+	size_t     triangle_count;
+	size_t     dropped_count;  // primitives missing from some bins, out of memory
+	Bin*       bins;
+} BinSet;
+
+typedef struct {
+	uint32_t    width;
+	uint32_t    height;
+	uint32_t    tiles_x;
+	uint32_t    tiles_y;
+	uint32_t    set_count;
+	BinSet*     sets;
+} Binner;
+
+bool binner_create(Binner* b, uint32_t width, uint32_t height, uint32_t producers);
+void binner_destroy(Binner* b);
+void binner_reset(Binner* b);
+// false when memory ran out and the primitive is missing from some or all of
+// its tiles, binner_dropped_count counts those
+bool binner_line_add(Binner* b, uint32_t producer, V3f start, V3f end, Color color);
+bool binner_triangle_add(Binner* b, uint32_t producer, V3f v1, V3f v2, V3f v3, Color color);
+void binner_tile_raster(Binner* b, Framebuffer* fb, uint32_t tile, OcclusionStats* stats, PipelineStats* pipeline);
+size_t binner_line_count(const Binner* b);
+size_t binner_triangle_count(const Binner* b);
+size_t binner_dropped_count(const Binner* b);
+
+#endif
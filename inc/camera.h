@@ -16,7 +16,16 @@ typedef struct {
 
 void camera_default_set(Camera* c);
 void camera_update_mouse(Camera* camera, V2f rel);
+// target must not lie straight above or below position
+void camera_look_at(Camera* c, V3f position, V3f target);
 void camera_info_print(Camera camera);
 
+// focal length for a screen two units tall, from fovy
+float camera_focal_get(Camera camera);
+// world to view space, x right, y up, z along forward
+M4f camera_view_get(Camera camera);
+// view to clip space, w is the view depth and z / w the depth buffer value depth_scale / w + depth_bias
+M4f camera_projection_get(Camera camera, float aspect, float depth_scale, float depth_bias);
+
 #endif
 
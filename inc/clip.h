@@ -0,0 +1,78 @@
+#ifndef CLIP_H
+#define CLIP_H
+
+#include "./lalg.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Outcodes of a clip space position, one bit per plane. The side planes
+// bound the viewport and are used for trivial rejection, the guard band
+// planes bound the range the rasterizer handles by scissoring alone.
+enum {
+	CLIP_NEAR         = 1 << 0,
+	CLIP_FAR          = 1 << 1,
+	CLIP_LEFT         = 1 << 2,
+	CLIP_RIGHT        = 1 << 3,
+	CLIP_TOP          = 1 << 4,
+	CLIP_BOTTOM       = 1 << 5,
+	CLIP_GUARD_LEFT   = 1 << 6,
+	CLIP_GUARD_RIGHT  = 1 << 7,
+	CLIP_GUARD_TOP    = 1 << 8,
+	CLIP_GUARD_BOTTOM = 1 << 9,
+	CLIP_PLANES       = 10
+};
+
+#define CLIP_FRUSTUM (CLIP_NEAR | CLIP_FAR | CLIP_LEFT | CLIP_RIGHT | CLIP_TOP | CLIP_BOTTOM)
+#define CLIP_GUARD   (CLIP_GUARD_LEFT | CLIP_GUARD_RIGHT | CLIP_GUARD_TOP | CLIP_GUARD_BOTTOM)
+
+// a triangle clipped against six planes has at most 3 + 6 vertices
+#define CLIP_POLY_MAX 9
+
+typedef struct {
+	float znear;
+	float zfar;
+	float guard_x;  // guard band half extent relative to the viewport, >= 1
+	float guard_y;
+} ClipPlanes;
+
+// Signed distance to one plane, negative outside. w is the view depth, the
+// side planes are |x| <= w and |y| <= w, the guard band |x| <= guard_x * w.
+static inline float clip_plane_dist(V4f p, uint32_t plane, const ClipPlanes* c) {
+
+	switch (plane) {
+	case CLIP_NEAR:         return p.w - c->znear;
+	case CLIP_FAR:          return c->zfar - p.w;
+	case CLIP_LEFT:         return p.w + p.x;
+	case CLIP_RIGHT:        return p.w - p.x;
+	case CLIP_TOP:          return p.w - p.y;
+	case CLIP_BOTTOM:       return p.w + p.y;
+	case CLIP_GUARD_LEFT:   return c->guard_x * p.w + p.x;
+	case CLIP_GUARD_RIGHT:  return c->guard_x * p.w - p.x;
+	case CLIP_GUARD_TOP:    return c->guard_y * p.w - p.y;
+	case CLIP_GUARD_BOTTOM: return c->guard_y * p.w + p.y;
+	default:                return 0.0f;
+	}
+}
+
+static inline uint32_t clip_outcode(V4f p, const ClipPlanes* c) {
+
+	uint32_t res = 0;
+
+	for (uint32_t i = 0; i < CLIP_PLANES; i++) {
+		if (clip_plane_dist(p, 1u << i, c) < 0.0f) res |= 1u << i;
+	}
+
+	return res;
+}
+
+// Parametric clip of the segment a -> b against the planes set in planes.
+// Returns false if nothing is left.
+bool clip_line(V4f* a, V4f* b, uint32_t planes, const ClipPlanes* c);
+
+// Sutherland–Hodgman clip of the convex polygon poly (n vertices, room for
+// CLIP_POLY_MAX) against the planes set in planes, at most six of them.
+// Returns the new vertex count.
+size_t clip_polygon(V4f* poly, size_t n, uint32_t planes, const ClipPlanes* c);
+
+#endif
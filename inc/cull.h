@@ -0,0 +1,61 @@
+#ifndef CULL_H
+#define CULL_H
+
+#include "./vertex.h"
+#include "./mesh.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+	CULL_NONE,
+	CULL_BACK,
+	CULL_FRONT,
+	CULL_MODE_COUNT
+} CullMode;
+
+// what the culling stage decided for a face
+enum {
+	FACE_VISIBLE,
+	FACE_CULLED_FACING,
+	FACE_CULLED_DEGENERATE,
+	FACE_CULLED_MESHLET    // its whole meshlet was culled
+};
+
+// what the cluster test decided for a meshlet
+enum {
+	MESHLET_VISIBLE,
+	MESHLET_CULLED_FRUSTUM,
+	MESHLET_CULLED_FACING
+};
+
+typedef struct {
+	size_t facing;
+	size_t degenerate;
+	size_t meshlets_frustum;
+	size_t meshlets_facing;
+} CullStats;
+
+// World space planes of the view frustum as (normal, offset), inside where
+// dot(normal, p) + offset >= 0. Same planes as the CLIP_FRUSTUM outcodes.
+typedef struct {
+	V4f planes[6];
+} Frustum;
+
+const char* cull_mode_name(CullMode mode);
+
+void frustum_from_transform(Frustum* f, const VertexTransform* t);
+// conservative tests, true only if the volume is completely outside one plane
+bool frustum_sphere_outside(const Frustum* f, V3f center, float radius);
+bool frustum_aabb_outside(const Frustum* f, V3f aabb_min, V3f aabb_max);
+
+// Whole meshlet against the frustum and, by its normal cone, against the
+// facing test of face_cull as seen from eye. Conservative like the frustum tests.
+uint8_t meshlet_cull(const Meshlet* m, const Frustum* f, V3f eye, CullMode mode);
+
+// Front faces are counter-clockwise as seen by the camera, like in .obj files.
+// Faces fully in front of the near plane are decided by their snapped screen
+// area, the others by the sign of their homogeneous determinant.
+uint8_t face_cull(const PostVertex* a, const PostVertex* b, const PostVertex* c, CullMode mode);
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+	DEPTH_F32,          // float in [0, 1], near = 0
+	DEPTH_U24,          // 24 bit fixed point, near = 0
+	DEPTH_F32_REVERSED, // float in [0, 1], near = 1, best precision far away
+	DEPTH_FORMAT_COUNT
+} DepthFormat;
+
+typedef struct {
+	DepthFormat format;
+	union {
+		float*    f32;
+		uint32_t* u24;
+	};
+	// maps view space z to the stored depth: d = scale / z + bias
+	float scale;
+	float bias;
+} DepthBuffer;
+
+// coarse depth, one farthest depth key per tile
+#define HIZ_TILE_BITS 3
+#define HIZ_TILE_SIZE (1 << HIZ_TILE_BITS)
+
+typedef struct {
+	float*   max;
+	uint8_t* dirty;   // tile was written since max was computed, max is only an upper bound
+	uint32_t tiles_x;
+	uint32_t tiles_y;
+} HiZ;
+
+typedef struct {
+	size_t fragments_rejected; // failed the per-pixel early depth test
+	size_t tiles_rejected;     // skipped by the hierarchical depth test
+	size_t triangles_rejected; // every covered tile was occluded
+} OcclusionStats;
+
+typedef struct {
+	uint32_t*      color;
+	DepthBuffer    depth;
+	HiZ            hiz;
+	OcclusionStats occlusion;
+	uint16_t*      overdraw;  // fragments per pixel, only counted while not NULL
+	uint32_t       width;
+	uint32_t       height;
+} Framebuffer;
+
+static const uint32_t DEPTH_U24_MAX = 0x00FFFFFF;
+
+bool framebuffer_init(Framebuffer* fb, uint32_t* color, uint32_t width, uint32_t height, DepthFormat format);
+void framebuffer_free(Framebuffer* fb);
+void framebuffer_clear(Framebuffer* fb);
+void framebuffer_clear_rows(Framebuffer* fb, uint32_t y_begin, uint32_t y_end);
+// allocates a cleared overdraw buffer, or frees it so the rasterizer stops counting
+bool framebuffer_overdraw_set(Framebuffer* fb, bool on);
+void depth_range_set(DepthBuffer* db, float znear, float zfar);
+const char* depth_format_name(DepthFormat format);
+void hiz_tile_refresh(Framebuffer* fb, size_t tile);
+bool hiz_rect_occluded(Framebuffer* fb, int32_t x_min, int32_t y_min, int32_t x_max, int32_t y_max, float near_key);
+
+static inline float depth_from_view_z(const DepthBuffer* db, float z) {
+
+	return db->scale / z + db->bias;
+}
+
+// Early depth test: returns true and stores d if the fragment is visible.
+static inline bool depth_test_write(DepthBuffer* db, size_t i, float d) {
+
+	switch (db->format) {
+	case DEPTH_F32:
+		if (!(d < db->f32[i])) return false;
+		db->f32[i] = d;
+		return true;
+	case DEPTH_U24: {
+		uint32_t q = d <= 0.0f ? 0 : d >= (float) DEPTH_U24_MAX ? DEPTH_U24_MAX : (uint32_t) d;
+		if (!(q < db->u24[i])) return false;
+		db->u24[i] = q;
+		return true;
+	}
+	case DEPTH_F32_REVERSED:
+		if (!(d > db->f32[i])) return false;
+		db->f32[i] = d;
+		return true;
+	default:
+		return true;
+	}
+}
+
+// orders the depths of every format so that smaller means closer
+static inline float depth_key(DepthFormat format, float d) {
+
+	return format == DEPTH_F32_REVERSED ? -d : d;
+}
+
+// A fragment no closer than near_key can't pass the depth test anywhere in
+// the tile. Stale tiles are only refreshed when the bound isn't good enough.
+static inline bool hiz_tile_occluded(Framebuffer* fb, size_t tile, float near_key) {
+
+	if (near_key >= fb->hiz.max[tile]) return true;
+	if (!fb->hiz.dirty[tile]) return false;
+
+	hiz_tile_refresh(fb, tile);
+	return near_key >= fb->hiz.max[tile];
+}
+
+#endif
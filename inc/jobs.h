@@ -0,0 +1,85 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#define JOB_DEQUE_SIZE     4096
+#define JOB_MAX_SUCCESSORS 8
+#define JOB_ARENA_SIZE     4096
+#define JOB_LOG_SIZE       4096
+
+// a job covers the range [begin, end) of whatever its fn iterates over
+typedef void (*JobFn)(void* arg, size_t begin, size_t end);
+
+typedef struct Job {
+	JobFn        fn;
+	void*        arg;
+	size_t       begin;
+	size_t       end;
+	const char*  name;
+	size_t       chunks;      // > 0 turns the job into a stage that spawns chunks children
+	struct Job*  parent;      // stage this job is a chunk of
+	atomic_int   pending;     // own execution plus unfinished children
+	atomic_int   deps;        // unfinished jobs this one waits for
+	atomic_bool  done;
+	struct Job*  successors[JOB_MAX_SUCCESSORS];
+	uint32_t     successor_count;
+} Job;
+
+typedef struct {
+	const char* name;
+	uint32_t    thread;
+	uint64_t    start_ns;
+	uint64_t    end_ns;
+} JobTiming;
+
+// Chase-Lev work-stealing deque: the owner pushes and pops at the bottom,
+// everyone else steals from the top.
+typedef struct {
+	atomic_llong  top;
+	atomic_llong  bottom;
+	_Atomic(Job*) buffer[JOB_DEQUE_SIZE];
+} JobDeque;
+
+typedef struct {
+	JobTiming records[JOB_LOG_SIZE];
+	size_t    count;
+} JobLog;
+
+typedef struct {
+	pthread_t*      threads;
+	uint32_t        count;    // threads including the main thread
+	atomic_uint     active;   // threads above this index are parked
+	JobDeque*       deques;
+	JobLog*         logs;
+	Job             arena[JOB_ARENA_SIZE];
+	atomic_size_t   arena_used;
+	pthread_mutex_t lock;
+	pthread_cond_t  wake;
+	atomic_uint     sleepers; // active threads waiting for work
+	atomic_bool     quit;
+} Jobs;
+
+bool jobs_create(Jobs* j, uint32_t count);
+void jobs_destroy(Jobs* j);
+void jobs_active_set(Jobs* j, uint32_t active);
+uint32_t jobs_thread_index(void);
+
+// all jobs of a frame live in an arena, reset it once nothing is running anymore
+void jobs_frame_reset(Jobs* j);
+Job* jobs_add(Jobs* j, const char* name, JobFn fn, void* arg, size_t begin, size_t end);
+Job* jobs_parallel_for(Jobs* j, const char* name, JobFn fn, void* arg, size_t begin, size_t end, size_t chunks);
+void jobs_depend(Job* before, Job* after);
+void jobs_submit(Jobs* j, Job* job);
+void jobs_wait(Jobs* j, Job* job);
+
+// per job timing of the current frame
+uint64_t jobs_time_ns(void);  // monotonic clock the timings are taken with
+size_t jobs_timings(const Jobs* j, uint32_t thread, const JobTiming** records);
+double jobs_stage_ms(const Jobs* j, const char* name);
+double jobs_busy_ms(const Jobs* j, uint32_t thread);
+
+#endif
@@ -31,6 +31,16 @@ typedef union {
 	float arr[3];
 } V3f;
 
+typedef union {
+	struct {
+		float x;
+		float y;
+		float z;
+		float w;
+	};
+	float arr[4];
+} V4f;
+
 typedef union {
 	struct {
 		uint32_t x;
@@ -40,6 +50,15 @@ typedef union {
 	uint32_t arr[3];
 } V3u;
 
+// structure of arrays stream of quantized positions, the arrays are padded
+// so batch kernels may read a full vector past the last vertex
+typedef struct {
+	uint16_t* x;
+	uint16_t* y;
+	uint16_t* z;
+	size_t    count;
+} V3qSoA;
+
 typedef struct {
 	V3f v1;
 	V3f v2;
@@ -67,6 +86,16 @@ typedef union {
 	float arr[9];
 } M3f;
 
+typedef union {
+	struct {
+		float m00, m01, m02, m03;
+		float m10, m11, m12, m13;
+		float m20, m21, m22, m23;
+		float m30, m31, m32, m33;
+	};
+	float arr[16];
+} M4f;
+
 static inline V2u v2s_to_v2u(V2s a) {
 
 	V2u res = {0};
@@ -152,6 +181,57 @@ static inline V3f mul_m3f_v3f(M3f m, V3f a) {
 	return res;
 }
 
+static inline M4f id_4f() {
+
+	M4f res = {0};
+
+	res = (M4f) {{
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	}};
+
+	return res;
+}
+
+static inline V4f mul_m4f_v4f(M4f m, V4f a) {
+
+	V4f res = {0};
+
+	for (size_t i = 0; i < 4; i++) {
+	for (size_t j = 0; j < 4; j++) {
+		res.arr[i] += m.arr[i + j*4] * a.arr[j];
+	}}
+
+	return res;
+}
+
+static inline M4f mul_m4f(M4f a, M4f b) {
+
+	M4f res = {0};
+
+	for (size_t i = 0; i < 4; i++) {
+	for (size_t j = 0; j < 4; j++) {
+	for (size_t k = 0; k < 4; k++) {
+		res.arr[i + j*4] += a.arr[i + k*4] * b.arr[k + j*4];
+	}}}
+
+	return res;
+}
+
+static inline V4f lerp_4f(V4f a, V4f b, float t) {
+
+	V4f res = {0};
+
+	res.x = a.x + t * (b.x - a.x);
+	res.y = a.y + t * (b.y - a.y);
+	res.z = a.z + t * (b.z - a.z);
+	res.w = a.w + t * (b.w - a.w);
+
+	return res;
+}
+
 static inline V3f cross_3f(V3f a, V3f b) {
 
 	V3f res = {
@@ -0,0 +1,111 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include "./lalg.h"
+#include "./camera.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MESHLET_MAX_VERTICES  64
+#define MESHLET_MAX_TRIANGLES 124
+// levels of detail of one asset
+#define MESH_LOD_MAX          8
+// share of the pixel error a level has to pass it by before it is switched
+#define MESH_LOD_HYSTERESIS   0.25f
+
+// Cluster of neighbouring faces built offline by objToC. The bounding sphere
+// and the normal cone let whole clusters be culled before their vertices are
+// transformed.
+typedef struct {
+	uint32_t v_offset;    // first vertex in mv
+	uint32_t v_count;
+	uint32_t t_offset;    // first triangle in mt
+	uint32_t t_count;
+	V3f      center;
+	float    radius;
+	V3f      cone_axis;   // average face normal
+	float    cone_cutoff; // sine of the cone's half angle, 1 if the cone is too wide to cull
+} Meshlet;
+
+// Indexed triangle mesh, face and edge indices start at 1 like in .obj files.
+// Positions are quantized to the bounds of the asset and indices take 16 bits
+// if the vertices they address allow it, see mesh_face.
+typedef struct {
+	size_t     v_count;
+	size_t     f_count;
+	size_t     e_count;
+	V3f        aabb_min;  // bounds from objToC
+	V3f        aabb_max;
+	V3f        center;
+	float      radius;
+	float      error;     // object space distance to the surface of level 0 of its asset
+	V3f        q_offset;  // a stored position p decodes to q_offset + q_scale * p
+	V3f        q_scale;
+	uint32_t   index_size; // bytes per index of f and mv, 2 or 4
+	const uint16_t (*v)[3];
+	const void* f;
+	V2u*       e;   // unique edges, built by mesh_edges_build
+	V2u*       e2;  // the same edges as the second face sees them, meshlets duplicate border vertices
+	V2u*       ef;  // the up to two faces of each edge, 0 if there is none
+
+	size_t          m_count;
+	size_t          mv_count;
+	const Meshlet*  m;
+	const void*     mv;       // vertex in v of each meshlet vertex
+	const uint8_t   (*mt)[3]; // meshlet local vertices of each meshlet triangle
+	uint16_t        (*cv)[3]; // meshlet vertices, built by mesh_meshlets_unpack
+	void*           cf;       // meshlet triangles as faces indexing cv, in meshlet order
+	uint32_t        cf_index_size;
+} Mesh;
+
+static inline uint32_t index_get(const void* indices, uint32_t index_size, size_t i) {
+
+	return index_size == 2 ? ((const uint16_t*) indices)[i] : ((const uint32_t*) indices)[i];
+}
+
+static inline V3u mesh_face(const Mesh* mesh, size_t i) {
+
+	return (V3u) {{ index_get(mesh->f, mesh->index_size, 3 * i + 0),
+			index_get(mesh->f, mesh->index_size, 3 * i + 1),
+			index_get(mesh->f, mesh->index_size, 3 * i + 2) }};
+}
+
+static inline V3u mesh_cface(const Mesh* mesh, size_t i) {
+
+	return (V3u) {{ index_get(mesh->cf, mesh->cf_index_size, 3 * i + 0),
+			index_get(mesh->cf, mesh->cf_index_size, 3 * i + 1),
+			index_get(mesh->cf, mesh->cf_index_size, 3 * i + 2) }};
+}
+
+// LOD chain of one asset, lod[0] is the full mesh and every further level
+// has about half the faces of the one before
+typedef struct {
+	Mesh   lod[MESH_LOD_MAX];
+	size_t lod_count;
+	void*  map;       // file the const arrays point into, see mesh_load
+	size_t map_size;
+} MeshLods;
+
+// Edges of cf if the meshlets are unpacked, of f otherwise. Vertices shared
+// by two meshlets still make a single edge.
+bool mesh_edges_build(Mesh* mesh);
+void mesh_edges_free(Mesh* mesh);
+
+bool mesh_meshlets_unpack(Mesh* mesh);
+// frees everything built at runtime
+void mesh_free(Mesh* mesh);
+
+// Maps a mesh file written by objToC -b. The arrays are used in place after
+// one pass checks every index and meshlet range. Release it with mesh_unload.
+bool mesh_load(MeshLods* lods, const char* path);
+void mesh_unload(MeshLods* lods);
+
+// Coarsest level whose error projects to at most pixel_error pixels on a
+// screen height pixels tall, seen from the camera. To avoid flipping back and
+// forth, the level only gets coarser below pixel_error * (1 - hysteresis) and
+// finer above pixel_error * (1 + hysteresis).
+size_t mesh_lod_select(const MeshLods* lods, size_t current, Camera camera, uint32_t height,
+		       float pixel_error, float hysteresis);
+
+#endif
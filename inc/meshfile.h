@@ -0,0 +1,73 @@
+#ifndef MESHFILE_H
+#define MESHFILE_H
+
+#include <stdint.h>
+
+// Binary mesh container written by objToC -b and mapped by mesh_load. The
+// blocks are stored exactly like the arrays of Mesh, native byte order, so
+// loading is a single mmap without parsing. Only used by objToC and mesh.c,
+// it must not depend on anything else of the renderer.
+
+#define MESH_FILE_MAGIC   "SRMF"
+#define MESH_FILE_VERSION 3
+// every block starts at a multiple of this, a cache line
+#define MESH_FILE_ALIGN   64
+// levels of detail in one file, must match MESH_LOD_MAX
+#define MESH_FILE_LOD_MAX 8
+
+// how v is stored
+enum {
+	MESH_FILE_POSITION_U16     // three uint16_t on a grid spanning aabb_min to aabb_max
+};
+
+// how f and mv are stored, 1-based like in .obj files
+enum {
+	MESH_FILE_INDEX_U32,       // uint32_t
+	MESH_FILE_INDEX_U16        // uint16_t, only if every level has fewer than 65536 vertices
+};
+
+typedef struct {
+	uint64_t offset;  // from the start of the file, a multiple of MESH_FILE_ALIGN
+	uint64_t size;    // in bytes
+} MeshFileBlock;
+
+// one level of detail, each has its own vertices and meshlets
+typedef struct {
+	uint32_t v_count;
+	uint32_t f_count;
+	uint32_t m_count;
+	uint32_t mv_count;
+	float    error;     // object space distance to the surface of level 0
+	uint32_t reserved;
+
+	MeshFileBlock v;   // positions
+	MeshFileBlock f;   // faces
+	MeshFileBlock m;   // meshlets, 48 bytes each like Meshlet
+	MeshFileBlock mv;  // 1-based vertex of every meshlet vertex
+	MeshFileBlock mt;  // three uint8_t meshlet local vertices per face
+} MeshFileLod;
+
+typedef struct {
+	char     magic[4];
+	uint32_t version;
+	uint64_t file_size;
+
+	// of level 0, every level fits into them
+	float    aabb_min[3];
+	float    aabb_max[3];
+	float    center[3];
+	float    radius;
+
+	// a stored position p decodes to q_offset + q_scale * p
+	uint32_t position_format;
+	uint32_t index_format;
+	float    q_offset[3];
+	float    q_scale[3];
+
+	// finest first, the errors never decrease
+	uint32_t    lod_count;
+	uint32_t    reserved;
+	MeshFileLod lod[MESH_FILE_LOD_MAX];
+} MeshFileHeader;
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef OBJ_H
+#define OBJ_H
+
+#include "./lalg.h"
+#include "./jobs.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// attributes obj_load keeps besides the positions
+enum {
+	OBJ_NORMALS = 1 << 0,
+	OBJ_UVS     = 1 << 1
+};
+
+// the file is cut at line ends into chunks of about this many bytes
+#define OBJ_CHUNK_SIZE (1 << 20)
+
+// indexed triangle mesh of an .obj file, faces start at 1 like in Mesh
+typedef struct {
+	size_t v_count;
+	size_t f_count;
+	V3f*   v;
+	V3f*   vn;        // NULL unless OBJ_NORMALS, zero where a face had none
+	V2f*   vt;        // NULL unless OBJ_UVS, zero where a face had none
+	V3u*   f;
+	V3f    aabb_min;  // of the vertices the faces use
+	V3f    aabb_max;
+} ObjMesh;
+
+// Maps path and parses its chunks in parallel on jobs, call it while no frame
+// is running. Polygons become triangle fans and corners with the same
+// position and kept attributes are welded into one vertex.
+bool obj_load(ObjMesh* obj, const char* path, uint32_t attributes, Jobs* jobs);
+void obj_free(ObjMesh* obj);
+
+#endif
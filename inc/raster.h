@@ -0,0 +1,56 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include "./lalg.h"
+#include "./color.h"
+#include "./framebuffer.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// sub-pixel precision of the triangle rasterizer (28.4 fixed point)
+#define RASTER_SUBPIXEL_BITS 4
+#define RASTER_SUBPIXEL_ONE  (1 << RASTER_SUBPIXEL_BITS)
+
+// Half extent in pixels of the guard band around the viewport center. Up to
+// 2^19 a float still snaps exactly to the 28.4 grid and the 64 bit edge
+// functions are far from overflowing, so anything inside only needs scissoring.
+#define RASTER_GUARD_BAND    (1 << 18)
+
+// Modeled on the pipeline statistics queries of GPUs. Every thread counts
+// into its own copy, the copies are summed once the frame is done.
+typedef struct {
+	size_t input_vertices;      // vertices the vertex stage fetched, of culled meshlets too
+	size_t vertex_invocations;  // vertices transformed
+	size_t input_primitives;    // lines and triangles handed to the geometry stage
+	size_t culled_primitives;   // dropped by face culling or with their meshlet
+	size_t clipper_invocations; // primitives that reached clipping, wireframe triangles as three lines
+	size_t clipper_primitives;  // primitives that left it for the binner
+	size_t fragments;           // covered pixels that reached the per-pixel depth test
+	size_t depth_passed;
+	size_t pixels_written;      // the same as depth_passed as long as there is no blending
+} PipelineStats;
+
+void pipeline_stats_add(PipelineStats* sum, const PipelineStats* s);
+
+// inclusive pixel rectangle
+typedef struct {
+	int32_t x_min;
+	int32_t y_min;
+	int32_t x_max;
+	int32_t y_max;
+} Rect;
+
+// Twice the signed area of the triangle on the 28.4 grid the rasterizer snaps
+// to. Positive for clockwise vertices on screen (y down), zero means nothing
+// would be rasterized.
+int64_t triangle_area_fixed(V3f a, V3f b, V3f c);
+
+// vertices are in screen space, z holds the value for the depth buffer.
+// Only pixels inside the scissor rect are touched.
+void triangle_fill(V3f a, V3f b, V3f c, Framebuffer* fb, Rect scissor, OcclusionStats* stats,
+		   PipelineStats* pipeline, Color color);
+// start and end are whole pixel positions, z holds the value for the depth buffer
+void line_fill(V3f start, V3f end, Framebuffer* fb, Rect scissor, PipelineStats* pipeline, Color color);
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "./lalg.h"
+#include "./camera.h"
+#include "./framebuffer.h"
+#include "./binner.h"
+#include "./jobs.h"
+#include "./mesh.h"
+#include "./vertex.h"
+#include "./cull.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// geometry is cut into a fixed number of chunks, each with its own bins,
+// so the draw order doesn't depend on the number of threads
+#define GEOMETRY_CHUNKS 64
+
+// debug views replacing the colour output, black is cold and red is hot
+typedef enum {
+	HEATMAP_OFF,
+	HEATMAP_OVERDRAW,         // fragments per pixel, needs framebuffer_overdraw_set
+	HEATMAP_TILE_TIME,        // raster time per binner tile, relative to the slowest one
+	HEATMAP_TILE_PRIMITIVES,  // binned primitives per tile, relative to the fullest one
+	HEATMAP_MODE_COUNT
+} HeatmapMode;
+
+// fragments per pixel the overdraw heatmap shows as red
+#define HEATMAP_OVERDRAW_MAX 8
+
+typedef struct {
+	bool        grid_on;
+	bool        mesh_on;
+	bool        wireframe;   // mesh drawn from its edge list, or its faces as lines without one
+	bool        guard_band;  // see vertex_transform_setup
+	CullMode    cull;        // of the mesh draw
+	HeatmapMode heatmap;
+	uint32_t    heatmap_top; // pixel rows at the top the heatmap leaves alone, for a HUD
+} RenderOptions;
+
+// The asset and everything its frames need besides the framebuffer. The job
+// system and the binner belong to the caller.
+typedef struct {
+	Jobs*           jobs;
+	Binner*         binner;
+	MeshLods*       lods;
+	V3qSoA          positions[MESH_LOD_MAX];  // meshlet vertices of every level for the batch kernels
+	PostVertex*     verts;      // post-transform meshlet vertices, the per frame arrays fit the largest level
+	uint8_t*        meshlets;   // MESHLET_* decision of the cluster test per meshlet
+	uint8_t*        faces;      // FACE_* decision of the culling stage per mesh face
+	CullStats*      cull_stats; // one per thread
+	OcclusionStats* occlusion;  // one per thread
+	PipelineStats*  pipeline;   // one per thread
+	uint64_t*       tile_ns;    // raster time per binner tile, measured for HEATMAP_TILE_TIME only
+	float*          tile_heat;  // per binner tile in [0, 1]
+} Renderer;
+
+// totals of one frame
+typedef struct {
+	size_t         lines;          // binned, after clipping
+	size_t         triangles;
+	size_t         dropped;        // primitives the binner ran out of memory for
+	size_t         objects_culled; // 0 or 1, the whole mesh by its bounds
+	size_t         meshlets;       // that went through the cluster test
+	CullStats      cull;
+	OcclusionStats occlusion;
+	PipelineStats  pipeline;
+	double         heat_max;       // what red stands for, fragments, ms or primitives
+} RenderStats;
+
+const char* heatmap_mode_name(HeatmapMode mode);
+
+// unpacks the meshlets of every level and builds their vertex streams and edges
+bool renderer_create(Renderer* r, MeshLods* lods, Jobs* jobs, Binner* binner);
+void renderer_destroy(Renderer* r);
+
+// Draws the grid and level lod of the asset into fb, which has to be cleared
+// already. Resets the job arena first, the timings of the stages "vertex",
+// "cull", "geometry", "raster" and, with a heatmap, "heatmap" stay until the
+// next reset.
+void renderer_draw(Renderer* r, Framebuffer* fb, Camera camera, size_t lod, const RenderOptions* o,
+		   RenderStats* stats);
+
+// JobFn clearing the rows of depth tiles [begin, end) of the Framebuffer fb
+void render_clear_job(void* fb, size_t begin, size_t end);
+
+#endif
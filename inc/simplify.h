@@ -0,0 +1,21 @@
+#ifndef SIMPLIFY_H
+#define SIMPLIFY_H
+
+#include "./lalg.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Quadric error simplification by half edge collapses, vertices keep their
+// positions so the result indexes the same v. Border vertices only slide
+// along the border and their edges carry extra planes, so open borders stay
+// in place. Collapses that would flip a face are skipped.
+//
+// f is 1-based like in Mesh, out has room for f_count faces. Stops at target
+// faces or once the next collapse would move the surface by more than
+// max_error, returns how many faces were written. error gets the largest
+// distance the surface moved by.
+size_t simplify(V3u* out, const V3f* v, size_t v_count, const V3u* f, size_t f_count,
+		size_t target, float max_error, float* error);
+
+#endif
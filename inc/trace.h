@@ -0,0 +1,83 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Scoped timing markers for the hot paths. Built with -DTRACE every marker
+// stores its begin and end time stamp counter values into a ring of the
+// thread that ran it, trace_write turns the last frames of all rings into
+// a Chrome trace (chrome://tracing or ui.perfetto.dev). Without -DTRACE the
+// markers compile to nothing.
+
+#define TRACE_THREAD_MAX 64
+#define TRACE_RING_SIZE  (1 << 16)  // events per thread, a power of two
+
+typedef struct {
+	const char* name;
+	uint64_t    begin;  // time stamp counter ticks
+	uint64_t    end;
+	uint32_t    frame;
+} TraceEvent;
+
+#ifdef TRACE
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+static inline uint64_t trace_clock(void) {
+
+	return __rdtsc();
+}
+#else
+#include <time.h>
+
+static inline uint64_t trace_clock(void) {
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+#endif
+
+typedef struct {
+	const char* name;
+	uint64_t    begin;
+} TraceScope;
+
+void trace_event(const char* name, uint64_t begin, uint64_t end);
+void trace_frame_mark(void);
+
+static inline TraceScope trace_scope_begin(const char* name) {
+
+	return (TraceScope) { .name = name, .begin = trace_clock() };
+}
+
+static inline void trace_scope_end(TraceScope* s) {
+
+	trace_event(s->name, s->begin, trace_clock());
+}
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b)  TRACE_CONCAT_(a, b)
+
+// times the rest of the enclosing block, name must outlive the trace
+#define TRACE_SCOPE(name) \
+	TraceScope TRACE_CONCAT(trace_scope_, __LINE__) __attribute__((cleanup(trace_scope_end))) = \
+		trace_scope_begin(name)
+// starts the next frame, the events that follow belong to it
+#define TRACE_FRAME() trace_frame_mark()
+
+#else
+
+#define TRACE_SCOPE(name) ((void) 0)
+#define TRACE_FRAME()     ((void) 0)
+
+#endif
+
+// Writes the events of the last frames frames as Chrome trace JSON. Must not
+// run while other threads record events, between frames is fine. Fails
+// without -DTRACE.
+bool trace_write(const char* path, uint32_t frames);
+
+#endif
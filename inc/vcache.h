@@ -0,0 +1,30 @@
+#ifndef VCACHE_H
+#define VCACHE_H
+
+#include "./lalg.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// cache size the face order is optimized for
+#define VCACHE_SIZE 32
+
+// transforms of a face order through a FIFO post-transform cache
+typedef struct {
+	size_t transforms;
+	float  acmr;  // transforms per face, 0.5 at best for large regular meshes
+	float  atvr;  // transforms per vertex, 1 at best
+} VcacheStats;
+
+VcacheStats vcache_analyze(const V3u* f, size_t f_count, size_t v_count, uint32_t cache_size);
+
+// Forsyth's linear-speed vertex cache optimization: reorders the faces,
+// 1-based like in Mesh, so neighbouring faces reuse recently used vertices.
+// The faces stay as they are if that doesn't save transforms at VCACHE_SIZE.
+bool vcache_optimize(V3u* f, size_t f_count, size_t v_count);
+
+// Renumbers the vertices in order of first use by f, so the vertex fetch
+// walks v front to back. Unused vertices move to the end.
+bool vfetch_optimize(V3f* v, size_t v_count, V3u* f, size_t f_count);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef VERTEX_H
+#define VERTEX_H
+
+#include "./lalg.h"
+#include "./camera.h"
+#include "./framebuffer.h"
+#include "./clip.h"
+#include "./raster.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// widest batch of any kernel, streams are padded by this many vertices
+#define VERTEX_BATCH_MAX 16
+
+// written once per frame by the vertex stage, primitives index into it
+typedef struct {
+	V4f      clip;     // clip space position, w is the view depth
+	V3f      screen;   // pixels, z holds the depth buffer value. Meaningless behind the near plane.
+	uint32_t outcode;  // planes of clip.h the vertex is outside of
+} PostVertex;
+
+// everything a kernel needs, set up once per frame
+typedef struct {
+	M4f   view_proj;
+	M4f   stream_proj;  // view_proj after the decoding of the quantized stream
+	float half_width;
+	float half_height;
+	ClipPlanes planes;
+	uint32_t   clip_mask;  // planes primitives are geometrically clipped against
+} VertexTransform;
+
+typedef enum {
+	VERTEX_ISA_SCALAR,
+	VERTEX_ISA_SSE2,
+	VERTEX_ISA_AVX2,
+	VERTEX_ISA_AVX512,
+	VERTEX_ISA_COUNT
+} VertexIsa;
+
+bool soa_3q_create(V3qSoA* s, const uint16_t (*v)[3], size_t count);
+void soa_3q_destroy(V3qSoA* s);
+
+// With guard_band only primitives crossing the near plane or leaving the
+// guard band get clipped, the rest is left to the scissor and the depth test.
+void vertex_transform_setup(VertexTransform* t, Camera camera, const DepthBuffer* depth,
+			    uint32_t width, uint32_t height, bool guard_band);
+
+// Positions of the streams decode to q_offset + q_scale * p, the decoding is
+// folded into the matrix so the kernels only convert them to float. Until
+// this is called the stream holds plain coordinates.
+void vertex_stream_setup(VertexTransform* t, V3f q_offset, V3f q_scale);
+
+// picks isa if the cpu supports it, VERTEX_ISA_COUNT picks the widest one.
+// Call once before any transform.
+VertexIsa   vertex_kernel_init(VertexIsa isa);
+VertexIsa   vertex_kernel_isa(void);
+const char* vertex_isa_name(VertexIsa isa);
+
+// perspective divide and viewport, p must lie in front of the near plane
+static inline V3f clip_to_screen(const VertexTransform* t, V4f p) {
+
+	return (V3f) {{ (p.x / p.w + 1.0f) * t->half_width,
+			(1.0f - p.y / p.w) * t->half_height,
+			p.z / p.w }};
+}
+
+PostVertex vertex_transform_one(const VertexTransform* t, V3f v);
+
+// transforms, projects and classifies the vertices [begin, end) of in into out
+void vertex_transform(const VertexTransform* t, const V3qSoA* in, size_t begin, size_t end, PostVertex* out);
+
+#endif
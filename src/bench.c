@@ -0,0 +1,403 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "../inc/lalg.h"
+#include "../inc/camera.h"
+#include "../inc/framebuffer.h"
+#include "../inc/binner.h"
+#include "../inc/jobs.h"
+#include "../inc/mesh.h"
+#include "../inc/vertex.h"
+#include "../inc/render.h"
+
+// Replays fixed camera paths over fixed scenes without a window and reports
+// frame time statistics, as a table and as JSON to compare across commits.
+// The camera of a frame only depends on its index and the binning doesn't
+// depend on the number of threads, so every run draws the same primitives.
+
+#define BENCH_FRAMES 240
+#define BENCH_WARMUP 16
+
+typedef enum {
+	PATH_ORBIT,  // circles the asset at distance radii, a little above it
+	PATH_DOLLY,  // moves in from distance radii to just outside the asset
+	PATH_FLY     // flies straight through the asset, its faces cross the near plane
+} CameraPath;
+
+typedef struct {
+	const char* name;
+	const char* mesh;        // written by objToC -b, relative to the repository
+	CameraPath  path;
+	float       distance;    // in radii of the asset
+	bool        mesh_on;
+	bool        grid_on;
+	bool        wireframe;
+	float       lod_pixels;  // screen space error of the level of detail, 0 keeps level 0
+	uint32_t    width;       // fixed framebuffer size, 0 takes the one of -s
+	uint32_t    height;
+} Scene;
+
+static const Scene scenes[] = {
+	{ "grid",        "assets/cube.srm",   PATH_ORBIT,  3.0f, false, true,  false, 0.0f,    0,    0 },
+	{ "cube",        "assets/cube.srm",   PATH_ORBIT,  3.0f, true,  true,  false, 0.0f,    0,    0 },
+	{ "teapot",      "assets/teapot.srm", PATH_ORBIT,  3.0f, true,  true,  false, 1.0f,    0,    0 },
+	{ "teapot_wire", "assets/teapot.srm", PATH_ORBIT,  3.0f, true,  true,  true,  1.0f,    0,    0 },
+	{ "teapot_lod",  "assets/teapot.srm", PATH_DOLLY, 40.0f, true,  false, false, 1.0f,    0,    0 },
+	// every pixel covered a few times over by the finest level
+	{ "stress_fill", "assets/teapot.srm", PATH_ORBIT,  1.2f, true,  false, false, 0.0f,    0,    0 },
+	{ "stress_clip", "assets/teapot.srm", PATH_FLY,    2.0f, true,  true,  false, 0.0f,    0,    0 },
+	// more bin tiles than the job arena holds jobs
+	{ "teapot_8k",   "assets/teapot.srm", PATH_ORBIT,  3.0f, true,  true,  false, 1.0f, 7680, 4320 }
+};
+
+#define SCENE_COUNT (sizeof scenes / sizeof *scenes)
+
+// stages of renderer_draw and the clear after it, in the order they run
+static const char* stages[] = { "vertex", "cull", "geometry", "raster", "clear" };
+
+#define STAGE_COUNT (sizeof stages / sizeof *stages)
+
+typedef struct {
+	double mean;
+	double median;
+	double p95;
+	double p99;
+	double max;
+} Summary;
+
+typedef struct {
+	const Scene*  scene;
+	uint32_t      width;
+	uint32_t      height;
+	Summary       frame;
+	Summary       stage[STAGE_COUNT];
+	size_t        lines;      // binned over all measured frames, the same on every run
+	size_t        triangles;
+	size_t        dropped;    // primitives the binner ran out of memory for, 0 unless something broke
+	PipelineStats pipeline;   // summed like lines and triangles
+} Result;
+
+// the camera at t in [0, 1) along the path of s around mesh
+static Camera path_camera(const Scene* s, const Mesh* mesh, float t) {
+
+	Camera camera;
+	camera_default_set(&camera);
+
+	V3f   center = mesh->center;
+	float r      = mesh->radius;
+	float angle  = 2.0f * (float) M_PI * t;
+
+	switch (s->path) {
+	case PATH_ORBIT: {
+		float d = s->distance * r;
+		V3f   p = {{ center.x + d * cosf(angle), center.y + 0.4f * d, center.z + d * sinf(angle) }};
+		camera_look_at(&camera, p, center);
+		break;
+	}
+	case PATH_DOLLY: {
+		// the same share closer every frame, so every level gets its turn
+		float d = s->distance * r * powf(1.2f / s->distance, t);
+		V3f   p = {{ center.x + 0.6f * d, center.y + 0.3f * d, center.z - 0.8f * d }};
+		camera_look_at(&camera, p, center);
+		break;
+	}
+	case PATH_FLY: {
+		float d = s->distance * r;
+		V3f   p = {{ center.x - d + 2.0f * d * t, center.y + 0.1f * r, center.z + 0.05f * r }};
+		camera_look_at(&camera, p, add_3f(p, (V3f) {{ 1.0f, -0.1f, 0.05f }}));
+		break;
+	}
+	default:
+		break;
+	}
+
+	return camera;
+}
+
+static int ms_compare(const void* a, const void* b) {
+
+	double x = *(const double*) a;
+	double y = *(const double*) b;
+	return (x > y) - (x < y);
+}
+
+// sorts ms, percentiles by the nearest rank
+static Summary summarize(double* ms, size_t n) {
+
+	qsort(ms, n, sizeof *ms, ms_compare);
+
+	double sum = 0.0;
+	for (size_t i = 0; i < n; i++) sum += ms[i];
+
+	size_t p95 = (size_t) ceil(0.95 * (double) n);
+	size_t p99 = (size_t) ceil(0.99 * (double) n);
+	return (Summary) {
+		.mean   = sum / (double) n,
+		.median = n % 2 ? ms[n / 2] : 0.5 * (ms[n / 2 - 1] + ms[n / 2]),
+		.p95    = ms[p95 ? p95 - 1 : 0],
+		.p99    = ms[p99 ? p99 - 1 : 0],
+		.max    = ms[n - 1]
+	};
+}
+
+static bool scene_draw(const Scene* s, Jobs* jobs, Binner* binner, Framebuffer* fb, size_t frames, size_t warmup,
+		       Result* result) {
+
+	MeshLods lods;
+	if (!mesh_load(&lods, s->mesh)) {
+		fprintf(stderr, "Failed to load %s.\n", s->mesh);
+		return false;
+	}
+
+	Renderer renderer;
+	double*  ms = malloc((STAGE_COUNT + 1) * frames * sizeof *ms);
+	if (!ms || !renderer_create(&renderer, &lods, jobs, binner)) {
+		fprintf(stderr, "Failed to set up the renderer for %s.\n", s->name);
+		free(ms);
+		mesh_unload(&lods);
+		return false;
+	}
+
+	RenderOptions options = {
+		.grid_on    = s->grid_on,
+		.mesh_on    = s->mesh_on,
+		.wireframe  = s->wireframe,
+		.guard_band = true,
+		.cull       = CULL_BACK
+	};
+
+	*result = (Result) { .scene = s, .width = fb->width, .height = fb->height };
+	framebuffer_clear(fb);
+
+	// warmup frames run the start of the path, the level selection starts over after them
+	size_t lod = lods.lod_count;
+	for (size_t i = 0; i < warmup + frames; i++) {
+		if (i == warmup) lod = lods.lod_count;
+
+		size_t frame  = i < warmup ? i % frames : i - warmup;
+		Camera camera = path_camera(s, &lods.lod[0], (float) frame / (float) frames);
+		lod = s->lod_pixels > 0.0f ? mesh_lod_select(&lods, lod, camera, fb->height, s->lod_pixels,
+							     MESH_LOD_HYSTERESIS) : 0;
+
+		uint64_t start = jobs_time_ns();
+		RenderStats stats;
+		renderer_draw(&renderer, fb, camera, lod, &options, &stats);
+		Job* clear = jobs_parallel_for(jobs, "clear", render_clear_job, fb, 0, fb->hiz.tiles_y, 16);
+		jobs_submit(jobs, clear);
+		jobs_wait(jobs, clear);
+		uint64_t end = jobs_time_ns();
+
+		if (i < warmup) continue;
+
+		ms[frame] = (double) (end - start) / 1e6;
+		for (size_t k = 0; k < STAGE_COUNT; k++) ms[(k + 1) * frames + frame] = jobs_stage_ms(jobs, stages[k]);
+		result->lines     += stats.lines;
+		result->triangles += stats.triangles;
+		result->dropped   += stats.dropped;
+		pipeline_stats_add(&result->pipeline, &stats.pipeline);
+	}
+
+	result->frame = summarize(ms, frames);
+	for (size_t k = 0; k < STAGE_COUNT; k++) result->stage[k] = summarize(ms + (k + 1) * frames, frames);
+
+	free(ms);
+	renderer_destroy(&renderer);
+	mesh_unload(&lods);
+	return true;
+}
+
+// runs s at its own size or at width x height
+static bool scene_run(const Scene* s, Jobs* jobs, uint32_t width, uint32_t height, size_t frames, size_t warmup,
+		      Result* result) {
+
+	if (s->width) {
+		width  = s->width;
+		height = s->height;
+	}
+
+	size_t      bytes  = ((size_t) width * height * sizeof(uint32_t) + 63) & ~(size_t) 63;
+	uint32_t*   color  = aligned_alloc(64, bytes);
+	Framebuffer fb     = {0};
+	Binner      binner = {0};
+	bool        ok     = color && binner_create(&binner, width, height, GEOMETRY_CHUNKS) &&
+			     framebuffer_init(&fb, color, width, height, DEPTH_F32);
+	if (!ok) {
+		fprintf(stderr, "Failed to set up a %ux%u framebuffer for %s.\n", width, height, s->name);
+	} else {
+		Camera camera;
+		camera_default_set(&camera);
+		depth_range_set(&fb.depth, camera.znear, camera.zfar);
+
+		ok = scene_draw(s, jobs, &binner, &fb, frames, warmup, result);
+	}
+
+	framebuffer_free(&fb);
+	binner_destroy(&binner);
+	free(color);
+	return ok;
+}
+
+static void summary_json(FILE* out, const Summary* s) {
+
+	fprintf(out, "{ \"mean\": %.4f, \"median\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }",
+		s->mean, s->median, s->p95, s->p99, s->max);
+}
+
+static void pipeline_json(FILE* out, const PipelineStats* p) {
+
+	fprintf(out, "{ \"input_vertices\": %zu, \"vertex_invocations\": %zu, \"input_primitives\": %zu, "
+		"\"culled_primitives\": %zu, \"clipper_invocations\": %zu, \"clipper_primitives\": %zu, "
+		"\"fragments\": %zu, \"depth_passed\": %zu, \"pixels_written\": %zu }",
+		p->input_vertices, p->vertex_invocations, p->input_primitives, p->culled_primitives,
+		p->clipper_invocations, p->clipper_primitives, p->fragments, p->depth_passed, p->pixels_written);
+}
+
+static bool results_write(const char* path, const Result* results, size_t count, uint32_t threads,
+			  uint32_t width, uint32_t height, size_t frames, size_t warmup) {
+
+	FILE* out = fopen(path, "w");
+	if (!out) return false;
+
+	fprintf(out, "{\n");
+	fprintf(out, "\t\"threads\": %u,\n", threads);
+	fprintf(out, "\t\"isa\": \"%s\",\n", vertex_isa_name(vertex_kernel_isa()));
+	fprintf(out, "\t\"width\": %u,\n", width);
+	fprintf(out, "\t\"height\": %u,\n", height);
+	fprintf(out, "\t\"frames\": %zu,\n", frames);
+	fprintf(out, "\t\"warmup\": %zu,\n", warmup);
+	fprintf(out, "\t\"scenes\": [\n");
+	for (size_t i = 0; i < count; i++) {
+		const Result* r = &results[i];
+		fprintf(out, "\t\t{\n");
+		fprintf(out, "\t\t\t\"name\": \"%s\",\n", r->scene->name);
+		fprintf(out, "\t\t\t\"mesh\": \"%s\",\n", r->scene->mesh);
+		fprintf(out, "\t\t\t\"width\": %u,\n", r->width);
+		fprintf(out, "\t\t\t\"height\": %u,\n", r->height);
+		fprintf(out, "\t\t\t\"lines\": %zu,\n", r->lines);
+		fprintf(out, "\t\t\t\"triangles\": %zu,\n", r->triangles);
+		fprintf(out, "\t\t\t\"dropped\": %zu,\n", r->dropped);
+		fprintf(out, "\t\t\t\"pipeline\": ");
+		pipeline_json(out, &r->pipeline);
+		fprintf(out, ",\n");
+		fprintf(out, "\t\t\t\"frame_ms\": ");
+		summary_json(out, &r->frame);
+		fprintf(out, ",\n\t\t\t\"stage_ms\": {\n");
+		for (size_t k = 0; k < STAGE_COUNT; k++) {
+			fprintf(out, "\t\t\t\t\"%s\": ", stages[k]);
+			summary_json(out, &r->stage[k]);
+			fprintf(out, "%s\n", k + 1 < STAGE_COUNT ? "," : "");
+		}
+		fprintf(out, "\t\t\t}\n\t\t}%s\n", i + 1 < count ? "," : "");
+	}
+	fprintf(out, "\t]\n}\n");
+
+	return fclose(out) == 0;
+}
+
+int main(int argc, char** argv) {
+
+	long     cpus    = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t threads = cpus > 0 ? (uint32_t) cpus : 1;
+	VertexIsa isa    = VERTEX_ISA_COUNT;
+	uint32_t width   = 1920;
+	uint32_t height  = 1080;
+	size_t   frames  = BENCH_FRAMES;
+	size_t   warmup  = BENCH_WARMUP;
+	const char* json = "bench.json";
+
+	// scenes named on the command line, all of them otherwise
+	bool picked[SCENE_COUNT] = {0};
+	bool any   = false;
+	bool usage = false;
+	for (int i = 1; i < argc && !usage; i++) {
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			threads = (uint32_t) strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+			i++;
+			for (isa = 0; isa < VERTEX_ISA_COUNT; isa++) {
+				if (strcmp(argv[i], vertex_isa_name(isa)) == 0) break;
+			}
+			usage = isa == VERTEX_ISA_COUNT;
+		} else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+			usage = sscanf(argv[++i], "%ux%u", &width, &height) != 2 || !width || !height;
+		} else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+			frames = (size_t) strtoull(argv[++i], NULL, 10);
+			usage  = !frames;
+		} else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+			warmup = (size_t) strtoull(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+			json = argv[++i];
+		} else {
+			size_t s = 0;
+			while (s < SCENE_COUNT && strcmp(argv[i], scenes[s].name) != 0) s++;
+			usage = s == SCENE_COUNT;
+			if (!usage) picked[s] = any = true;
+		}
+	}
+	if (usage) {
+		fprintf(stderr, "usage: %s [-t threads] [-k scalar|sse2|avx2|avx512] [-s widthxheight] [-f frames] "
+				"[-w warmup frames] [-o results.json] [scene ...]\nscenes:", argv[0]);
+		for (size_t s = 0; s < SCENE_COUNT; s++) fprintf(stderr, " %s", scenes[s].name);
+		fprintf(stderr, "\n");
+		return EXIT_FAILURE;
+	}
+	if (threads < 1) threads = 1;
+	vertex_kernel_init(isa);
+
+	Jobs*   jobs    = calloc(1, sizeof *jobs);
+	Result* results = calloc(SCENE_COUNT, sizeof *results);
+	if (!jobs || !results || !jobs_create(jobs, threads)) {
+		fprintf(stderr, "Failed to set up %u render threads.\n", threads);
+		return EXIT_FAILURE;
+	}
+
+	printf("%ux%u, %u threads, %s, %zu frames after %zu warmup frames, ms\n", width, height, threads,
+	       vertex_isa_name(vertex_kernel_isa()), frames, warmup);
+	printf("%-12s %8s %8s %8s %8s %8s |", "scene", "mean", "median", "p95", "p99", "max");
+	for (size_t k = 0; k < STAGE_COUNT; k++) printf(" %8s", stages[k]);
+	printf("\n");
+
+	size_t count = 0;
+	bool   ok    = true;
+	for (size_t s = 0; s < SCENE_COUNT && ok; s++) {
+		if (any && !picked[s]) continue;
+
+		Result* r = &results[count];
+		ok = scene_run(&scenes[s], jobs, width, height, frames, warmup, r);
+		if (!ok) break;
+		count++;
+
+		// the stage columns are means
+		printf("%-12s %8.3f %8.3f %8.3f %8.3f %8.3f |", r->scene->name, r->frame.mean, r->frame.median,
+		       r->frame.p95, r->frame.p99, r->frame.max);
+		for (size_t k = 0; k < STAGE_COUNT; k++) printf(" %8.3f", r->stage[k].mean);
+		printf("\n");
+		// the frames drew less than the scene, their times don't compare
+		if (r->dropped) fprintf(stderr, "%s: %zu primitives dropped, out of memory.\n", r->scene->name, r->dropped);
+	}
+
+	// pipeline statistics, like the lines and triangles the same on every run
+	printf("\npipeline statistics per frame\n");
+	printf("%-12s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n", "scene", "vertices", "vs", "prims",
+	       "culled", "clip in", "clip out", "fragments", "depth ok", "written");
+	for (size_t i = 0; i < count; i++) {
+		const PipelineStats* p = &results[i].pipeline;
+		printf("%-12s %10zu %10zu %10zu %10zu %10zu %10zu %10zu %10zu %10zu\n", results[i].scene->name,
+		       p->input_vertices / frames, p->vertex_invocations / frames, p->input_primitives / frames,
+		       p->culled_primitives / frames, p->clipper_invocations / frames, p->clipper_primitives / frames,
+		       p->fragments / frames, p->depth_passed / frames, p->pixels_written / frames);
+	}
+
+	if (ok && !results_write(json, results, count, threads, width, height, frames, warmup)) {
+		fprintf(stderr, "Failed to write %s.\n", json);
+		ok = false;
+	}
+
+	jobs_destroy(jobs);
+	free(jobs);
+	free(results);
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,239 @@
+#include "../inc/binner.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+bool binner_create(Binner* b, uint32_t width, uint32_t height, uint32_t producers) {
+
+	*b = (Binner) {0};
+
+	b->width     = width;
+	b->height    = height;
+	b->tiles_x   = (width  + BIN_TILE_SIZE - 1) / BIN_TILE_SIZE;
+	b->tiles_y   = (height + BIN_TILE_SIZE - 1) / BIN_TILE_SIZE;
+	b->set_count = producers;
+	b->sets      = calloc(producers, sizeof *b->sets);
+	if (!b->sets) return false;
+
+	size_t tiles = (size_t) b->tiles_x * b->tiles_y;
+	for (uint32_t i = 0; i < producers; i++) {
+		b->sets[i].bins = calloc(tiles, sizeof(Bin));
+		if (!b->sets[i].bins) return false;
+	}
+
+	return true;
+}
+
+void binner_destroy(Binner* b) {
+
+	size_t tiles = (size_t) b->tiles_x * b->tiles_y;
+	for (uint32_t i = 0; i < b->set_count && b->sets; i++) {
+		for (size_t t = 0; t < tiles && b->sets[i].bins; t++) free(b->sets[i].bins[t].items);
+		free(b->sets[i].bins);
+		free(b->sets[i].prims);
+	}
+	free(b->sets);
+	b->sets = NULL;
+}
+
+void binner_reset(Binner* b) {
+
+	size_t tiles = (size_t) b->tiles_x * b->tiles_y;
+	for (uint32_t i = 0; i < b->set_count; i++) {
+		BinSet* set = &b->sets[i];
+		for (size_t t = 0; t < tiles; t++) set->bins[t].count = 0;
+		set->prim_count     = 0;
+		set->line_count     = 0;
+		set->triangle_count = 0;
+		set->dropped_count  = 0;
+	}
+}
+
+static uint32_t prim_push(BinSet* set, Primitive p) {
+
+	if (set->prim_count == set->prim_capacity) {
+		size_t cap = set->prim_capacity ? 2 * set->prim_capacity : 1024;
+		Primitive* prims = realloc(set->prims, cap * sizeof *prims);
+		if (!prims) return UINT32_MAX;
+		set->prims = prims;
+		set->prim_capacity = cap;
+	}
+
+	set->prims[set->prim_count] = p;
+	return (uint32_t) set->prim_count++;
+}
+
+static bool bin_push(Bin* bin, uint32_t item) {
+
+	if (bin->count == bin->capacity) {
+		uint32_t cap = bin->capacity ? 2 * bin->capacity : 64;
+		uint32_t* items = realloc(bin->items, cap * sizeof *items);
+		if (!items) return false;
+		bin->items = items;
+		bin->capacity = cap;
+	}
+
+	bin->items[bin->count++] = item;
+	return true;
+}
+
+static inline int32_t clamp_s32(int32_t v, int32_t lo, int32_t hi) {
+
+	return v < lo ? lo : v > hi ? hi : v;
+}
+
+// Lines are binned along their path: per tile column (or row for steep
+// lines) only the tiles the line actually passes through get the item.
+bool binner_line_add(Binner* b, uint32_t producer, V3f start, V3f end, Color color) {
+
+	BinSet* set = &b->sets[producer];
+
+	uint32_t idx = prim_push(set, (Primitive) { .v = { start, end, end }, .color = color, .type = PRIMITIVE_LINE });
+	if (idx == UINT32_MAX) {
+		set->dropped_count += 1;
+		return false;
+	}
+	set->line_count += 1;
+
+	float dx = end.x - start.x;
+	float dy = end.y - start.y;
+	bool x_major = fabsf(dx) >= fabsf(dy);
+
+	float major0 = x_major ? start.x : start.y, major1 = x_major ? end.x : end.y;
+	float minor0 = x_major ? start.y : start.x, minor1 = x_major ? end.y : end.x;
+	if (major0 > major1) {
+		float t = major0; major0 = major1; major1 = t;
+		t = minor0; minor0 = minor1; minor1 = t;
+	}
+	float slope = major1 > major0 ? (minor1 - minor0) / (major1 - major0) : 0.0f;
+
+	int32_t tiles_major = (int32_t) (x_major ? b->tiles_x : b->tiles_y) - 1;
+	int32_t tiles_minor = (int32_t) (x_major ? b->tiles_y : b->tiles_x) - 1;
+	int32_t t_begin = clamp_s32((int32_t) major0 >> BIN_TILE_BITS, 0, tiles_major);
+	int32_t t_end   = clamp_s32((int32_t) major1 >> BIN_TILE_BITS, 0, tiles_major);
+
+	bool ok = true;
+	for (int32_t t = t_begin; t <= t_end; t++) {
+		// minor coordinate where the line enters and leaves this tile column
+		float m_lo = fmaxf(major0, (float) (t << BIN_TILE_BITS));
+		float m_hi = fminf(major1, (float) (((t + 1) << BIN_TILE_BITS) - 1));
+		float n_a  = minor0 + (m_lo - major0) * slope;
+		float n_b  = minor0 + (m_hi - major0) * slope;
+
+		// one pixel of slack for the rounding of the rasterizer
+		int32_t s_begin = clamp_s32((int32_t) (fminf(n_a, n_b) - 1.0f) >> BIN_TILE_BITS, 0, tiles_minor);
+		int32_t s_end   = clamp_s32((int32_t) (fmaxf(n_a, n_b) + 1.0f) >> BIN_TILE_BITS, 0, tiles_minor);
+
+		for (int32_t s = s_begin; s <= s_end; s++) {
+			uint32_t tx = (uint32_t) (x_major ? t : s);
+			uint32_t ty = (uint32_t) (x_major ? s : t);
+			ok &= bin_push(&set->bins[ty * b->tiles_x + tx], idx);
+		}
+	}
+
+	set->dropped_count += !ok;
+	return ok;
+}
+
+bool binner_triangle_add(Binner* b, uint32_t producer, V3f v1, V3f v2, V3f v3, Color color) {
+
+	float x_min = fminf(v1.x, fminf(v2.x, v3.x));
+	float y_min = fminf(v1.y, fminf(v2.y, v3.y));
+	float x_max = fmaxf(v1.x, fmaxf(v2.x, v3.x));
+	float y_max = fmaxf(v1.y, fmaxf(v2.y, v3.y));
+
+	if (x_max < 0.0f || y_max < 0.0f || x_min >= (float) b->width || y_min >= (float) b->height) return true;
+
+	BinSet* set = &b->sets[producer];
+
+	uint32_t idx = prim_push(set, (Primitive) { .v = { v1, v2, v3 }, .color = color, .type = PRIMITIVE_TRIANGLE });
+	if (idx == UINT32_MAX) {
+		set->dropped_count += 1;
+		return false;
+	}
+	set->triangle_count += 1;
+
+	int32_t tx0 = clamp_s32((int32_t) fmaxf(x_min, 0.0f) >> BIN_TILE_BITS, 0, (int32_t) b->tiles_x - 1);
+	int32_t ty0 = clamp_s32((int32_t) fmaxf(y_min, 0.0f) >> BIN_TILE_BITS, 0, (int32_t) b->tiles_y - 1);
+	int32_t tx1 = clamp_s32((int32_t) fminf(x_max, (float) b->width)  >> BIN_TILE_BITS, 0, (int32_t) b->tiles_x - 1);
+	int32_t ty1 = clamp_s32((int32_t) fminf(y_max, (float) b->height) >> BIN_TILE_BITS, 0, (int32_t) b->tiles_y - 1);
+
+	bool ok = true;
+	for (int32_t ty = ty0; ty <= ty1; ty++) {
+	for (int32_t tx = tx0; tx <= tx1; tx++) {
+		ok &= bin_push(&set->bins[(uint32_t) ty * b->tiles_x + (uint32_t) tx], idx);
+	}}
+
+	set->dropped_count += !ok;
+	return ok;
+}
+
+static void tile_triangle_raster(const Primitive* p, Framebuffer* fb, Rect tile, OcclusionStats* stats,
+				 PipelineStats* pipeline) {
+
+	// triangle setup: coarse occlusion test against the tiles it covers here
+	DepthFormat format = fb->depth.format;
+	float near_key = fminf(depth_key(format, p->v[0].z), fminf(depth_key(format, p->v[1].z), depth_key(format, p->v[2].z)));
+
+	int32_t x_min = (int32_t) fmaxf(fminf(p->v[0].x, fminf(p->v[1].x, p->v[2].x)), (float) tile.x_min);
+	int32_t y_min = (int32_t) fmaxf(fminf(p->v[0].y, fminf(p->v[1].y, p->v[2].y)), (float) tile.y_min);
+	int32_t x_max = (int32_t) fminf(fmaxf(p->v[0].x, fmaxf(p->v[1].x, p->v[2].x)), (float) tile.x_max);
+	int32_t y_max = (int32_t) fminf(fmaxf(p->v[0].y, fmaxf(p->v[1].y, p->v[2].y)), (float) tile.y_max);
+
+	if (hiz_rect_occluded(fb, x_min, y_min, x_max, y_max, near_key)) {
+		stats->triangles_rejected += 1;
+		return;
+	}
+
+	triangle_fill(p->v[0], p->v[1], p->v[2], fb, tile, stats, pipeline, p->color);
+}
+
+// A tile is only ever rasterized by one thread at a time, so the
+// framebuffer needs no locks.
+void binner_tile_raster(Binner* b, Framebuffer* fb, uint32_t tile, OcclusionStats* stats, PipelineStats* pipeline) {
+
+	int32_t x = (int32_t) (tile % b->tiles_x) << BIN_TILE_BITS;
+	int32_t y = (int32_t) (tile / b->tiles_x) << BIN_TILE_BITS;
+	Rect rect = {
+		.x_min = x,
+		.y_min = y,
+		.x_max = clamp_s32(x + BIN_TILE_SIZE - 1, 0, (int32_t) b->width  - 1),
+		.y_max = clamp_s32(y + BIN_TILE_SIZE - 1, 0, (int32_t) b->height - 1)
+	};
+
+	// producers in order keep the primitive order of a single threaded frame
+	for (uint32_t s = 0; s < b->set_count; s++) {
+		const BinSet* set = &b->sets[s];
+		const Bin*    bin = &set->bins[tile];
+
+		for (uint32_t i = 0; i < bin->count; i++) {
+			const Primitive* p = &set->prims[bin->items[i]];
+			if (p->type == PRIMITIVE_LINE) {
+				line_fill(p->v[0], p->v[1], fb, rect, pipeline, p->color);
+			} else {
+				tile_triangle_raster(p, fb, rect, stats, pipeline);
+			}
+		}
+	}
+}
+
+size_t binner_line_count(const Binner* b) {
+
+	size_t res = 0;
+	for (uint32_t i = 0; i < b->set_count; i++) res += b->sets[i].line_count;
+	return res;
+}
+
+size_t binner_triangle_count(const Binner* b) {
+
+	size_t res = 0;
+	for (uint32_t i = 0; i < b->set_count; i++) res += b->sets[i].triangle_count;
+	return res;
+}
+
+size_t binner_dropped_count(const Binner* b) {
+
+	size_t res = 0;
+	for (uint32_t i = 0; i < b->set_count; i++) res += b->sets[i].dropped_count;
+	return res;
+}
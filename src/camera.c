@@ -15,6 +15,16 @@ void camera_default_set(Camera* c) {
 	c->zfar     = 100.0f;
 }
 
+void camera_look_at(Camera* c, V3f position, V3f target) {
+
+	// up stays in the plane of forward and the world's y axis, like after camera_update_mouse
+	V3f v_y     = (V3f) {{ 0.0f, 1.0f, 0.0f }};
+	c->position = position;
+	c->forward  = norm_3f(sub_3f(target, position));
+	V3f right   = norm_3f(cross_3f(c->forward, v_y));
+	c->up       = norm_3f(cross_3f(right, c->forward));
+}
+
 void camera_update_mouse(Camera* camera, V2f rel) {
 
 	// sets mouse speed
@@ -42,3 +52,41 @@ void camera_info_print(Camera camera) {
 	printf("right    = (%.2f, %.2f, %.2f)\n", right.x, right.y, right.z);
 }
 
+
+M4f camera_view_get(Camera camera) {
+
+	M4f res = id_4f();
+
+	V3f right = norm_3f(cross_3f(camera.forward, camera.up));
+	V3f rows[3] = { right, camera.up, camera.forward };
+
+	for (size_t i = 0; i < 3; i++) {
+		res.arr[i + 0*4] = rows[i].x;
+		res.arr[i + 1*4] = rows[i].y;
+		res.arr[i + 2*4] = rows[i].z;
+		res.arr[i + 3*4] = -dot_3f(rows[i], camera.position);
+	}
+
+	return res;
+}
+
+float camera_focal_get(Camera camera) {
+
+	// only place the field of view is turned into a focal length
+	return 1 / tanf(0.5f * camera.fovy * M_PI / 180.0f);
+}
+
+M4f camera_projection_get(Camera camera, float aspect, float depth_scale, float depth_bias) {
+
+	M4f res = {0};
+
+	const float f = camera_focal_get(camera);
+
+	res.arr[0 + 0*4] = f / aspect;
+	res.arr[1 + 1*4] = f;
+	res.arr[2 + 2*4] = depth_bias;
+	res.arr[2 + 3*4] = depth_scale;
+	res.arr[3 + 2*4] = 1.0f;
+
+	return res;
+}
@@ -0,0 +1,62 @@
+#include "../inc/clip.h"
+
+bool clip_line(V4f* a, V4f* b, uint32_t planes, const ClipPlanes* c) {
+
+	float t0 = 0.0f;
+	float t1 = 1.0f;
+
+	for (uint32_t i = 0; i < CLIP_PLANES; i++) {
+		uint32_t plane = 1u << i;
+		if (!(planes & plane)) continue;
+
+		float d0 = clip_plane_dist(*a, plane, c);
+		float d1 = clip_plane_dist(*b, plane, c);
+		if (d0 < 0.0f && d1 < 0.0f) return false;
+
+		if (d0 < 0.0f) {
+			float t = d0 / (d0 - d1);
+			if (t > t0) t0 = t;
+		} else if (d1 < 0.0f) {
+			float t = d0 / (d0 - d1);
+			if (t < t1) t1 = t;
+		}
+		if (t0 > t1) return false;
+	}
+
+	V4f p0 = *a;
+	V4f p1 = *b;
+	if (t0 > 0.0f) *a = lerp_4f(p0, p1, t0);
+	if (t1 < 1.0f) *b = lerp_4f(p0, p1, t1);
+
+	return true;
+}
+
+size_t clip_polygon(V4f* poly, size_t n, uint32_t planes, const ClipPlanes* c) {
+
+	V4f tmp[CLIP_POLY_MAX];
+
+	for (uint32_t i = 0; i < CLIP_PLANES && n >= 3; i++) {
+		uint32_t plane = 1u << i;
+		if (!(planes & plane)) continue;
+
+		size_t m = 0;
+		for (size_t k = 0; k < n; k++) {
+			V4f cur = poly[k];
+			V4f nxt = poly[(k + 1) % n];
+			float dc = clip_plane_dist(cur, plane, c);
+			float dn = clip_plane_dist(nxt, plane, c);
+
+			if (dc >= 0.0f) tmp[m++] = cur;
+			if ((dc >= 0.0f) != (dn >= 0.0f)) {
+				// always step from the inside vertex so neighbours sharing the edge agree
+				tmp[m++] = dc >= 0.0f ? lerp_4f(cur, nxt, dc / (dc - dn))
+						      : lerp_4f(nxt, cur, dn / (dn - dc));
+			}
+		}
+
+		for (size_t k = 0; k < m; k++) poly[k] = tmp[k];
+		n = m;
+	}
+
+	return n < 3 ? 0 : n;
+}
@@ -0,0 +1,108 @@
+#include "../inc/cull.h"
+
+#include <math.h>
+
+static const char* cull_mode_names[CULL_MODE_COUNT] = {
+	[CULL_NONE]  = "none",
+	[CULL_BACK]  = "back",
+	[CULL_FRONT] = "front"
+};
+
+const char* cull_mode_name(CullMode mode) {
+
+	return mode < CULL_MODE_COUNT ? cull_mode_names[mode] : "unknown";
+}
+
+void frustum_from_transform(Frustum* f, const VertexTransform* t) {
+
+	*f = (Frustum) {0};
+
+	// rows of the view-projection matrix, clip = (dot(r0, p), dot(r1, p), dot(r2, p), dot(r3, p))
+	const float* m = t->view_proj.arr;
+	V4f r[4];
+	for (size_t i = 0; i < 4; i++) r[i] = (V4f) {{ m[i], m[i + 4], m[i + 8], m[i + 12] }};
+
+	// the plane distances of clip_plane_dist written out as linear forms of p
+	f->planes[0] = (V4f) {{  r[3].x,           r[3].y,           r[3].z,           r[3].w - t->planes.znear }};
+	f->planes[1] = (V4f) {{ -r[3].x,          -r[3].y,          -r[3].z,           t->planes.zfar - r[3].w }};
+	f->planes[2] = (V4f) {{  r[3].x + r[0].x,  r[3].y + r[0].y,  r[3].z + r[0].z,  r[3].w + r[0].w }};
+	f->planes[3] = (V4f) {{  r[3].x - r[0].x,  r[3].y - r[0].y,  r[3].z - r[0].z,  r[3].w - r[0].w }};
+	f->planes[4] = (V4f) {{  r[3].x - r[1].x,  r[3].y - r[1].y,  r[3].z - r[1].z,  r[3].w - r[1].w }};
+	f->planes[5] = (V4f) {{  r[3].x + r[1].x,  r[3].y + r[1].y,  r[3].z + r[1].z,  r[3].w + r[1].w }};
+
+	// unit normals so the offset is a distance, spheres need that
+	for (size_t i = 0; i < 6; i++) {
+		V4f* p = &f->planes[i];
+		float len = sqrtf(p->x * p->x + p->y * p->y + p->z * p->z);
+		if (len > 1e-8f) *p = (V4f) {{ p->x / len, p->y / len, p->z / len, p->w / len }};
+	}
+}
+
+bool frustum_sphere_outside(const Frustum* f, V3f center, float radius) {
+
+	for (size_t i = 0; i < 6; i++) {
+		V4f p = f->planes[i];
+		if (p.x * center.x + p.y * center.y + p.z * center.z + p.w < -radius) return true;
+	}
+
+	return false;
+}
+
+bool frustum_aabb_outside(const Frustum* f, V3f aabb_min, V3f aabb_max) {
+
+	for (size_t i = 0; i < 6; i++) {
+		V4f p = f->planes[i];
+
+		// the corner furthest along the normal
+		float x = p.x >= 0.0f ? aabb_max.x : aabb_min.x;
+		float y = p.y >= 0.0f ? aabb_max.y : aabb_min.y;
+		float z = p.z >= 0.0f ? aabb_max.z : aabb_min.z;
+		if (p.x * x + p.y * y + p.z * z + p.w < 0.0f) return true;
+	}
+
+	return false;
+}
+
+uint8_t meshlet_cull(const Meshlet* m, const Frustum* f, V3f eye, CullMode mode) {
+
+	if (frustum_sphere_outside(f, m->center, m->radius)) return MESHLET_CULLED_FRUSTUM;
+	if (mode == CULL_NONE) return MESHLET_VISIBLE;
+
+	// Every normal of the cone points away from the eye for every point of the
+	// sphere, the cutoff widens the test by the cone's half angle.
+	V3f   view = sub_3f(m->center, eye);
+	float d    = dot_3f(view, m->cone_axis);
+	if (mode == CULL_FRONT) d = -d;
+	if (d >= m->cone_cutoff * sqrtf(dot_3f(view, view)) + m->radius) return MESHLET_CULLED_FACING;
+
+	return MESHLET_VISIBLE;
+}
+
+// Sign of the 3x3 determinant of the (x, y, w) rows. Matches the screen area
+// for vertices in front of the camera (with y flipped) and stays valid for
+// vertices behind it, where the projection itself breaks down.
+static inline float det_xyw(V4f a, V4f b, V4f c) {
+
+	return a.x * (b.y * c.w - c.y * b.w)
+	     - a.y * (b.x * c.w - c.x * b.w)
+	     + a.w * (b.x * c.y - c.x * b.y);
+}
+
+uint8_t face_cull(const PostVertex* a, const PostVertex* b, const PostVertex* c, CullMode mode) {
+
+	// clockwise on screen with y down means back facing
+	bool back;
+
+	if (!((a->outcode | b->outcode | c->outcode) & CLIP_NEAR)) {
+		int64_t area = triangle_area_fixed(a->screen, b->screen, c->screen);
+		if (area == 0) return FACE_CULLED_DEGENERATE;
+		back = area > 0;
+	} else {
+		back = det_xyw(a->clip, b->clip, c->clip) < 0.0f;
+	}
+
+	if (mode == CULL_BACK  &&  back) return FACE_CULLED_FACING;
+	if (mode == CULL_FRONT && !back) return FACE_CULLED_FACING;
+
+	return FACE_VISIBLE;
+}
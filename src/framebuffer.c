@@ -0,0 +1,170 @@
+#include "../inc/framebuffer.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+bool framebuffer_init(Framebuffer* fb, uint32_t* color, uint32_t width, uint32_t height, DepthFormat format) {
+
+	fb->color  = color;
+	fb->width  = width;
+	fb->height = height;
+
+	// every format fits into 32 bits, so switching formats never reallocates
+	fb->depth.format = format;
+	fb->depth.u24    = malloc((size_t) width * height * sizeof(uint32_t));
+	if (!fb->depth.u24) return false;
+
+	fb->hiz.tiles_x = (width  + HIZ_TILE_SIZE - 1) / HIZ_TILE_SIZE;
+	fb->hiz.tiles_y = (height + HIZ_TILE_SIZE - 1) / HIZ_TILE_SIZE;
+	size_t tiles    = (size_t) fb->hiz.tiles_x * fb->hiz.tiles_y;
+	fb->hiz.max     = malloc(tiles * sizeof(float));
+	fb->hiz.dirty   = malloc(tiles * sizeof(uint8_t));
+	if (!fb->hiz.max || !fb->hiz.dirty) return false;
+
+	fb->occlusion = (OcclusionStats) {0};
+	fb->overdraw  = NULL;
+
+	depth_range_set(&fb->depth, 0.5f, 100.0f);
+	framebuffer_clear(fb);
+
+	return true;
+}
+
+void framebuffer_free(Framebuffer* fb) {
+
+	free(fb->depth.u24);
+	free(fb->hiz.max);
+	free(fb->hiz.dirty);
+	free(fb->overdraw);
+	fb->depth.u24 = NULL;
+	fb->hiz.max   = NULL;
+	fb->hiz.dirty = NULL;
+	fb->overdraw  = NULL;
+}
+
+bool framebuffer_overdraw_set(Framebuffer* fb, bool on) {
+
+	if (!on) {
+		free(fb->overdraw);
+		fb->overdraw = NULL;
+		return true;
+	}
+
+	if (!fb->overdraw) fb->overdraw = calloc((size_t) fb->width * fb->height, sizeof *fb->overdraw);
+	return fb->overdraw != NULL;
+}
+
+void framebuffer_clear(Framebuffer* fb) {
+
+	framebuffer_clear_rows(fb, 0, fb->height);
+}
+
+// clears rows [y_begin, y_end), bands should start on a multiple of HIZ_TILE_SIZE
+void framebuffer_clear_rows(Framebuffer* fb, uint32_t y_begin, uint32_t y_end) {
+
+	size_t first = (size_t) y_begin * fb->width;
+	size_t n     = (size_t) (y_end - y_begin) * fb->width;
+
+	memset(fb->color + first, 0, n * sizeof(uint32_t));
+	if (fb->overdraw) memset(fb->overdraw + first, 0, n * sizeof *fb->overdraw);
+
+	float far_key = 0.0f;
+	switch (fb->depth.format) {
+	case DEPTH_F32:
+		for (size_t i = first; i < first + n; i++) fb->depth.f32[i] = 1.0f;
+		far_key = 1.0f;
+		break;
+	case DEPTH_U24:
+		for (size_t i = first; i < first + n; i++) fb->depth.u24[i] = DEPTH_U24_MAX;
+		far_key = (float) DEPTH_U24_MAX;
+		break;
+	case DEPTH_F32_REVERSED:
+		memset(fb->depth.f32 + first, 0, n * sizeof(float));
+		far_key = -0.0f;
+		break;
+	default:
+		break;
+	}
+
+	size_t tile_first = (size_t) (y_begin / HIZ_TILE_SIZE) * fb->hiz.tiles_x;
+	size_t tile_last  = (size_t) ((y_end + HIZ_TILE_SIZE - 1) / HIZ_TILE_SIZE) * fb->hiz.tiles_x;
+	for (size_t i = tile_first; i < tile_last; i++) fb->hiz.max[i] = far_key;
+	memset(fb->hiz.dirty + tile_first, 0, tile_last - tile_first);
+}
+
+void hiz_tile_refresh(Framebuffer* fb, size_t tile) {
+
+	uint32_t tx = (uint32_t) (tile % fb->hiz.tiles_x) * HIZ_TILE_SIZE;
+	uint32_t ty = (uint32_t) (tile / fb->hiz.tiles_x) * HIZ_TILE_SIZE;
+	uint32_t tx_end = tx + HIZ_TILE_SIZE < fb->width  ? tx + HIZ_TILE_SIZE : fb->width;
+	uint32_t ty_end = ty + HIZ_TILE_SIZE < fb->height ? ty + HIZ_TILE_SIZE : fb->height;
+
+	float max = -INFINITY;
+	for (uint32_t y = ty; y < ty_end; y++) {
+	for (uint32_t x = tx; x < tx_end; x++) {
+		size_t i = (size_t) y * fb->width + x;
+		float key = 0.0f;
+		switch (fb->depth.format) {
+		case DEPTH_F32:          key =  fb->depth.f32[i];          break;
+		case DEPTH_U24:          key =  (float) fb->depth.u24[i];  break;
+		case DEPTH_F32_REVERSED: key = -fb->depth.f32[i];          break;
+		default:                                                   break;
+		}
+		if (key > max) max = key;
+	}}
+
+	fb->hiz.max[tile]   = max;
+	fb->hiz.dirty[tile] = 0;
+}
+
+// true if a primitive no closer than near_key is hidden in every tile of the rect
+bool hiz_rect_occluded(Framebuffer* fb, int32_t x_min, int32_t y_min, int32_t x_max, int32_t y_max, float near_key) {
+
+	if (x_min < 0) x_min = 0;
+	if (y_min < 0) y_min = 0;
+	if (x_max > (int32_t) fb->width  - 1) x_max = (int32_t) fb->width  - 1;
+	if (y_max > (int32_t) fb->height - 1) y_max = (int32_t) fb->height - 1;
+	if (x_min > x_max || y_min > y_max) return false;
+
+	for (int32_t ty = y_min >> HIZ_TILE_BITS; ty <= y_max >> HIZ_TILE_BITS; ty++) {
+	for (int32_t tx = x_min >> HIZ_TILE_BITS; tx <= x_max >> HIZ_TILE_BITS; tx++) {
+		size_t tile = (size_t) ty * fb->hiz.tiles_x + (size_t) tx;
+		if (!hiz_tile_occluded(fb, tile, near_key)) return false;
+	}}
+
+	return true;
+}
+
+// All formats are affine in 1/z, which makes them linear in screen space.
+void depth_range_set(DepthBuffer* db, float znear, float zfar) {
+
+	float range = zfar - znear;
+
+	switch (db->format) {
+	case DEPTH_F32:
+		db->scale = -znear * zfar / range;
+		db->bias  =  zfar / range;
+		break;
+	case DEPTH_U24:
+		db->scale = -znear * zfar / range * (float) DEPTH_U24_MAX;
+		db->bias  =  zfar / range * (float) DEPTH_U24_MAX;
+		break;
+	case DEPTH_F32_REVERSED:
+		db->scale =  znear * zfar / range;
+		db->bias  = -znear / range;
+		break;
+	default:
+		break;
+	}
+}
+
+const char* depth_format_name(DepthFormat format) {
+
+	switch (format) {
+	case DEPTH_F32:          return "f32";
+	case DEPTH_U24:          return "u24";
+	case DEPTH_F32_REVERSED: return "f32 reversed";
+	default:                 return "?";
+	}
+}
@@ -0,0 +1,306 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../inc/lalg.h"
+#include "../inc/camera.h"
+#include "../inc/framebuffer.h"
+#include "../inc/binner.h"
+#include "../inc/jobs.h"
+#include "../inc/mesh.h"
+#include "../inc/vertex.h"
+#include "../inc/render.h"
+
+// Renders fixed scenes from fixed camera poses without a window and compares
+// every frame against a reference image. The references are written with
+// -u by the single threaded scalar path:
+//
+//	xgolden -t 1 -k scalar -u
+//
+// so a plain run proves that the threaded path and the widest vertex kernel
+// draw the same pixels. Failed cases leave the frame and a diff image in the
+// output directory, the diff shows pixels off by more than the tolerance in
+// red over the dimmed reference.
+
+#define GOLDEN_WIDTH  320
+#define GOLDEN_HEIGHT 180
+#define GOLDEN_DIR    "assets/golden"
+
+typedef struct {
+	const char*  name;
+	const char*  mesh;       // written by objToC -b, relative to the repository
+	V3f          eye;        // from the center of the asset, in its radii
+	bool         mesh_on;
+	bool         grid_on;
+	bool         wireframe;
+	bool         guard_band;
+	CullMode     cull;
+	size_t       lod;        // clamped to the levels of the mesh
+	DepthFormat  depth;
+	HeatmapMode  heatmap;    // only the deterministic ones
+} Case;
+
+static const Case cases[] = {
+	{ "grid",            "assets/cube.srm",   {{ 2.0f, 1.5f, -3.0f }}, false, true,  false, true,  CULL_BACK,  0, DEPTH_F32, HEATMAP_OFF },
+	{ "cube",            "assets/cube.srm",   {{ 2.0f, 1.5f, -3.0f }}, true,  true,  false, true,  CULL_BACK,  0, DEPTH_F32, HEATMAP_OFF },
+	{ "cube_wire",       "assets/cube.srm",   {{-2.5f, 1.0f,  2.0f }}, true,  false, true,  true,  CULL_BACK,  0, DEPTH_F32, HEATMAP_OFF },
+	{ "teapot",          "assets/teapot.srm", {{ 2.0f, 1.0f, -2.0f }}, true,  true,  false, true,  CULL_BACK,  0, DEPTH_F32, HEATMAP_OFF },
+	{ "teapot_top",      "assets/teapot.srm", {{ 0.3f, 3.0f, -0.4f }}, true,  true,  false, true,  CULL_BACK,  0, DEPTH_F32, HEATMAP_OFF },
+	{ "teapot_wire",     "assets/teapot.srm", {{-2.0f, 0.8f,  2.0f }}, true,  false, true,  true,  CULL_BACK,  0, DEPTH_F32, HEATMAP_OFF },
+	{ "teapot_front",    "assets/teapot.srm", {{ 2.0f, 1.0f, -2.0f }}, true,  false, false, true,  CULL_FRONT, 0, DEPTH_F32, HEATMAP_OFF },
+	{ "teapot_lod",      "assets/teapot.srm", {{ 1.5f, 0.8f, -1.5f }}, true,  false, false, true,  CULL_BACK,  2, DEPTH_F32, HEATMAP_OFF },
+	{ "teapot_u24",      "assets/teapot.srm", {{ 2.0f, 1.0f, -2.0f }}, true,  true,  false, true,  CULL_BACK,  0, DEPTH_U24, HEATMAP_OFF },
+	{ "teapot_reversed", "assets/teapot.srm", {{ 2.0f, 1.0f, -2.0f }}, true,  true,  false, true,  CULL_NONE,  0, DEPTH_F32_REVERSED, HEATMAP_OFF },
+	// faces cross the near plane and the sides of the screen
+	{ "clip_guard",      "assets/teapot.srm", {{ 0.6f, 0.05f, 0.0f }}, true,  true,  false, true,  CULL_NONE,  0, DEPTH_F32, HEATMAP_OFF },
+	// Faces crossing the near plane are culled by their homogeneous determinant.
+	// Flat colour hides which side of the surface is drawn, overdraw doesn't.
+	{ "clip_guard_cull", "assets/teapot.srm", {{ 0.6f, 0.05f, 0.0f }}, true,  true,  false, true,  CULL_BACK,  0, DEPTH_F32, HEATMAP_OVERDRAW },
+	{ "clip_frustum",    "assets/teapot.srm", {{ 0.6f, 0.05f, 0.0f }}, true,  true,  false, false, CULL_NONE,  0, DEPTH_F32, HEATMAP_OFF },
+	{ "overdraw",        "assets/teapot.srm", {{ 1.2f, 0.6f, -1.2f }}, true,  true,  false, true,  CULL_NONE,  0, DEPTH_F32, HEATMAP_OVERDRAW }
+};
+
+#define CASE_COUNT (sizeof cases / sizeof *cases)
+
+// how far a frame may be off its reference
+typedef struct {
+	uint32_t channel;  // largest difference of a colour channel that still counts as equal
+	size_t   pixels;   // pixels that may differ by more
+} Tolerance;
+
+static bool ppm_write(const char* path, const uint32_t* pixels, uint32_t width, uint32_t height) {
+
+	FILE* out = fopen(path, "wb");
+	if (!out) return false;
+
+	fprintf(out, "P6\n%u %u\n255\n", width, height);
+	for (size_t i = 0; i < (size_t) width * height; i++) {
+		uint8_t rgb[3] = { (uint8_t) (pixels[i] >> 16), (uint8_t) (pixels[i] >> 8), (uint8_t) pixels[i] };
+		fwrite(rgb, 1, sizeof rgb, out);
+	}
+
+	return fclose(out) == 0;
+}
+
+// binary PPM as written by ppm_write, into pixels of width x height
+static bool ppm_read(const char* path, uint32_t* pixels, uint32_t width, uint32_t height) {
+
+	FILE* in = fopen(path, "rb");
+	if (!in) return false;
+
+	uint32_t w = 0, h = 0, max = 0;
+	bool ok = fscanf(in, "P6 %u %u %u", &w, &h, &max) == 3 && fgetc(in) != EOF &&
+		  w == width && h == height && max == 255;
+	for (size_t i = 0; ok && i < (size_t) width * height; i++) {
+		uint8_t rgb[3];
+		ok = fread(rgb, 1, sizeof rgb, in) == sizeof rgb;
+		pixels[i] = (uint32_t) rgb[0] << 16 | (uint32_t) rgb[1] << 8 | rgb[2];
+	}
+
+	fclose(in);
+	return ok;
+}
+
+static uint32_t channel_diff(uint32_t a, uint32_t b, int shift) {
+
+	int32_t d = (int32_t) ((a >> shift) & 0xFF) - (int32_t) ((b >> shift) & 0xFF);
+	return (uint32_t) (d < 0 ? -d : d);
+}
+
+// Counts the pixels off by more than the tolerance and marks them in diff,
+// the others show the reference at a quarter of its brightness.
+static size_t image_compare(const uint32_t* frame, const uint32_t* ref, uint32_t* diff, size_t count,
+			    uint32_t channel, uint32_t* max_diff) {
+
+	size_t bad = 0;
+	*max_diff  = 0;
+	for (size_t i = 0; i < count; i++) {
+		uint32_t d = 0;
+		for (int shift = 0; shift <= 16; shift += 8) {
+			uint32_t c = channel_diff(frame[i], ref[i], shift);
+			d = c > d ? c : d;
+		}
+		*max_diff = d > *max_diff ? d : *max_diff;
+
+		if (d > channel) {
+			diff[i] = 0x00FF0000;
+			bad += 1;
+		} else {
+			diff[i] = (ref[i] >> 2) & 0x003F3F3F;
+		}
+	}
+	return bad;
+}
+
+static bool case_render(const Case* c, Jobs* jobs, Binner* binner, Framebuffer* fb) {
+
+	MeshLods lods;
+	if (!mesh_load(&lods, c->mesh)) {
+		fprintf(stderr, "Failed to load %s.\n", c->mesh);
+		return false;
+	}
+
+	Renderer renderer;
+	if (!renderer_create(&renderer, &lods, jobs, binner) ||
+	    !framebuffer_overdraw_set(fb, c->heatmap == HEATMAP_OVERDRAW)) {
+		fprintf(stderr, "Failed to set up the renderer for %s.\n", c->name);
+		mesh_unload(&lods);
+		return false;
+	}
+
+	const Mesh* mesh = &lods.lod[0];
+	V3f center = mesh->center;
+	V3f eye    = add_3f(center, scal_3f(mesh->radius, c->eye));
+
+	Camera camera;
+	camera_default_set(&camera);
+	camera_look_at(&camera, eye, center);
+
+	fb->depth.format = c->depth;
+	depth_range_set(&fb->depth, camera.znear, camera.zfar);
+	framebuffer_clear(fb);
+
+	RenderOptions options = {
+		.grid_on    = c->grid_on,
+		.mesh_on    = c->mesh_on,
+		.wireframe  = c->wireframe,
+		.guard_band = c->guard_band,
+		.cull       = c->cull,
+		.heatmap    = c->heatmap
+	};
+	size_t      lod = c->lod < lods.lod_count ? c->lod : lods.lod_count - 1;
+	RenderStats stats;
+	renderer_draw(&renderer, fb, camera, lod, &options, &stats);
+
+	// an image with primitives missing is no reference for anything
+	if (stats.dropped) fprintf(stderr, "Ran out of memory binning %s, %zu primitives dropped.\n", c->name, stats.dropped);
+
+	renderer_destroy(&renderer);
+	mesh_unload(&lods);
+	return !stats.dropped;
+}
+
+int main(int argc, char** argv) {
+
+	long      cpus    = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t  threads = cpus > 0 ? (uint32_t) cpus : 1;
+	VertexIsa isa     = VERTEX_ISA_COUNT;
+	Tolerance tolerance = { .channel = 0, .pixels = 0 };
+	const char* out_dir = ".";
+	bool update = false;
+
+	// cases named on the command line, all of them otherwise
+	bool picked[CASE_COUNT] = {0};
+	bool any   = false;
+	bool usage = false;
+	for (int i = 1; i < argc && !usage; i++) {
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			threads = (uint32_t) strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+			i++;
+			for (isa = 0; isa < VERTEX_ISA_COUNT; isa++) {
+				if (strcmp(argv[i], vertex_isa_name(isa)) == 0) break;
+			}
+			usage = isa == VERTEX_ISA_COUNT;
+		} else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+			tolerance.channel = (uint32_t) strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+			tolerance.pixels = (size_t) strtoull(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+			out_dir = argv[++i];
+		} else if (strcmp(argv[i], "-u") == 0) {
+			update = true;
+		} else {
+			size_t c = 0;
+			while (c < CASE_COUNT && strcmp(argv[i], cases[c].name) != 0) c++;
+			usage = c == CASE_COUNT;
+			if (!usage) picked[c] = any = true;
+		}
+	}
+	if (usage) {
+		fprintf(stderr, "usage: %s [-t threads] [-k scalar|sse2|avx2|avx512] [-e channel tolerance] "
+				"[-p pixel tolerance] [-o diff directory] [-u] [case ...]\ncases:", argv[0]);
+		for (size_t c = 0; c < CASE_COUNT; c++) fprintf(stderr, " %s", cases[c].name);
+		fprintf(stderr, "\n");
+		return EXIT_FAILURE;
+	}
+	if (threads < 1) threads = 1;
+	VertexIsa picked_isa = vertex_kernel_init(isa);
+	if (isa != VERTEX_ISA_COUNT && picked_isa != isa) {
+		fprintf(stderr, "%s is not supported.\n", vertex_isa_name(isa));
+		return EXIT_FAILURE;
+	}
+
+	size_t      count = (size_t) GOLDEN_WIDTH * GOLDEN_HEIGHT;
+	size_t      bytes = (count * sizeof(uint32_t) + 63) & ~(size_t) 63;
+	Jobs*       jobs  = calloc(1, sizeof *jobs);
+	uint32_t*   color = aligned_alloc(64, bytes);
+	uint32_t*   ref   = malloc(count * sizeof *ref);
+	uint32_t*   diff  = malloc(count * sizeof *diff);
+	Framebuffer fb    = {0};
+	Binner      binner;
+	if (!jobs || !color || !ref || !diff || !jobs_create(jobs, threads) ||
+	    !binner_create(&binner, GOLDEN_WIDTH, GOLDEN_HEIGHT, GEOMETRY_CHUNKS) ||
+	    !framebuffer_init(&fb, color, GOLDEN_WIDTH, GOLDEN_HEIGHT, DEPTH_F32)) {
+		fprintf(stderr, "Failed to set up %u render threads.\n", threads);
+		return EXIT_FAILURE;
+	}
+
+	printf("%ux%u, %u threads, %s, tolerance %u per channel and %zu pixels\n", GOLDEN_WIDTH, GOLDEN_HEIGHT,
+	       threads, vertex_isa_name(vertex_kernel_isa()), tolerance.channel, tolerance.pixels);
+
+	size_t failed = 0, run = 0;
+	for (size_t i = 0; i < CASE_COUNT; i++) {
+		const Case* c = &cases[i];
+		if (any && !picked[i]) continue;
+		run++;
+
+		if (!case_render(c, jobs, &binner, &fb)) {
+			failed++;
+			continue;
+		}
+
+		char path[512];
+		snprintf(path, sizeof path, "%s/%s.ppm", GOLDEN_DIR, c->name);
+		if (update) {
+			bool ok = ppm_write(path, color, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+			printf("%-16s %s\n", c->name, ok ? "updated" : "failed to write the reference");
+			failed += ok ? 0 : 1;
+			continue;
+		}
+
+		if (!ppm_read(path, ref, GOLDEN_WIDTH, GOLDEN_HEIGHT)) {
+			printf("%-16s FAIL, no reference %s, -u writes it\n", c->name, path);
+			failed++;
+			continue;
+		}
+
+		uint32_t max_diff = 0;
+		size_t   bad      = image_compare(color, ref, diff, count, tolerance.channel, &max_diff);
+		if (bad <= tolerance.pixels) {
+			printf("%-16s ok, %zu pixels off, max difference %u\n", c->name, bad, max_diff);
+			continue;
+		}
+
+		failed++;
+		char frame_path[512];
+		snprintf(frame_path, sizeof frame_path, "%s/%s.ppm", out_dir, c->name);
+		snprintf(path, sizeof path, "%s/%s_diff.ppm", out_dir, c->name);
+		bool written = ppm_write(frame_path, color, GOLDEN_WIDTH, GOLDEN_HEIGHT) &&
+			       ppm_write(path, diff, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+		printf("%-16s FAIL, %zu pixels off, max difference %u, %s %s\n", c->name, bad, max_diff,
+		       written ? "see" : "failed to write", path);
+	}
+
+	printf("%zu of %zu cases %s\n", run - failed, run, update ? "updated" : "passed");
+
+	framebuffer_free(&fb);
+	binner_destroy(&binner);
+	jobs_destroy(jobs);
+	free(jobs);
+	free(color);
+	free(ref);
+	free(diff);
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,389 @@
+#include "../inc/jobs.h"
+#include "../inc/trace.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static _Thread_local uint32_t job_thread = 0;
+
+typedef struct {
+	Jobs*    jobs;
+	uint32_t index;
+} JobThreadArg;
+
+uint64_t jobs_time_ns(void) {
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+
+static bool deque_push(JobDeque* d, Job* job) {
+
+	long long b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+	long long t = atomic_load_explicit(&d->top, memory_order_acquire);
+	if (b - t >= JOB_DEQUE_SIZE) return false;
+
+	atomic_store_explicit(&d->buffer[b % JOB_DEQUE_SIZE], job, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+
+	return true;
+}
+
+static Job* deque_pop(JobDeque* d) {
+
+	long long b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+	atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	long long t = atomic_load_explicit(&d->top, memory_order_relaxed);
+
+	if (t > b) {
+		atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+		return NULL;
+	}
+
+	Job* job = atomic_load_explicit(&d->buffer[b % JOB_DEQUE_SIZE], memory_order_relaxed);
+	if (t == b) {
+		// last item, race against thieves for it
+		if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+				memory_order_seq_cst, memory_order_relaxed)) {
+			job = NULL;
+		}
+		atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+	}
+
+	return job;
+}
+
+static Job* deque_steal(JobDeque* d) {
+
+	long long t = atomic_load_explicit(&d->top, memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	long long b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+	if (t >= b) return NULL;
+
+	Job* job = atomic_load_explicit(&d->buffer[t % JOB_DEQUE_SIZE], memory_order_relaxed);
+	if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+			memory_order_seq_cst, memory_order_relaxed)) {
+		return NULL;
+	}
+
+	return job;
+}
+
+static bool deque_empty(JobDeque* d) {
+
+	return atomic_load(&d->top) >= atomic_load(&d->bottom);
+}
+
+static void job_execute(Jobs* j, Job* job);
+
+static void job_push(Jobs* j, Job* job) {
+
+	// a full deque just runs the job right away
+	if (!deque_push(&j->deques[job_thread], job)) {
+		job_execute(j, job);
+		return;
+	}
+
+	atomic_thread_fence(memory_order_seq_cst);
+	if (atomic_load(&j->sleepers) > 0) {
+		pthread_mutex_lock(&j->lock);
+		pthread_cond_broadcast(&j->wake);
+		pthread_mutex_unlock(&j->lock);
+	}
+}
+
+static void job_finish(Jobs* j, Job* job) {
+
+	if (atomic_fetch_sub(&job->pending, 1) != 1) return;
+
+	// Once done is set a waiter may reset the arena and reuse this job, so
+	// everything needed afterwards is copied first. done can't move behind
+	// the release of the successors and the parent either: their completion
+	// may end the frame just the same, and the store would hit a reused job.
+	Job*     successors[JOB_MAX_SUCCESSORS];
+	uint32_t count  = job->successor_count;
+	Job*     parent = job->parent;
+	memcpy(successors, job->successors, count * sizeof *successors);
+	atomic_store_explicit(&job->done, true, memory_order_release);
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (atomic_fetch_sub(&successors[i]->deps, 1) == 1) job_push(j, successors[i]);
+	}
+	if (parent) job_finish(j, parent);
+}
+
+static Job* job_alloc(Jobs* j, const char* name, JobFn fn, void* arg, size_t begin, size_t end);
+
+static void job_run(Jobs* j, const char* name, JobFn fn, void* arg, size_t begin, size_t end) {
+
+	uint64_t start = jobs_time_ns();
+	{
+		TRACE_SCOPE(name);
+		fn(arg, begin, end);
+	}
+
+	JobLog* log = &j->logs[job_thread];
+	if (log->count < JOB_LOG_SIZE) {
+		log->records[log->count++] = (JobTiming) {
+			.name     = name,
+			.thread   = job_thread,
+			.start_ns = start,
+			.end_ns   = jobs_time_ns()
+		};
+	}
+}
+
+static void job_execute(Jobs* j, Job* job) {
+
+	if (job->chunks > 0) {
+		// stage: split the range into children that can be stolen
+		size_t count = job->end - job->begin;
+		atomic_fetch_add(&job->pending, (int) job->chunks);
+		for (size_t c = 0; c < job->chunks; c++) {
+			size_t b = job->begin + count * c / job->chunks;
+			size_t e = job->begin + count * (c + 1) / job->chunks;
+			Job* child = job_alloc(j, job->name, job->fn, job->arg, b, e);
+			if (!child) {
+				// a full arena runs the rest of the range right here
+				job_run(j, job->name, job->fn, job->arg, b, job->end);
+				atomic_fetch_sub(&job->pending, (int) (job->chunks - c));
+				break;
+			}
+			child->parent = job;
+			job_push(j, child);
+		}
+	} else {
+		job_run(j, job->name, job->fn, job->arg, job->begin, job->end);
+	}
+
+	job_finish(j, job);
+}
+
+static Job* job_find(Jobs* j) {
+
+	Job* job = deque_pop(&j->deques[job_thread]);
+	if (job) return job;
+
+	// parked threads may still hold queued jobs, so everyone is a victim
+	for (uint32_t i = 1; i < j->count; i++) {
+		uint32_t victim = (job_thread + i) % j->count;
+		job = deque_steal(&j->deques[victim]);
+		if (job) return job;
+	}
+
+	return NULL;
+}
+
+static bool any_work(Jobs* j) {
+
+	for (uint32_t i = 0; i < j->count; i++) {
+		if (!deque_empty(&j->deques[i])) return true;
+	}
+	return false;
+}
+
+static void* job_thread_main(void* data) {
+
+	JobThreadArg* arg = data;
+	Jobs* j = arg->jobs;
+	job_thread = arg->index;
+	free(arg);
+
+	uint32_t idle = 0;
+	while (!atomic_load(&j->quit)) {
+		Job* job = job_thread < atomic_load(&j->active) ? job_find(j) : NULL;
+		if (job) {
+			job_execute(j, job);
+			idle = 0;
+			continue;
+		}
+
+		// spin a little before going to sleep
+		if (++idle < 256) continue;
+
+		// only active sleepers make job_push wake everyone up
+		pthread_mutex_lock(&j->lock);
+		bool parked = job_thread >= atomic_load(&j->active);
+		if (!parked) atomic_fetch_add(&j->sleepers, 1);
+		if (!atomic_load(&j->quit) && (parked || !any_work(j))) pthread_cond_wait(&j->wake, &j->lock);
+		if (!parked) atomic_fetch_sub(&j->sleepers, 1);
+		pthread_mutex_unlock(&j->lock);
+		idle = 0;
+	}
+
+	return NULL;
+}
+
+bool jobs_create(Jobs* j, uint32_t count) {
+
+	if (count == 0) count = 1;
+
+	j->count   = count;
+	j->threads = calloc(count, sizeof *j->threads);
+	j->deques  = calloc(count, sizeof *j->deques);
+	j->logs    = calloc(count, sizeof *j->logs);
+	if (!j->threads || !j->deques || !j->logs) return false;
+
+	atomic_init(&j->active, count);
+	atomic_init(&j->arena_used, 0);
+	atomic_init(&j->sleepers, 0);
+	atomic_init(&j->quit, false);
+	pthread_mutex_init(&j->lock, NULL);
+	pthread_cond_init(&j->wake, NULL);
+
+	// thread 0 is the main thread, it runs jobs while it waits for them
+	job_thread = 0;
+	for (uint32_t i = 1; i < count; i++) {
+		JobThreadArg* arg = malloc(sizeof *arg);
+		if (!arg) return false;
+		*arg = (JobThreadArg) { .jobs = j, .index = i };
+		if (pthread_create(&j->threads[i], NULL, job_thread_main, arg) != 0) {
+			free(arg);
+			j->count = i;
+			atomic_store(&j->active, i);
+			break;
+		}
+	}
+
+	return true;
+}
+
+void jobs_destroy(Jobs* j) {
+
+	pthread_mutex_lock(&j->lock);
+	atomic_store(&j->quit, true);
+	pthread_cond_broadcast(&j->wake);
+	pthread_mutex_unlock(&j->lock);
+
+	for (uint32_t i = 1; i < j->count; i++) pthread_join(j->threads[i], NULL);
+
+	pthread_cond_destroy(&j->wake);
+	pthread_mutex_destroy(&j->lock);
+	free(j->threads);
+	free(j->deques);
+	free(j->logs);
+}
+
+void jobs_active_set(Jobs* j, uint32_t active) {
+
+	if (active < 1) active = 1;
+	if (active > j->count) active = j->count;
+
+	pthread_mutex_lock(&j->lock);
+	atomic_store(&j->active, active);
+	pthread_cond_broadcast(&j->wake);
+	pthread_mutex_unlock(&j->lock);
+}
+
+uint32_t jobs_thread_index(void) {
+
+	return job_thread;
+}
+
+void jobs_frame_reset(Jobs* j) {
+
+	atomic_store(&j->arena_used, 0);
+	for (uint32_t i = 0; i < j->count; i++) j->logs[i].count = 0;
+}
+
+// NULL once the arena is used up
+static Job* job_alloc(Jobs* j, const char* name, JobFn fn, void* arg, size_t begin, size_t end) {
+
+	size_t idx = atomic_fetch_add(&j->arena_used, 1);
+	if (idx >= JOB_ARENA_SIZE) return NULL;
+
+	Job* job = &j->arena[idx];
+	job->fn              = fn;
+	job->arg             = arg;
+	job->begin           = begin;
+	job->end             = end;
+	job->name            = name;
+	job->chunks          = 0;
+	job->parent          = NULL;
+	job->successor_count = 0;
+	atomic_init(&job->pending, 1);
+	atomic_init(&job->deps, 0);
+	atomic_init(&job->done, false);
+
+	return job;
+}
+
+Job* jobs_add(Jobs* j, const char* name, JobFn fn, void* arg, size_t begin, size_t end) {
+
+	// stages fall back to running inline, but a job the caller holds on to
+	// has nowhere else to live: that many jobs per frame is a bug
+	Job* job = job_alloc(j, name, fn, arg, begin, end);
+	if (!job) abort();
+
+	return job;
+}
+
+// a stage that runs fn on chunks pieces of [begin, end) in parallel
+Job* jobs_parallel_for(Jobs* j, const char* name, JobFn fn, void* arg, size_t begin, size_t end, size_t chunks) {
+
+	Job* job = jobs_add(j, name, fn, arg, begin, end);
+	job->chunks = chunks < end - begin ? chunks : end - begin;
+
+	return job;
+}
+
+// edges have to be added before either job is submitted
+void jobs_depend(Job* before, Job* after) {
+
+	if (before->successor_count == JOB_MAX_SUCCESSORS) abort();
+
+	before->successors[before->successor_count++] = after;
+	atomic_fetch_add(&after->deps, 1);
+}
+
+// jobs still waiting for dependencies are started by whoever finishes the last one
+void jobs_submit(Jobs* j, Job* job) {
+
+	if (atomic_load(&job->deps) == 0) job_push(j, job);
+}
+
+void jobs_wait(Jobs* j, Job* job) {
+
+	while (!atomic_load_explicit(&job->done, memory_order_acquire)) {
+		Job* next = job_find(j);
+		if (next) job_execute(j, next);
+	}
+}
+
+size_t jobs_timings(const Jobs* j, uint32_t thread, const JobTiming** records) {
+
+	*records = j->logs[thread].records;
+	return j->logs[thread].count;
+}
+
+// wall time from the first chunk of a stage starting to the last one ending
+double jobs_stage_ms(const Jobs* j, const char* name) {
+
+	uint64_t start = UINT64_MAX;
+	uint64_t end   = 0;
+
+	for (uint32_t t = 0; t < j->count; t++) {
+		const JobLog* log = &j->logs[t];
+		for (size_t i = 0; i < log->count; i++) {
+			if (strcmp(log->records[i].name, name) != 0) continue;
+			if (log->records[i].start_ns < start) start = log->records[i].start_ns;
+			if (log->records[i].end_ns   > end)   end   = log->records[i].end_ns;
+		}
+	}
+
+	return end > start ? (double) (end - start) / 1e6 : 0.0;
+}
+
+// time a thread spent inside jobs, compare threads to see load imbalance
+double jobs_busy_ms(const Jobs* j, uint32_t thread) {
+
+	uint64_t busy = 0;
+	const JobLog* log = &j->logs[thread];
+	for (size_t i = 0; i < log->count; i++) busy += log->records[i].end_ns - log->records[i].start_ns;
+
+	return (double) busy / 1e6;
+}
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <string.h>
 #include <limits.h>
 #include <time.h>
 #include <sanitizer/lsan_interface.h>
@@ -8,48 +9,69 @@
 #include "../inc/camera.h"
 #include "../inc/text.h"
 #include "../inc/color.h"
-#include "../assets/asset_cube.h"
-#include "../assets/asset_teapot.h"
-
-static         size_t lines_count_global    = 0;
-static         size_t triangle_count_global = 0;
-
-static const uint32_t SCREEN_WIDTH  = 1920;
-static const uint32_t SCREEN_HEIGHT = 1080;
-static const uint32_t PIXELS_NUMBER = SCREEN_WIDTH*SCREEN_HEIGHT;
+#include "../inc/raster.h"
+#include "../inc/framebuffer.h"
+#include "../inc/binner.h"
+#include "../inc/jobs.h"
+#include "../inc/mesh.h"
+#include "../inc/vertex.h"
+#include "../inc/cull.h"
+#include "../inc/render.h"
+#include "../inc/trace.h"
+
+// window or headless framebuffer size, -s changes it
+static uint32_t screen_width  = 1920;
+static uint32_t screen_height = 1080;
+
+// frames a headless run renders unless -f says otherwise
+#define HEADLESS_FRAMES 100
+// frames a trace covers unless -n says otherwise
+#define TRACE_FRAMES    10
 
 typedef struct {
 	SDL_Window*  window;
 	SDL_Surface* surface;
 	SDL_Event    event;
 	size_t       bytes_per_pixel;
+	Framebuffer  fb;
+	uint32_t*    pixels;  // color buffer of a headless context, the window surface otherwise
 } SDLContext;
 
 typedef struct {
 	uint32_t flags;
 	bool grid_on;
 	bool wireframe;
+	bool guard_band;
+	CullMode cull;
+	float lod_pixels;  // screen space error a level of detail may have
+	HeatmapMode heatmap;
 } State;
 
 State state = {
 	.flags = 0,
 	.grid_on = true,
-	.wireframe = true
+	.wireframe = true,
+	.guard_band = true,
+	.cull = CULL_BACK,
+	.lod_pixels = 1.0f,
+	.heatmap = HEATMAP_OFF
 };
 
 void pixel_set(uint32_t x, uint32_t y, uint32_t* buffer, uint32_t color)
 {
 
-if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+if (x >= screen_width || y >= screen_height) return;
 
 
 	//printf("here! ps\n");
-    buffer[y * SCREEN_WIDTH + x] = color;
+    buffer[y * screen_width + x] = color;
 }
 
 void memory_free(SDLContext* ctx) {
 
-	SDL_DestroyWindow(ctx->window);
+	framebuffer_free(&ctx->fb);
+	if (ctx->window) SDL_DestroyWindow(ctx->window);
+	else             free(ctx->pixels);
 	free(ctx);
 }
 
@@ -60,260 +82,75 @@ void context_sdl_init(SDLContext* ctx) {
 
 	SDL_Init(SDL_INIT_VIDEO);
 	ctx->window = SDL_CreateWindow("SoftRend", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
-						   SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN);
+						   screen_width, screen_height, SDL_WINDOW_SHOWN);
 	if (!ctx->window) fprintf(stderr, "Failed to create window. Error: %s\n", SDL_GetError());
 
 	ctx->surface = SDL_GetWindowSurface(ctx->window);
 	ctx->bytes_per_pixel = ctx->surface->format->BytesPerPixel;
 
+	// depth buffer lives right next to the window surface
+	ctx->pixels = ctx->surface->pixels;
+	if (!framebuffer_init(&ctx->fb, ctx->pixels, screen_width, screen_height, DEPTH_F32)) {
+		fprintf(stderr, "Failed to allocate depth buffer.\n");
+	}
 
 	SDL_SetRelativeMouseMode(SDL_TRUE);
 	__lsan_enable();
 }
 
-static inline V3f world_to_view(V3f v_in, Camera c) {
-
-	V3f res   = {0};
-	V3f right = norm_3f(cross_3f(c.forward, c.up));
-
-	V3f rel = {
-		.x = v_in.x - c.position.x,
-		.y = v_in.y - c.position.y,
-		.z = v_in.z - c.position.z
-	};
-
-        res.x = rel.x * right.x     + rel.y * right.y     + rel.z * right.z;
-        res.y = rel.x * c.up.x      + rel.y * c.up.y      + rel.z * c.up.z;
-        res.z = rel.x * c.forward.x + rel.y * c.forward.y + rel.z * c.forward.z;
-
-	return res;
-}
-
-V2s get_image_crd(V3f v, Camera camera) {
-
-	const float a = (float) SCREEN_HEIGHT / (float) SCREEN_WIDTH;
-	const float f = 1 / tanf(0.5f * camera.fovy * M_PI / 180.0f);
-
-	float px = a * f * v.x;
-	float py = f * v.y;
-	float pz = fmaxf(v.z, camera.znear);
-
-	// perspective divide
-	px /= pz;
-	py /= pz;
-
-	int32_t x_screen = (int32_t)((px + 1.0f) * 0.5f * (int32_t)SCREEN_WIDTH);
-	int32_t y_screen = (int32_t)((1.0f - py) * 0.5f * (int32_t)SCREEN_HEIGHT);
-	// Clamp to avoid overflow of small V2s types
-	if (x_screen < INT32_MIN) x_screen = INT32_MIN;
-	if (x_screen > INT32_MAX) x_screen = INT32_MAX;
-	if (y_screen < INT32_MIN) y_screen = INT32_MIN;
-	if (y_screen > INT32_MAX) y_screen = INT32_MAX;
-
-	return (V2s){ x_screen, y_screen };
-}
-
-#define XMIN 40
-#define YMIN 40
-#define XMAX (SCREEN_WIDTH - 40)
-#define YMAX (SCREEN_HEIGHT - 40)
-
-static const float EPS = 1e-12;
-
-// Liang–Barsky clipping.
-bool clipline(int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2) {
-
-	const float dx = (float) (*x2 - *x1);
-	const float dy = (float) (*y2 - *y1);
-
-	float p[4] = { -dx, dx, -dy, dy };
-	float q[4] = { *x1 - (float) XMIN, (float) XMAX - *x1,
-		       *y1 - (float) YMIN, (float) YMAX - *y1 };
-
-	float u1 = 0.0f;
-	float u2 = 1.0f;
-
-	for (int i = 0; i < 4; ++i) {
-		float pi = p[i];
-		float qi = q[i];
-
-		/* Handle near-parallel (pi == 0) robustly */
-		if (fabs(pi) < EPS) {
-			if (qi < 0.0f) return false;
-		} else {
-			float r = qi / pi;
-	                if (pi < 0.0f) {
-                		if (r > u1) u1 = r;
-			} else {
-		                if (r < u2) u2 = r;
-           		}
-			if (u1 > u2) return false;
-            	}
-	}
-
-	/* compute clipped coordinates using original x1,y1,d */
-	float nx1 = *x1 + u1 * dx;
-	float ny1 = *y1 + u1 * dy;
-	float nx2 = *x1 + u2 * dx;
-	float ny2 = *y1 + u2 * dy;
-
-	/* round to nearest integer (llround available in math.h) */
-	*x1 = (int32_t) llroundf(nx1);
-	*y1 = (int32_t) llroundf(ny1);
-	*x2 = (int32_t) llroundf(nx2);
-	*y2 = (int32_t) llroundf(ny2);
-
-	return true;
-}
-
-void line_draw(V3f p1, V3f p2, uint32_t* buffer, uint32_t color, Camera camera) {
-
-	// change to cam basis for near-plane clipping
-	p1 = world_to_view(p1, camera);
-	p2 = world_to_view(p2, camera);
-
-	if (p1.z <= camera.znear && p2.z <= camera.znear) return;
-
-	// this implies p1.z > c.znear
-	if (p1.z < camera.znear) {
-		// get new p0 behind clipping plane
-		p1 = intersect_z(p2, p1, camera.znear);
-	}
-
-	// this implies p0.z > c.znear
-	if (p2.z < camera.znear) {
-		p2 = intersect_z(p1, p2, camera.znear);
-	}
-
-	V2s start = get_image_crd(p1, camera);
-	V2s end   = get_image_crd(p2, camera);
-
-	if ( start.x < (int32_t) XMIN && end.x < (int32_t) XMIN) return;
-	if ( start.y < (int32_t) YMIN && end.y < (int32_t) YMIN) return;
-	if ( start.x > (int32_t) XMAX && end.x > (int32_t) XMAX) return;
-	if ( start.y > (int32_t) YMAX && end.y > (int32_t) YMAX) return;
-
-	if (!clipline(&start.x, &start.y, &end.x, &end.y)) {
-		return;
-	}
-	lines_count_global += 1;
-
-	int32_t dx =  abs((int32_t)end.x - (int32_t)start.x);
-	int32_t sx = (int32_t)start.x < (int32_t)end.x ? 1 : -1;
-
-	int32_t dy = -abs((int32_t)end.y - (int32_t)start.y);
-	int32_t sy = (int32_t)start.y < (int32_t)end.y ? 1 : -1;
-
-	int32_t err = dx + dy;
-	while (1) {
-		pixel_set(start.x, start.y, buffer, color);
-		if (start.x == end.x && start.y == end.y) break;
-		int32_t e2 = 2 * err;
-		if (e2 > dy) { err += dy; start.x += sx; }
-		if (e2 < dx) { err += dx; start.y += sy; }
-	}
-}
-
-
-
-void grid_draw(uint32_t* buffer, Camera camera) {
-
-	int32_t grid_const = 40;
-	uint32_t color = BLUE;
-
-	for (int32_t i = -grid_const; i <= grid_const; i+=1) {
-		V3f p1 = { .x = (float) i, .y = 0.0f, .z = -((float) grid_const) };
-		V3f p2 = { .x = (float) i, .y = 0.0f, .z = +((float) grid_const) };
-		line_draw(p1, p2, buffer, color, camera);
-	}
-
-	for (int32_t i = -grid_const; i <= grid_const; i+=1) {
-		V3f p1 = { .x = -((float) grid_const), .y = 0.0f, .z = (float) i};
-		V3f p2 = { .x = +((float) grid_const), .y = 0.0f, .z = (float) i};
-		line_draw(p1, p2, buffer, color, camera);
-	}
-}
+// Renders into plain memory without initializing SDL, for machines without
+// a display. There are no events, the camera stays where it starts.
+bool context_headless_init(SDLContext* ctx) {
 
-void buffer_flush(uint32_t* buffer, uint8_t bytes_per_pixel) {
+	// whole cache lines, like the other per pixel buffers
+	size_t bytes = ((size_t) screen_width * screen_height * sizeof(uint32_t) + 63) & ~(size_t) 63;
+	ctx->pixels = aligned_alloc(64, bytes);
+	if (!ctx->pixels) return false;
 
-	memset(buffer, 0, PIXELS_NUMBER * bytes_per_pixel);
+	ctx->bytes_per_pixel = sizeof(uint32_t);
+	return framebuffer_init(&ctx->fb, ctx->pixels, screen_width, screen_height, DEPTH_F32);
 }
 
-bool is_point_in_triangle(V2u p, Triangle t) {
-
-	V3f v1 = t.v1;
-	V3f v2 = t.v2;
-	V3f v3 = t.v3;
-
-	V2s a = { .x = (int32_t)v1.x, .y = (int32_t)v1.y };
-	V2s b = { .x = (int32_t)v2.x, .y = (int32_t)v2.y };
-	V2s c = { .x = (int32_t)v3.x, .y = (int32_t)v3.y };
-	V2s s = { .x = (int32_t) p.x, .y = (int32_t) p.y };
+#define HUD_LINES       6
 
-	int32_t as_x = s.x - a.x;
-	int32_t as_y = s.y - a.y;
+// the HUD lines of a frame
+typedef struct {
+	Framebuffer* fb;
+	char         hud[HUD_LINES][256];
+} Hud;
 
-	bool s_ab = (b.x - a.x) * as_y - (b.y - a.y) * as_x > 0;
+static void job_hud(void* arg, size_t begin, size_t end) {
 
-	if (( (c.x - a.x) * as_y - (c.y - a.y) * as_x > 0 ) == s_ab) return false;
-	if (( (c.x - b.x) * (s.y - b.y) - (c.y - b.y) * (s.x - b.x)  > 0 ) != s_ab) return false;
-	return true;
-}
+	Hud* f = arg;
 
-void triangle_draw(Triangle t, uint32_t* buffer, Camera camera, Color color) {
-
-	if (state.wireframe) {
-		line_draw(t.v1, t.v2, buffer, color, camera);
-		line_draw(t.v1, t.v3, buffer, color, camera);
-		line_draw(t.v2, t.v3, buffer, color, camera);
-	} else {
-		/*
-		V2s v1 = get_image_crd(t.v1, camera);
-		V2s v2 = get_image_crd(t.v2, camera);
-		V2s v3 = get_image_crd(t.v3, camera);
-
-		uint32_t x_min = v1.x;
-		if (v2.x < x_min) x_min = v2.x;
-		if (v3.x < x_min) x_min = v3.x;
-		uint32_t x_max = t.v1.x;
-		if (v2.x > x_max) x_max = v2.x;
-		if (v3.x > x_max) x_max = v3.x;
-		uint32_t y_min = t.v1.y;
-		if (v2.y < y_min) y_min = v2.y;
-		if (v3.y < y_min) y_min = v3.y;
-		uint32_t y_max = t.v1.y;
-		if (v2.y > y_max) y_max = v2.y;
-		if (v3.y > y_max) y_max = v3.y;
-
-		for(uint32_t x = x_min; x <= x_max; x++) {
-		for(uint32_t y = y_min; y <= y_max; y++) {
-			V2u p = (V2u) { x, y };
-			if (is_point_in_triangle(p, t)) {
-				pixel_set(x, y, buffer, color);
-			}
-		}}
-	*/
+	for (size_t i = begin; i < end; i++) {
+		TRACE_SCOPE("text");
+		text_render(f->hud[i], 0, (uint32_t) i * 2 * CHAR_HEIGHT_FONT, f->fb->color, GREEN, 2);
 	}
 }
 
 void time_measure_start(struct timespec* t0) {
 
 	*t0 = (struct timespec){0};
-	timespec_get(t0, TIME_UTC);
+	clock_gettime(CLOCK_MONOTONIC, t0);
 }
 
 double time_measure_end_ms(struct timespec* t1, struct timespec* t0) {
 
 	*t1 = (struct timespec){0};
-	timespec_get(t1, TIME_UTC);
+	clock_gettime(CLOCK_MONOTONIC, t1);
 
-	long dns = t1->tv_nsec - t0->tv_nsec;
-	double frame_time_ms = (double) dns / (1000 * 1000);
+	// the nanoseconds alone wrap around every second
+	double frame_time_ms = (double) (t1->tv_sec - t0->tv_sec) * 1e3 + (double) (t1->tv_nsec - t0->tv_nsec) / 1e6;
 
 	return frame_time_ms;
 }
 
-void event_loop(SDLContext* ctx, uint32_t* buffer, Camera camera) {
+// Runs until escape is pressed, or for frames frames if that isn't 0. A
+// headless context has no window, so there are no events and nothing is
+// presented. p writes the last trace_frames frames to trace_path.
+void event_loop(SDLContext* ctx, Framebuffer* fb, Renderer* renderer, Camera camera, size_t frames,
+		const char* trace_path, uint32_t trace_frames) {
 
 	// for fps calculation
 	struct timespec t0 = {0};
@@ -322,6 +159,16 @@ void event_loop(SDLContext* ctx, uint32_t* buffer, Camera camera) {
 
 	bool running = true;
 
+	Jobs*     jobs = renderer->jobs;
+	MeshLods* lods = renderer->lods;
+	size_t    lod  = 0;
+	Hud       hud_lines = { .fb = fb };
+
+	// timings of the jobs that run after the frame was presented
+	double clear_ms = 0.0;
+	double hud_ms   = 0.0;
+	char   busy[256] = "";
+
 	Triangle tri1 = {
 		.v1 = {{ -1.0f, 0.0f, -1.0f }},
 		.v2 = {{  1.0f, 0.0f,  1.0f }},
@@ -330,8 +177,10 @@ void event_loop(SDLContext* ctx, uint32_t* buffer, Camera camera) {
 
 	while (running) {
 
+		TRACE_FRAME();
+		TRACE_SCOPE("frame");
 		time_measure_start(&t0);
-		while (SDL_PollEvent(&ctx->event) != 0) {
+		while (ctx->window && SDL_PollEvent(&ctx->event) != 0) {
 
 			switch (ctx->event.type) {
 
@@ -340,6 +189,28 @@ void event_loop(SDLContext* ctx, uint32_t* buffer, Camera camera) {
 				if (ctx->event.key.keysym.sym == SDLK_ESCAPE) running = false;
 				if (ctx->event.key.keysym.sym == SDLK_g) state.grid_on = !state.grid_on;
 				if (ctx->event.key.keysym.sym == SDLK_w) state.wireframe = !state.wireframe;
+				if (ctx->event.key.keysym.sym == SDLK_b) state.guard_band = !state.guard_band;
+				if (ctx->event.key.keysym.sym == SDLK_c) state.cull = (state.cull + 1) % CULL_MODE_COUNT;
+				if (ctx->event.key.keysym.sym == SDLK_h) {
+					state.heatmap = (state.heatmap + 1) % HEATMAP_MODE_COUNT;
+					// only the overdraw heatmap pays for counting fragments
+					if (!framebuffer_overdraw_set(fb, state.heatmap == HEATMAP_OVERDRAW)) {
+						fprintf(stderr, "Failed to allocate the overdraw buffer.\n");
+						state.heatmap = HEATMAP_TILE_TIME;
+					}
+				}
+				if (ctx->event.key.keysym.sym == SDLK_p) {
+					if (trace_write(trace_path, trace_frames)) printf("Wrote %s.\n", trace_path);
+				}
+				if (ctx->event.key.keysym.sym == SDLK_MINUS)  state.lod_pixels *= 0.5f;
+				if (ctx->event.key.keysym.sym == SDLK_EQUALS) state.lod_pixels *= 2.0f;
+				if (ctx->event.key.keysym.sym == SDLK_z) {
+					fb->depth.format = (fb->depth.format + 1) % DEPTH_FORMAT_COUNT;
+					depth_range_set(&fb->depth, camera.znear, camera.zfar);
+					framebuffer_clear(fb);
+				}
+				if (ctx->event.key.keysym.sym == SDLK_LEFTBRACKET)  jobs_active_set(jobs, jobs->active - 1);
+				if (ctx->event.key.keysym.sym == SDLK_RIGHTBRACKET) jobs_active_set(jobs, jobs->active + 1);
 				if (ctx->event.key.keysym.sym == SDLK_u) {
 					V3f dir = (V3f) {{camera.forward.x, 0.0f, camera.forward.z}};
 					dir = norm_3f(dir);
@@ -372,63 +243,198 @@ void event_loop(SDLContext* ctx, uint32_t* buffer, Camera camera) {
 				break;
 			}
 		}
-		if (state.grid_on) grid_draw(buffer, camera);
-		/*
-		for (size_t i = 0; i < asset_cube.f_count; i++) {
-			Triangle t = {
-				.v1 = asset_cube.v[asset_cube.f[i].x-1],
-				.v2 = asset_cube.v[asset_cube.f[i].y-1],
-				.v3 = asset_cube.v[asset_cube.f[i].z-1]
-			};
-
-			triangle_draw(t, buffer, camera, GREEN);
-		}
-		*/
-
-		for (size_t i = 0; i < asset_teapot.f_count; i++) {
-			Triangle t = {
-				.v1 = asset_teapot.v[asset_teapot.f[i].x-1],
-				.v2 = asset_teapot.v[asset_teapot.f[i].y-1],
-				.v3 = asset_teapot.v[asset_teapot.f[i].z-1]
-			};
-
-			triangle_draw(t, buffer, camera, GREEN);
-		}
+		// the level of detail follows how many pixels its error covers
+		lod = mesh_lod_select(lods, lod, camera, fb->height, state.lod_pixels, MESH_LOD_HYSTERESIS);
+		const Mesh* mesh = &lods->lod[lod];
+
+		RenderOptions options = {
+			.grid_on     = state.grid_on,
+			.mesh_on     = true,
+			.wireframe   = state.wireframe,
+			.guard_band  = state.guard_band,
+			.cull        = state.cull,
+			.heatmap     = state.heatmap,
+			// the HUD of this frame is in the colour buffer already
+			.heatmap_top = HUD_LINES * 2 * CHAR_HEIGHT_FONT
+		};
+		RenderStats frame;
+		renderer_draw(renderer, fb, camera, lod, &options, &frame);
 
 		//triangle_draw(tri1, buffer, camera, GREEN);
 		//V3f origin = {{8.0f, 0.0f, 8.0f}};
 		//cube_draw(origin, 2.0f, buffer, RED, camera);
 
-		SDL_UpdateWindowSurface(ctx->window);
-		buffer_flush(buffer, ctx->bytes_per_pixel);
+		if (ctx->window) {
+			TRACE_SCOPE("present");
+			SDL_UpdateWindowSurface(ctx->window);
+		}
 
 		// end time measuring
 		double t_ms = time_measure_end_ms(&t1, &t0);
-		text_render(string_format("frame time = %.2f ms, FPS = %.2f,"
-					"lines drawn = %zu, triangles drawn = %zu\n",
-					t_ms, 1/(t_ms/1000), lines_count_global,
-					triangle_count_global), 0, 0, buffer, GREEN, 2);
-		lines_count_global     = 0;
-		triangle_count_global = 0;
+		snprintf(hud_lines.hud[0], sizeof hud_lines.hud[0], "frame time = %.2f ms, FPS = %.2f,"
+					"lines drawn = %zu, triangles drawn = %zu, dropped = %zu, depth = %s, threads = %u, "
+					"simd = %s, clip = %s\n",
+					t_ms, 1/(t_ms/1000), frame.lines,
+					frame.triangles, frame.dropped, depth_format_name(fb->depth.format), jobs->active,
+					vertex_isa_name(vertex_kernel_isa()), state.guard_band ? "guard band" : "frustum");
+		snprintf(hud_lines.hud[1], sizeof hud_lines.hud[1], "hiz rejected: triangles = %zu, tiles = %zu, "
+					"early-z rejected fragments = %zu, culled (%s): facing = %zu, degenerate = %zu, "
+					"objects = %zu of 1, meshlets: frustum = %zu, facing = %zu of %zu\n",
+					frame.occlusion.triangles_rejected, frame.occlusion.tiles_rejected,
+					frame.occlusion.fragments_rejected, cull_mode_name(options.cull),
+					frame.cull.facing, frame.cull.degenerate, frame.objects_culled,
+					frame.cull.meshlets_frustum, frame.cull.meshlets_facing, frame.meshlets);
+		snprintf(hud_lines.hud[2], sizeof hud_lines.hud[2], "jobs: vertex = %.2f ms, cull = %.2f ms, geometry = %.2f ms, "
+					"raster = %.2f ms, clear = %.2f ms, hud = %.2f ms\n",
+					jobs_stage_ms(jobs, "vertex"), jobs_stage_ms(jobs, "cull"), jobs_stage_ms(jobs, "geometry"),
+					jobs_stage_ms(jobs, "raster"), clear_ms, hud_ms);
+		snprintf(hud_lines.hud[3], sizeof hud_lines.hud[3], "busy ms per thread:%s", busy);
+		snprintf(hud_lines.hud[4], sizeof hud_lines.hud[4], "lod = %zu of %zu, faces = %zu, error = %.3f, "
+					"max error = %.2f px, heatmap = %s, red = %.2f\n",
+					lod, lods->lod_count, mesh->f_count, mesh->error, state.lod_pixels,
+					heatmap_mode_name(state.heatmap), frame.heat_max);
+		snprintf(hud_lines.hud[5], sizeof hud_lines.hud[5], "pipeline: vertices = %zu, vs = %zu, "
+					"primitives = %zu, culled = %zu, clipper in = %zu, out = %zu, fragments = %zu, "
+					"depth passed = %zu, written = %zu\n",
+					frame.pipeline.input_vertices, frame.pipeline.vertex_invocations,
+					frame.pipeline.input_primitives, frame.pipeline.culled_primitives,
+					frame.pipeline.clipper_invocations, frame.pipeline.clipper_primitives,
+					frame.pipeline.fragments, frame.pipeline.depth_passed, frame.pipeline.pixels_written);
+
+		// Clear for the next frame while the HUD is drawn, the HUD only
+		// waits for the rows it covers.
+		uint32_t hud_rows = (HUD_LINES * 2 * CHAR_HEIGHT_FONT + HIZ_TILE_SIZE - 1) / HIZ_TILE_SIZE;
+		if (hud_rows > fb->hiz.tiles_y) hud_rows = fb->hiz.tiles_y;
+		Job* clear_hud  = jobs_add(jobs, "clear", render_clear_job, fb, 0, hud_rows);
+		Job* clear_rest = jobs_parallel_for(jobs, "clear", render_clear_job, fb, hud_rows, fb->hiz.tiles_y, 16);
+		Job* hud        = jobs_add(jobs, "hud", job_hud, &hud_lines, 0, HUD_LINES);
+		jobs_depend(clear_hud, hud);
+		jobs_submit(jobs, clear_rest);
+		jobs_submit(jobs, clear_hud);
+		jobs_wait(jobs, clear_rest);
+		jobs_wait(jobs, hud);
+
+		clear_ms = jobs_stage_ms(jobs, "clear");
+		hud_ms   = jobs_stage_ms(jobs, "hud");
+		size_t len = 0;
+		for (uint32_t i = 0; i < jobs->active && len < sizeof busy; i++) {
+			len += (size_t) snprintf(busy + len, sizeof busy - len, " %.1f", jobs_busy_ms(jobs, i));
+		}
+
+		step++;
+		if (frames && step >= frames) running = false;
 	}
 }
 
-int main(void) {
+int main(int argc, char** argv) {
+
+	// threads of the job system, -t 1 renders single threaded
+	uint32_t threads = (uint32_t) SDL_GetCPUCount();
+	// vertex kernel, the widest one the cpu supports unless forced with -k
+	VertexIsa isa = VERTEX_ISA_COUNT;
+	// mesh file written by objToC -b
+	const char* mesh_path = "assets/teapot.srm";
+	// -H renders without a window, -f frames and then quits
+	bool   headless = false;
+	size_t frames   = 0;
+	// -T writes the last -n frames as a Chrome trace on exit, needs -DTRACE
+	const char* trace_path   = NULL;
+	uint32_t    trace_frames = TRACE_FRAMES;
+	bool usage = false;
+	for (int i = 1; i < argc && !usage; i++) {
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			threads = (uint32_t) strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+			i++;
+			for (isa = 0; isa < VERTEX_ISA_COUNT; isa++) {
+				if (strcmp(argv[i], vertex_isa_name(isa)) == 0) break;
+			}
+			usage = isa == VERTEX_ISA_COUNT;
+		} else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+			mesh_path = argv[++i];
+		} else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+			usage = sscanf(argv[++i], "%ux%u", &screen_width, &screen_height) != 2 ||
+				!screen_width || !screen_height;
+		} else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+			frames = (size_t) strtoull(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "-H") == 0) {
+			headless = true;
+		} else if (strcmp(argv[i], "-T") == 0 && i + 1 < argc) {
+			trace_path = argv[++i];
+		} else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+			trace_frames = (uint32_t) strtoul(argv[++i], NULL, 10);
+		} else {
+			usage = true;
+		}
+	}
+	if (usage) {
+		fprintf(stderr, "usage: %s [-t threads] [-k scalar|sse2|avx2|avx512] [-m mesh.srm] [-s widthxheight] "
+				"[-H] [-f frames] [-T trace.json] [-n frames]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	if (threads < 1) threads = 1;
+	if (headless && !frames) frames = HEADLESS_FRAMES;
+
+	VertexIsa picked = vertex_kernel_init(isa);
+	if (isa != VERTEX_ISA_COUNT && picked != isa) {
+		fprintf(stderr, "%s is not supported, using %s.\n", vertex_isa_name(isa), vertex_isa_name(picked));
+	}
+
+	MeshLods mesh;
+	if (!mesh_load(&mesh, mesh_path)) {
+		fprintf(stderr, "Failed to load %s.\n", mesh_path);
+		return EXIT_FAILURE;
+	}
 
 	SDLContext* ctx = calloc((size_t) 1, (size_t) sizeof *ctx);
+	if (!ctx) return EXIT_FAILURE;
 
-	context_sdl_init(ctx);
+	if (!headless) {
+		context_sdl_init(ctx);
+	} else if (!context_headless_init(ctx)) {
+		fprintf(stderr, "Failed to allocate a %ux%u framebuffer.\n", screen_width, screen_height);
+		return EXIT_FAILURE;
+	}
 
-	uint32_t* buffer = ctx->surface->pixels;
+	Jobs*  jobs = calloc(1, sizeof *jobs);
+	Binner binner;
+	if (!jobs || !jobs_create(jobs, threads) ||
+	    !binner_create(&binner, screen_width, screen_height, GEOMETRY_CHUNKS)) {
+		fprintf(stderr, "Failed to set up %u render threads.\n", threads);
+		return EXIT_FAILURE;
+	}
 
 	Camera camera;
 	camera_default_set(&camera);
+	depth_range_set(&ctx->fb.depth, camera.znear, camera.zfar);
+
+	Renderer renderer;
+	if (!renderer_create(&renderer, &mesh, jobs, &binner)) {
+		fprintf(stderr, "Failed to allocate the vertex streams.\n");
+		return EXIT_FAILURE;
+	}
 
-	event_loop(ctx, buffer, camera);
+	struct timespec start, end;
+	time_measure_start(&start);
+	event_loop(ctx, &ctx->fb, &renderer, camera, frames, trace_path ? trace_path : "trace.json", trace_frames);
+	double ms = time_measure_end_ms(&end, &start);
 
+	if (trace_path && trace_write(trace_path, trace_frames)) {
+		printf("Wrote the last %u frames to %s.\n", trace_frames, trace_path);
+	}
+
+	if (headless) {
+		printf("%zu frames of %ux%u in %.1f ms, %.2f ms per frame\n", frames, screen_width, screen_height,
+		       ms, ms / (double) frames);
+	}
+
+	renderer_destroy(&renderer);
+	binner_destroy(&binner);
+	jobs_destroy(jobs);
+	free(jobs);
+	mesh_unload(&mesh);
 	memory_free(ctx);
-	SDL_Quit();
+	if (!headless) SDL_Quit();
 
 	return 0;
 }
-
@@ -0,0 +1,304 @@
+#include "../inc/mesh.h"
+#include "../inc/meshfile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+_Static_assert(sizeof(Meshlet) == 48, "meshlets are stored as they are in memory");
+
+// smallest indices that can address count vertices from 1
+static inline uint32_t index_size_for(size_t count) {
+
+	return count <= UINT16_MAX ? 2 : 4;
+}
+
+static inline void index_set(void* indices, uint32_t index_size, size_t i, uint32_t value) {
+
+	if (index_size == 2) ((uint16_t*) indices)[i] = (uint16_t) value;
+	else                 ((uint32_t*) indices)[i] = value;
+}
+
+static inline uint64_t edge_key(uint32_t a, uint32_t b) {
+
+	return a < b ? (uint64_t) a << 32 | b : (uint64_t) b << 32 | a;
+}
+
+static inline size_t edge_hash(uint64_t key, size_t mask) {
+
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdull;
+	key ^= key >> 33;
+	return (size_t) key & mask;
+}
+
+// Collects every edge shared by the faces once, in order of first appearance,
+// together with the faces on both sides of it.
+bool mesh_edges_build(Mesh* mesh) {
+
+	// meshlet copies of a vertex are told apart by cf but are the same vertex of v
+	bool unpacked = mesh->cf != NULL;
+
+	size_t max_edges = 3 * mesh->f_count;
+
+	// open addressing, indices start at 1 so a zero key is an empty slot
+	size_t size = 16;
+	while (size < 2 * max_edges) size *= 2;
+
+	uint64_t* table = calloc(size, sizeof *table);
+	uint32_t* slots = malloc(size * sizeof *slots);
+	V2u* edges      = malloc((max_edges ? max_edges : 1) * sizeof *edges);
+	V2u* edges2     = malloc((max_edges ? max_edges : 1) * sizeof *edges2);
+	V2u* faces      = malloc((max_edges ? max_edges : 1) * sizeof *faces);
+	if (!table || !slots || !edges || !edges2 || !faces) {
+		free(table);
+		free(slots);
+		free(edges);
+		free(edges2);
+		free(faces);
+		return false;
+	}
+
+	size_t count = 0;
+	for (size_t i = 0; i < mesh->f_count; i++) {
+		V3u      face   = unpacked ? mesh_cface(mesh, i) : mesh_face(mesh, i);
+		uint32_t idx[3] = { face.x, face.y, face.z };
+
+		for (size_t k = 0; k < 3; k++) {
+			uint32_t a = idx[k];
+			uint32_t b = idx[(k + 1) % 3];
+			uint32_t ia = unpacked ? index_get(mesh->mv, mesh->index_size, a-1) : a;
+			uint32_t ib = unpacked ? index_get(mesh->mv, mesh->index_size, b-1) : b;
+			if (ia == ib) continue;
+
+			uint64_t key = edge_key(ia, ib);
+			size_t slot  = edge_hash(key, size - 1);
+			while (table[slot] && table[slot] != key) slot = (slot + 1) & (size - 1);
+			if (table[slot]) {
+				size_t e = slots[slot];
+				if (!faces[e].y) {
+					faces[e].y = (uint32_t) i + 1;
+					// same direction as the first face's copy
+					uint32_t x = edges[e].x;
+					bool same  = (unpacked ? index_get(mesh->mv, mesh->index_size, x-1) : x) == ia;
+					edges2[e]  = same ? (V2u) { a, b } : (V2u) { b, a };
+				}
+				continue;
+			}
+
+			table[slot]     = key;
+			slots[slot]     = (uint32_t) count;
+			faces[count]    = (V2u) { (uint32_t) i + 1, 0 };
+			edges2[count]   = (V2u) { a, b };
+			edges[count++]  = (V2u) { a, b };
+		}
+	}
+
+	free(table);
+	free(slots);
+	mesh_edges_free(mesh);
+	mesh->e       = edges;
+	mesh->e2      = edges2;
+	mesh->ef      = faces;
+	mesh->e_count = count;
+	return true;
+}
+
+void mesh_edges_free(Mesh* mesh) {
+
+	free(mesh->e);
+	free(mesh->e2);
+	free(mesh->ef);
+	mesh->e       = NULL;
+	mesh->e2      = NULL;
+	mesh->ef      = NULL;
+	mesh->e_count = 0;
+}
+
+// Every meshlet gets its own copy of its vertices so it can be transformed on
+// its own, the faces are rewritten to index those copies.
+bool mesh_meshlets_unpack(Mesh* mesh) {
+
+	if (!mesh->m_count) return false;
+
+	uint32_t index_size = index_size_for(mesh->mv_count);
+	uint16_t (*cv)[3] = malloc((mesh->mv_count ? mesh->mv_count : 1) * sizeof *cv);
+	void*    cf       = malloc((mesh->f_count ? mesh->f_count : 1) * 3 * index_size);
+	if (!cv || !cf) {
+		free(cv);
+		free(cf);
+		return false;
+	}
+
+	for (size_t i = 0; i < mesh->mv_count; i++) {
+		memcpy(cv[i], mesh->v[index_get(mesh->mv, mesh->index_size, i) - 1], sizeof *cv);
+	}
+
+	for (size_t i = 0; i < mesh->m_count; i++) {
+		const Meshlet* m = &mesh->m[i];
+		for (uint32_t t = m->t_offset; t < m->t_offset + m->t_count; t++) {
+			for (int k = 0; k < 3; k++) index_set(cf, index_size, 3 * (size_t) t + k, m->v_offset + mesh->mt[t][k] + 1);
+		}
+	}
+
+	free(mesh->cv);
+	free(mesh->cf);
+	mesh->cv = cv;
+	mesh->cf = cf;
+	mesh->cf_index_size = index_size;
+	return true;
+}
+
+void mesh_free(Mesh* mesh) {
+
+	mesh_edges_free(mesh);
+	free(mesh->cv);
+	free(mesh->cf);
+	mesh->cv = NULL;
+	mesh->cf = NULL;
+}
+
+// a block has to lie inside the file and hold count elements of size bytes
+static bool block_valid(const MeshFileBlock* b, uint64_t file_size, uint64_t count, uint64_t size) {
+
+	return b->offset % MESH_FILE_ALIGN == 0 && b->size == count * size &&
+	       b->offset <= file_size && b->size <= file_size - b->offset;
+}
+
+static inline const void* block_at(const void* map, const MeshFileBlock* b) {
+
+	return (const char*) map + b->offset;
+}
+
+// Indices and meshlet ranges of a level whose blocks passed block_valid, one
+// pass over them. The meshlets have to cover the faces in order, each once,
+// or mesh_meshlets_unpack would leave faces of cf unwritten.
+static bool lod_indices_valid(const void* map, const MeshFileLod* l, uint32_t index_size) {
+
+	const void*    f  = block_at(map, &l->f);
+	const void*    mv = block_at(map, &l->mv);
+	const Meshlet* m  = block_at(map, &l->m);
+	const uint8_t (*mt)[3] = block_at(map, &l->mt);
+
+	for (size_t i = 0; i < 3 * (size_t) l->f_count; i++) {
+		uint32_t index = index_get(f, index_size, i);
+		if (index < 1 || index > l->v_count) return false;
+	}
+	for (size_t i = 0; i < l->mv_count; i++) {
+		uint32_t index = index_get(mv, index_size, i);
+		if (index < 1 || index > l->v_count) return false;
+	}
+
+	uint64_t faces = 0;
+	for (size_t i = 0; i < l->m_count; i++) {
+		if (m[i].t_offset != faces ||
+		    (uint64_t) m[i].t_offset + m[i].t_count > l->f_count ||
+		    (uint64_t) m[i].v_offset + m[i].v_count > l->mv_count) return false;
+
+		for (uint32_t t = m[i].t_offset; t < m[i].t_offset + m[i].t_count; t++) {
+			if (mt[t][0] >= m[i].v_count || mt[t][1] >= m[i].v_count || mt[t][2] >= m[i].v_count) return false;
+		}
+		faces += m[i].t_count;
+	}
+	return faces == l->f_count;
+}
+
+bool mesh_load(MeshLods* lods, const char* path) {
+
+	*lods = (MeshLods) {0};
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(MeshFileHeader)) {
+		close(fd);
+		return false;
+	}
+
+	// the mapping stays valid after the descriptor is closed
+	size_t size = (size_t) st.st_size;
+	void*  map  = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) return false;
+
+	const MeshFileHeader* h = map;
+	bool valid = memcmp(h->magic, MESH_FILE_MAGIC, sizeof h->magic) == 0 &&
+		     h->version == MESH_FILE_VERSION && h->file_size == size &&
+		     h->position_format == MESH_FILE_POSITION_U16 &&
+		     (h->index_format == MESH_FILE_INDEX_U16 || h->index_format == MESH_FILE_INDEX_U32) &&
+		     h->lod_count >= 1 && h->lod_count <= MESH_LOD_MAX;
+	uint32_t index_size = h->index_format == MESH_FILE_INDEX_U16 ? 2 : 4;
+	for (uint32_t i = 0; valid && i < h->lod_count; i++) {
+		const MeshFileLod* l = &h->lod[i];
+		valid = (index_size == 4 || l->v_count <= UINT16_MAX) &&
+			block_valid(&l->v,  size, l->v_count,  3 * sizeof(uint16_t)) &&
+			block_valid(&l->f,  size, l->f_count,  3 * index_size) &&
+			block_valid(&l->m,  size, l->m_count,  sizeof(Meshlet)) &&
+			block_valid(&l->mv, size, l->mv_count, index_size) &&
+			block_valid(&l->mt, size, l->f_count,  3 * sizeof(uint8_t)) &&
+			lod_indices_valid(map, l, index_size);
+	}
+	if (!valid) {
+		munmap(map, size);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < h->lod_count; i++) {
+		const MeshFileLod* l = &h->lod[i];
+		lods->lod[i] = (Mesh) {
+			.v_count    = l->v_count,
+			.f_count    = l->f_count,
+			.aabb_min   = {{ h->aabb_min[0], h->aabb_min[1], h->aabb_min[2] }},
+			.aabb_max   = {{ h->aabb_max[0], h->aabb_max[1], h->aabb_max[2] }},
+			.center     = {{ h->center[0], h->center[1], h->center[2] }},
+			.radius     = h->radius,
+			.error      = l->error,
+			.q_offset   = {{ h->q_offset[0], h->q_offset[1], h->q_offset[2] }},
+			.q_scale    = {{ h->q_scale[0], h->q_scale[1], h->q_scale[2] }},
+			.index_size = index_size,
+			.v          = block_at(map, &l->v),
+			.f          = block_at(map, &l->f),
+			.m_count    = l->m_count,
+			.mv_count   = l->mv_count,
+			.m          = block_at(map, &l->m),
+			.mv         = block_at(map, &l->mv),
+			.mt         = block_at(map, &l->mt)
+		};
+	}
+	lods->lod_count = h->lod_count;
+	lods->map       = map;
+	lods->map_size  = size;
+	return true;
+}
+
+void mesh_unload(MeshLods* lods) {
+
+	for (size_t i = 0; i < lods->lod_count; i++) mesh_free(&lods->lod[i]);
+	if (lods->map) munmap(lods->map, lods->map_size);
+	*lods = (MeshLods) {0};
+}
+
+size_t mesh_lod_select(const MeshLods* lods, size_t current, Camera camera, uint32_t height,
+		       float pixel_error, float hysteresis) {
+
+	// pixels per unit of object space error at the nearest point of the bounding sphere
+	const Mesh* m = &lods->lod[0];
+	float distance = length_3f(sub_3f(m->center, camera.position)) - m->radius;
+	float scale    = 0.5f * (float) height * camera_focal_get(camera) / maxf(distance, camera.znear);
+
+	size_t coarse = 0;
+	size_t fine   = 0;
+	for (size_t i = 1; i < lods->lod_count; i++) {
+		float pixels = lods->lod[i].error * scale;
+		if (pixels <= pixel_error * (1.0f - hysteresis)) coarse = i;
+		if (pixels <= pixel_error) fine = i;
+	}
+
+	if (current >= lods->lod_count) return fine;
+	if (lods->lod[current].error * scale > pixel_error * (1.0f + hysteresis)) return fine;
+	return coarse > current ? coarse : current;
+}
@@ -0,0 +1,438 @@
+#include "../inc/obj.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define OBJ_NONE UINT32_MAX
+
+// 0-based into the v, vt and vn of the whole file, OBJ_NONE if missing
+typedef struct {
+	uint32_t p;
+	uint32_t t;
+	uint32_t n;
+} ObjCorner;
+
+// Lines [begin, end) of the file. The first pass counts what they hold, the
+// prefix sum turns that into where the second pass writes it.
+typedef struct {
+	const char* begin;
+	const char* end;
+	size_t      v;
+	size_t      vt;
+	size_t      vn;
+	size_t      tris;
+	size_t      v_base;
+	size_t      vt_base;
+	size_t      vn_base;
+	size_t      tri_base;
+	bool        failed;
+} ObjChunk;
+
+typedef struct {
+	ObjChunk*  chunks;
+	size_t     chunk_count;
+	float*     v;        // three per position
+	float*     vt;       // two per uv
+	float*     vn;       // three per normal
+	ObjCorner* corners;  // three per triangle
+	size_t     v_count;
+	size_t     vt_count;
+	size_t     vn_count;
+} ObjParse;
+
+// what a welded vertex is told apart by, -0 is stored as +0
+typedef struct {
+	float p[3];
+	float t[2];
+	float n[3];
+} ObjVertex;
+
+static const double pow10_table[] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline bool is_space(char c) {
+
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline bool is_digit(char c) {
+
+	return (unsigned char) (c - '0') < 10;
+}
+
+static inline const char* space_skip(const char* s, const char* end) {
+
+	while (s < end && is_space(*s)) s++;
+	return s;
+}
+
+static inline const char* token_skip(const char* s, const char* end) {
+
+	while (s < end && !is_space(*s)) s++;
+	return s;
+}
+
+static inline const char* line_end(const char* s, const char* end) {
+
+	const char* e = memchr(s, '\n', (size_t) (end - s));
+	return e ? e : end;
+}
+
+// true if the line starts with the keyword followed by a space
+static inline bool keyword(const char* s, const char* end, const char* word, size_t len) {
+
+	return (size_t) (end - s) > len && memcmp(s, word, len) == 0 && is_space(s[len]);
+}
+
+// Decimal float with optional fraction and exponent. The digits beyond what a
+// uint64_t holds only move the exponent, exact enough for a float.
+static const char* float_parse(const char* s, const char* end, float* out) {
+
+	bool neg = false;
+	if (s < end && (*s == '-' || *s == '+')) neg = *s++ == '-';
+
+	uint64_t mantissa = 0;
+	int      exponent = 0;
+	int      digits   = 0;
+	for (; s < end && is_digit(*s); s++, digits++) {
+		if (mantissa < 1000000000000000000ull) mantissa = mantissa * 10 + (uint64_t) (*s - '0');
+		else exponent++;
+	}
+	if (s < end && *s == '.') {
+		for (s++; s < end && is_digit(*s); s++, digits++) {
+			if (mantissa < 1000000000000000000ull) {
+				mantissa = mantissa * 10 + (uint64_t) (*s - '0');
+				exponent--;
+			}
+		}
+	}
+	if (!digits) return NULL;
+
+	if (s < end && (*s == 'e' || *s == 'E')) {
+		const char* e = s + 1;
+		bool e_neg = false;
+		if (e < end && (*e == '-' || *e == '+')) e_neg = *e++ == '-';
+		if (e < end && is_digit(*e)) {
+			int value = 0;
+			for (; e < end && is_digit(*e); e++) value = value < 10000 ? value * 10 + (*e - '0') : value;
+			exponent += e_neg ? -value : value;
+			s = e;
+		}
+	}
+
+	double value = (double) mantissa;
+	if (exponent < 0) value = -exponent <= 22 ? value / pow10_table[-exponent] : value * pow(10.0, exponent);
+	if (exponent > 0) value = exponent <= 22 ? value * pow10_table[exponent] : value * pow(10.0, exponent);
+
+	*out = (float) (neg ? -value : value);
+	return s;
+}
+
+static const char* int_parse(const char* s, const char* end, int64_t* out) {
+
+	bool neg = false;
+	if (s < end && (*s == '-' || *s == '+')) neg = *s++ == '-';
+	if (s == end || !is_digit(*s)) return NULL;
+
+	int64_t value = 0;
+	for (; s < end && is_digit(*s); s++) value = value < INT32_MAX ? value * 10 + (*s - '0') : value;
+
+	*out = neg ? -value : value;
+	return s;
+}
+
+// 1-based index or negative relative to the next element, 0-based absolute out
+static bool index_resolve(int64_t idx, size_t next, size_t count, uint32_t* out) {
+
+	int64_t abs = idx > 0 ? idx - 1 : (int64_t) next + idx;
+	if (idx == 0 || abs < 0 || (size_t) abs >= count) return false;
+
+	*out = (uint32_t) abs;
+	return true;
+}
+
+// "p", "p/t", "p//n" or "p/t/n"
+static const char* corner_parse(const char* s, const char* end, const ObjParse* parse,
+				size_t v_next, size_t vt_next, size_t vn_next, ObjCorner* c) {
+
+	int64_t idx;
+	*c = (ObjCorner) { OBJ_NONE, OBJ_NONE, OBJ_NONE };
+
+	s = int_parse(s, end, &idx);
+	if (!s || !index_resolve(idx, v_next, parse->v_count, &c->p)) return NULL;
+	if (s == end || *s != '/') return s;
+
+	s++;
+	if (s < end && *s != '/') {
+		s = int_parse(s, end, &idx);
+		if (!s || !index_resolve(idx, vt_next, parse->vt_count, &c->t)) return NULL;
+	}
+	if (s == end || *s != '/') return s;
+
+	s = int_parse(s + 1, end, &idx);
+	if (!s || !index_resolve(idx, vn_next, parse->vn_count, &c->n)) return NULL;
+	return s;
+}
+
+// first pass: only looks at the keywords and the number of face corners
+static void job_count(void* arg, size_t begin, size_t end) {
+
+	ObjParse* parse = arg;
+
+	for (size_t i = begin; i < end; i++) {
+		ObjChunk* c = &parse->chunks[i];
+
+		for (const char* line = c->begin; line < c->end; line = line_end(line, c->end) + 1) {
+			const char* e = line_end(line, c->end);
+			const char* s = space_skip(line, e);
+
+			if      (keyword(s, e, "v", 1))  c->v++;
+			else if (keyword(s, e, "vt", 2)) c->vt++;
+			else if (keyword(s, e, "vn", 2)) c->vn++;
+			else if (keyword(s, e, "f", 1)) {
+				size_t corners = 0;
+				for (s = space_skip(s + 1, e); s < e && *s != '#'; s = space_skip(token_skip(s, e), e)) corners++;
+				if (corners >= 3) c->tris += corners - 2;
+			}
+		}
+	}
+}
+
+// second pass: writes every element to where the prefix sum put it
+static void job_parse(void* arg, size_t begin, size_t end) {
+
+	ObjParse* parse = arg;
+
+	for (size_t i = begin; i < end; i++) {
+		ObjChunk* c = &parse->chunks[i];
+		size_t v = c->v_base, vt = c->vt_base, vn = c->vn_base, tri = c->tri_base;
+
+		for (const char* line = c->begin; line < c->end && !c->failed; line = line_end(line, c->end) + 1) {
+			const char* e = line_end(line, c->end);
+			const char* s = space_skip(line, e);
+
+			if (keyword(s, e, "v", 1)) {
+				float* p = &parse->v[3 * v++];
+				s += 1;
+				for (int k = 0; k < 3 && s; k++) s = float_parse(space_skip(s, e), e, &p[k]);
+				c->failed = !s;
+			} else if (keyword(s, e, "vt", 2)) {
+				// the second coordinate is optional, a third one is ignored
+				float* t = &parse->vt[2 * vt++];
+				s = float_parse(space_skip(s + 2, e), e, &t[0]);
+				c->failed = !s;
+				if (s && !float_parse(space_skip(s, e), e, &t[1])) t[1] = 0.0f;
+			} else if (keyword(s, e, "vn", 2)) {
+				float* n = &parse->vn[3 * vn++];
+				s += 2;
+				for (int k = 0; k < 3 && s; k++) s = float_parse(space_skip(s, e), e, &n[k]);
+				c->failed = !s;
+			} else if (keyword(s, e, "f", 1)) {
+				// triangle fan around the first corner
+				ObjCorner first, prev, cur;
+				size_t    corners = 0;
+				for (s = space_skip(s + 1, e); s < e && *s != '#'; s = space_skip(token_skip(s, e), e)) {
+					if (!corner_parse(s, e, parse, v, vt, vn, &cur)) {
+						c->failed = true;
+						break;
+					}
+					if (corners >= 2) {
+						ObjCorner* out = &parse->corners[3 * tri++];
+						out[0] = first;
+						out[1] = prev;
+						out[2] = cur;
+					}
+					if (corners++ == 0) first = cur;
+					prev = cur;
+				}
+			}
+		}
+	}
+}
+
+static inline size_t vertex_hash(const ObjVertex* v, size_t mask) {
+
+	uint32_t words[8];
+	memcpy(words, v, sizeof words);
+
+	uint64_t h = 0xcbf29ce484222325ull;
+	for (int k = 0; k < 8; k++) {
+		h ^= words[k];
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+	}
+	return (size_t) h & mask;
+}
+
+_Static_assert(sizeof(ObjVertex) == 8 * sizeof(uint32_t), "vertices are hashed as eight words");
+
+// Welds the corners into unique vertices in order of first appearance.
+static bool obj_weld(ObjMesh* obj, const ObjParse* parse, size_t tris, uint32_t attributes) {
+
+	size_t corners = 3 * tris;
+	size_t size    = 16;
+	while (size < 2 * corners) size *= 2;
+
+	// slots hold the vertex index + 1, 0 is empty
+	uint32_t*  table = calloc(size, sizeof *table);
+	ObjVertex* verts = malloc((corners ? corners : 1) * sizeof *verts);
+	V3u*       faces = malloc((tris ? tris : 1) * sizeof *faces);
+	if (!table || !verts || !faces) {
+		free(table);
+		free(verts);
+		free(faces);
+		return false;
+	}
+
+	obj->aabb_min = (V3f) {{  INFINITY,  INFINITY,  INFINITY }};
+	obj->aabb_max = (V3f) {{ -INFINITY, -INFINITY, -INFINITY }};
+
+	size_t count = 0;
+	for (size_t i = 0; i < corners; i++) {
+		const ObjCorner* c = &parse->corners[i];
+		ObjVertex key = {0};
+
+		for (int k = 0; k < 3; k++) key.p[k] = parse->v[3 * c->p + k] + 0.0f;
+		if ((attributes & OBJ_UVS) && c->t != OBJ_NONE) {
+			for (int k = 0; k < 2; k++) key.t[k] = parse->vt[2 * c->t + k] + 0.0f;
+		}
+		if ((attributes & OBJ_NORMALS) && c->n != OBJ_NONE) {
+			for (int k = 0; k < 3; k++) key.n[k] = parse->vn[3 * c->n + k] + 0.0f;
+		}
+
+		size_t slot = vertex_hash(&key, size - 1);
+		while (table[slot] && memcmp(&verts[table[slot] - 1], &key, sizeof key) != 0) slot = (slot + 1) & (size - 1);
+		if (!table[slot]) {
+			verts[count] = key;
+			table[slot]  = (uint32_t) ++count;
+			for (int k = 0; k < 3; k++) {
+				obj->aabb_min.arr[k] = fminf(obj->aabb_min.arr[k], key.p[k]);
+				obj->aabb_max.arr[k] = fmaxf(obj->aabb_max.arr[k], key.p[k]);
+			}
+		}
+		faces[i / 3].arr[i % 3] = table[slot];
+	}
+	free(table);
+
+	if (!count) obj->aabb_min = obj->aabb_max = (V3f) {{ 0.0f, 0.0f, 0.0f }};
+
+	obj->v  = malloc((count ? count : 1) * sizeof *obj->v);
+	obj->vn = (attributes & OBJ_NORMALS) ? malloc((count ? count : 1) * sizeof *obj->vn) : NULL;
+	obj->vt = (attributes & OBJ_UVS)     ? malloc((count ? count : 1) * sizeof *obj->vt) : NULL;
+	if (!obj->v || ((attributes & OBJ_NORMALS) && !obj->vn) || ((attributes & OBJ_UVS) && !obj->vt)) {
+		free(verts);
+		free(faces);
+		return false;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		obj->v[i] = (V3f) {{ verts[i].p[0], verts[i].p[1], verts[i].p[2] }};
+		if (obj->vn) obj->vn[i] = (V3f) {{ verts[i].n[0], verts[i].n[1], verts[i].n[2] }};
+		if (obj->vt) obj->vt[i] = (V2f) {{ verts[i].t[0], verts[i].t[1] }};
+	}
+	free(verts);
+
+	obj->v_count = count;
+	obj->f_count = tris;
+	obj->f       = faces;
+	return true;
+}
+
+bool obj_load(ObjMesh* obj, const char* path, uint32_t attributes, Jobs* jobs) {
+
+	*obj = (ObjMesh) {0};
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		return false;
+	}
+
+	size_t size = (size_t) st.st_size;
+	char*  map  = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) return false;
+	madvise(map, size, MADV_SEQUENTIAL);
+
+	// chunks end right after a line end so no line is split
+	ObjParse parse = {0};
+	parse.chunks = calloc(size / OBJ_CHUNK_SIZE + 1, sizeof *parse.chunks);
+	if (!parse.chunks) {
+		munmap(map, size);
+		return false;
+	}
+	for (const char* s = map, *end = map + size; s < end; ) {
+		const char* e = s + OBJ_CHUNK_SIZE < end ? s + OBJ_CHUNK_SIZE : end;
+		e = e < end ? line_end(e, end) + 1 : end;
+		if (e > end) e = end;
+		parse.chunks[parse.chunk_count++] = (ObjChunk) { .begin = s, .end = e };
+		s = e;
+	}
+
+	// a few jobs per thread so stealing evens out chunks of different cost
+	size_t n      = parse.chunk_count;
+	size_t pieces = 4 * (size_t) jobs->count;
+
+	jobs_frame_reset(jobs);
+	Job* count = jobs_parallel_for(jobs, "obj count", job_count, &parse, 0, n, pieces);
+	jobs_submit(jobs, count);
+	jobs_wait(jobs, count);
+
+	size_t tris = 0;
+	for (size_t i = 0; i < n; i++) {
+		ObjChunk* c = &parse.chunks[i];
+		c->v_base   = parse.v_count;
+		c->vt_base  = parse.vt_count;
+		c->vn_base  = parse.vn_count;
+		c->tri_base = tris;
+		parse.v_count  += c->v;
+		parse.vt_count += c->vt;
+		parse.vn_count += c->vn;
+		tris           += c->tris;
+	}
+
+	parse.v       = malloc((3 * parse.v_count + 1) * sizeof *parse.v);
+	parse.vt      = malloc((2 * parse.vt_count + 1) * sizeof *parse.vt);
+	parse.vn      = malloc((3 * parse.vn_count + 1) * sizeof *parse.vn);
+	parse.corners = malloc((3 * tris + 1) * sizeof *parse.corners);
+
+	bool ok = parse.v && parse.vt && parse.vn && parse.corners &&
+		  parse.v_count < OBJ_NONE && parse.vt_count < OBJ_NONE && parse.vn_count < OBJ_NONE;
+	if (ok) {
+		jobs_frame_reset(jobs);
+		Job* fill = jobs_parallel_for(jobs, "obj parse", job_parse, &parse, 0, n, pieces);
+		jobs_submit(jobs, fill);
+		jobs_wait(jobs, fill);
+
+		for (size_t i = 0; i < n; i++) ok = ok && !parse.chunks[i].failed;
+	}
+	munmap(map, size);
+
+	ok = ok && obj_weld(obj, &parse, tris, attributes);
+
+	free(parse.chunks);
+	free(parse.v);
+	free(parse.vt);
+	free(parse.vn);
+	free(parse.corners);
+	if (!ok) obj_free(obj);
+	return ok;
+}
+
+void obj_free(ObjMesh* obj) {
+
+	free(obj->v);
+	free(obj->vn);
+	free(obj->vt);
+	free(obj->f);
+	*obj = (ObjMesh) {0};
+}
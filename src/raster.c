@@ -0,0 +1,267 @@
+#include "../inc/raster.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// keeps the 64 bit edge functions far away from overflowing for vertices
+// that were projected way outside of the screen
+static const float RASTER_COORD_LIMIT = (float) (1 << 20);
+
+static inline int64_t fixed_from_float(float f) {
+
+	if (f < -RASTER_COORD_LIMIT) f = -RASTER_COORD_LIMIT;
+	if (f >  RASTER_COORD_LIMIT) f =  RASTER_COORD_LIMIT;
+
+	return (int64_t) lrintf(f * (float) RASTER_SUBPIXEL_ONE);
+}
+
+static inline int64_t min3_s64(int64_t a, int64_t b, int64_t c) {
+
+	int64_t res = a < b ? a : b;
+	return res < c ? res : c;
+}
+
+static inline int64_t max3_s64(int64_t a, int64_t b, int64_t c) {
+
+	int64_t res = a > b ? a : b;
+	return res > c ? res : c;
+}
+
+// edges are oriented so that the inside of the triangle is positive.
+// with y pointing down a top edge is exactly horizontal and runs to the
+// right, a left edge runs upwards.
+static inline bool is_top_left(int64_t x0, int64_t y0, int64_t x1, int64_t y1) {
+
+	int64_t dx = x1 - x0;
+	int64_t dy = y1 - y0;
+
+	return (dy == 0 && dx > 0) || dy < 0;
+}
+
+void pipeline_stats_add(PipelineStats* sum, const PipelineStats* s) {
+
+	sum->input_vertices      += s->input_vertices;
+	sum->vertex_invocations  += s->vertex_invocations;
+	sum->input_primitives    += s->input_primitives;
+	sum->culled_primitives   += s->culled_primitives;
+	sum->clipper_invocations += s->clipper_invocations;
+	sum->clipper_primitives  += s->clipper_primitives;
+	sum->fragments           += s->fragments;
+	sum->depth_passed        += s->depth_passed;
+	sum->pixels_written      += s->pixels_written;
+}
+
+int64_t triangle_area_fixed(V3f a, V3f b, V3f c) {
+
+	int64_t x0 = fixed_from_float(a.x), y0 = fixed_from_float(a.y);
+	int64_t x1 = fixed_from_float(b.x), y1 = fixed_from_float(b.y);
+	int64_t x2 = fixed_from_float(c.x), y2 = fixed_from_float(c.y);
+
+	return (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
+}
+
+// Edge function rasterizer: all three edge functions are evaluated once at
+// the first pixel center of the bounding box and then stepped incrementally.
+// Depth is interpolated along with them and tested before the colour write.
+void triangle_fill(V3f a, V3f b, V3f c, Framebuffer* fb, Rect scissor, OcclusionStats* stats,
+		   PipelineStats* pipeline, Color color) {
+
+	const uint32_t width = fb->width;
+
+	int64_t x0 = fixed_from_float(a.x), y0 = fixed_from_float(a.y);
+	int64_t x1 = fixed_from_float(b.x), y1 = fixed_from_float(b.y);
+	int64_t x2 = fixed_from_float(c.x), y2 = fixed_from_float(c.y);
+
+	int64_t area = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
+	if (area == 0) return;
+
+	float z0 = a.z, z1 = b.z, z2 = c.z;
+
+	// bring the triangle into positive winding
+	if (area < 0) {
+		int64_t tx = x1, ty = y1;
+		float   tz = z1;
+		x1 = x2; y1 = y2; z1 = z2;
+		x2 = tx; y2 = ty; z2 = tz;
+		area = -area;
+	}
+
+	// bounding box of the covered pixel centers, clamped to the scissor rect
+	const int64_t half = RASTER_SUBPIXEL_ONE / 2;
+	int64_t x_min = (min3_s64(x0, x1, x2) - half + RASTER_SUBPIXEL_ONE - 1) >> RASTER_SUBPIXEL_BITS;
+	int64_t y_min = (min3_s64(y0, y1, y2) - half + RASTER_SUBPIXEL_ONE - 1) >> RASTER_SUBPIXEL_BITS;
+	int64_t x_max = (max3_s64(x0, x1, x2) - half) >> RASTER_SUBPIXEL_BITS;
+	int64_t y_max = (max3_s64(y0, y1, y2) - half) >> RASTER_SUBPIXEL_BITS;
+
+	if (x_min < scissor.x_min) x_min = scissor.x_min;
+	if (y_min < scissor.y_min) y_min = scissor.y_min;
+	if (x_max > scissor.x_max) x_max = scissor.x_max;
+	if (y_max > scissor.y_max) y_max = scissor.y_max;
+	if (x_min > x_max || y_min > y_max) return;
+
+	// per pixel steps of the edge functions
+	int64_t a01 = (y0 - y1) * RASTER_SUBPIXEL_ONE, b01 = (x1 - x0) * RASTER_SUBPIXEL_ONE;
+	int64_t a12 = (y1 - y2) * RASTER_SUBPIXEL_ONE, b12 = (x2 - x1) * RASTER_SUBPIXEL_ONE;
+	int64_t a20 = (y2 - y0) * RASTER_SUBPIXEL_ONE, b20 = (x0 - x2) * RASTER_SUBPIXEL_ONE;
+
+	// top-left fill rule: pixels exactly on a right or bottom edge are not ours
+	int64_t bias0 = is_top_left(x1, y1, x2, y2) ? 0 : -1;
+	int64_t bias1 = is_top_left(x2, y2, x0, y0) ? 0 : -1;
+	int64_t bias2 = is_top_left(x0, y0, x1, y1) ? 0 : -1;
+
+	// evaluate at the first pixel center
+	int64_t px = (x_min << RASTER_SUBPIXEL_BITS) + half;
+	int64_t py = (y_min << RASTER_SUBPIXEL_BITS) + half;
+
+	int64_t w0_row = (x2 - x1) * (py - y1) - (y2 - y1) * (px - x1) + bias0;
+	int64_t w1_row = (x0 - x2) * (py - y2) - (y0 - y2) * (px - x2) + bias1;
+	int64_t w2_row = (x1 - x0) * (py - y0) - (y1 - y0) * (px - x0) + bias2;
+
+	// depth plane expressed through the barycentric weights w1 and w2
+	double dz1 = (double) (z1 - z0) / (double) area;
+	double dz2 = (double) (z2 - z0) / (double) area;
+	float dzdx = (float) (dz1 * (double) a20 + dz2 * (double) a01);
+	float dzdy = (float) (dz1 * (double) b20 + dz2 * (double) b01);
+	float z_org = z0 + (float) (dz1 * (double) w1_row + dz2 * (double) w2_row);
+
+	const DepthFormat format = fb->depth.format;
+	float tri_near_key = fminf(depth_key(format, z0), fminf(depth_key(format, z1), depth_key(format, z2)));
+	size_t    rejected = 0;
+	size_t    passed   = 0;
+	uint16_t* overdraw = fb->overdraw;  // NULL unless the overdraw heatmap is on
+
+	// walk the bounding box tile by tile so whole tiles can be skipped by the hierarchical depth test
+	for (int64_t ty = y_min >> HIZ_TILE_BITS; ty <= y_max >> HIZ_TILE_BITS; ty++) {
+	for (int64_t tx = x_min >> HIZ_TILE_BITS; tx <= x_max >> HIZ_TILE_BITS; tx++) {
+
+		int64_t x_lo = tx << HIZ_TILE_BITS, x_hi = x_lo + HIZ_TILE_SIZE - 1;
+		int64_t y_lo = ty << HIZ_TILE_BITS, y_hi = y_lo + HIZ_TILE_SIZE - 1;
+		if (x_lo < x_min) x_lo = x_min;
+		if (y_lo < y_min) y_lo = y_min;
+		if (x_hi > x_max) x_hi = x_max;
+		if (y_hi > y_max) y_hi = y_max;
+
+		// nearest depth of the plane over the pixel centers of this tile
+		float zx_lo = z_org + dzdx * (float) (x_lo - x_min), zx_hi = z_org + dzdx * (float) (x_hi - x_min);
+		float zy_lo = dzdy * (float) (y_lo - y_min),         zy_hi = dzdy * (float) (y_hi - y_min);
+		float corner_key = fminf(fminf(depth_key(format, zx_lo + zy_lo), depth_key(format, zx_hi + zy_lo)),
+					 fminf(depth_key(format, zx_lo + zy_hi), depth_key(format, zx_hi + zy_hi)));
+
+		size_t tile = (size_t) ty * fb->hiz.tiles_x + (size_t) tx;
+		if (hiz_tile_occluded(fb, tile, fmaxf(corner_key, tri_near_key))) {
+			stats->tiles_rejected += 1;
+			continue;
+		}
+
+		int64_t ox = x_lo - x_min;
+		int64_t oy = y_lo - y_min;
+		int64_t w0_tile = w0_row + a12 * ox + b12 * oy;
+		int64_t w1_tile = w1_row + a20 * ox + b20 * oy;
+		int64_t w2_tile = w2_row + a01 * ox + b01 * oy;
+		float   z_tile  = z_org + dzdx * (float) ox + dzdy * (float) oy;
+
+		size_t written  = 0;
+		float  far_key  = -INFINITY;
+
+		for (int64_t y = y_lo; y <= y_hi; y++) {
+
+			int64_t w0 = w0_tile;
+			int64_t w1 = w1_tile;
+			int64_t w2 = w2_tile;
+			float   z  = z_tile;
+			size_t  i  = (size_t) y * width + (size_t) x_lo;
+
+			for (int64_t x = x_lo; x <= x_hi; x++, i++) {
+				if ((w0 | w1 | w2) >= 0) {
+					if (overdraw) overdraw[i] += 1;
+					if (depth_test_write(&fb->depth, i, z)) {
+						fb->color[i] = color;
+						written += 1;
+						far_key = fmaxf(far_key, depth_key(format, z));
+					} else {
+						rejected += 1;
+					}
+				}
+
+				w0 += a12;
+				w1 += a20;
+				w2 += a01;
+				z  += dzdx;
+			}
+
+			w0_tile += b12;
+			w1_tile += b20;
+			w2_tile += b01;
+			z_tile  += dzdy;
+		}
+
+		passed += written;
+
+		// a fully covered tile knows its new max exactly, otherwise refresh lazily
+		if (written == HIZ_TILE_SIZE * HIZ_TILE_SIZE) {
+			fb->hiz.max[tile]   = far_key;
+			fb->hiz.dirty[tile] = 0;
+		} else if (written > 0) {
+			fb->hiz.dirty[tile] = 1;
+		}
+	}}
+
+	stats->fragments_rejected += rejected;
+	pipeline->fragments       += passed + rejected;
+	pipeline->depth_passed    += passed;
+	pipeline->pixels_written  += passed;
+}
+
+// DDA with a 16.16 slope: the pixel of step k only depends on k, so any
+// scissor rect can jump straight to its first step and tiles rasterize a
+// shared line exactly like a single pass would.
+void line_fill(V3f start, V3f end, Framebuffer* fb, Rect scissor, PipelineStats* pipeline, Color color) {
+
+	int32_t x0 = (int32_t) start.x, y0 = (int32_t) start.y;
+	int32_t x1 = (int32_t) end.x,   y1 = (int32_t) end.y;
+	int32_t dx = x1 - x0;
+	int32_t dy = y1 - y0;
+
+	bool    x_major = abs(dx) >= abs(dy);
+	int32_t steps   = x_major ? abs(dx) : abs(dy);
+	int32_t s_major = (x_major ? dx : dy) < 0 ? -1 : 1;
+	int64_t slope   = steps > 0 ? (int64_t) (x_major ? dy : dx) * 65536 / steps : 0;
+	float   dd      = steps > 0 ? (end.z - start.z) / (float) steps : 0.0f;
+
+	int32_t major0 = x_major ? x0 : y0;
+	int32_t minor0 = x_major ? y0 : x0;
+	int32_t lo     = x_major ? scissor.x_min : scissor.y_min;
+	int32_t hi     = x_major ? scissor.x_max : scissor.y_max;
+	int32_t lo_min = x_major ? scissor.y_min : scissor.x_min;
+	int32_t hi_min = x_major ? scissor.y_max : scissor.x_max;
+
+	// steps whose major coordinate lies inside the scissor rect
+	int32_t k_lo = s_major > 0 ? lo - major0 : major0 - hi;
+	int32_t k_hi = s_major > 0 ? hi - major0 : major0 - lo;
+	if (k_lo < 0)     k_lo = 0;
+	if (k_hi > steps) k_hi = steps;
+
+	size_t fragments = 0;
+	size_t passed    = 0;
+	for (int32_t k = k_lo; k <= k_hi; k++) {
+		int32_t minor = minor0 + (int32_t) (((int64_t) k * slope + (1 << 15)) >> 16);
+		if (minor < lo_min || minor > hi_min) continue;
+
+		int32_t major = major0 + k * s_major;
+		int32_t x = x_major ? major : minor;
+		int32_t y = x_major ? minor : major;
+
+		size_t i = (size_t) y * fb->width + (size_t) x;
+		fragments += 1;
+		if (fb->overdraw) fb->overdraw[i] += 1;
+		if (depth_test_write(&fb->depth, i, start.z + (float) k * dd)) {
+			fb->color[i] = color;
+			fb->hiz.dirty[(y >> HIZ_TILE_BITS) * fb->hiz.tiles_x + (x >> HIZ_TILE_BITS)] = 1;
+			passed += 1;
+		}
+	}
+
+	pipeline->fragments      += fragments;
+	pipeline->depth_passed   += passed;
+	pipeline->pixels_written += passed;
+}
@@ -0,0 +1,500 @@
+#include "../inc/render.h"
+#include "../inc/color.h"
+#include "../inc/clip.h"
+#include "../inc/trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* heatmap_mode_names[HEATMAP_MODE_COUNT] = {
+	[HEATMAP_OFF]             = "off",
+	[HEATMAP_OVERDRAW]        = "overdraw",
+	[HEATMAP_TILE_TIME]       = "tile time",
+	[HEATMAP_TILE_PRIMITIVES] = "tile primitives"
+};
+
+const char* heatmap_mode_name(HeatmapMode mode) {
+
+	return mode < HEATMAP_MODE_COUNT ? heatmap_mode_names[mode] : "unknown";
+}
+
+// where the geometry of one thread ends up
+typedef struct {
+	Binner*                binner;
+	uint32_t               producer;
+	const VertexTransform* xf;
+	bool                   wireframe;  // triangles as their three edges
+	PipelineStats*         stats;      // of the thread
+} DrawTarget;
+
+void line_assemble(const PostVertex* a, const PostVertex* b, DrawTarget* dt, uint32_t color) {
+
+	dt->stats->clipper_invocations += 1;
+
+	// both ends outside of the same plane
+	if (a->outcode & b->outcode) return;
+
+	V3f s1 = a->screen;
+	V3f s2 = b->screen;
+
+	// only lines crossing a clipped plane pay for clipping
+	uint32_t planes = (a->outcode | b->outcode) & dt->xf->clip_mask;
+	if (planes) {
+		TRACE_SCOPE("clip line");
+		V4f p1 = a->clip;
+		V4f p2 = b->clip;
+		if (!clip_line(&p1, &p2, planes, &dt->xf->planes)) return;
+
+		s1 = clip_to_screen(dt->xf, p1);
+		s2 = clip_to_screen(dt->xf, p2);
+	}
+
+	binner_line_add(dt->binner, dt->producer, s1, s2, color);
+	dt->stats->clipper_primitives += 1;
+}
+
+void line_draw(V3f p1, V3f p2, DrawTarget* dt, uint32_t color) {
+
+	PostVertex a = vertex_transform_one(dt->xf, p1);
+	PostVertex b = vertex_transform_one(dt->xf, p2);
+	dt->stats->input_vertices     += 2;
+	dt->stats->vertex_invocations += 2;
+
+	line_assemble(&a, &b, dt, color);
+}
+
+#define GRID_CONST      40
+#define GRID_LINE_COUNT (2 * (2 * GRID_CONST + 1))
+
+// grid line i of GRID_LINE_COUNT, first all lines along z then along x
+void grid_line_draw(size_t i, DrawTarget* dt) {
+
+	int32_t grid_const = GRID_CONST;
+	uint32_t color = BLUE;
+	int32_t lines = 2 * grid_const + 1;
+
+	if ((int32_t) i < lines) {
+		float x = (float) ((int32_t) i - grid_const);
+		V3f p1 = { .x = x, .y = 0.0f, .z = -((float) grid_const) };
+		V3f p2 = { .x = x, .y = 0.0f, .z = +((float) grid_const) };
+		line_draw(p1, p2, dt, color);
+	} else {
+		float z = (float) ((int32_t) i - lines - grid_const);
+		V3f p1 = { .x = -((float) grid_const), .y = 0.0f, .z = z};
+		V3f p2 = { .x = +((float) grid_const), .y = 0.0f, .z = z};
+		line_draw(p1, p2, dt, color);
+	}
+}
+
+void triangle_assemble(const PostVertex* a, const PostVertex* b, const PostVertex* c,
+		       DrawTarget* dt, Color color) {
+
+	if (dt->wireframe) {
+		line_assemble(a, b, dt, color);
+		line_assemble(a, c, dt, color);
+		line_assemble(b, c, dt, color);
+		return;
+	}
+
+	dt->stats->clipper_invocations += 1;
+
+	// all three vertices outside of the same plane
+	if (a->outcode & b->outcode & c->outcode) return;
+
+	// the common case, nothing to clip
+	uint32_t planes = (a->outcode | b->outcode | c->outcode) & dt->xf->clip_mask;
+	if (!planes) {
+		binner_triangle_add(dt->binner, dt->producer, a->screen, b->screen, c->screen, color);
+		dt->stats->clipper_primitives += 1;
+		return;
+	}
+
+	TRACE_SCOPE("clip polygon");
+	V4f poly[CLIP_POLY_MAX] = { a->clip, b->clip, c->clip };
+	size_t n = clip_polygon(poly, 3, planes, &dt->xf->planes);
+
+	V3f screen[CLIP_POLY_MAX];
+	for (size_t i = 0; i < n; i++) screen[i] = clip_to_screen(dt->xf, poly[i]);
+
+	for (size_t i = 1; i + 1 < n; i++) {
+		binner_triangle_add(dt->binner, dt->producer, screen[0], screen[i], screen[i + 1], color);
+		dt->stats->clipper_primitives += 1;
+	}
+}
+
+void triangle_draw(Triangle t, DrawTarget* dt, Color color) {
+
+	PostVertex a = vertex_transform_one(dt->xf, t.v1);
+	PostVertex b = vertex_transform_one(dt->xf, t.v2);
+	PostVertex c = vertex_transform_one(dt->xf, t.v3);
+	dt->stats->input_vertices     += 3;
+	dt->stats->vertex_invocations += 3;
+
+	triangle_assemble(&a, &b, &c, dt, color);
+}
+
+// everything a frame hands to its jobs
+typedef struct {
+	Framebuffer*    fb;
+	Binner*         binner;
+	const Mesh*     mesh;
+	const V3qSoA*   positions;  // meshlet vertices as a stream for the batch kernels
+	VertexTransform xf;
+	Frustum         frustum;
+	V3f             eye;
+	PostVertex*     verts;      // post-transform meshlet vertices
+	CullMode        cull;       // of the mesh draw
+	uint8_t*        meshlets;   // MESHLET_* decision of the cluster test per meshlet
+	uint8_t*        faces;      // FACE_* decision of the culling stage per mesh face
+	CullStats*      cull_stats; // one per thread
+	size_t          grid_lines;
+	bool            wireframe;  // mesh drawn from its edge list
+	size_t          items;
+	OcclusionStats* stats;   // one per thread
+	PipelineStats*  pipeline; // one per thread
+	HeatmapMode     heatmap;
+	uint32_t        heatmap_top;
+	uint64_t*       tile_ns;  // NULL unless the tile times are needed
+	const float*    tile_heat;
+} Frame;
+
+// Vertex stage: culls whole meshlets, then transforms the vertices of the
+// remaining ones exactly once per frame.
+static void job_vertex(void* arg, size_t begin, size_t end) {
+
+	Frame* f = arg;
+	CullStats*    stats    = &f->cull_stats[jobs_thread_index()];
+	PipelineStats pipeline = {0};
+
+	for (size_t i = begin; i < end; i++) {
+		const Meshlet* m = &f->mesh->m[i];
+		f->meshlets[i] = meshlet_cull(m, &f->frustum, f->eye, f->cull);
+		pipeline.input_vertices += m->v_count;
+
+		if (f->meshlets[i] == MESHLET_CULLED_FRUSTUM) stats->meshlets_frustum += 1;
+		if (f->meshlets[i] == MESHLET_CULLED_FACING)  stats->meshlets_facing  += 1;
+		if (f->meshlets[i] != MESHLET_VISIBLE) continue;
+
+		vertex_transform(&f->xf, f->positions, m->v_offset, m->v_offset + m->v_count, f->verts);
+		pipeline.vertex_invocations += m->v_count;
+	}
+
+	pipeline_stats_add(&f->pipeline[jobs_thread_index()], &pipeline);
+}
+
+// Culling stage: decides once per face whether it reaches the rasterizer.
+static void job_cull(void* arg, size_t begin, size_t end) {
+
+	Frame* f = arg;
+	CullStats* stats = &f->cull_stats[jobs_thread_index()];
+
+	for (size_t i = begin; i < end; i++) {
+		const Meshlet* m = &f->mesh->m[i];
+		size_t first = m->t_offset;
+		size_t last  = m->t_offset + m->t_count;
+
+		if (f->meshlets[i] != MESHLET_VISIBLE) {
+			memset(&f->faces[first], FACE_CULLED_MESHLET, last - first);
+			continue;
+		}
+
+		for (size_t t = first; t < last; t++) {
+			V3u face = mesh_cface(f->mesh, t);
+			f->faces[t] = face_cull(&f->verts[face.x-1], &f->verts[face.y-1], &f->verts[face.z-1], f->cull);
+
+			if (f->faces[t] == FACE_CULLED_FACING)     stats->facing     += 1;
+			if (f->faces[t] == FACE_CULLED_DEGENERATE) stats->degenerate += 1;
+		}
+	}
+}
+
+// Geometry stage: every chunk assembles a contiguous slice of the frame's
+// primitives into its own bins, chunks in order keep the draw order.
+static void job_geometry(void* arg, size_t begin, size_t end) {
+
+	Frame* f = arg;
+	// counted locally, the copies of the threads share cache lines
+	PipelineStats stats = {0};
+
+	for (size_t c = begin; c < end; c++) {
+		DrawTarget dt = {
+			.binner    = f->binner,
+			.producer  = (uint32_t) c,
+			.xf        = &f->xf,
+			.wireframe = f->wireframe,
+			.stats     = &stats
+		};
+
+		size_t first = f->items * c / GEOMETRY_CHUNKS;
+		size_t last  = f->items * (c + 1) / GEOMETRY_CHUNKS;
+		stats.input_primitives += last - first;
+
+		for (size_t i = first; i < last; i++) {
+			if (i < f->grid_lines) {
+				grid_line_draw(i, &dt);
+				continue;
+			}
+
+			if (f->wireframe) {
+				// hidden lines: an edge stays if one of its faces does, drawn
+				// from the vertices of a meshlet that was transformed
+				V2u faces = f->mesh->ef[i - f->grid_lines];
+				if (faces.x && f->faces[faces.x-1] == FACE_VISIBLE) {
+					V2u edge = f->mesh->e[i - f->grid_lines];
+					line_assemble(&f->verts[edge.x-1], &f->verts[edge.y-1], &dt, GREEN);
+				} else if (faces.y && f->faces[faces.y-1] == FACE_VISIBLE) {
+					V2u edge = f->mesh->e2[i - f->grid_lines];
+					line_assemble(&f->verts[edge.x-1], &f->verts[edge.y-1], &dt, GREEN);
+				} else {
+					stats.culled_primitives += 1;
+				}
+				continue;
+			}
+
+			if (f->faces[i - f->grid_lines] != FACE_VISIBLE) {
+				stats.culled_primitives += 1;
+				continue;
+			}
+
+			V3u face = mesh_cface(f->mesh, i - f->grid_lines);
+			triangle_assemble(&f->verts[face.x-1], &f->verts[face.y-1], &f->verts[face.z-1],
+					  &dt, GREEN);
+		}
+	}
+
+	pipeline_stats_add(&f->pipeline[jobs_thread_index()], &stats);
+}
+
+// Raster stage: one job per range of screen tiles.
+static void job_raster(void* arg, size_t begin, size_t end) {
+
+	Frame* f = arg;
+	OcclusionStats* stats    = &f->stats[jobs_thread_index()];
+	PipelineStats   pipeline = {0};
+
+	for (size_t t = begin; t < end; t++) {
+		uint64_t start = f->tile_ns ? jobs_time_ns() : 0;
+		binner_tile_raster(f->binner, f->fb, (uint32_t) t, stats, &pipeline);
+		if (f->tile_ns) f->tile_ns[t] = jobs_time_ns() - start;
+	}
+	pipeline_stats_add(&f->pipeline[jobs_thread_index()], &pipeline);
+}
+
+// t in [0, 1] from black over blue, green and yellow to red
+static Color heat_color(float t) {
+
+	static const Color ramp[] = { 0x00000000, 0x000000FF, 0x0000FF00, 0x00FFFF00, 0x00FF0000 };
+	const size_t last = sizeof ramp / sizeof *ramp - 1;
+
+	t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+	float  x = t * (float) last;
+	size_t i = (size_t) x < last ? (size_t) x : last - 1;
+	float  s = x - (float) i;
+
+	Color res = 0;
+	for (int shift = 0; shift <= 16; shift += 8) {
+		float a = (float) ((ramp[i]     >> shift) & 0xFF);
+		float b = (float) ((ramp[i + 1] >> shift) & 0xFF);
+		res |= (Color) (a + (b - a) * s + 0.5f) << shift;
+	}
+	return res;
+}
+
+// Heatmap stage: replaces the colour of rows of binner tiles [begin, end)
+// below heatmap_top.
+static void job_heatmap(void* arg, size_t begin, size_t end) {
+
+	Frame*       f  = arg;
+	Framebuffer* fb = f->fb;
+
+	uint32_t y_begin = (uint32_t) begin * BIN_TILE_SIZE > f->heatmap_top ? (uint32_t) begin * BIN_TILE_SIZE :
+			   f->heatmap_top;
+	uint32_t y_end   = (uint32_t) end * BIN_TILE_SIZE < fb->height ? (uint32_t) end * BIN_TILE_SIZE : fb->height;
+	for (uint32_t y = y_begin; y < y_end; y++) {
+		uint32_t* row  = fb->color + (size_t) y * fb->width;
+		size_t    base = (size_t) (y >> BIN_TILE_BITS) * f->binner->tiles_x;
+
+		if (f->heatmap == HEATMAP_OVERDRAW) {
+			const uint16_t* count = fb->overdraw ? fb->overdraw + (size_t) y * fb->width : NULL;
+			for (uint32_t x = 0; x < fb->width; x++) {
+				row[x] = heat_color(count ? (float) count[x] / (float) HEATMAP_OVERDRAW_MAX : 0.0f);
+			}
+			continue;
+		}
+
+		for (uint32_t x = 0; x < fb->width; x++) row[x] = heat_color(f->tile_heat[base + (x >> BIN_TILE_BITS)]);
+	}
+}
+
+// per tile values of the tile heatmaps relative to the largest, returns that
+static double tile_heat_compute(Renderer* r, HeatmapMode mode) {
+
+	const Binner* b     = r->binner;
+	uint32_t      tiles = b->tiles_x * b->tiles_y;
+
+	double max = 0.0;
+	for (uint32_t t = 0; t < tiles; t++) {
+		double value = 0.0;
+		if (mode == HEATMAP_TILE_TIME) {
+			value = (double) r->tile_ns[t];
+		} else {
+			for (uint32_t s = 0; s < b->set_count; s++) value += b->sets[s].bins[t].count;
+		}
+		r->tile_heat[t] = (float) value;
+		max = value > max ? value : max;
+	}
+
+	for (uint32_t t = 0; t < tiles; t++) r->tile_heat[t] = max > 0.0 ? r->tile_heat[t] / (float) max : 0.0f;
+
+	return mode == HEATMAP_TILE_TIME ? max / 1e6 : max;
+}
+
+void render_clear_job(void* fb, size_t begin, size_t end) {
+
+	Framebuffer* f = fb;
+	uint32_t height  = f->height;
+	uint32_t y_begin = (uint32_t) begin * HIZ_TILE_SIZE;
+	uint32_t y_end   = (uint32_t) end * HIZ_TILE_SIZE;
+
+	// the last row of tiles may stick out of the screen
+	framebuffer_clear_rows(f, y_begin < height ? y_begin : height, y_end < height ? y_end : height);
+}
+
+bool renderer_create(Renderer* r, MeshLods* lods, Jobs* jobs, Binner* binner) {
+
+	*r = (Renderer) { .jobs = jobs, .binner = binner, .lods = lods };
+
+	// the per frame arrays fit the largest level
+	size_t mv_max = 0, m_max = 0, f_max = 0;
+	for (size_t i = 0; i < lods->lod_count; i++) {
+		mv_max = lods->lod[i].mv_count > mv_max ? lods->lod[i].mv_count : mv_max;
+		m_max  = lods->lod[i].m_count  > m_max  ? lods->lod[i].m_count  : m_max;
+		f_max  = lods->lod[i].f_count  > f_max  ? lods->lod[i].f_count  : f_max;
+	}
+
+	r->verts      = calloc(mv_max ? mv_max : 1, sizeof *r->verts);
+	r->meshlets   = calloc(m_max ? m_max : 1, sizeof *r->meshlets);
+	r->faces      = calloc(f_max ? f_max : 1, sizeof *r->faces);
+	r->cull_stats = calloc(jobs->count, sizeof *r->cull_stats);
+	r->occlusion  = calloc(jobs->count, sizeof *r->occlusion);
+	r->pipeline   = calloc(jobs->count, sizeof *r->pipeline);
+	r->tile_ns    = calloc((size_t) binner->tiles_x * binner->tiles_y, sizeof *r->tile_ns);
+	r->tile_heat  = calloc((size_t) binner->tiles_x * binner->tiles_y, sizeof *r->tile_heat);
+
+	bool ready = r->verts && r->meshlets && r->faces && r->cull_stats && r->occlusion && r->pipeline &&
+		     r->tile_ns && r->tile_heat;
+	for (size_t i = 0; ready && i < lods->lod_count; i++) {
+		Mesh* mesh = &lods->lod[i];
+		ready = mesh_meshlets_unpack(mesh) && soa_3q_create(&r->positions[i], mesh->cv, mesh->mv_count);
+		if (ready && !mesh_edges_build(mesh)) fprintf(stderr, "Failed to build the edge list of level %zu.\n", i);
+	}
+	if (!ready) {
+		renderer_destroy(r);
+		return false;
+	}
+
+	return true;
+}
+
+void renderer_destroy(Renderer* r) {
+
+	for (size_t i = 0; i < MESH_LOD_MAX; i++) soa_3q_destroy(&r->positions[i]);
+	free(r->tile_heat);
+	free(r->tile_ns);
+	free(r->pipeline);
+	free(r->occlusion);
+	free(r->cull_stats);
+	free(r->faces);
+	free(r->meshlets);
+	free(r->verts);
+	*r = (Renderer) {0};
+}
+
+void renderer_draw(Renderer* r, Framebuffer* fb, Camera camera, size_t lod, const RenderOptions* o,
+		   RenderStats* stats) {
+
+	TRACE_SCOPE("draw");
+	Jobs*       jobs = r->jobs;
+	const Mesh* mesh = &r->lods->lod[lod];
+
+	Frame frame = {
+		.fb          = fb,
+		.binner      = r->binner,
+		.mesh        = mesh,
+		.positions   = &r->positions[lod],
+		.eye         = camera.position,
+		.verts       = r->verts,
+		.cull        = o->cull,
+		.meshlets    = r->meshlets,
+		.faces       = r->faces,
+		.cull_stats  = r->cull_stats,
+		.grid_lines  = o->grid_on ? GRID_LINE_COUNT : 0,
+		.stats       = r->occlusion,
+		.pipeline    = r->pipeline,
+		.heatmap     = o->heatmap,
+		.heatmap_top = o->heatmap_top,
+		.tile_ns     = o->heatmap == HEATMAP_TILE_TIME ? r->tile_ns : NULL,
+		.tile_heat   = r->tile_heat
+	};
+	vertex_transform_setup(&frame.xf, camera, &fb->depth, fb->width, fb->height, o->guard_band);
+	vertex_stream_setup(&frame.xf, mesh->q_offset, mesh->q_scale);
+	frame.wireframe = o->wireframe && mesh->e;
+
+	// whole objects outside the frustum never reach the vertex stage
+	frustum_from_transform(&frame.frustum, &frame.xf);
+	bool   mesh_visible   = o->mesh_on &&
+			      !frustum_sphere_outside(&frame.frustum, mesh->center, mesh->radius) &&
+			      !frustum_aabb_outside(&frame.frustum, mesh->aabb_min, mesh->aabb_max);
+	size_t m_count        = mesh_visible ? mesh->m_count : 0;
+
+	frame.items = frame.grid_lines + (!mesh_visible ? 0 : frame.wireframe ? mesh->e_count : mesh->f_count);
+	for (uint32_t i = 0; i < jobs->count; i++) r->occlusion[i]  = (OcclusionStats) {0};
+	for (uint32_t i = 0; i < jobs->count; i++) r->cull_stats[i] = (CullStats) {0};
+	for (uint32_t i = 0; i < jobs->count; i++) r->pipeline[i]   = (PipelineStats) {0};
+
+	jobs_frame_reset(jobs);
+	binner_reset(r->binner);
+
+	// a few tile ranges per thread keep stealing fair and the job count
+	// bounded, however large the framebuffer
+	uint32_t tiles  = r->binner->tiles_x * r->binner->tiles_y;
+	size_t   pieces = 16 * (size_t) jobs->count;
+	Job* vertex   = jobs_parallel_for(jobs, "vertex", job_vertex, &frame, 0, m_count, 32);
+	Job* cull     = jobs_parallel_for(jobs, "cull", job_cull, &frame, 0, m_count, 32);
+	Job* geometry = jobs_parallel_for(jobs, "geometry", job_geometry, &frame, 0, GEOMETRY_CHUNKS, GEOMETRY_CHUNKS);
+	Job* raster   = jobs_parallel_for(jobs, "raster", job_raster, &frame, 0, tiles, pieces);
+	jobs_depend(vertex, cull);
+	jobs_depend(cull, geometry);
+	jobs_depend(geometry, raster);
+	jobs_submit(jobs, vertex);
+	jobs_wait(jobs, raster);
+
+	double heat_max = HEATMAP_OVERDRAW_MAX;
+	if (o->heatmap != HEATMAP_OFF) {
+		if (o->heatmap != HEATMAP_OVERDRAW) heat_max = tile_heat_compute(r, o->heatmap);
+
+		Job* heatmap = jobs_parallel_for(jobs, "heatmap", job_heatmap, &frame, 0, r->binner->tiles_y, pieces);
+		jobs_submit(jobs, heatmap);
+		jobs_wait(jobs, heatmap);
+	}
+
+	*stats = (RenderStats) {
+		.lines          = binner_line_count(r->binner),
+		.triangles      = binner_triangle_count(r->binner),
+		.dropped        = binner_dropped_count(r->binner),
+		.objects_culled = o->mesh_on && !mesh_visible ? 1 : 0,
+		.meshlets       = m_count,
+		.heat_max       = o->heatmap != HEATMAP_OFF ? heat_max : 0.0
+	};
+	for (uint32_t i = 0; i < jobs->count; i++) {
+		stats->occlusion.fragments_rejected += r->occlusion[i].fragments_rejected;
+		stats->occlusion.tiles_rejected     += r->occlusion[i].tiles_rejected;
+		stats->occlusion.triangles_rejected += r->occlusion[i].triangles_rejected;
+		stats->cull.facing           += r->cull_stats[i].facing;
+		stats->cull.degenerate       += r->cull_stats[i].degenerate;
+		stats->cull.meshlets_frustum += r->cull_stats[i].meshlets_frustum;
+		stats->cull.meshlets_facing  += r->cull_stats[i].meshlets_facing;
+		pipeline_stats_add(&stats->pipeline, &r->pipeline[i]);
+	}
+}
@@ -0,0 +1,300 @@
+#include "../inc/simplify.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// border edges add a plane through them standing on their face, weighted
+// like a face this many times their squared length
+#define SIMPLIFY_BORDER_WEIGHT 10.0
+
+// sum of squared distances to planes n.p + d = 0, weighted by w
+typedef struct {
+	double a00, a11, a22, a10, a20, a21;
+	double b0, b1, b2;
+	double c;
+	double w;
+} Quadric;
+
+typedef struct {
+	uint32_t u;     // removed vertex
+	uint32_t v;     // vertex u moves onto
+	float    cost;  // squared distance
+} Collapse;
+
+static void quadric_add_plane(Quadric* q, V3f n, float d, double w) {
+
+	q->a00 += w * n.x * n.x;
+	q->a11 += w * n.y * n.y;
+	q->a22 += w * n.z * n.z;
+	q->a10 += w * n.y * n.x;
+	q->a20 += w * n.z * n.x;
+	q->a21 += w * n.z * n.y;
+	q->b0  += w * n.x * d;
+	q->b1  += w * n.y * d;
+	q->b2  += w * n.z * d;
+	q->c   += w * d * d;
+	q->w   += w;
+}
+
+static void quadric_add(Quadric* q, const Quadric* r) {
+
+	q->a00 += r->a00;
+	q->a11 += r->a11;
+	q->a22 += r->a22;
+	q->a10 += r->a10;
+	q->a20 += r->a20;
+	q->a21 += r->a21;
+	q->b0  += r->b0;
+	q->b1  += r->b1;
+	q->b2  += r->b2;
+	q->c   += r->c;
+	q->w   += r->w;
+}
+
+// weighted mean squared distance of p to the planes
+static double quadric_error(const Quadric* q, V3f p) {
+
+	double x = p.x, y = p.y, z = p.z;
+	double e = q->a00 * x * x + q->a11 * y * y + q->a22 * z * z
+		 + 2.0 * (q->a10 * x * y + q->a20 * x * z + q->a21 * y * z)
+		 + 2.0 * (q->b0 * x + q->b1 * y + q->b2 * z) + q->c;
+
+	return q->w > 0.0 && e > 0.0 ? e / q->w : 0.0;
+}
+
+static inline V3f face_cross(const V3f* v, uint32_t a, uint32_t b, uint32_t c) {
+
+	return cross_3f(sub_3f(v[b], v[a]), sub_3f(v[c], v[a]));
+}
+
+static inline uint64_t half_edge_key(uint32_t a, uint32_t b) {
+
+	return (uint64_t) a << 32 | b;
+}
+
+static inline size_t half_edge_hash(uint64_t key, size_t mask) {
+
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdull;
+	key ^= key >> 33;
+	return (size_t) key & mask;
+}
+
+static int collapse_compare(const void* a, const void* b) {
+
+	float ca = ((const Collapse*) a)->cost;
+	float cb = ((const Collapse*) b)->cost;
+	return (ca > cb) - (ca < cb);
+}
+
+// open addressing set of the half edges of faces, 0-based vertices + 1 so a
+// zero key is an empty slot
+static uint64_t* half_edges_build(const V3u* f, size_t f_count, size_t* size) {
+
+	*size = 16;
+	while (*size < 6 * f_count) *size *= 2;
+
+	uint64_t* table = calloc(*size, sizeof *table);
+	if (!table) return NULL;
+
+	for (size_t i = 0; i < f_count; i++) {
+		for (int k = 0; k < 3; k++) {
+			uint64_t key  = half_edge_key(f[i].arr[k] + 1, f[i].arr[(k + 1) % 3] + 1);
+			size_t   slot = half_edge_hash(key, *size - 1);
+			while (table[slot] && table[slot] != key) slot = (slot + 1) & (*size - 1);
+			table[slot] = key;
+		}
+	}
+	return table;
+}
+
+static bool half_edge_find(const uint64_t* table, size_t size, uint32_t a, uint32_t b) {
+
+	uint64_t key  = half_edge_key(a + 1, b + 1);
+	size_t   slot = half_edge_hash(key, size - 1);
+	while (table[slot] && table[slot] != key) slot = (slot + 1) & (size - 1);
+	return table[slot] == key;
+}
+
+// Moving u onto v must not turn any of the remaining faces around u over.
+// The faces see the collapses of this pass through remap.
+static bool collapse_valid(const V3f* v, const V3u* f, const uint32_t* start, const uint32_t* adj,
+			   const uint32_t* remap, uint32_t from, uint32_t to) {
+
+	for (uint32_t a = start[from]; a < start[from + 1]; a++) {
+		V3u face = f[adj[a]];
+		for (int k = 0; k < 3; k++) face.arr[k] = remap[face.arr[k]];
+		if (face.x == face.y || face.y == face.z || face.z == face.x) continue;
+		if (face.x == to || face.y == to || face.z == to) continue;
+
+		V3f before = face_cross(v, face.x, face.y, face.z);
+		for (int k = 0; k < 3; k++) face.arr[k] = face.arr[k] == from ? to : face.arr[k];
+		V3f after  = face_cross(v, face.x, face.y, face.z);
+
+		if (dot_3f(before, after) <= 0.0f) return false;
+	}
+	return true;
+}
+
+size_t simplify(V3u* out, const V3f* v, size_t v_count, const V3u* f, size_t f_count,
+		size_t target, float max_error, float* error) {
+
+	*error = 0.0f;
+
+	// work on 0-based faces, dropped faces are compacted away after every pass
+	V3u*      faces    = malloc((f_count + 1) * sizeof *faces);
+	Quadric*  quadrics = calloc(v_count + 1, sizeof *quadrics);
+	bool*     border   = calloc(v_count + 1, sizeof *border);
+	uint32_t* remap    = malloc((v_count + 1) * sizeof *remap);
+	bool*     locked   = calloc(v_count + 1, sizeof *locked);
+	uint32_t* start    = calloc(v_count + 2, sizeof *start);
+	uint32_t* fill     = calloc(v_count + 1, sizeof *fill);
+	uint32_t* adj      = malloc((3 * f_count + 1) * sizeof *adj);
+	Collapse* cands    = malloc((6 * f_count + 1) * sizeof *cands);
+	size_t    size     = 0;
+	uint64_t* edges    = NULL;
+	if (faces) {
+		for (size_t i = 0; i < f_count; i++) {
+			faces[i] = (V3u) {{ f[i].x - 1, f[i].y - 1, f[i].z - 1 }};
+		}
+		edges = half_edges_build(faces, f_count, &size);
+	}
+	if (!faces || !quadrics || !border || !remap || !locked || !start || !fill || !adj || !cands || !edges) {
+		free(faces);
+		free(quadrics);
+		free(border);
+		free(remap);
+		free(locked);
+		free(start);
+		free(fill);
+		free(adj);
+		free(cands);
+		free(edges);
+		memcpy(out, f, f_count * sizeof *out);
+		return f_count;
+	}
+
+	// planes of the faces weighted by their area, borders by their length
+	for (size_t i = 0; i < f_count; i++) {
+		V3u   face = faces[i];
+		V3f   n    = face_cross(v, face.x, face.y, face.z);
+		float len  = length_3f(n);
+		if (len <= 0.0f) continue;
+
+		n = scal_3f(1.0f / len, n);
+		for (int k = 0; k < 3; k++) {
+			quadric_add_plane(&quadrics[face.arr[k]], n, -dot_3f(n, v[face.arr[k]]), 0.5 * len);
+		}
+
+		for (int k = 0; k < 3; k++) {
+			uint32_t a = face.arr[k], b = face.arr[(k + 1) % 3];
+			if (half_edge_find(edges, size, b, a)) continue;
+
+			border[a] = border[b] = true;
+			V3f   e      = sub_3f(v[b], v[a]);
+			V3f   side   = cross_3f(e, n);
+			float length = length_3f(side);
+			if (length <= 0.0f) continue;
+
+			side = scal_3f(1.0f / length, side);
+			double w = SIMPLIFY_BORDER_WEIGHT * dot_3f(e, e);
+			quadric_add_plane(&quadrics[a], side, -dot_3f(side, v[a]), w);
+			quadric_add_plane(&quadrics[b], side, -dot_3f(side, v[a]), w);
+		}
+	}
+
+	double max_cost = (double) max_error * max_error;
+	double worst    = 0.0;
+	size_t count    = f_count;
+
+	while (count > target) {
+		// faces around every vertex of the current faces
+		memset(start, 0, (v_count + 2) * sizeof *start);
+		memset(fill,  0, (v_count + 1) * sizeof *fill);
+		for (size_t i = 0; i < 3 * count; i++) start[faces[i / 3].arr[i % 3] + 1]++;
+		for (size_t i = 0; i < v_count; i++) start[i + 1] += start[i];
+		for (size_t i = 0; i < 3 * count; i++) {
+			uint32_t vi = faces[i / 3].arr[i % 3];
+			adj[start[vi] + fill[vi]++] = (uint32_t) (i / 3);
+		}
+
+		// Every half edge offers to remove its first vertex, border edges
+		// both ways. Interior vertices may go anywhere, border vertices only
+		// along their border.
+		free(edges);
+		edges = half_edges_build(faces, count, &size);
+		if (!edges) break;
+
+		size_t cand_count = 0;
+		for (size_t i = 0; i < count; i++) {
+			for (int k = 0; k < 3; k++) {
+				uint32_t a = faces[i].arr[k], b = faces[i].arr[(k + 1) % 3];
+				bool     open = !half_edge_find(edges, size, b, a);
+				uint32_t ends[2][2] = { { a, b }, { b, a } };
+
+				for (int d = 0; d < (open ? 2 : 1); d++) {
+					uint32_t from = ends[d][0], to = ends[d][1];
+					if (border[from] && !open) continue;
+
+					Quadric q = quadrics[from];
+					quadric_add(&q, &quadrics[to]);
+					cands[cand_count++] = (Collapse) { from, to, (float) quadric_error(&q, v[to]) };
+				}
+			}
+		}
+		qsort(cands, cand_count, sizeof *cands, collapse_compare);
+
+		// cheapest first, every vertex takes part in at most one collapse per pass
+		for (size_t i = 0; i < v_count; i++) {
+			remap[i]  = (uint32_t) i;
+			locked[i] = false;
+		}
+
+		size_t removed    = 0;
+		size_t collapses  = 0;
+		for (size_t c = 0; c < cand_count && count - removed > target; c++) {
+			Collapse col = cands[c];
+			if (col.cost > max_cost) break;
+			if (locked[col.u] || locked[col.v]) continue;
+			if (!collapse_valid(v, faces, start, adj, remap, col.u, col.v)) continue;
+
+			// faces shared by u and v disappear
+			for (uint32_t a = start[col.u]; a < start[col.u + 1]; a++) {
+				V3u face = faces[adj[a]];
+				for (int k = 0; k < 3; k++) face.arr[k] = remap[face.arr[k]];
+				if (face.x == col.v || face.y == col.v || face.z == col.v) removed++;
+			}
+
+			remap[col.u]  = col.v;
+			locked[col.u] = locked[col.v] = true;
+			quadric_add(&quadrics[col.v], &quadrics[col.u]);
+			worst = col.cost > worst ? col.cost : worst;
+			collapses++;
+		}
+		if (!collapses) break;
+
+		size_t kept = 0;
+		for (size_t i = 0; i < count; i++) {
+			V3u face = faces[i];
+			for (int k = 0; k < 3; k++) face.arr[k] = remap[face.arr[k]];
+			if (face.x == face.y || face.y == face.z || face.z == face.x) continue;
+			faces[kept++] = face;
+		}
+		count = kept;
+	}
+
+	for (size_t i = 0; i < count; i++) out[i] = (V3u) {{ faces[i].x + 1, faces[i].y + 1, faces[i].z + 1 }};
+	*error = sqrtf((float) worst);
+
+	free(faces);
+	free(quadrics);
+	free(border);
+	free(remap);
+	free(locked);
+	free(start);
+	free(fill);
+	free(adj);
+	free(cands);
+	free(edges);
+	return count;
+}
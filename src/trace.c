@@ -0,0 +1,132 @@
+#include "../inc/trace.h"
+
+#include <stdio.h>
+
+#ifdef TRACE
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+
+// written by its thread only, read by trace_write between frames
+typedef struct {
+	TraceEvent    events[TRACE_RING_SIZE];
+	atomic_size_t head;  // events ever recorded
+} TraceRing;
+
+static struct {
+	TraceRing*   rings[TRACE_THREAD_MAX];
+	atomic_uint  ring_count;
+	atomic_uint  frame;
+	// clock and time stamp counter at the first frame, to convert ticks
+	uint64_t     base_ns;
+	uint64_t     base_ticks;
+} trace;
+
+static _Thread_local TraceRing* trace_ring = NULL;
+static _Thread_local bool       trace_full = false;
+
+static uint64_t trace_time_ns(void) {
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+
+// the ring of the calling thread, allocated by its first event
+static TraceRing* trace_ring_get(void) {
+
+	if (trace_ring || trace_full) return trace_ring;
+
+	uint32_t index = atomic_fetch_add(&trace.ring_count, 1);
+	trace_ring = index < TRACE_THREAD_MAX ? calloc(1, sizeof *trace_ring) : NULL;
+	trace_full = !trace_ring;
+	if (trace_ring) trace.rings[index] = trace_ring;
+	return trace_ring;
+}
+
+void trace_event(const char* name, uint64_t begin, uint64_t end) {
+
+	TraceRing* ring = trace_ring_get();
+	if (!ring) return;
+
+	size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	ring->events[head & (TRACE_RING_SIZE - 1)] = (TraceEvent) {
+		.name  = name,
+		.begin = begin,
+		.end   = end,
+		.frame = atomic_load_explicit(&trace.frame, memory_order_relaxed)
+	};
+	atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void trace_frame_mark(void) {
+
+	if (!trace.base_ns) {
+		trace.base_ns    = trace_time_ns();
+		trace.base_ticks = trace_clock();
+	}
+	atomic_fetch_add_explicit(&trace.frame, 1, memory_order_relaxed);
+}
+
+bool trace_write(const char* path, uint32_t frames) {
+
+	if (!trace.base_ns) {
+		fprintf(stderr, "No frames traced.\n");
+		return false;
+	}
+
+	FILE* out = fopen(path, "w");
+	if (!out) return false;
+
+	// ticks per microsecond over everything since the first frame
+	uint64_t now_ns    = trace_time_ns();
+	uint64_t now_ticks = trace_clock();
+	double   per_us    = now_ns > trace.base_ns ?
+			     (double) (now_ticks - trace.base_ticks) * 1e3 / (double) (now_ns - trace.base_ns) : 1e3;
+	if (per_us <= 0.0) per_us = 1e3;
+
+	uint32_t frame = atomic_load(&trace.frame);
+	uint32_t first = frame > frames ? frame - frames + 1 : 0;
+	uint32_t count = atomic_load(&trace.ring_count);
+	if (count > TRACE_THREAD_MAX) count = TRACE_THREAD_MAX;
+
+	fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool comma = false;
+	for (uint32_t t = 0; t < count; t++) {
+		TraceRing* ring = trace.rings[t];
+		if (!ring) continue;
+
+		fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+			"\"args\":{\"name\":\"thread %u\"}}", comma ? ",\n" : "", t, t);
+		comma = true;
+
+		// the oldest events were overwritten once the ring wrapped around
+		size_t head  = atomic_load_explicit(&ring->head, memory_order_acquire);
+		size_t start = head > TRACE_RING_SIZE ? head - TRACE_RING_SIZE : 0;
+		for (size_t i = start; i < head; i++) {
+			const TraceEvent* e = &ring->events[i & (TRACE_RING_SIZE - 1)];
+			if (e->frame < first) continue;
+
+			double ts  = (double) (int64_t) (e->begin - trace.base_ticks) / per_us;
+			double dur = (double) (e->end - e->begin) / per_us;
+			fprintf(out, ",\n{\"name\":\"%s\",\"cat\":\"srend\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+				"\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%u}}", e->name, t, ts, dur, e->frame);
+		}
+	}
+	fprintf(out, "\n]}\n");
+
+	return fclose(out) == 0;
+}
+
+#else
+
+bool trace_write(const char* path, uint32_t frames) {
+
+	(void) path;
+	(void) frames;
+	fprintf(stderr, "Tracing needs a build with -DTRACE.\n");
+	return false;
+}
+
+#endif
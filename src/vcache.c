@@ -0,0 +1,213 @@
+#include "../inc/vcache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// scoring of Forsyth's "Linear-Speed Vertex Cache Optimisation"
+#define VCACHE_DECAY_POWER   1.5f
+#define VCACHE_LAST_SCORE    0.75f  // the last face's vertices, a fixed score so it isn't reused right away
+#define VCACHE_VALENCE_SCALE 2.0f
+#define VCACHE_VALENCE_POWER 0.5f
+#define VCACHE_VALENCE_MAX   32     // scores of higher valences are looked up as this one
+
+static float score_cache[VCACHE_SIZE];
+static float score_valence[VCACHE_VALENCE_MAX];
+
+static void scores_init(void) {
+
+	for (uint32_t i = 0; i < VCACHE_SIZE; i++) {
+		score_cache[i] = i < 3 ? VCACHE_LAST_SCORE
+				       : powf(1.0f - (float) (i - 3) / (VCACHE_SIZE - 3), VCACHE_DECAY_POWER);
+	}
+	for (uint32_t i = 1; i < VCACHE_VALENCE_MAX; i++) {
+		score_valence[i] = VCACHE_VALENCE_SCALE * powf((float) i, -VCACHE_VALENCE_POWER);
+	}
+}
+
+// pos is -1 outside of the cache, vertices without faces left don't matter anymore
+static inline float vertex_score(int32_t pos, uint32_t remaining) {
+
+	if (!remaining) return -1.0f;
+
+	float score = pos >= 0 ? score_cache[pos] : 0.0f;
+	return score + score_valence[remaining < VCACHE_VALENCE_MAX ? remaining : VCACHE_VALENCE_MAX - 1];
+}
+
+static inline bool cache_has(const uint32_t* cache, uint32_t count, uint32_t v) {
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (cache[i] == v) return true;
+	}
+	return false;
+}
+
+VcacheStats vcache_analyze(const V3u* f, size_t f_count, size_t v_count, uint32_t cache_size) {
+
+	// FIFO: a vertex is still cached if fewer than cache_size others came in after it
+	size_t* stamp = calloc(v_count + 1, sizeof *stamp);
+	if (!stamp) return (VcacheStats) {0};
+
+	size_t transforms = 0;
+	for (size_t i = 0; i < f_count; i++) {
+		for (int k = 0; k < 3; k++) {
+			uint32_t v = f[i].arr[k] - 1;
+			if (stamp[v] && transforms - stamp[v] < cache_size) continue;
+			stamp[v] = ++transforms;
+		}
+	}
+	free(stamp);
+
+	return (VcacheStats) {
+		.transforms = transforms,
+		.acmr       = f_count ? (float) transforms / (float) f_count : 0.0f,
+		.atvr       = v_count ? (float) transforms / (float) v_count : 0.0f
+	};
+}
+
+// Greedy: always emits the face whose vertices score highest, the candidates
+// are the faces of the vertices in the simulated LRU cache.
+bool vcache_optimize(V3u* f, size_t f_count, size_t v_count) {
+
+	uint32_t* start     = calloc(v_count + 1, sizeof *start);
+	uint32_t* remaining = calloc(v_count + 1, sizeof *remaining);
+	int32_t*  cache_pos = malloc((v_count + 1) * sizeof *cache_pos);
+	float*    v_score   = malloc((v_count + 1) * sizeof *v_score);
+	uint32_t* adj       = malloc((3 * f_count + 1) * sizeof *adj);
+	float*    f_score   = calloc(f_count + 1, sizeof *f_score);
+	bool*     emitted   = calloc(f_count + 1, sizeof *emitted);
+	V3u*      out       = malloc((f_count + 1) * sizeof *out);
+	if (!start || !remaining || !cache_pos || !v_score || !adj || !f_score || !emitted || !out) {
+		free(start);
+		free(remaining);
+		free(cache_pos);
+		free(v_score);
+		free(adj);
+		free(f_score);
+		free(emitted);
+		free(out);
+		return false;
+	}
+
+	scores_init();
+
+	// faces around every vertex, remaining counts the ones not emitted yet
+	// and keeps them at the front of the vertex's range
+	for (size_t i = 0; i < 3 * f_count; i++) start[f[i / 3].arr[i % 3]]++;
+	for (size_t v = 0; v < v_count; v++) start[v + 1] += start[v];
+	for (size_t i = 0; i < 3 * f_count; i++) {
+		uint32_t v = f[i / 3].arr[i % 3] - 1;
+		adj[start[v] + remaining[v]++] = (uint32_t) (i / 3);
+	}
+
+	for (size_t v = 0; v < v_count; v++) {
+		cache_pos[v] = -1;
+		v_score[v]   = vertex_score(-1, remaining[v]);
+	}
+	int64_t best = -1;
+	for (size_t i = 0; i < f_count; i++) {
+		for (int k = 0; k < 3; k++) f_score[i] += v_score[f[i].arr[k] - 1];
+		if (best < 0 || f_score[i] > f_score[best]) best = (int64_t) i;
+	}
+
+	uint32_t cache[VCACHE_SIZE + 3];
+	uint32_t cache_count = 0;
+	size_t   cursor      = 0;
+
+	for (size_t n = 0; n < f_count; n++) {
+		// nothing in the cache has faces left, continue in the input order
+		if (best < 0) {
+			while (emitted[cursor]) cursor++;
+			best = (int64_t) cursor;
+		}
+
+		V3u face = f[best];
+		out[n] = face;
+		emitted[best] = true;
+
+		uint32_t next[VCACHE_SIZE + 3];
+		uint32_t next_count = 0;
+		for (int k = 0; k < 3; k++) {
+			uint32_t v = face.arr[k] - 1;
+			if (!cache_has(next, next_count, v)) next[next_count++] = v;
+
+			uint32_t* faces = &adj[start[v]];
+			for (uint32_t a = 0; a < remaining[v]; a++) {
+				if (faces[a] != (uint32_t) best) continue;
+				faces[a] = faces[--remaining[v]];
+				break;
+			}
+		}
+		for (uint32_t i = 0; i < cache_count; i++) {
+			if (!cache_has(next, next_count < 3 ? next_count : 3, cache[i])) next[next_count++] = cache[i];
+		}
+
+		// rescore everything that moved in, within or out of the cache
+		for (uint32_t i = 0; i < next_count; i++) {
+			uint32_t v = next[i];
+			cache_pos[v] = i < VCACHE_SIZE ? (int32_t) i : -1;
+
+			float score = vertex_score(cache_pos[v], remaining[v]);
+			float delta = score - v_score[v];
+			v_score[v]  = score;
+			for (uint32_t a = 0; a < remaining[v]; a++) f_score[adj[start[v] + a]] += delta;
+		}
+
+		cache_count = next_count < VCACHE_SIZE ? next_count : VCACHE_SIZE;
+		memcpy(cache, next, cache_count * sizeof *cache);
+
+		best = -1;
+		for (uint32_t i = 0; i < cache_count; i++) {
+			uint32_t v = cache[i];
+			for (uint32_t a = 0; a < remaining[v]; a++) {
+				uint32_t t = adj[start[v] + a];
+				if (best < 0 || f_score[t] > f_score[best]) best = t;
+			}
+		}
+	}
+
+	// orders that are already good, like tessellated patches, are kept
+	if (vcache_analyze(out, f_count, v_count, VCACHE_SIZE).transforms <
+	    vcache_analyze(f, f_count, v_count, VCACHE_SIZE).transforms) {
+		memcpy(f, out, f_count * sizeof *f);
+	}
+
+	free(start);
+	free(remaining);
+	free(cache_pos);
+	free(v_score);
+	free(adj);
+	free(f_score);
+	free(emitted);
+	free(out);
+	return true;
+}
+
+bool vfetch_optimize(V3f* v, size_t v_count, V3u* f, size_t f_count) {
+
+	// new 1-based index of every vertex, 0 until it is first used
+	uint32_t* remap = calloc(v_count + 1, sizeof *remap);
+	V3f*      moved = malloc((v_count + 1) * sizeof *moved);
+	if (!remap || !moved) {
+		free(remap);
+		free(moved);
+		return false;
+	}
+
+	uint32_t count = 0;
+	for (size_t i = 0; i < f_count; i++) {
+		for (int k = 0; k < 3; k++) {
+			uint32_t* r = &remap[f[i].arr[k] - 1];
+			if (!*r) *r = ++count;
+			f[i].arr[k] = *r;
+		}
+	}
+	for (size_t i = 0; i < v_count; i++) {
+		if (!remap[i]) remap[i] = ++count;
+		moved[remap[i] - 1] = v[i];
+	}
+	memcpy(v, moved, v_count * sizeof *v);
+
+	free(remap);
+	free(moved);
+	return true;
+}
@@ -0,0 +1,356 @@
+#include "../inc/vertex.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VERTEX_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*VertexKernel)(const VertexTransform* t, const V3qSoA* in, size_t begin, size_t end, PostVertex* out);
+
+static VertexIsa    kernel_isa = VERTEX_ISA_SCALAR;
+static VertexKernel kernel;
+
+static const char* isa_names[VERTEX_ISA_COUNT] = {
+	[VERTEX_ISA_SCALAR] = "scalar",
+	[VERTEX_ISA_SSE2]   = "sse2",
+	[VERTEX_ISA_AVX2]   = "avx2",
+	[VERTEX_ISA_AVX512] = "avx512"
+};
+
+bool soa_3q_create(V3qSoA* s, const uint16_t (*v)[3], size_t count) {
+
+	*s = (V3qSoA) {0};
+
+	// 64 byte aligned, padded by a full batch
+	size_t bytes = ((count + VERTEX_BATCH_MAX) * sizeof(uint16_t) + 63) & ~(size_t) 63;
+	s->x = aligned_alloc(64, bytes);
+	s->y = aligned_alloc(64, bytes);
+	s->z = aligned_alloc(64, bytes);
+	if (!s->x || !s->y || !s->z) {
+		soa_3q_destroy(s);
+		return false;
+	}
+
+	memset(s->x, 0, bytes);
+	memset(s->y, 0, bytes);
+	memset(s->z, 0, bytes);
+	for (size_t i = 0; i < count; i++) {
+		s->x[i] = v[i][0];
+		s->y[i] = v[i][1];
+		s->z[i] = v[i][2];
+	}
+	s->count = count;
+
+	return true;
+}
+
+void soa_3q_destroy(V3qSoA* s) {
+
+	free(s->x);
+	free(s->y);
+	free(s->z);
+	*s = (V3qSoA) {0};
+}
+
+void vertex_transform_setup(VertexTransform* t, Camera camera, const DepthBuffer* depth,
+			    uint32_t width, uint32_t height, bool guard_band) {
+
+	M4f view = camera_view_get(camera);
+	M4f proj = camera_projection_get(camera, (float) width / (float) height, depth->scale, depth->bias);
+
+	M4f view_proj = mul_m4f(proj, view);
+
+	*t = (VertexTransform) {
+		.view_proj   = view_proj,
+		.stream_proj = view_proj,
+		.half_width  = 0.5f * (float) width,
+		.half_height = 0.5f * (float) height,
+		.planes      = {
+			.znear   = camera.znear,
+			.zfar    = camera.zfar,
+			.guard_x = guard_band ? (float) RASTER_GUARD_BAND / (0.5f * (float) width)  : 1.0f,
+			.guard_y = guard_band ? (float) RASTER_GUARD_BAND / (0.5f * (float) height) : 1.0f
+		},
+		// fragments past the far plane always fail the depth test against the cleared buffer
+		.clip_mask   = guard_band ? CLIP_NEAR | CLIP_GUARD : CLIP_FRUSTUM
+	};
+}
+
+void vertex_stream_setup(VertexTransform* t, V3f q_offset, V3f q_scale) {
+
+	M4f decode = {{
+		q_scale.x,  0.0f,       0.0f,       0.0f,
+		0.0f,       q_scale.y,  0.0f,       0.0f,
+		0.0f,       0.0f,       q_scale.z,  0.0f,
+		q_offset.x, q_offset.y, q_offset.z, 1.0f
+	}};
+	t->stream_proj = mul_m4f(t->view_proj, decode);
+}
+
+static inline PostVertex transform_point(const VertexTransform* t, const M4f* m, V3f v) {
+
+	PostVertex res = {0};
+
+	res.clip    = mul_m4f_v4f(*m, (V4f) {{ v.x, v.y, v.z, 1.0f }});
+	res.outcode = clip_outcode(res.clip, &t->planes);
+	if (!(res.outcode & CLIP_NEAR)) res.screen = clip_to_screen(t, res.clip);
+
+	return res;
+}
+
+PostVertex vertex_transform_one(const VertexTransform* t, V3f v) {
+
+	return transform_point(t, &t->view_proj, v);
+}
+
+static void transform_scalar(const VertexTransform* t, const V3qSoA* in, size_t begin, size_t end, PostVertex* out) {
+
+	for (size_t i = begin; i < end; i++) {
+		out[i] = transform_point(t, &t->stream_proj, (V3f) {{ in->x[i], in->y[i], in->z[i] }});
+	}
+}
+
+#ifdef VERTEX_X86
+
+// lanes of one batch, written out to the array of structs
+typedef struct {
+	_Alignas(64) float clip[4][VERTEX_BATCH_MAX];
+	_Alignas(64) float screen[3][VERTEX_BATCH_MAX];
+	_Alignas(64) uint32_t outcode[VERTEX_BATCH_MAX];
+} Lanes;
+
+static inline void lanes_store(const Lanes* l, size_t n, PostVertex* out) {
+
+	for (size_t k = 0; k < n; k++) {
+		out[k] = (PostVertex) {
+			.clip    = {{ l->clip[0][k],   l->clip[1][k],   l->clip[2][k], l->clip[3][k] }},
+			.screen  = {{ l->screen[0][k], l->screen[1][k], l->screen[2][k] }},
+			.outcode = l->outcode[k]
+		};
+	}
+}
+
+// The kernels below do the same math as transform_point in the same order,
+// one matrix row per output component, so every isa gives the same bits. The
+// integers convert to float exactly, the decoding is part of stream_proj.
+
+static void transform_sse2(const VertexTransform* t, const V3qSoA* in, size_t begin, size_t end, PostVertex* out) {
+
+	const float* m = t->stream_proj.arr;
+	const __m128 one   = _mm_set1_ps(1.0f);
+	const __m128 zero  = _mm_setzero_ps();
+	const __m128 znear = _mm_set1_ps(t->planes.znear);
+	const __m128 zfar  = _mm_set1_ps(t->planes.zfar);
+	const __m128 gx    = _mm_set1_ps(t->planes.guard_x);
+	const __m128 gy    = _mm_set1_ps(t->planes.guard_y);
+	const __m128 hw    = _mm_set1_ps(t->half_width);
+	const __m128 hh    = _mm_set1_ps(t->half_height);
+
+	Lanes l;
+	for (size_t i = begin; i < end; i += 4) {
+		__m128 x = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*) (in->x + i)), _mm_setzero_si128()));
+		__m128 y = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*) (in->y + i)), _mm_setzero_si128()));
+		__m128 z = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*) (in->z + i)), _mm_setzero_si128()));
+
+		__m128 c[4];
+		for (size_t r = 0; r < 4; r++) {
+			c[r] = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[r + 0*4]), x),
+								_mm_mul_ps(_mm_set1_ps(m[r + 1*4]), y)),
+								_mm_mul_ps(_mm_set1_ps(m[r + 2*4]), z)),
+								_mm_set1_ps(m[r + 3*4]));
+		}
+
+		// behind the near plane the screen values are never read, clamp to stay finite
+		__m128 pw = _mm_max_ps(c[3], znear);
+		__m128 sx = _mm_mul_ps(_mm_add_ps(_mm_div_ps(c[0], pw), one), hw);
+		__m128 sy = _mm_mul_ps(_mm_sub_ps(one, _mm_div_ps(c[1], pw)), hh);
+		__m128 sz = _mm_div_ps(c[2], pw);
+
+		// outcodes from the plane distances of clip_plane_dist
+		__m128 dist[CLIP_PLANES] = {
+			_mm_sub_ps(c[3], znear), _mm_sub_ps(zfar, c[3]),
+			_mm_add_ps(c[3], c[0]),  _mm_sub_ps(c[3], c[0]),
+			_mm_sub_ps(c[3], c[1]),  _mm_add_ps(c[3], c[1]),
+			_mm_add_ps(_mm_mul_ps(gx, c[3]), c[0]), _mm_sub_ps(_mm_mul_ps(gx, c[3]), c[0]),
+			_mm_sub_ps(_mm_mul_ps(gy, c[3]), c[1]), _mm_add_ps(_mm_mul_ps(gy, c[3]), c[1])
+		};
+		__m128i code = _mm_setzero_si128();
+		for (uint32_t p = 0; p < CLIP_PLANES; p++) {
+			code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(dist[p], zero)),
+								_mm_set1_epi32(1 << p)));
+		}
+
+		for (size_t r = 0; r < 4; r++) _mm_store_ps(l.clip[r], c[r]);
+		_mm_store_ps(l.screen[0], sx);
+		_mm_store_ps(l.screen[1], sy);
+		_mm_store_ps(l.screen[2], sz);
+		_mm_store_si128((__m128i*) l.outcode, code);
+		lanes_store(&l, end - i < 4 ? end - i : 4, out + i);
+	}
+}
+
+__attribute__((target("avx2")))
+static void transform_avx2(const VertexTransform* t, const V3qSoA* in, size_t begin, size_t end, PostVertex* out) {
+
+	const float* m = t->stream_proj.arr;
+	const __m256 one   = _mm256_set1_ps(1.0f);
+	const __m256 zero  = _mm256_setzero_ps();
+	const __m256 znear = _mm256_set1_ps(t->planes.znear);
+	const __m256 zfar  = _mm256_set1_ps(t->planes.zfar);
+	const __m256 gx    = _mm256_set1_ps(t->planes.guard_x);
+	const __m256 gy    = _mm256_set1_ps(t->planes.guard_y);
+	const __m256 hw    = _mm256_set1_ps(t->half_width);
+	const __m256 hh    = _mm256_set1_ps(t->half_height);
+
+	Lanes l;
+	for (size_t i = begin; i < end; i += 8) {
+		__m256 x = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) (in->x + i))));
+		__m256 y = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) (in->y + i))));
+		__m256 z = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) (in->z + i))));
+
+		__m256 c[4];
+		for (size_t r = 0; r < 4; r++) {
+			c[r] = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[r + 0*4]), x),
+									 _mm256_mul_ps(_mm256_set1_ps(m[r + 1*4]), y)),
+									 _mm256_mul_ps(_mm256_set1_ps(m[r + 2*4]), z)),
+									 _mm256_set1_ps(m[r + 3*4]));
+		}
+
+		__m256 pw = _mm256_max_ps(c[3], znear);
+		__m256 sx = _mm256_mul_ps(_mm256_add_ps(_mm256_div_ps(c[0], pw), one), hw);
+		__m256 sy = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_div_ps(c[1], pw)), hh);
+		__m256 sz = _mm256_div_ps(c[2], pw);
+
+		__m256 dist[CLIP_PLANES] = {
+			_mm256_sub_ps(c[3], znear), _mm256_sub_ps(zfar, c[3]),
+			_mm256_add_ps(c[3], c[0]),  _mm256_sub_ps(c[3], c[0]),
+			_mm256_sub_ps(c[3], c[1]),  _mm256_add_ps(c[3], c[1]),
+			_mm256_add_ps(_mm256_mul_ps(gx, c[3]), c[0]), _mm256_sub_ps(_mm256_mul_ps(gx, c[3]), c[0]),
+			_mm256_sub_ps(_mm256_mul_ps(gy, c[3]), c[1]), _mm256_add_ps(_mm256_mul_ps(gy, c[3]), c[1])
+		};
+		__m256i code = _mm256_setzero_si256();
+		for (uint32_t p = 0; p < CLIP_PLANES; p++) {
+			code = _mm256_or_si256(code, _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(dist[p], zero, _CMP_LT_OQ)),
+								      _mm256_set1_epi32(1 << p)));
+		}
+
+		for (size_t r = 0; r < 4; r++) _mm256_store_ps(l.clip[r], c[r]);
+		_mm256_store_ps(l.screen[0], sx);
+		_mm256_store_ps(l.screen[1], sy);
+		_mm256_store_ps(l.screen[2], sz);
+		_mm256_store_si256((__m256i*) l.outcode, code);
+		lanes_store(&l, end - i < 8 ? end - i : 8, out + i);
+	}
+}
+
+__attribute__((target("avx512f")))
+static void transform_avx512(const VertexTransform* t, const V3qSoA* in, size_t begin, size_t end, PostVertex* out) {
+
+	const float* m = t->stream_proj.arr;
+	const __m512 one   = _mm512_set1_ps(1.0f);
+	const __m512 zero  = _mm512_setzero_ps();
+	const __m512 znear = _mm512_set1_ps(t->planes.znear);
+	const __m512 zfar  = _mm512_set1_ps(t->planes.zfar);
+	const __m512 gx    = _mm512_set1_ps(t->planes.guard_x);
+	const __m512 gy    = _mm512_set1_ps(t->planes.guard_y);
+	const __m512 hw    = _mm512_set1_ps(t->half_width);
+	const __m512 hh    = _mm512_set1_ps(t->half_height);
+
+	Lanes l;
+	for (size_t i = begin; i < end; i += 16) {
+		__m512 x = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*) (in->x + i))));
+		__m512 y = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*) (in->y + i))));
+		__m512 z = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*) (in->z + i))));
+
+		__m512 c[4];
+		for (size_t r = 0; r < 4; r++) {
+			c[r] = _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(m[r + 0*4]), x),
+									 _mm512_mul_ps(_mm512_set1_ps(m[r + 1*4]), y)),
+									 _mm512_mul_ps(_mm512_set1_ps(m[r + 2*4]), z)),
+									 _mm512_set1_ps(m[r + 3*4]));
+		}
+
+		__mmask16 near = _mm512_cmp_ps_mask(c[3], znear, _CMP_LT_OQ);
+		__m512 pw = _mm512_mask_mov_ps(c[3], near, znear);
+		__m512 sx = _mm512_mul_ps(_mm512_add_ps(_mm512_div_ps(c[0], pw), one), hw);
+		__m512 sy = _mm512_mul_ps(_mm512_sub_ps(one, _mm512_div_ps(c[1], pw)), hh);
+		__m512 sz = _mm512_div_ps(c[2], pw);
+
+		__m512 dist[CLIP_PLANES] = {
+			_mm512_sub_ps(c[3], znear), _mm512_sub_ps(zfar, c[3]),
+			_mm512_add_ps(c[3], c[0]),  _mm512_sub_ps(c[3], c[0]),
+			_mm512_sub_ps(c[3], c[1]),  _mm512_add_ps(c[3], c[1]),
+			_mm512_add_ps(_mm512_mul_ps(gx, c[3]), c[0]), _mm512_sub_ps(_mm512_mul_ps(gx, c[3]), c[0]),
+			_mm512_sub_ps(_mm512_mul_ps(gy, c[3]), c[1]), _mm512_add_ps(_mm512_mul_ps(gy, c[3]), c[1])
+		};
+		__m512i code = _mm512_setzero_si512();
+		for (uint32_t p = 0; p < CLIP_PLANES; p++) {
+			code = _mm512_mask_or_epi32(code, _mm512_cmp_ps_mask(dist[p], zero, _CMP_LT_OQ), code,
+						    _mm512_set1_epi32(1 << p));
+		}
+
+		for (size_t r = 0; r < 4; r++) _mm512_store_ps(l.clip[r], c[r]);
+		_mm512_store_ps(l.screen[0], sx);
+		_mm512_store_ps(l.screen[1], sy);
+		_mm512_store_ps(l.screen[2], sz);
+		_mm512_store_si512(l.outcode, code);
+		lanes_store(&l, end - i < 16 ? end - i : 16, out + i);
+	}
+}
+
+#endif
+
+static bool isa_supported(VertexIsa isa) {
+
+#ifdef VERTEX_X86
+	__builtin_cpu_init();
+	switch (isa) {
+	case VERTEX_ISA_SCALAR: return true;
+	case VERTEX_ISA_SSE2:   return __builtin_cpu_supports("sse2");
+	case VERTEX_ISA_AVX2:   return __builtin_cpu_supports("avx2");
+	case VERTEX_ISA_AVX512: return __builtin_cpu_supports("avx512f");
+	default:                return false;
+	}
+#else
+	return isa == VERTEX_ISA_SCALAR;
+#endif
+}
+
+VertexIsa vertex_kernel_init(VertexIsa isa) {
+
+	if (isa >= VERTEX_ISA_COUNT || !isa_supported(isa)) {
+		isa = VERTEX_ISA_AVX512;
+		while (isa > VERTEX_ISA_SCALAR && !isa_supported(isa)) isa--;
+	}
+
+	switch (isa) {
+#ifdef VERTEX_X86
+	case VERTEX_ISA_SSE2:   kernel = transform_sse2;   break;
+	case VERTEX_ISA_AVX2:   kernel = transform_avx2;   break;
+	case VERTEX_ISA_AVX512: kernel = transform_avx512; break;
+#endif
+	default:                kernel = transform_scalar; break;
+	}
+	kernel_isa = isa;
+
+	return isa;
+}
+
+VertexIsa vertex_kernel_isa(void) {
+
+	return kernel_isa;
+}
+
+const char* vertex_isa_name(VertexIsa isa) {
+
+	return isa < VERTEX_ISA_COUNT ? isa_names[isa] : "unknown";
+}
+
+void vertex_transform(const VertexTransform* t, const V3qSoA* in, size_t begin, size_t end, PostVertex* out) {
+
+	if (!kernel) vertex_kernel_init(VERTEX_ISA_COUNT);
+	kernel(t, in, begin, end, out);
+}